@@ -0,0 +1,688 @@
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L // clock_gettime, getrusage and popen are only declared when posix interfaces are asked for.
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "confetti_allocator.h"
+#include "list.h"
+#include "linked_list.h"
+
+#if defined(_WIN32)
+    #include <windows.h>
+    #include <psapi.h>
+
+    #define popen _popen
+    #define pclose _pclose
+#else
+    #include <time.h>
+    #include <sys/resource.h>
+#endif
+
+#ifndef CONFETTI_BENCH_VERSION
+    #define CONFETTI_BENCH_VERSION "unknown"
+#endif
+
+#define BENCH_MAX_ELEMENT_SIZE 4096                  // The largest element size measured, values are built in a buffer of this size.
+#define BENCH_MAX_OPERATIONS ((int64_t) 100000)      // The most operations a single repetition of a case times.
+#define BENCH_TIME_LIMIT_NS ((uint64_t) 250000000)   // How long a single repetition may time operations before it stops early.
+#define BENCH_MIN_TIME_NS ((uint64_t) 50000000)      // How long a case is repeated for so small counts are measured reliably.
+#define BENCH_MAX_REPETITIONS 100000                 // The most times a case is repeated.
+#define BENCH_ELEMENT_OVERHEAD ((uint64_t) 32)       // Estimated bytes every element costs besides its value, used to skip cases that don't fit.
+#define BENCH_DEFAULT_MAX_BYTES ((uint64_t) 1 << 30) // The default memory budget of a single case.
+#define BENCH_MAX_COMMAND 4096                       // The longest command line a case is run in its own process with.
+
+typedef enum bench_format {
+    BENCH_FORMAT_TABLE,
+    BENCH_FORMAT_CSV,
+    BENCH_FORMAT_JSON
+} bench_format_t;
+
+// the timed part of a case, accumulated over its repetitions.
+typedef struct bench_measure {
+    uint64_t ns;
+    int64_t operations;
+    uint64_t allocations;
+    uint64_t startNs;
+    uint64_t startAllocations;
+} bench_measure_t;
+
+// the operations of a container the cases are written against.
+typedef struct bench_container {
+    const char* name;
+    void* (*create)(const uint64_t elementSize);
+    void (*destroy)(void* container);
+    void (*append)(void* container, void* value, const uint64_t size);
+    void (*prepend)(void* container, void* value, const uint64_t size);
+    void (*insert)(void* container, const int64_t index, void* value, const uint64_t size);
+    void (*remove)(void* container, const int64_t index);
+    void (*peek)(void* container, const int64_t index);
+    void (*find)(void* container, void* value, const uint64_t size);
+    void (*sort)(void* container);
+    void* (*clone)(void* container);
+    void* (*join)(void* container1, void* container2);
+} bench_container_t;
+
+// a measured operation, `footprint` is how many copies of the container it keeps alive at once.
+typedef struct bench_case {
+    const char* name;
+    uint64_t footprint;
+    void (*run)(const bench_container_t* container, const uint64_t elementSize, const int64_t count, bench_measure_t* measure);
+} bench_case_t;
+
+static uint64_t allocationCount = 0;
+static uint64_t randomState = 0x9E3779B97F4A7C15ULL;
+static uint8_t valueBuffer[BENCH_MAX_ELEMENT_SIZE];
+
+static void* bench_allocate(void* const context, const uint64_t size) {
+    (void) context;
+
+    allocationCount++;
+    return malloc((size_t) size);
+}
+
+static void* bench_reallocate(void* const context, void* const block, const uint64_t oldSize, const uint64_t newSize) {
+    (void) context;
+    (void) oldSize;
+
+    allocationCount++;
+    return realloc(block, (size_t) newSize);
+}
+
+static void bench_deallocate(void* const context, void* const block, const uint64_t size) {
+    (void) context;
+    (void) size;
+
+    free(block);
+}
+
+// every container requests its memory through this allocator so its allocations can be counted.
+// copies handed to the caller, such as those of `list_get`, come from the default allocator instead, 
+// so the cases only use accessors which borrow values.
+static const confetti_allocator_t countingAllocator = { &bench_allocate, &bench_reallocate, &bench_deallocate, NULL };
+
+static uint64_t bench_now(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER frequency, counter;
+
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+
+    return (uint64_t) ((double) counter.QuadPart * 1e9 / (double) frequency.QuadPart);
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+#endif
+}
+
+// the peak resident set size of the process in kilobytes, every case runs in its own process so this is the peak of that case.
+static uint64_t bench_peak_rss(void) {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+
+    return (uint64_t) counters.PeakWorkingSetSize / 1024;
+#else
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+    #if defined(__APPLE__)
+        return (uint64_t) usage.ru_maxrss / 1024;
+    #else
+        return (uint64_t) usage.ru_maxrss;
+    #endif
+#endif
+}
+
+static uint64_t bench_random(void) {
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 7;
+    randomState ^= randomState << 17;
+
+    return randomState;
+}
+
+// the key of the element at an index of a filled container, scattered so sorting has work to do.
+static uint64_t bench_key(const int64_t index) {
+    uint64_t key = (uint64_t) index * 0x9E3779B97F4A7C15ULL;
+
+    key ^= key >> 31;
+    return key;
+}
+
+// builds a value whose first 8 bytes hold its key, the remaining bytes are left as they are.
+static void* bench_value(const uint64_t key) {
+    memcpy(valueBuffer, &key, sizeof(key));
+    return valueBuffer;
+}
+
+static int32_t bench_compare(const void* const data1, const void* const data2, const uint64_t size) {
+    (void) size;
+
+    uint64_t key1, key2;
+
+    memcpy(&key1, data1, sizeof(key1));
+    memcpy(&key2, data2, sizeof(key2));
+
+    return key1 < key2 ? -1 : key1 > key2;
+}
+
+static void bench_start(bench_measure_t* const measure) {
+    measure->startAllocations = allocationCount;
+    measure->startNs = bench_now();
+}
+
+static void bench_stop(bench_measure_t* const measure, const int64_t operations) {
+    measure->ns += bench_now() - measure->startNs;
+    measure->allocations += allocationCount - measure->startAllocations;
+    measure->operations += operations;
+}
+
+// checked every 64 operations, lets slow operations on large containers stop before they take too long.
+static bool bench_expired(const bench_measure_t* const measure, const int64_t operation) {
+    return (operation & 63) == 63 && bench_now() - measure->startNs > BENCH_TIME_LIMIT_NS;
+}
+
+static int64_t bench_operations(const int64_t count) {
+    return count < BENCH_MAX_OPERATIONS ? count : BENCH_MAX_OPERATIONS;
+}
+
+static void* bench_filled(const bench_container_t* const container, const uint64_t elementSize, const int64_t count) {
+    void* const filled = container->create(elementSize);
+
+    for (int64_t i = 0; i < count; i++)
+        container->append(filled, bench_value(bench_key(i)), elementSize);
+
+    return filled;
+}
+
+// list_t
+
+static void* list_fixed_bench_create(const uint64_t elementSize) {
+    list_t* list = NULL;
+    list_options_t options = { 0 };
+
+    options.elementSize = elementSize;
+    options.equalityFunction = &bench_compare;
+    options.allocator = &countingAllocator;
+
+    if (list_create_with_options(&list, &options) != LIST_SUCCESS) {
+        fprintf(stderr, "failed to create a list\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return list;
+}
+
+static void* list_bench_create(const uint64_t elementSize) {
+    (void) elementSize;
+
+    return list_fixed_bench_create(0);
+}
+
+static void list_bench_destroy(void* container) {
+    list_t* list = (list_t*) container;
+    list_free(&list);
+}
+
+static void list_bench_append(void* container, void* value, const uint64_t size) {
+    list_append((list_t*) container, value, size);
+}
+
+static void list_bench_prepend(void* container, void* value, const uint64_t size) {
+    list_prepend((list_t*) container, value, size);
+}
+
+static void list_bench_insert(void* container, const int64_t index, void* value, const uint64_t size) {
+    list_insert((list_t*) container, index, value, size);
+}
+
+static void list_bench_remove(void* container, const int64_t index) {
+    list_remove((list_t*) container, index);
+}
+
+static void list_bench_peek(void* container, const int64_t index) {
+    const void* value = NULL;
+    list_peek((list_t*) container, &value, NULL, index);
+}
+
+static void list_bench_find(void* container, void* value, const uint64_t size) {
+    int64_t index;
+    list_find_first((list_t*) container, &index, 0, value, size);
+}
+
+static void list_bench_sort(void* container) {
+    list_sort((list_t*) container, true);
+}
+
+static void* list_bench_clone(void* container) {
+    list_t* clone = NULL;
+    list_clone((list_t*) container, &clone);
+
+    return clone;
+}
+
+static void* list_bench_join(void* container1, void* container2) {
+    list_t* joined = NULL;
+    list_join((list_t*) container1, (list_t*) container2, &joined);
+
+    return joined;
+}
+
+// linked_list_t
+
+static void* linked_list_bench_create(const uint64_t elementSize) {
+    (void) elementSize;
+
+    linked_list_t* linkedList = NULL;
+    linked_list_options_t options = { 0 };
+
+    options.equalityFunction = &bench_compare;
+    options.allocator = &countingAllocator;
+
+    if (linked_list_create_with_options(&linkedList, &options) != LINKED_LIST_SUCCESS) {
+        fprintf(stderr, "failed to create a linked list\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return linkedList;
+}
+
+static void linked_list_bench_destroy(void* container) {
+    linked_list_t* linkedList = (linked_list_t*) container;
+    linked_list_free(&linkedList);
+}
+
+static void linked_list_bench_append(void* container, void* value, const uint64_t size) {
+    linked_list_append((linked_list_t*) container, value, size);
+}
+
+static void linked_list_bench_prepend(void* container, void* value, const uint64_t size) {
+    linked_list_prepend((linked_list_t*) container, value, size);
+}
+
+static void linked_list_bench_insert(void* container, const int64_t index, void* value, const uint64_t size) {
+    linked_list_insert((linked_list_t*) container, index, value, size);
+}
+
+static void linked_list_bench_remove(void* container, const int64_t index) {
+    linked_list_remove((linked_list_t*) container, (uint64_t) index);
+}
+
+static void linked_list_bench_peek(void* container, const int64_t index) {
+    const void* value = NULL;
+    linked_list_peek((linked_list_t*) container, &value, NULL, index);
+}
+
+static void linked_list_bench_find(void* container, void* value, const uint64_t size) {
+    int64_t index;
+    linked_list_find_first((linked_list_t*) container, &index, 0, value, size);
+}
+
+static void linked_list_bench_sort(void* container) {
+    linked_list_sort((linked_list_t*) container, true);
+}
+
+static void* linked_list_bench_clone(void* container) {
+    linked_list_t* clone = NULL;
+    linked_list_clone((linked_list_t*) container, &clone);
+
+    return clone;
+}
+
+static void* linked_list_bench_join(void* container1, void* container2) {
+    linked_list_t* joined = NULL;
+    linked_list_join((linked_list_t*) container1, (linked_list_t*) container2, &joined);
+
+    return joined;
+}
+
+static const bench_container_t containers[] = {
+    {
+        "list", &list_bench_create, &list_bench_destroy, &list_bench_append, &list_bench_prepend, &list_bench_insert,
+        &list_bench_remove, &list_bench_peek, &list_bench_find, &list_bench_sort, &list_bench_clone, &list_bench_join
+    },
+    {
+        "list_fixed", &list_fixed_bench_create, &list_bench_destroy, &list_bench_append, &list_bench_prepend, &list_bench_insert,
+        &list_bench_remove, &list_bench_peek, &list_bench_find, &list_bench_sort, &list_bench_clone, &list_bench_join
+    },
+    {
+        "linked_list", &linked_list_bench_create, &linked_list_bench_destroy, &linked_list_bench_append, &linked_list_bench_prepend,
+        &linked_list_bench_insert, &linked_list_bench_remove, &linked_list_bench_peek, &linked_list_bench_find, &linked_list_bench_sort,
+        &linked_list_bench_clone, &linked_list_bench_join
+    }
+};
+
+// cases
+
+// appends `count` values to an empty container.
+static void bench_append(const bench_container_t* container, const uint64_t elementSize, const int64_t count, bench_measure_t* measure) {
+    void* const target = container->create(elementSize);
+
+    bench_start(measure);
+
+    for (int64_t i = 0; i < count; i++)
+        container->append(target, bench_value(bench_key(i)), elementSize);
+
+    bench_stop(measure, count);
+    container->destroy(target);
+}
+
+// prepends values to a container already holding `count` values.
+static void bench_prepend(const bench_container_t* container, const uint64_t elementSize, const int64_t count, bench_measure_t* measure) {
+    void* const target = bench_filled(container, elementSize, count);
+    const int64_t operations = bench_operations(count);
+    int64_t i = 0;
+
+    bench_start(measure);
+
+    for (; i < operations && !bench_expired(measure, i); i++)
+        container->prepend(target, bench_value(bench_random()), elementSize);
+
+    bench_stop(measure, i);
+    container->destroy(target);
+}
+
+// inserts values in the middle of a container already holding `count` values.
+static void bench_insert(const bench_container_t* container, const uint64_t elementSize, const int64_t count, bench_measure_t* measure) {
+    void* const target = bench_filled(container, elementSize, count);
+    const int64_t operations = bench_operations(count);
+    int64_t i = 0;
+
+    bench_start(measure);
+
+    for (; i < operations && !bench_expired(measure, i); i++)
+        container->insert(target, (count + i) / 2, bench_value(bench_random()), elementSize);
+
+    bench_stop(measure, i);
+    container->destroy(target);
+}
+
+// removes values from the middle of a container holding `count` values.
+static void bench_remove(const bench_container_t* container, const uint64_t elementSize, const int64_t count, bench_measure_t* measure) {
+    void* const target = bench_filled(container, elementSize, count);
+    const int64_t operations = bench_operations(count);
+    int64_t i = 0;
+
+    bench_start(measure);
+
+    for (; i < operations && !bench_expired(measure, i); i++)
+        container->remove(target, (count - i) / 2);
+
+    bench_stop(measure, i);
+    container->destroy(target);
+}
+
+// peeks at the values at random indices of a container holding `count` values.
+static void bench_peek(const bench_container_t* container, const uint64_t elementSize, const int64_t count, bench_measure_t* measure) {
+    void* const target = bench_filled(container, elementSize, count);
+    const int64_t operations = bench_operations(count);
+    int64_t i = 0;
+
+    bench_start(measure);
+
+    for (; i < operations && !bench_expired(measure, i); i++)
+        container->peek(target, (int64_t) (bench_random() % (uint64_t) count));
+
+    bench_stop(measure, i);
+    container->destroy(target);
+}
+
+// finds values at random positions of an unsorted container holding `count` values.
+static void bench_find(const bench_container_t* container, const uint64_t elementSize, const int64_t count, bench_measure_t* measure) {
+    void* const target = bench_filled(container, elementSize, count);
+    const int64_t operations = bench_operations(count);
+    int64_t i = 0;
+
+    bench_start(measure);
+
+    for (; i < operations && !bench_expired(measure, i); i++)
+        container->find(target, bench_value(bench_key((int64_t) (bench_random() % (uint64_t) count))), elementSize);
+
+    bench_stop(measure, i);
+    container->destroy(target);
+}
+
+// sorts a container holding `count` values in scattered order, reported per value.
+static void bench_sort(const bench_container_t* container, const uint64_t elementSize, const int64_t count, bench_measure_t* measure) {
+    void* const target = bench_filled(container, elementSize, count);
+
+    bench_start(measure);
+    container->sort(target);
+    bench_stop(measure, count);
+
+    container->destroy(target);
+}
+
+// clones a container holding `count` values, reported per value.
+static void bench_clone(const bench_container_t* container, const uint64_t elementSize, const int64_t count, bench_measure_t* measure) {
+    void* const target = bench_filled(container, elementSize, count);
+
+    bench_start(measure);
+    void* const clone = container->clone(target);
+    bench_stop(measure, count);
+
+    if (clone != NULL)
+        container->destroy(clone);
+
+    container->destroy(target);
+}
+
+// joins a container holding `count` values with itself, reported per value of the result.
+static void bench_join(const bench_container_t* container, const uint64_t elementSize, const int64_t count, bench_measure_t* measure) {
+    void* const target = bench_filled(container, elementSize, count);
+
+    bench_start(measure);
+    void* const joined = container->join(target, target);
+    bench_stop(measure, count * 2);
+
+    if (joined != NULL)
+        container->destroy(joined);
+
+    container->destroy(target);
+}
+
+static const bench_case_t cases[] = {
+    { "append", 1, &bench_append },
+    { "prepend", 1, &bench_prepend },
+    { "insert", 1, &bench_insert },
+    { "remove", 1, &bench_remove },
+    { "peek", 1, &bench_peek },
+    { "find", 1, &bench_find },
+    { "sort", 1, &bench_sort },
+    { "clone", 2, &bench_clone },
+    { "join", 3, &bench_join }
+};
+
+static const uint64_t elementSizes[] = { 8, 64, 512, 4096 };
+static const int64_t counts[] = { 10, 1000, 100000, 10000000 };
+
+static void bench_repeat(const bench_container_t* const container, const bench_case_t* const benchCase, const uint64_t elementSize, const int64_t count, bench_measure_t* const measure) {
+    const uint64_t start = bench_now();
+
+    // small cases are repeated until enough time was spent for the timer to be trusted.
+    for (int repetition = 0; repetition < BENCH_MAX_REPETITIONS && bench_now() - start < BENCH_MIN_TIME_NS; repetition++)
+        benchCase->run(container, elementSize, count, measure);
+}
+
+// runs the case `--run-case=CONTAINER,CASE,SIZE,COUNT` names and prints its measurements for the parent process to read.
+static int bench_run_case(const char* const description) {
+    size_t c, o;
+    unsigned long long elementSize;
+    long long count;
+
+    if (sscanf(description, "%zu,%zu,%llu,%lld", &c, &o, &elementSize, &count) != 4)
+        return EXIT_FAILURE;
+    else if (c >= sizeof(containers) / sizeof(containers[0]) || o >= sizeof(cases) / sizeof(cases[0]) || elementSize > BENCH_MAX_ELEMENT_SIZE || count < 1)
+        return EXIT_FAILURE;
+
+    bench_measure_t measure = { 0 };
+
+    bench_repeat(&containers[c], &cases[o], (uint64_t) elementSize, (int64_t) count, &measure);
+
+    printf(
+        "%llu %lld %llu %llu\n", 
+        (unsigned long long) measure.ns, (long long) measure.operations, 
+        (unsigned long long) measure.allocations, (unsigned long long) bench_peak_rss()
+    );
+
+    return EXIT_SUCCESS;
+}
+
+// runs a case in a new process of the benchmark, so its peak resident set size isn't raised by the cases before it.
+static bool bench_spawn(const char* const program, const size_t c, const size_t o, const uint64_t elementSize, const int64_t count, bench_measure_t* const measure, uint64_t* const peakRss) {
+    char command[BENCH_MAX_COMMAND];
+    const int length = snprintf(
+        command, sizeof(command), "\"%s\" --run-case=%zu,%zu,%llu,%lld", 
+        program, c, o, (unsigned long long) elementSize, (long long) count
+    );
+
+    if (length < 0 || (size_t) length >= sizeof(command))
+        return false;
+
+    FILE* const child = popen(command, "r");
+
+    if (child == NULL)
+        return false;
+
+    unsigned long long ns, allocations, rss;
+    long long operations;
+    const bool parsed = fscanf(child, "%llu %lld %llu %llu", &ns, &operations, &allocations, &rss) == 4;
+
+    if (pclose(child) != 0 || !parsed)
+        return false;
+
+    measure->ns = (uint64_t) ns;
+    measure->operations = (int64_t) operations;
+    measure->allocations = (uint64_t) allocations;
+    *peakRss = (uint64_t) rss;
+
+    return true;
+}
+
+static void bench_print_usage(void) {
+    printf(
+        "usage: confetti_bench [options]\n"
+        "  --format=table|csv|json  output format, table by default\n"
+        "  --filter=TEXT            only run cases whose container/operation name contains TEXT\n"
+        "  --max-count=N            skip counts above N\n"
+        "  --max-bytes=N            skip cases estimated to need more than N bytes, 1 GiB by default\n"
+    );
+}
+
+int main(int argc, char** argv) {
+    bench_format_t format = BENCH_FORMAT_TABLE;
+    const char* filter = NULL;
+    int64_t maxCount = INT64_MAX;
+    uint64_t maxBytes = BENCH_DEFAULT_MAX_BYTES;
+
+    for (int i = 1; i < argc; i++) {
+        if (strncmp(argv[i], "--run-case=", 11) == 0)
+            return bench_run_case(argv[i] + 11);
+        else if (strcmp(argv[i], "--format=table") == 0)
+            format = BENCH_FORMAT_TABLE;
+        else if (strcmp(argv[i], "--format=csv") == 0)
+            format = BENCH_FORMAT_CSV;
+        else if (strcmp(argv[i], "--format=json") == 0)
+            format = BENCH_FORMAT_JSON;
+        else if (strncmp(argv[i], "--filter=", 9) == 0)
+            filter = argv[i] + 9;
+        else if (strncmp(argv[i], "--max-count=", 12) == 0)
+            maxCount = strtoll(argv[i] + 12, NULL, 10);
+        else if (strncmp(argv[i], "--max-bytes=", 12) == 0)
+            maxBytes = strtoull(argv[i] + 12, NULL, 10);
+        else {
+            bench_print_usage();
+            return strcmp(argv[i], "--help") == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if (format == BENCH_FORMAT_TABLE)
+        printf("%-12s %-8s %6s %9s %10s %12s %10s %17s\n", "container", "op", "size", "count", "ops", "ns/op", "allocs/op", "case peak rss kb");
+    else if (format == BENCH_FORMAT_CSV)
+        printf("container,operation,element_size,count,operations,ns_per_op,allocs_per_op,case_peak_rss_kb\n");
+    else
+        printf("{\"benchmark\":\"confetti_bench\",\"version\":\"%s\",\"results\":[", CONFETTI_BENCH_VERSION);
+
+    bool first = true;
+
+    for (size_t c = 0; c < sizeof(containers) / sizeof(containers[0]); c++) {
+        const bench_container_t* const container = &containers[c];
+
+        for (size_t o = 0; o < sizeof(cases) / sizeof(cases[0]); o++) {
+            const bench_case_t* const benchCase = &cases[o];
+            char name[64];
+
+            snprintf(name, sizeof(name), "%s/%s", container->name, benchCase->name);
+
+            if (filter != NULL && strstr(name, filter) == NULL)
+                continue;
+
+            for (size_t s = 0; s < sizeof(elementSizes) / sizeof(elementSizes[0]); s++) {
+                for (size_t n = 0; n < sizeof(counts) / sizeof(counts[0]); n++) {
+                    const uint64_t elementSize = elementSizes[s];
+                    const int64_t count = counts[n];
+                    const uint64_t footprint = (uint64_t) count * (elementSize + BENCH_ELEMENT_OVERHEAD) * benchCase->footprint;
+
+                    if (count > maxCount || footprint > maxBytes)
+                        continue;
+
+                    bench_measure_t measure = { 0 };
+                    uint64_t peakRss = 0;
+
+                    fflush(stdout);
+
+                    if (!bench_spawn(argv[0], c, o, elementSize, count, &measure, &peakRss)) {
+                        fprintf(stderr, "failed to run %s with %llu byte elements and a count of %lld\n", name, (unsigned long long) elementSize, (long long) count);
+                        continue;
+                    }
+
+                    const double operations = measure.operations > 0 ? (double) measure.operations : 1.0;
+                    const double nsPerOperation = (double) measure.ns / operations;
+                    const double allocationsPerOperation = (double) measure.allocations / operations;
+
+                    if (format == BENCH_FORMAT_TABLE) {
+                        printf(
+                            "%-12s %-8s %6llu %9lld %10lld %12.2f %10.3f %17llu\n",
+                            container->name, benchCase->name, (unsigned long long) elementSize, (long long) count,
+                            (long long) measure.operations, nsPerOperation, allocationsPerOperation, (unsigned long long) peakRss
+                        );
+                    }
+                    else if (format == BENCH_FORMAT_CSV) {
+                        printf(
+                            "%s,%s,%llu,%lld,%lld,%.2f,%.3f,%llu\n",
+                            container->name, benchCase->name, (unsigned long long) elementSize, (long long) count,
+                            (long long) measure.operations, nsPerOperation, allocationsPerOperation, (unsigned long long) peakRss
+                        );
+                    }
+                    else {
+                        printf(
+                            "%s{\"container\":\"%s\",\"operation\":\"%s\",\"element_size\":%llu,\"count\":%lld,\"operations\":%lld,"
+                            "\"ns_per_op\":%.2f,\"allocs_per_op\":%.3f,\"case_peak_rss_kb\":%llu}",
+                            first ? "" : ",", container->name, benchCase->name, (unsigned long long) elementSize, (long long) count,
+                            (long long) measure.operations, nsPerOperation, allocationsPerOperation, (unsigned long long) peakRss
+                        );
+                    }
+
+                    first = false;
+                    fflush(stdout);
+                }
+            }
+        }
+    }
+
+    if (format == BENCH_FORMAT_JSON)
+        printf("]}\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,132 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "list.h"
+#include "ring_queue.h"
+#include "concurrent_queue.h"
+#include "concurrent_list.h"
+
+#define OPERATIONS_PER_THREAD 200000
+#define MAX_THREADS 64
+
+typedef void* (benchmark_worker_t)(void* context);
+
+static pthread_mutex_t listMutex = PTHREAD_MUTEX_INITIALIZER;
+static list_t* mutexList = NULL;
+static concurrent_list_t* concurrentList = NULL;
+static ring_queue_t* ringQueue = NULL;
+static concurrent_queue_t* concurrentQueue = NULL;
+
+// every thread appends to one list guarded by a single mutex, the baseline.
+void* mutexListWorker(void* context) {
+    (void) context;
+
+    for (int64_t i = 0; i < OPERATIONS_PER_THREAD; i++) {
+        pthread_mutex_lock(&listMutex);
+        list_append(mutexList, &i, sizeof(int64_t));
+        pthread_mutex_unlock(&listMutex);
+    }
+
+    return NULL;
+}
+
+// every thread collects its values in a batch which takes the write lock once per 256 values.
+void* concurrentListWorker(void* context) {
+    (void) context;
+
+    concurrent_list_batch_t* batch = NULL;
+    concurrent_list_batch_create(&batch, concurrentList, 256, sizeof(int64_t));
+
+    for (int64_t i = 0; i < OPERATIONS_PER_THREAD; i++)
+        concurrent_list_batch_append(batch, &i);
+
+    concurrent_list_batch_free(&batch);
+
+    return NULL;
+}
+
+// every thread hands values through the ring queue, pushing one and popping one at a time.
+void* ringQueueWorker(void* context) {
+    (void) context;
+
+    for (int64_t i = 0; i < OPERATIONS_PER_THREAD; i++) {
+        int64_t value = i;
+
+        while (ring_queue_push(ringQueue, &value) != RING_QUEUE_SUCCESS);
+        while (ring_queue_pop(ringQueue, &value) != RING_QUEUE_SUCCESS);
+    }
+
+    return NULL;
+}
+
+// every thread hands values through the concurrent queue, pushing one and popping one at a time.
+void* concurrentQueueWorker(void* context) {
+    (void) context;
+
+    for (int64_t i = 0; i < OPERATIONS_PER_THREAD; i++) {
+        concurrent_queue_element_t* element = NULL;
+
+        concurrent_queue_push(concurrentQueue, &i, sizeof(int64_t));
+
+        while (concurrent_queue_pop(concurrentQueue, &element) != CONCURRENT_QUEUE_SUCCESS);
+
+        concurrent_queue_element_free(&element);
+    }
+
+    return NULL;
+}
+
+double runBenchmark(benchmark_worker_t* worker, int threadCount) {
+    pthread_t threads[MAX_THREADS];
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (int i = 0; i < threadCount; i++)
+        pthread_create(&threads[i], NULL, worker, NULL);
+
+    for (int i = 0; i < threadCount; i++)
+        pthread_join(threads[i], NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    const double seconds = (double) (end.tv_sec - start.tv_sec) + (double) (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    // millions of operations per second across every thread.
+    return (double) threadCount * OPERATIONS_PER_THREAD / seconds / 1e6;
+}
+
+int main(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxThreads = cores < 1 ? 1 : cores > MAX_THREADS ? MAX_THREADS : (int) cores;
+
+    printf("threads, mutex list append, batched concurrent list append, ring queue, concurrent queue (Mops/s)\n");
+
+    for (int threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+        list_create_fixed(&mutexList, 0, sizeof(int64_t), NULL, NULL);
+        double lockedList = runBenchmark(&mutexListWorker, threadCount);
+        list_free(&mutexList);
+
+        list_options_t options = { 0, sizeof(int64_t), NULL, NULL, NULL, LIST_FLAG_NONE, NULL };
+        concurrent_list_create_with_options(&concurrentList, &options);
+        double batchedList = runBenchmark(&concurrentListWorker, threadCount);
+        concurrent_list_free(&concurrentList);
+
+        ring_queue_create(&ringQueue, 1024, sizeof(int64_t));
+        double ring = runBenchmark(&ringQueueWorker, threadCount);
+        ring_queue_free(&ringQueue);
+
+        concurrent_queue_create(&concurrentQueue);
+        double queue = runBenchmark(&concurrentQueueWorker, threadCount);
+        concurrent_queue_free(&concurrentQueue);
+
+        printf("%d, %.2f, %.2f, %.2f, %.2f\n", threadCount, lockedList, batchedList, ring, queue);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,54 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "list.h"
+
+int main(void) {
+    list_t* destination = NULL;
+    list_t* source = NULL;
+
+    list_create(&destination, 0, NULL, NULL);
+    list_create(&source, 64, NULL, NULL);
+
+    for (int i = 0; i < 20; i++)
+        list_append(destination, &i, sizeof(int));
+
+    for (int i = 20; i < 40; i++)
+        list_append(source, &i, sizeof(int));
+
+    list_result_t result = list_concat_into(destination, source);
+    printf("concat result: %d\n", result);
+
+    // the source gave its elements away, shrinking it must leave the destination's elements alone.
+    list_resize(source, 1);
+    list_shrink_to_fit(source);
+
+    const void* value = NULL;
+
+    for (int64_t i = 0; i < destination->size; i++) {
+        list_peek(destination, &value, NULL, i);
+        printf("value: %d\n", *(const int*) value);
+    }
+
+    // a source with a shrink divisor shrinks itself as soon as the concat empties it.
+    list_options_t options = { 0 };
+    options.capacity = 64;
+    options.growth.shrinkDivisor = 4;
+
+    list_t* shrinkingSource = NULL;
+    list_create_with_options(&shrinkingSource, &options);
+
+    for (int i = 40; i < 60; i++)
+        list_append(shrinkingSource, &i, sizeof(int));
+
+    result = list_concat_into(destination, shrinkingSource);
+    printf("concat result: %d\n", result);
+
+    list_peek(destination, &value, NULL, destination->size - 1);
+    printf("last value: %d\n", *(const int*) value);
+
+    list_free(&shrinkingSource);
+    list_free(&source);
+    list_free(&destination);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,491 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L // pthread_rwlock_t is only declared when posix interfaces are asked for.
+#endif
+
+#include "concurrent_list.h"
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <pthread.h>
+#endif
+
+// private struct definitions
+
+#if defined(_WIN32)
+    typedef SRWLOCK concurrent_list_lock_t;
+#else
+    typedef pthread_rwlock_t concurrent_list_lock_t;
+#endif
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Initializes a reader-writer lock.
+ *
+ * @param lock Pointer to the lock.
+ *
+ * @return `true` if the lock was initialized, otherwise `false`.
+ */
+static bool concurrent_list_lock_init(concurrent_list_lock_t* const lock);
+
+/**
+ * @brief Destroys a reader-writer lock.
+ *
+ * @param lock Pointer to the lock.
+ */
+static void concurrent_list_lock_destroy(concurrent_list_lock_t* const lock);
+
+/**
+ * @brief Acquires the lock of a concurrent list.
+ *
+ * @param concurrentList Pointer to the concurrent list.
+ * @param exclusive If `true` the lock is held for writing, otherwise for reading.
+ */
+static void concurrent_list_lock(concurrent_list_t* const concurrentList, const bool exclusive);
+
+/**
+ * @brief Releases the lock of a concurrent list.
+ *
+ * @param concurrentList Pointer to the concurrent list.
+ * @param exclusive Whether the lock was held for writing.
+ */
+static void concurrent_list_unlock(concurrent_list_t* const concurrentList, const bool exclusive);
+
+/**
+ * @brief Acquires the lock of a concurrent list for searching its list.
+ *
+ * A stale hash index is rebuilt by the next search, which modifies the list, so 
+ * lists with a hash index attached are searched while holding the lock exclusively.
+ *
+ * @param concurrentList Pointer to the concurrent list.
+ *
+ * @return `true` if the lock is held for writing, otherwise `false`.
+ */
+static bool concurrent_list_lock_for_search(concurrent_list_t* const concurrentList);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static bool concurrent_list_lock_init(concurrent_list_lock_t* const lock) {
+#if defined(_WIN32)
+    InitializeSRWLock(lock);
+    return true;
+#else
+    return pthread_rwlock_init(lock, NULL) == 0;
+#endif
+}
+
+
+static void concurrent_list_lock_destroy(concurrent_list_lock_t* const lock) {
+#if defined(_WIN32)
+    (void) lock;
+#else
+    pthread_rwlock_destroy(lock);
+#endif
+}
+
+
+static void concurrent_list_lock(concurrent_list_t* const concurrentList, const bool exclusive) {
+    concurrent_list_lock_t* const lock = (concurrent_list_lock_t*) concurrentList->lock;
+
+#if defined(_WIN32)
+    if (exclusive)
+        AcquireSRWLockExclusive(lock);
+    else 
+        AcquireSRWLockShared(lock);
+#else
+    if (exclusive)
+        pthread_rwlock_wrlock(lock);
+    else 
+        pthread_rwlock_rdlock(lock);
+#endif
+}
+
+
+static void concurrent_list_unlock(concurrent_list_t* const concurrentList, const bool exclusive) {
+    concurrent_list_lock_t* const lock = (concurrent_list_lock_t*) concurrentList->lock;
+
+#if defined(_WIN32)
+    if (exclusive)
+        ReleaseSRWLockExclusive(lock);
+    else 
+        ReleaseSRWLockShared(lock);
+#else
+    (void) exclusive;
+    pthread_rwlock_unlock(lock);
+#endif
+}
+
+
+static bool concurrent_list_lock_for_search(concurrent_list_t* const concurrentList) {
+    concurrent_list_lock(concurrentList, false);
+
+    if (concurrentList->list->index == NULL)
+        return false;
+
+    concurrent_list_unlock(concurrentList, false);
+    concurrent_list_lock(concurrentList, true);
+
+    return true;
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+list_result_t concurrent_list_create(
+    concurrent_list_t** concurrentListOut, 
+    const int64_t capacity, 
+    list_custom_equality_function_t* const customEqualityFunction, 
+    list_custom_sorting_function_t* const customSortingFunction
+) {
+    list_options_t options = { capacity, 0, customEqualityFunction, customSortingFunction, NULL, LIST_FLAG_NONE, NULL, NULL, { 0, 0, 0 } };
+
+    return concurrent_list_create_with_options(concurrentListOut, &options);
+}
+
+
+list_result_t concurrent_list_create_with_options(concurrent_list_t** concurrentListOut, const list_options_t* const options) {
+    list_t* list = NULL;
+    list_result_t listCreateResult = list_create_with_options(&list, options);
+
+    if (listCreateResult != LIST_SUCCESS)
+        return listCreateResult;
+
+    const confetti_allocator_t* const allocator = &list->allocator;
+    concurrent_list_t* const concurrentList = (concurrent_list_t*) allocator->allocate(allocator->context, sizeof(concurrent_list_t));
+
+    if (concurrentList == NULL) {
+        list_free(&list);
+        return LIST_ALLOCATION_FAILURE;
+    }
+
+    concurrentList->lock = allocator->allocate(allocator->context, sizeof(concurrent_list_lock_t));
+
+    if (concurrentList->lock == NULL || !concurrent_list_lock_init((concurrent_list_lock_t*) concurrentList->lock)) {
+        if (concurrentList->lock != NULL)
+            allocator->deallocate(allocator->context, concurrentList->lock, sizeof(concurrent_list_lock_t));
+
+        allocator->deallocate(allocator->context, concurrentList, sizeof(concurrent_list_t));
+        list_free(&list);
+        return LIST_ALLOCATION_FAILURE;
+    }
+
+    concurrentList->list = list;
+
+    *concurrentListOut = concurrentList;
+    return LIST_SUCCESS;
+}
+
+
+list_result_t concurrent_list_free(concurrent_list_t** concurrentList) {
+    if (concurrentList == NULL || *concurrentList == NULL)
+        return LIST_NULL_ERROR;
+
+    confetti_allocator_t allocator = (*concurrentList)->list->allocator;
+
+    concurrent_list_lock_destroy((concurrent_list_lock_t*) (*concurrentList)->lock);
+    allocator.deallocate(allocator.context, (*concurrentList)->lock, sizeof(concurrent_list_lock_t));
+
+    list_result_t listFreeResult = list_free(&(*concurrentList)->list);
+
+    allocator.deallocate(allocator.context, *concurrentList, sizeof(concurrent_list_t));
+    *concurrentList = NULL;
+
+    return listFreeResult;
+}
+
+
+list_result_t concurrent_list_size(concurrent_list_t* const concurrentList, int64_t* const sizeOut) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+    else if (sizeOut == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    concurrent_list_lock(concurrentList, false);
+    *sizeOut = concurrentList->list->size;
+    concurrent_list_unlock(concurrentList, false);
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t concurrent_list_append(concurrent_list_t* const concurrentList, void* const value, const uint64_t size) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+
+    concurrent_list_lock(concurrentList, true);
+    list_result_t appendResult = list_append(concurrentList->list, value, size);
+    concurrent_list_unlock(concurrentList, true);
+
+    return appendResult;
+}
+
+
+list_result_t concurrent_list_append_many(
+    concurrent_list_t* const concurrentList, 
+    const void* const values, 
+    const int64_t count, 
+    const uint64_t stride
+) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+
+    concurrent_list_lock(concurrentList, true);
+    list_result_t appendResult = list_append_many(concurrentList->list, values, count, stride);
+    concurrent_list_unlock(concurrentList, true);
+
+    return appendResult;
+}
+
+
+list_result_t concurrent_list_insert(
+    concurrent_list_t* const concurrentList, 
+    const int64_t index, 
+    void* const value, 
+    const uint64_t size
+) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+
+    concurrent_list_lock(concurrentList, true);
+    list_result_t insertResult = list_insert(concurrentList->list, index, value, size);
+    concurrent_list_unlock(concurrentList, true);
+
+    return insertResult;
+}
+
+
+list_result_t concurrent_list_get(concurrent_list_t* const concurrentList, list_element_t** elementOut, const int64_t index) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+
+    concurrent_list_lock(concurrentList, false);
+    list_result_t getResult = list_get(concurrentList->list, elementOut, index);
+    concurrent_list_unlock(concurrentList, false);
+
+    return getResult;
+}
+
+
+list_result_t concurrent_list_set(
+    concurrent_list_t* const concurrentList, 
+    const int64_t index, 
+    void* const value, 
+    const uint64_t size
+) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+
+    concurrent_list_lock(concurrentList, true);
+    list_result_t setResult = list_set(concurrentList->list, index, value, size);
+    concurrent_list_unlock(concurrentList, true);
+
+    return setResult;
+}
+
+
+list_result_t concurrent_list_remove(concurrent_list_t* const concurrentList, const int64_t index) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+
+    concurrent_list_lock(concurrentList, true);
+    list_result_t removeResult = list_remove(concurrentList->list, index);
+    concurrent_list_unlock(concurrentList, true);
+
+    return removeResult;
+}
+
+
+list_result_t concurrent_list_pop(concurrent_list_t* const concurrentList, list_element_t** elementOut, const int64_t index) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+
+    concurrent_list_lock(concurrentList, true);
+    list_result_t popResult = list_pop(concurrentList->list, elementOut, index);
+    concurrent_list_unlock(concurrentList, true);
+
+    return popResult;
+}
+
+
+list_result_t concurrent_list_includes(concurrent_list_t* const concurrentList, void* const value, const uint64_t size) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+
+    const bool exclusive = concurrent_list_lock_for_search(concurrentList);
+    list_result_t includesResult = list_includes(concurrentList->list, value, size);
+    concurrent_list_unlock(concurrentList, exclusive);
+
+    return includesResult;
+}
+
+
+list_result_t concurrent_list_find_first(
+    concurrent_list_t* const concurrentList, 
+    int64_t* const indexOut, 
+    const int64_t startIndex, 
+    void* const value, 
+    const uint64_t size
+) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+
+    const bool exclusive = concurrent_list_lock_for_search(concurrentList);
+    list_result_t findResult = list_find_first(concurrentList->list, indexOut, startIndex, value, size);
+    concurrent_list_unlock(concurrentList, exclusive);
+
+    return findResult;
+}
+
+
+list_result_t concurrent_list_read(
+    concurrent_list_t* const concurrentList, 
+    concurrent_list_function_t* const function, 
+    void* const context
+) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+    else if (function == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    concurrent_list_lock(concurrentList, false);
+    list_result_t functionResult = function(concurrentList->list, context);
+    concurrent_list_unlock(concurrentList, false);
+
+    return functionResult;
+}
+
+
+list_result_t concurrent_list_write(
+    concurrent_list_t* const concurrentList, 
+    concurrent_list_function_t* const function, 
+    void* const context
+) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+    else if (function == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    concurrent_list_lock(concurrentList, true);
+    list_result_t functionResult = function(concurrentList->list, context);
+    concurrent_list_unlock(concurrentList, true);
+
+    return functionResult;
+}
+
+
+list_result_t concurrent_list_batch_create(
+    concurrent_list_batch_t** batchOut, 
+    concurrent_list_t* const concurrentList, 
+    const int64_t capacity, 
+    const uint64_t stride
+) {
+    if (concurrentList == NULL)
+        return LIST_NULL_ERROR;
+    else if (stride == 0)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    const int64_t batchCapacity = capacity < 1 ? DEFAULT_CONCURRENT_LIST_BATCH_CAPACITY : capacity;
+    const confetti_allocator_t* const allocator = &concurrentList->list->allocator;
+    concurrent_list_batch_t* const batch = (concurrent_list_batch_t*) allocator->allocate(allocator->context, sizeof(concurrent_list_batch_t));
+
+    if (batch == NULL)
+        return LIST_ALLOCATION_FAILURE;
+
+    batch->values = (uint8_t*) allocator->allocate(allocator->context, stride * (uint64_t) batchCapacity);
+
+    if (batch->values == NULL) {
+        allocator->deallocate(allocator->context, batch, sizeof(concurrent_list_batch_t));
+        return LIST_ALLOCATION_FAILURE;
+    }
+
+    batch->list = concurrentList;
+    batch->stride = stride;
+    batch->count = 0;
+    batch->capacity = batchCapacity;
+
+    *batchOut = batch;
+    return LIST_SUCCESS;
+}
+
+
+list_result_t concurrent_list_batch_append(concurrent_list_batch_t* const batch, const void* const value) {
+    if (batch == NULL || value == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    if (batch->count == batch->capacity) {
+        list_result_t flushResult = concurrent_list_batch_flush(batch);
+
+        if (flushResult != LIST_SUCCESS)
+            return flushResult;
+    }
+
+    memcpy(batch->values + (uint64_t) batch->count * batch->stride, value, batch->stride);
+    batch->count++;
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t concurrent_list_batch_flush(concurrent_list_batch_t* const batch) {
+    if (batch == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+    else if (batch->count == 0)
+        return LIST_SUCCESS;
+
+    list_result_t appendResult = concurrent_list_append_many(batch->list, batch->values, batch->count, batch->stride);
+
+    if (appendResult != LIST_SUCCESS)
+        return appendResult;
+
+    batch->count = 0;
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t concurrent_list_batch_free(concurrent_list_batch_t** batch) {
+    if (batch == NULL || *batch == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    list_result_t flushResult = concurrent_list_batch_flush(*batch);
+
+    if (flushResult != LIST_SUCCESS)
+        return flushResult;
+
+    const confetti_allocator_t* const allocator = &(*batch)->list->list->allocator;
+
+    allocator->deallocate(allocator->context, (*batch)->values, (*batch)->stride * (uint64_t) (*batch)->capacity);
+    allocator->deallocate(allocator->context, *batch, sizeof(concurrent_list_batch_t));
+    *batch = NULL;
+
+    return LIST_SUCCESS;
+}
+
+#pragma endregion
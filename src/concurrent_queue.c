@@ -0,0 +1,400 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "concurrent_queue.h"
+#include "confetti_atomic.h"
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Builds a tagged handle.
+ *
+ * @param handle The node handle, 0 for no node.
+ * @param tag The change counter.
+ *
+ * @return The tagged handle.
+ */
+static uint64_t concurrent_queue_tag(const uint32_t handle, const uint64_t tag);
+
+/**
+ * @brief Returns the node handle of a tagged handle.
+ *
+ * @param tagged The tagged handle.
+ *
+ * @return The node handle, 0 for no node.
+ */
+static uint32_t concurrent_queue_handle(const uint64_t tagged);
+
+/**
+ * @brief Returns the change counter of a tagged handle bumped by one.
+ *
+ * @param tagged The tagged handle.
+ *
+ * @return The next change counter.
+ */
+static uint64_t concurrent_queue_next_tag(const uint64_t tagged);
+
+/**
+ * @brief Returns the chunk a node position lies in.
+ *
+ * Chunk `c` holds `CONCURRENT_QUEUE_CHUNK_CAPACITY << c` nodes.
+ *
+ * @param position The position of the node, its handle minus one.
+ * @param offsetOut Pointer to where the offset of the node within its chunk will be stored.
+ *
+ * @return The index of the chunk.
+ */
+static uint32_t concurrent_queue_chunk_of(const uint64_t position, uint64_t* const offsetOut);
+
+/**
+ * @brief Returns the node a handle refers to.
+ *
+ * @param concurrentQueue Pointer to the concurrent queue.
+ * @param handle The node handle, which must not be 0.
+ *
+ * @return Pointer to the node.
+ */
+static concurrent_queue_node_t* concurrent_queue_node(concurrent_queue_t* const concurrentQueue, const uint32_t handle);
+
+/**
+ * @brief Takes a node from the free list, or a fresh node from the chunks if none is free.
+ *
+ * @param concurrentQueue Pointer to the concurrent queue.
+ *
+ * @return The handle of the node, or 0 if memory allocation failed.
+ */
+static uint32_t concurrent_queue_node_acquire(concurrent_queue_t* const concurrentQueue);
+
+/**
+ * @brief Returns a node to the free list.
+ *
+ * @param concurrentQueue Pointer to the concurrent queue.
+ * @param handle The handle of the node.
+ */
+static void concurrent_queue_node_release(concurrent_queue_t* const concurrentQueue, const uint32_t handle);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static uint64_t concurrent_queue_tag(const uint32_t handle, const uint64_t tag) {
+    return (tag << 32) | (uint64_t) handle;
+}
+
+
+static uint32_t concurrent_queue_handle(const uint64_t tagged) {
+    return (uint32_t) (tagged & UINT32_MAX);
+}
+
+
+static uint64_t concurrent_queue_next_tag(const uint64_t tagged) {
+    return (tagged >> 32) + 1;
+}
+
+
+static uint32_t concurrent_queue_chunk_of(const uint64_t position, uint64_t* const offsetOut) {
+    const uint64_t scaled = position / CONCURRENT_QUEUE_CHUNK_CAPACITY + 1;
+    uint32_t chunk = 0;
+
+    while ((scaled >> (chunk + 1)) != 0)
+        chunk++;
+
+    *offsetOut = position - CONCURRENT_QUEUE_CHUNK_CAPACITY * (((uint64_t) 1 << chunk) - 1);
+    return chunk;
+}
+
+
+static concurrent_queue_node_t* concurrent_queue_node(concurrent_queue_t* const concurrentQueue, const uint32_t handle) {
+    uint64_t offset = 0;
+    const uint32_t chunk = concurrent_queue_chunk_of((uint64_t) handle - 1, &offset);
+    concurrent_queue_node_t* const nodes = (concurrent_queue_node_t*) confetti_atomic_load_pointer(
+        (void* const volatile*) &concurrentQueue->chunks[chunk]
+    );
+
+    return &nodes[offset];
+}
+
+
+static uint32_t concurrent_queue_node_acquire(concurrent_queue_t* const concurrentQueue) {
+    uint64_t top = confetti_atomic_load(&concurrentQueue->freeList);
+
+    while (concurrent_queue_handle(top) != 0) {
+        const uint64_t next = confetti_atomic_load(&concurrent_queue_node(concurrentQueue, concurrent_queue_handle(top))->next);
+
+        // the tag of the top changes whenever it is popped, so a stale next link is never installed.
+        if (confetti_atomic_compare_exchange(
+            &concurrentQueue->freeList, 
+            &top, 
+            concurrent_queue_tag(concurrent_queue_handle(next), concurrent_queue_next_tag(top))
+        ))
+            return concurrent_queue_handle(top);
+    }
+
+    const uint64_t position = confetti_atomic_fetch_add(&concurrentQueue->nodeCount, 1);
+
+    // the chunks together hold just under 2^32 nodes, so every handle fits in 32 bits.
+    if (position >= CONCURRENT_QUEUE_CHUNK_CAPACITY * (((uint64_t) 1 << CONCURRENT_QUEUE_MAX_CHUNKS) - 1))
+        return 0;
+
+    uint64_t offset = 0;
+    const uint32_t chunk = concurrent_queue_chunk_of(position, &offset);
+    void* volatile* const slot = (void* volatile*) &concurrentQueue->chunks[chunk];
+
+    if (confetti_atomic_load_pointer(slot) == NULL) {
+        const uint64_t allocationSize = sizeof(concurrent_queue_node_t) * (CONCURRENT_QUEUE_CHUNK_CAPACITY << chunk);
+        concurrent_queue_node_t* const nodes = (concurrent_queue_node_t*) concurrentQueue->allocator.allocate(
+            concurrentQueue->allocator.context, 
+            allocationSize
+        );
+
+        if (nodes == NULL)
+            return 0;
+
+        memset(nodes, 0, allocationSize);
+
+        // threads reaching a new chunk at once race to install it, the losers free theirs.
+        if (!confetti_atomic_publish_pointer(slot, nodes))
+            concurrentQueue->allocator.deallocate(concurrentQueue->allocator.context, nodes, allocationSize);
+    }
+
+    return (uint32_t) (position + 1);
+}
+
+
+static void concurrent_queue_node_release(concurrent_queue_t* const concurrentQueue, const uint32_t handle) {
+    concurrent_queue_node_t* const node = concurrent_queue_node(concurrentQueue, handle);
+    uint64_t top = confetti_atomic_load(&concurrentQueue->freeList);
+
+    do {
+        const uint64_t next = confetti_atomic_load_relaxed(&node->next);
+
+        confetti_atomic_store(&node->next, concurrent_queue_tag(concurrent_queue_handle(top), concurrent_queue_next_tag(next)));
+    } while (!confetti_atomic_compare_exchange(
+        &concurrentQueue->freeList, 
+        &top, 
+        concurrent_queue_tag(handle, concurrent_queue_next_tag(top))
+    ));
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+concurrent_queue_result_t concurrent_queue_create(concurrent_queue_t** concurrentQueueOut) {
+    concurrent_queue_options_t options = { NULL };
+
+    return concurrent_queue_create_with_options(concurrentQueueOut, &options);
+}
+
+
+concurrent_queue_result_t concurrent_queue_create_with_options(
+    concurrent_queue_t** concurrentQueueOut, 
+    const concurrent_queue_options_t* const options
+) {
+    if (options == NULL)
+        return CONCURRENT_QUEUE_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const allocator = options->allocator == NULL 
+        ? confetti_allocator_default() 
+        : options->allocator;
+
+    if (allocator->allocate == NULL || allocator->reallocate == NULL || allocator->deallocate == NULL)
+        return CONCURRENT_QUEUE_INVALID_PARAMS_ERROR;
+
+    concurrent_queue_t* const concurrentQueue = (concurrent_queue_t*) allocator->allocate(allocator->context, sizeof(concurrent_queue_t));
+
+    if (concurrentQueue == NULL)
+        return CONCURRENT_QUEUE_ALLOCATION_FAILURE;
+
+    concurrentQueue->freeList = 0;
+    concurrentQueue->nodeCount = 0;
+    concurrentQueue->allocator = *allocator;
+
+    for (uint32_t chunk = 0; chunk < CONCURRENT_QUEUE_MAX_CHUNKS; chunk++)
+        concurrentQueue->chunks[chunk] = NULL;
+
+    const uint32_t dummy = concurrent_queue_node_acquire(concurrentQueue);
+
+    if (dummy == 0) {
+        allocator->deallocate(allocator->context, concurrentQueue, sizeof(concurrent_queue_t));
+        return CONCURRENT_QUEUE_ALLOCATION_FAILURE;
+    }
+
+    concurrentQueue->head = concurrent_queue_tag(dummy, 0);
+    concurrentQueue->tail = concurrent_queue_tag(dummy, 0);
+
+    *concurrentQueueOut = concurrentQueue;
+    return CONCURRENT_QUEUE_SUCCESS;
+}
+
+
+concurrent_queue_result_t concurrent_queue_free(concurrent_queue_t** concurrentQueue) {
+    if (*concurrentQueue == NULL)
+        return CONCURRENT_QUEUE_NULL_ERROR;
+
+    concurrent_queue_t* const queue = *concurrentQueue;
+    concurrent_queue_element_t* element = NULL;
+
+    while (concurrent_queue_pop(queue, &element) == CONCURRENT_QUEUE_SUCCESS)
+        concurrent_queue_element_free(&element);
+
+    confetti_allocator_t allocator = queue->allocator;
+
+    for (uint32_t chunk = 0; chunk < CONCURRENT_QUEUE_MAX_CHUNKS; chunk++) {
+        if (queue->chunks[chunk] != NULL)
+            allocator.deallocate(allocator.context, queue->chunks[chunk], sizeof(concurrent_queue_node_t) * (CONCURRENT_QUEUE_CHUNK_CAPACITY << chunk));
+    }
+
+    allocator.deallocate(allocator.context, queue, sizeof(concurrent_queue_t));
+    *concurrentQueue = NULL;
+
+    return CONCURRENT_QUEUE_SUCCESS;
+}
+
+
+concurrent_queue_result_t concurrent_queue_push(concurrent_queue_t* const concurrentQueue, const void* const value, const uint64_t size) {
+    if (concurrentQueue == NULL)
+        return CONCURRENT_QUEUE_NULL_ERROR;
+    else if (value == NULL)
+        return CONCURRENT_QUEUE_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const defaultAllocator = confetti_allocator_default();
+    concurrent_queue_element_t* const element = (concurrent_queue_element_t*) defaultAllocator->allocate(
+        defaultAllocator->context, 
+        sizeof(concurrent_queue_element_t) + size
+    );
+
+    if (element == NULL)
+        return CONCURRENT_QUEUE_ALLOCATION_FAILURE;
+
+    element->value = (void*) (element + 1);
+    element->size = size;
+    memcpy(element->value, value, size);
+
+    const uint32_t handle = concurrent_queue_node_acquire(concurrentQueue);
+
+    if (handle == 0) {
+        defaultAllocator->deallocate(defaultAllocator->context, element, sizeof(concurrent_queue_element_t) + size);
+        return CONCURRENT_QUEUE_ALLOCATION_FAILURE;
+    }
+
+    concurrent_queue_node_t* const node = concurrent_queue_node(concurrentQueue, handle);
+
+    confetti_atomic_store_pointer((void* volatile*) &node->element, element);
+    confetti_atomic_store(&node->next, concurrent_queue_tag(0, concurrent_queue_next_tag(confetti_atomic_load_relaxed(&node->next))));
+
+    uint64_t tail = 0;
+
+    while (true) {
+        tail = confetti_atomic_load(&concurrentQueue->tail);
+
+        concurrent_queue_node_t* const last = concurrent_queue_node(concurrentQueue, concurrent_queue_handle(tail));
+        uint64_t next = confetti_atomic_load(&last->next);
+
+        if (tail != confetti_atomic_load(&concurrentQueue->tail))
+            continue;
+
+        if (concurrent_queue_handle(next) == 0) {
+            if (confetti_atomic_compare_exchange(&last->next, &next, concurrent_queue_tag(handle, concurrent_queue_next_tag(next))))
+                break;
+        }
+        else {
+            // the tail lags behind a node another thread linked, help swing it forward.
+            confetti_atomic_compare_exchange(
+                &concurrentQueue->tail, 
+                &tail, 
+                concurrent_queue_tag(concurrent_queue_handle(next), concurrent_queue_next_tag(tail))
+            );
+        }
+    }
+
+    confetti_atomic_compare_exchange(&concurrentQueue->tail, &tail, concurrent_queue_tag(handle, concurrent_queue_next_tag(tail)));
+
+    return CONCURRENT_QUEUE_SUCCESS;
+}
+
+
+concurrent_queue_result_t concurrent_queue_pop(concurrent_queue_t* const concurrentQueue, concurrent_queue_element_t** elementOut) {
+    if (concurrentQueue == NULL)
+        return CONCURRENT_QUEUE_NULL_ERROR;
+    else if (elementOut == NULL)
+        return CONCURRENT_QUEUE_INVALID_PARAMS_ERROR;
+
+    uint64_t head = 0;
+    concurrent_queue_element_t* element = NULL;
+
+    while (true) {
+        head = confetti_atomic_load(&concurrentQueue->head);
+
+        uint64_t tail = confetti_atomic_load(&concurrentQueue->tail);
+        const uint64_t next = confetti_atomic_load(&concurrent_queue_node(concurrentQueue, concurrent_queue_handle(head))->next);
+
+        if (head != confetti_atomic_load(&concurrentQueue->head))
+            continue;
+
+        if (concurrent_queue_handle(head) == concurrent_queue_handle(tail)) {
+            if (concurrent_queue_handle(next) == 0)
+                return CONCURRENT_QUEUE_EMPTY_ERROR;
+
+            confetti_atomic_compare_exchange(
+                &concurrentQueue->tail, 
+                &tail, 
+                concurrent_queue_tag(concurrent_queue_handle(next), concurrent_queue_next_tag(tail))
+            );
+            continue;
+        }
+
+        // the element has to be read before the head moves on, after that the node may be recycled.
+        element = (concurrent_queue_element_t*) confetti_atomic_load_pointer(
+            (void* const volatile*) &concurrent_queue_node(concurrentQueue, concurrent_queue_handle(next))->element
+        );
+
+        if (confetti_atomic_compare_exchange(
+            &concurrentQueue->head, 
+            &head, 
+            concurrent_queue_tag(concurrent_queue_handle(next), concurrent_queue_next_tag(head))
+        ))
+            break;
+    }
+
+    // the old dummy is recycled and the node holding the element becomes the new dummy.
+    concurrent_queue_node_release(concurrentQueue, concurrent_queue_handle(head));
+
+    *elementOut = element;
+    return CONCURRENT_QUEUE_SUCCESS;
+}
+
+
+concurrent_queue_result_t concurrent_queue_element_free(concurrent_queue_element_t** element) {
+    if (element == NULL || *element == NULL)
+        return CONCURRENT_QUEUE_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const defaultAllocator = confetti_allocator_default();
+
+    defaultAllocator->deallocate(defaultAllocator->context, *element, sizeof(concurrent_queue_element_t) + (*element)->size);
+    *element = NULL;
+
+    return CONCURRENT_QUEUE_SUCCESS;
+}
+
+#pragma endregion
@@ -0,0 +1,446 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "confetti_allocator.h"
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Allocates a block with `malloc`, used by the default allocator.
+ */
+static void* default_allocate(void* const context, const uint64_t size);
+
+/**
+ * @brief Reallocates a block with `realloc`, used by the default allocator.
+ */
+static void* default_reallocate(void* const context, void* const block, const uint64_t oldSize, const uint64_t newSize);
+
+/**
+ * @brief Frees a block with `free`, used by the default allocator.
+ */
+static void default_deallocate(void* const context, void* const block, const uint64_t size);
+
+/**
+ * @brief Rounds a size up to the next multiple of `CONFETTI_ALLOCATOR_ALIGNMENT`.
+ *
+ * @param size The size to round up.
+ * 
+ * @return The aligned size.
+ */
+static uint64_t align_size(const uint64_t size);
+
+/**
+ * @brief Returns the aligned size of the header placed in front of every arena block.
+ */
+static uint64_t arena_block_header_size(void);
+
+/**
+ * @brief Allocates a block from an arena, requesting a new arena block from the heap if needed.
+ *
+ * @param context A pointer to the arena.
+ * @param size The size in bytes of the block to allocate.
+ * 
+ * @return A pointer to the allocated block, or NULL if the allocation failed.
+ */
+static void* arena_allocate(void* const context, const uint64_t size);
+
+/**
+ * @brief Resizes a block of an arena.
+ * 
+ * The most recent allocation is grown or shrunk in place when the current 
+ * arena block has room, any other block is copied into a new allocation.
+ * 
+ * @param context A pointer to the arena.
+ * @param block A pointer to the block to reallocate, or NULL.
+ * @param oldSize The size the block was allocated with.
+ * @param newSize The new size of the block.
+ * 
+ * @return A pointer to the reallocated block, or NULL if the reallocation failed.
+ */
+static void* arena_reallocate(void* const context, void* const block, const uint64_t oldSize, const uint64_t newSize);
+
+/**
+ * @brief Frees a block of an arena.
+ * 
+ * Only the most recent allocation is actually given back, every other 
+ * block is reclaimed when the arena is reset or freed.
+ * 
+ * @param context A pointer to the arena.
+ * @param block A pointer to the block to free, may be NULL.
+ * @param size The size the block was allocated with.
+ */
+static void arena_deallocate(void* const context, void* const block, const uint64_t size);
+
+/**
+ * @brief Allocates a block from a pool.
+ * 
+ * @param context A pointer to the pool.
+ * @param size The size in bytes of the block to allocate.
+ * 
+ * @return A pointer to the allocated block, or NULL if the allocation failed.
+ */
+static void* pool_allocate(void* const context, const uint64_t size);
+
+/**
+ * @brief Resizes a block of a pool, moving it between the pool and the fallback allocator if needed.
+ * 
+ * @param context A pointer to the pool.
+ * @param block A pointer to the block to reallocate, or NULL.
+ * @param oldSize The size the block was allocated with.
+ * @param newSize The new size of the block.
+ * 
+ * @return A pointer to the reallocated block, or NULL if the reallocation failed.
+ */
+static void* pool_reallocate(void* const context, void* const block, const uint64_t oldSize, const uint64_t newSize);
+
+/**
+ * @brief Returns a block to a pool's free list, or to the fallback allocator if it was too large for the pool.
+ * 
+ * @param context A pointer to the pool.
+ * @param block A pointer to the block to free, may be NULL.
+ * @param size The size the block was allocated with.
+ */
+static void pool_deallocate(void* const context, void* const block, const uint64_t size);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static const confetti_allocator_t defaultAllocator = {
+    &default_allocate,
+    &default_reallocate,
+    &default_deallocate,
+    NULL
+};
+
+
+static void* default_allocate(void* const context, const uint64_t size) {
+    (void) context;
+
+    return malloc(size);
+}
+
+
+static void* default_reallocate(void* const context, void* const block, const uint64_t oldSize, const uint64_t newSize) {
+    (void) context;
+    (void) oldSize;
+
+    return realloc(block, newSize);
+}
+
+
+static void default_deallocate(void* const context, void* const block, const uint64_t size) {
+    (void) context;
+    (void) size;
+
+    free(block);
+}
+
+
+static uint64_t align_size(const uint64_t size) {
+    return (size + CONFETTI_ALLOCATOR_ALIGNMENT - 1) & ~(CONFETTI_ALLOCATOR_ALIGNMENT - 1);
+}
+
+
+static uint64_t arena_block_header_size(void) {
+    return align_size(sizeof(confetti_arena_block_t));
+}
+
+
+static void* arena_allocate(void* const context, const uint64_t size) {
+    confetti_arena_t* const arena = (confetti_arena_t*) context;
+    uint64_t alignedSize = align_size(size);
+    confetti_arena_block_t* block = arena->current;
+
+    if (block == NULL || block->capacity - block->used < alignedSize) {
+        uint64_t capacity = alignedSize > arena->blockSize ? alignedSize : arena->blockSize;
+        confetti_arena_block_t* newBlock = (confetti_arena_block_t*) malloc(arena_block_header_size() + capacity);
+
+        if (newBlock == NULL)
+            return NULL;
+
+        newBlock->next = block;
+        newBlock->capacity = capacity;
+        newBlock->used = 0;
+
+        arena->current = newBlock;
+        block = newBlock;
+    }
+
+    uint8_t* memory = (uint8_t*) block + arena_block_header_size() + block->used;
+    block->used += alignedSize;
+
+    return memory;
+}
+
+
+static void* arena_reallocate(void* const context, void* const block, const uint64_t oldSize, const uint64_t newSize) {
+    confetti_arena_t* const arena = (confetti_arena_t*) context;
+
+    if (block == NULL)
+        return arena_allocate(context, newSize);
+
+    confetti_arena_block_t* current = arena->current;
+    uint64_t alignedOldSize = align_size(oldSize);
+    uint64_t alignedNewSize = align_size(newSize);
+    uint8_t* top = (uint8_t*) current + arena_block_header_size() + current->used;
+
+    if ((uint8_t*) block + alignedOldSize == top && current->used - alignedOldSize + alignedNewSize <= current->capacity) {
+        current->used = current->used - alignedOldSize + alignedNewSize;
+        return block;
+    }
+
+    if (alignedNewSize <= alignedOldSize)
+        return block;
+
+    void* newBlock = arena_allocate(context, newSize);
+
+    if (newBlock == NULL)
+        return NULL;
+
+    memcpy(newBlock, block, oldSize);
+    return newBlock;
+}
+
+
+static void arena_deallocate(void* const context, void* const block, const uint64_t size) {
+    confetti_arena_t* const arena = (confetti_arena_t*) context;
+    confetti_arena_block_t* current = arena->current;
+
+    if (block == NULL || current == NULL)
+        return;
+
+    uint64_t alignedSize = align_size(size);
+    uint8_t* top = (uint8_t*) current + arena_block_header_size() + current->used;
+
+    if ((uint8_t*) block + alignedSize == top)
+        current->used -= alignedSize;
+}
+
+
+static void* pool_allocate(void* const context, const uint64_t size) {
+    confetti_pool_t* const pool = (confetti_pool_t*) context;
+
+    if (size > pool->blockSize)
+        return pool->fallback.allocate(pool->fallback.context, size);
+
+    if (pool->freeList == NULL) {
+        uint64_t headerSize = align_size(sizeof(void*));
+        uint8_t* slab = (uint8_t*) pool->fallback.allocate(pool->fallback.context, headerSize + pool->blockSize * pool->slabCapacity);
+
+        if (slab == NULL)
+            return NULL;
+
+        *(void**) slab = pool->slabs;
+        pool->slabs = slab;
+
+        for (uint64_t i = pool->slabCapacity; i > 0; i--) {
+            void** freeBlock = (void**) (slab + headerSize + pool->blockSize * (i - 1));
+
+            *freeBlock = pool->freeList;
+            pool->freeList = freeBlock;
+        }
+    }
+
+    void** block = (void**) pool->freeList;
+    pool->freeList = *block;
+
+    return block;
+}
+
+
+static void* pool_reallocate(void* const context, void* const block, const uint64_t oldSize, const uint64_t newSize) {
+    confetti_pool_t* const pool = (confetti_pool_t*) context;
+
+    if (block == NULL)
+        return pool_allocate(context, newSize);
+
+    if (oldSize <= pool->blockSize && newSize <= pool->blockSize)
+        return block;
+
+    if (oldSize > pool->blockSize && newSize > pool->blockSize)
+        return pool->fallback.reallocate(pool->fallback.context, block, oldSize, newSize);
+
+    void* newBlock = pool_allocate(context, newSize);
+
+    if (newBlock == NULL)
+        return NULL;
+
+    memcpy(newBlock, block, oldSize < newSize ? oldSize : newSize);
+    pool_deallocate(context, block, oldSize);
+
+    return newBlock;
+}
+
+
+static void pool_deallocate(void* const context, void* const block, const uint64_t size) {
+    confetti_pool_t* const pool = (confetti_pool_t*) context;
+
+    if (block == NULL)
+        return;
+
+    if (size > pool->blockSize) {
+        pool->fallback.deallocate(pool->fallback.context, block, size);
+        return;
+    }
+
+    *(void**) block = pool->freeList;
+    pool->freeList = block;
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+const confetti_allocator_t* confetti_allocator_default(void) {
+    return &defaultAllocator;
+}
+
+
+confetti_allocator_result_t confetti_arena_create(confetti_arena_t** arenaOut, const uint64_t blockSize) {
+    confetti_arena_t* arena = (confetti_arena_t*) malloc(sizeof(confetti_arena_t));
+
+    if (arena == NULL)
+        return CONFETTI_ALLOCATOR_ALLOCATION_FAILURE;
+
+    arena->allocator.allocate = &arena_allocate;
+    arena->allocator.reallocate = &arena_reallocate;
+    arena->allocator.deallocate = &arena_deallocate;
+    arena->allocator.context = arena;
+    arena->current = NULL;
+    arena->blockSize = align_size(blockSize == 0 ? DEFAULT_CONFETTI_ARENA_BLOCK_SIZE : blockSize);
+
+    *arenaOut = arena;
+    return CONFETTI_ALLOCATOR_SUCCESS;
+}
+
+
+confetti_allocator_result_t confetti_arena_reset(confetti_arena_t* const arena) {
+    if (arena == NULL)
+        return CONFETTI_ALLOCATOR_NULL_ERROR;
+
+    confetti_arena_block_t* block = arena->current;
+
+    if (block == NULL)
+        return CONFETTI_ALLOCATOR_SUCCESS;
+
+    while (block->next != NULL) {
+        confetti_arena_block_t* next = block->next;
+
+        free(block);
+        block = next;
+    }
+
+    block->used = 0;
+    arena->current = block;
+
+    return CONFETTI_ALLOCATOR_SUCCESS;
+}
+
+
+confetti_allocator_result_t confetti_arena_free(confetti_arena_t** arena) {
+    if (arena == NULL || *arena == NULL)
+        return CONFETTI_ALLOCATOR_NULL_ERROR;
+
+    confetti_arena_block_t* block = (*arena)->current;
+
+    while (block != NULL) {
+        confetti_arena_block_t* next = block->next;
+
+        free(block);
+        block = next;
+    }
+
+    (*arena)->current = NULL;
+
+    free(*arena);
+    *arena = NULL;
+
+    return CONFETTI_ALLOCATOR_SUCCESS;
+}
+
+
+confetti_allocator_result_t confetti_pool_create(
+    confetti_pool_t** poolOut,
+    const uint64_t blockSize,
+    const uint64_t slabCapacity,
+    const confetti_allocator_t* const fallback
+) {
+    if (blockSize == 0)
+        return CONFETTI_ALLOCATOR_INVALID_PARAMS_ERROR;
+
+    confetti_pool_t* pool = (confetti_pool_t*) malloc(sizeof(confetti_pool_t));
+
+    if (pool == NULL)
+        return CONFETTI_ALLOCATOR_ALLOCATION_FAILURE;
+
+    pool->allocator.allocate = &pool_allocate;
+    pool->allocator.reallocate = &pool_reallocate;
+    pool->allocator.deallocate = &pool_deallocate;
+    pool->allocator.context = pool;
+    pool->fallback = fallback == NULL ? defaultAllocator : *fallback;
+    pool->freeList = NULL;
+    pool->slabs = NULL;
+    pool->blockSize = align_size(blockSize);
+    pool->slabCapacity = slabCapacity == 0 ? DEFAULT_CONFETTI_POOL_SLAB_CAPACITY : slabCapacity;
+
+    *poolOut = pool;
+    return CONFETTI_ALLOCATOR_SUCCESS;
+}
+
+
+confetti_allocator_result_t confetti_pool_reset(confetti_pool_t* const pool) {
+    if (pool == NULL)
+        return CONFETTI_ALLOCATOR_NULL_ERROR;
+
+    uint64_t slabSize = align_size(sizeof(void*)) + pool->blockSize * pool->slabCapacity;
+    void* slab = pool->slabs;
+
+    while (slab != NULL) {
+        void* next = *(void**) slab;
+
+        pool->fallback.deallocate(pool->fallback.context, slab, slabSize);
+        slab = next;
+    }
+
+    pool->slabs = NULL;
+    pool->freeList = NULL;
+
+    return CONFETTI_ALLOCATOR_SUCCESS;
+}
+
+
+confetti_allocator_result_t confetti_pool_free(confetti_pool_t** pool) {
+    if (pool == NULL || *pool == NULL)
+        return CONFETTI_ALLOCATOR_NULL_ERROR;
+
+    confetti_pool_reset(*pool);
+
+    free(*pool);
+    *pool = NULL;
+
+    return CONFETTI_ALLOCATOR_SUCCESS;
+}
+
+#pragma endregion
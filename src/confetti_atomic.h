@@ -0,0 +1,226 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+// Headers
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define CONFETTI_ATOMIC_MSVC // Interlocked intrinsics are used for read-modify-write operations, iso volatile intrinsics for loads and stores.
+    #include <intrin.h>
+
+    // arm targets compile volatile accesses with /volatile:iso semantics, which don't order anything, so a barrier 
+    // instruction is needed. x86 and x64 keep loads and stores in order, only the compiler has to be held back there.
+    #if defined(_M_ARM64) || defined(_M_ARM64EC)
+        #define CONFETTI_ATOMIC_MSVC_BARRIER() __dmb(_ARM64_BARRIER_ISH)
+    #elif defined(_M_ARM)
+        #define CONFETTI_ATOMIC_MSVC_BARRIER() __dmb(_ARM_BARRIER_ISH)
+    #else
+        #define CONFETTI_ATOMIC_MSVC_BARRIER() _ReadWriteBarrier()
+    #endif
+#elif !defined(__GNUC__) && !defined(__clang__)
+    #error "confetti needs gcc style __atomic builtins or msvc interlocked intrinsics for its concurrent containers."
+#endif
+
+// constant definitions
+
+#define CONFETTI_CACHE_LINE_SIZE ((uint64_t) 64) // Fields written by different threads are kept this many bytes apart.
+
+// internal function definitions
+
+#pragma region internal function definitions
+
+/**
+ * @brief Loads a value, ordering later memory accesses after it.
+ *
+ * @param target Pointer to the value.
+ *
+ * @return The loaded value.
+ */
+static inline uint64_t confetti_atomic_load(const volatile uint64_t* const target);
+
+/**
+ * @brief Loads a value without ordering any other memory access.
+ *
+ * @param target Pointer to the value.
+ *
+ * @return The loaded value.
+ */
+static inline uint64_t confetti_atomic_load_relaxed(const volatile uint64_t* const target);
+
+/**
+ * @brief Stores a value, ordering earlier memory accesses before it.
+ *
+ * @param target Pointer to the value.
+ * @param value The value to store.
+ */
+static inline void confetti_atomic_store(volatile uint64_t* const target, const uint64_t value);
+
+/**
+ * @brief Replaces a value if it still equals an expected value.
+ *
+ * @param target Pointer to the value.
+ * @param expected Pointer to the expected value, which is updated to the current value on failure.
+ * @param desired The value to store.
+ *
+ * @return `true` if the value was replaced, otherwise `false`.
+ */
+static inline bool confetti_atomic_compare_exchange(volatile uint64_t* const target, uint64_t* const expected, const uint64_t desired);
+
+/**
+ * @brief Adds to a value.
+ *
+ * @param target Pointer to the value.
+ * @param amount The amount to add.
+ *
+ * @return The value before the addition.
+ */
+static inline uint64_t confetti_atomic_fetch_add(volatile uint64_t* const target, const uint64_t amount);
+
+/**
+ * @brief Loads a pointer, ordering later memory accesses after it.
+ *
+ * @param target Pointer to the pointer.
+ *
+ * @return The loaded pointer.
+ */
+static inline void* confetti_atomic_load_pointer(void* const volatile* const target);
+
+/**
+ * @brief Stores a pointer, ordering earlier memory accesses before it.
+ *
+ * @param target Pointer to the pointer.
+ * @param value The pointer to store.
+ */
+static inline void confetti_atomic_store_pointer(void* volatile* const target, void* const value);
+
+/**
+ * @brief Replaces a pointer if it is still NULL.
+ *
+ * @param target Pointer to the pointer.
+ * @param desired The pointer to store.
+ *
+ * @return `true` if the pointer was stored, otherwise `false`.
+ */
+static inline bool confetti_atomic_publish_pointer(void* volatile* const target, void* const desired);
+
+#pragma endregion
+
+// internal functions
+
+#pragma region internal functions
+
+static inline uint64_t confetti_atomic_load(const volatile uint64_t* const target) {
+#if defined(CONFETTI_ATOMIC_MSVC)
+    // the intrinsic is a single access on every target, a plain 64 bit load is split in two on x86.
+    const uint64_t value = (uint64_t) __iso_volatile_load64((const volatile __int64*) target);
+
+    CONFETTI_ATOMIC_MSVC_BARRIER();
+    return value;
+#else
+    return __atomic_load_n(target, __ATOMIC_ACQUIRE);
+#endif
+}
+
+
+static inline uint64_t confetti_atomic_load_relaxed(const volatile uint64_t* const target) {
+#if defined(CONFETTI_ATOMIC_MSVC)
+    return (uint64_t) __iso_volatile_load64((const volatile __int64*) target);
+#else
+    return __atomic_load_n(target, __ATOMIC_RELAXED);
+#endif
+}
+
+
+static inline void confetti_atomic_store(volatile uint64_t* const target, const uint64_t value) {
+#if defined(CONFETTI_ATOMIC_MSVC)
+    CONFETTI_ATOMIC_MSVC_BARRIER();
+    __iso_volatile_store64((volatile __int64*) target, (__int64) value);
+#else
+    __atomic_store_n(target, value, __ATOMIC_RELEASE);
+#endif
+}
+
+
+static inline bool confetti_atomic_compare_exchange(volatile uint64_t* const target, uint64_t* const expected, const uint64_t desired) {
+#if defined(CONFETTI_ATOMIC_MSVC)
+    const uint64_t previous = (uint64_t) _InterlockedCompareExchange64((volatile __int64*) target, (__int64) desired, (__int64) *expected);
+
+    if (previous == *expected)
+        return true;
+
+    *expected = previous;
+    return false;
+#else
+    return __atomic_compare_exchange_n(target, expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+
+static inline uint64_t confetti_atomic_fetch_add(volatile uint64_t* const target, const uint64_t amount) {
+#if defined(CONFETTI_ATOMIC_MSVC)
+    return (uint64_t) _InterlockedExchangeAdd64((volatile __int64*) target, (__int64) amount);
+#else
+    return __atomic_fetch_add(target, amount, __ATOMIC_ACQ_REL);
+#endif
+}
+
+
+static inline void* confetti_atomic_load_pointer(void* const volatile* const target) {
+#if defined(CONFETTI_ATOMIC_MSVC) && defined(_WIN64)
+    void* const value = (void*) __iso_volatile_load64((const volatile __int64*) target);
+
+    CONFETTI_ATOMIC_MSVC_BARRIER();
+    return value;
+#elif defined(CONFETTI_ATOMIC_MSVC)
+    void* const value = (void*) __iso_volatile_load32((const volatile __int32*) target);
+
+    CONFETTI_ATOMIC_MSVC_BARRIER();
+    return value;
+#else
+    return __atomic_load_n(target, __ATOMIC_ACQUIRE);
+#endif
+}
+
+
+static inline void confetti_atomic_store_pointer(void* volatile* const target, void* const value) {
+#if defined(CONFETTI_ATOMIC_MSVC) && defined(_WIN64)
+    CONFETTI_ATOMIC_MSVC_BARRIER();
+    __iso_volatile_store64((volatile __int64*) target, (__int64) value);
+#elif defined(CONFETTI_ATOMIC_MSVC)
+    CONFETTI_ATOMIC_MSVC_BARRIER();
+    __iso_volatile_store32((volatile __int32*) target, (__int32) value);
+#else
+    __atomic_store_n(target, value, __ATOMIC_RELEASE);
+#endif
+}
+
+
+static inline bool confetti_atomic_publish_pointer(void* volatile* const target, void* const desired) {
+#if defined(CONFETTI_ATOMIC_MSVC)
+    return _InterlockedCompareExchangePointer(target, desired, NULL) == NULL;
+#else
+    void* expected = NULL;
+
+    return __atomic_compare_exchange_n(target, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+#pragma endregion
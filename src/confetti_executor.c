@@ -0,0 +1,534 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L // pthreads and sysconf are only declared when posix interfaces are asked for.
+#endif
+
+#include "confetti_executor.h"
+#include "confetti_atomic.h"
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+#endif
+
+// private struct definitions
+
+#if defined(_WIN32)
+    typedef HANDLE confetti_thread_t;
+    typedef SRWLOCK confetti_mutex_t;
+    typedef CONDITION_VARIABLE confetti_condition_t;
+    typedef DWORD confetti_thread_result_t;
+    #define CONFETTI_THREAD_CALL WINAPI // Calling convention of thread entry points.
+#else
+    typedef pthread_t confetti_thread_t;
+    typedef pthread_mutex_t confetti_mutex_t;
+    typedef pthread_cond_t confetti_condition_t;
+    typedef void* confetti_thread_result_t;
+    #define CONFETTI_THREAD_CALL // Calling convention of thread entry points.
+#endif
+
+/**
+ * @brief Type definition for the entry point of a thread.
+ */
+typedef confetti_thread_result_t (CONFETTI_THREAD_CALL confetti_thread_entry_t)(void* argument);
+
+/**
+ * @brief Represents a batch of tasks threads work through together.
+ */
+typedef struct confetti_batch {
+    confetti_task_function_t* task; /* The task to run. */
+    void* taskContext;              /* The context handed to every call of the task. */
+    uint64_t count;                 /* The amount of tasks. */
+    volatile uint64_t next;         /* Index of the next task to be claimed. */
+} confetti_batch_t;
+
+/**
+ * @brief Represents the worker threads of a thread pool and their synchronization.
+ */
+typedef struct confetti_thread_pool_state {
+    confetti_mutex_t runMutex;    /* Held while a batch runs, so batches run one at a time. */
+    confetti_mutex_t mutex;       /* Guards every field below. */
+    confetti_condition_t wake;    /* Signalled when a batch is posted or the pool stops. */
+    confetti_condition_t idle;    /* Signalled when the last worker leaves a batch. */
+    confetti_batch_t* batch;      /* The batch being run, NULL between batches. */
+    uint64_t generation;          /* Bumped every time a batch is posted. */
+    uint64_t active;              /* Amount of workers working on the current batch. */
+    bool stopping;                /* Set once the pool is being freed. */
+    confetti_thread_t* threads;   /* The worker threads. */
+    uint64_t startedThreads;      /* Amount of worker threads started. */
+} confetti_thread_pool_state_t;
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Starts a thread.
+ *
+ * @param threadOut Pointer to where the thread will be stored.
+ * @param entry The entry point of the thread.
+ * @param argument The argument handed to the entry point.
+ *
+ * @return `true` if the thread was started, otherwise `false`.
+ */
+static bool confetti_thread_start(confetti_thread_t* const threadOut, confetti_thread_entry_t* const entry, void* const argument);
+
+/**
+ * @brief Waits for a thread to return.
+ *
+ * @param thread The thread.
+ */
+static void confetti_thread_join(confetti_thread_t thread);
+
+/**
+ * @brief Initializes a mutex.
+ *
+ * @param mutex Pointer to the mutex.
+ *
+ * @return `true` if the mutex was initialized, otherwise `false`.
+ */
+static bool confetti_mutex_init(confetti_mutex_t* const mutex);
+
+/**
+ * @brief Destroys a mutex.
+ *
+ * @param mutex Pointer to the mutex.
+ */
+static void confetti_mutex_destroy(confetti_mutex_t* const mutex);
+
+/**
+ * @brief Locks a mutex.
+ *
+ * @param mutex Pointer to the mutex.
+ */
+static void confetti_mutex_lock(confetti_mutex_t* const mutex);
+
+/**
+ * @brief Unlocks a mutex.
+ *
+ * @param mutex Pointer to the mutex.
+ */
+static void confetti_mutex_unlock(confetti_mutex_t* const mutex);
+
+/**
+ * @brief Initializes a condition variable.
+ *
+ * @param condition Pointer to the condition variable.
+ *
+ * @return `true` if the condition variable was initialized, otherwise `false`.
+ */
+static bool confetti_condition_init(confetti_condition_t* const condition);
+
+/**
+ * @brief Destroys a condition variable.
+ *
+ * @param condition Pointer to the condition variable.
+ */
+static void confetti_condition_destroy(confetti_condition_t* const condition);
+
+/**
+ * @brief Waits on a condition variable, releasing a locked mutex while waiting.
+ *
+ * @param condition Pointer to the condition variable.
+ * @param mutex Pointer to the locked mutex.
+ */
+static void confetti_condition_wait(confetti_condition_t* const condition, confetti_mutex_t* const mutex);
+
+/**
+ * @brief Wakes every thread waiting on a condition variable.
+ *
+ * @param condition Pointer to the condition variable.
+ */
+static void confetti_condition_broadcast(confetti_condition_t* const condition);
+
+/**
+ * @brief Claims and runs tasks of a batch until every task has been claimed.
+ *
+ * @param batch Pointer to the batch.
+ */
+static void confetti_batch_work(confetti_batch_t* const batch);
+
+/**
+ * @brief Entry point of a thread started for a single batch.
+ *
+ * @param argument Pointer to the batch.
+ *
+ * @return Nothing meaningful.
+ */
+static confetti_thread_result_t CONFETTI_THREAD_CALL confetti_batch_main(void* argument);
+
+/**
+ * @brief Entry point of a worker thread of a thread pool.
+ *
+ * The worker sleeps until a batch is posted, works through it and goes back to sleep.
+ *
+ * @param argument Pointer to the state of the thread pool.
+ *
+ * @return Nothing meaningful.
+ */
+static confetti_thread_result_t CONFETTI_THREAD_CALL confetti_thread_pool_main(void* argument);
+
+/**
+ * @brief Runs a batch of tasks on a thread pool, as its executor.
+ *
+ * @param context Pointer to the thread pool.
+ * @param task The task to run.
+ * @param taskContext The context to hand to every call of the task.
+ * @param count The amount of tasks.
+ */
+static void confetti_thread_pool_run(void* const context, confetti_task_function_t* const task, void* const taskContext, const uint64_t count);
+
+/**
+ * @brief Stops and joins the workers of a thread pool and releases its state.
+ *
+ * @param state Pointer to the state of the thread pool.
+ */
+static void confetti_thread_pool_state_free(confetti_thread_pool_state_t* const state);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static bool confetti_thread_start(confetti_thread_t* const threadOut, confetti_thread_entry_t* const entry, void* const argument) {
+#if defined(_WIN32)
+    *threadOut = CreateThread(NULL, 0, entry, argument, 0, NULL);
+    return *threadOut != NULL;
+#else
+    return pthread_create(threadOut, NULL, entry, argument) == 0;
+#endif
+}
+
+
+static void confetti_thread_join(confetti_thread_t thread) {
+#if defined(_WIN32)
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+
+static bool confetti_mutex_init(confetti_mutex_t* const mutex) {
+#if defined(_WIN32)
+    InitializeSRWLock(mutex);
+    return true;
+#else
+    return pthread_mutex_init(mutex, NULL) == 0;
+#endif
+}
+
+
+static void confetti_mutex_destroy(confetti_mutex_t* const mutex) {
+#if defined(_WIN32)
+    (void) mutex;
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+
+static void confetti_mutex_lock(confetti_mutex_t* const mutex) {
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+
+static void confetti_mutex_unlock(confetti_mutex_t* const mutex) {
+#if defined(_WIN32)
+    ReleaseSRWLockExclusive(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+
+static bool confetti_condition_init(confetti_condition_t* const condition) {
+#if defined(_WIN32)
+    InitializeConditionVariable(condition);
+    return true;
+#else
+    return pthread_cond_init(condition, NULL) == 0;
+#endif
+}
+
+
+static void confetti_condition_destroy(confetti_condition_t* const condition) {
+#if defined(_WIN32)
+    (void) condition;
+#else
+    pthread_cond_destroy(condition);
+#endif
+}
+
+
+static void confetti_condition_wait(confetti_condition_t* const condition, confetti_mutex_t* const mutex) {
+#if defined(_WIN32)
+    SleepConditionVariableSRW(condition, mutex, INFINITE, 0);
+#else
+    pthread_cond_wait(condition, mutex);
+#endif
+}
+
+
+static void confetti_condition_broadcast(confetti_condition_t* const condition) {
+#if defined(_WIN32)
+    WakeAllConditionVariable(condition);
+#else
+    pthread_cond_broadcast(condition);
+#endif
+}
+
+
+static void confetti_batch_work(confetti_batch_t* const batch) {
+    uint64_t index;
+
+    while ((index = confetti_atomic_fetch_add(&batch->next, 1)) < batch->count)
+        batch->task(batch->taskContext, index);
+}
+
+
+static confetti_thread_result_t CONFETTI_THREAD_CALL confetti_batch_main(void* argument) {
+    confetti_batch_work((confetti_batch_t*) argument);
+
+    return 0;
+}
+
+
+static confetti_thread_result_t CONFETTI_THREAD_CALL confetti_thread_pool_main(void* argument) {
+    confetti_thread_pool_state_t* const state = (confetti_thread_pool_state_t*) argument;
+    uint64_t seenGeneration = 0;
+
+    confetti_mutex_lock(&state->mutex);
+
+    while (true) {
+        while (!state->stopping && state->generation == seenGeneration)
+            confetti_condition_wait(&state->wake, &state->mutex);
+
+        if (state->stopping)
+            break;
+
+        seenGeneration = state->generation;
+
+        // the batch may already be finished by the time a slow worker wakes up.
+        confetti_batch_t* const batch = state->batch;
+
+        if (batch == NULL)
+            continue;
+
+        state->active++;
+        confetti_mutex_unlock(&state->mutex);
+
+        confetti_batch_work(batch);
+
+        confetti_mutex_lock(&state->mutex);
+
+        if (--state->active == 0)
+            confetti_condition_broadcast(&state->idle);
+    }
+
+    confetti_mutex_unlock(&state->mutex);
+
+    return 0;
+}
+
+
+static void confetti_thread_pool_run(void* const context, confetti_task_function_t* const task, void* const taskContext, const uint64_t count) {
+    confetti_thread_pool_state_t* const state = (confetti_thread_pool_state_t*) ((confetti_thread_pool_t*) context)->state;
+    confetti_batch_t batch = { task, taskContext, count, 0 };
+
+    confetti_mutex_lock(&state->runMutex);
+
+    confetti_mutex_lock(&state->mutex);
+    state->batch = &batch;
+    state->generation++;
+    confetti_condition_broadcast(&state->wake);
+    confetti_mutex_unlock(&state->mutex);
+
+    confetti_batch_work(&batch);
+
+    // every task is claimed once the caller runs dry, wait for the workers still running theirs.
+    confetti_mutex_lock(&state->mutex);
+
+    while (state->active > 0)
+        confetti_condition_wait(&state->idle, &state->mutex);
+
+    state->batch = NULL;
+    confetti_mutex_unlock(&state->mutex);
+
+    confetti_mutex_unlock(&state->runMutex);
+}
+
+
+static void confetti_thread_pool_state_free(confetti_thread_pool_state_t* const state) {
+    confetti_mutex_lock(&state->mutex);
+    state->stopping = true;
+    confetti_condition_broadcast(&state->wake);
+    confetti_mutex_unlock(&state->mutex);
+
+    for (uint64_t i = 0; i < state->startedThreads; i++)
+        confetti_thread_join(state->threads[i]);
+
+    confetti_condition_destroy(&state->idle);
+    confetti_condition_destroy(&state->wake);
+    confetti_mutex_destroy(&state->mutex);
+    confetti_mutex_destroy(&state->runMutex);
+
+    free(state->threads);
+    free(state);
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+uint64_t confetti_executor_default_thread_count(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO systemInfo;
+
+    GetSystemInfo(&systemInfo);
+    return systemInfo.dwNumberOfProcessors > 0 ? (uint64_t) systemInfo.dwNumberOfProcessors : 1;
+#else
+    const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return processors > 0 ? (uint64_t) processors : 1;
+#endif
+}
+
+
+confetti_executor_result_t confetti_executor_run(
+    const confetti_executor_t* const executor, 
+    const uint64_t threadCount, 
+    confetti_task_function_t* const task, 
+    void* const taskContext, 
+    const uint64_t count
+) {
+    if (task == NULL)
+        return CONFETTI_EXECUTOR_INVALID_PARAMS_ERROR;
+    else if (count == 0)
+        return CONFETTI_EXECUTOR_SUCCESS;
+
+    if (executor != NULL) {
+        executor->run(executor->context, task, taskContext, count);
+        return CONFETTI_EXECUTOR_SUCCESS;
+    }
+
+    confetti_batch_t batch = { task, taskContext, count, 0 };
+    uint64_t helperCount = (threadCount == 0 ? confetti_executor_default_thread_count() : threadCount) - 1;
+
+    if (helperCount > count - 1)
+        helperCount = count - 1;
+
+    confetti_thread_t* const threads = helperCount > 0 
+        ? (confetti_thread_t*) malloc(sizeof(confetti_thread_t) * helperCount) 
+        : NULL;
+    uint64_t startedThreads = 0;
+
+    if (threads != NULL) {
+        while (startedThreads < helperCount && confetti_thread_start(&threads[startedThreads], &confetti_batch_main, &batch))
+            startedThreads++;
+    }
+
+    confetti_batch_work(&batch);
+
+    for (uint64_t i = 0; i < startedThreads; i++)
+        confetti_thread_join(threads[i]);
+
+    free(threads);
+
+    return CONFETTI_EXECUTOR_SUCCESS;
+}
+
+
+confetti_executor_result_t confetti_thread_pool_create(confetti_thread_pool_t** poolOut, const uint64_t threadCount) {
+    confetti_thread_pool_t* const pool = (confetti_thread_pool_t*) malloc(sizeof(confetti_thread_pool_t));
+    confetti_thread_pool_state_t* const state = (confetti_thread_pool_state_t*) malloc(sizeof(confetti_thread_pool_state_t));
+
+    if (pool == NULL || state == NULL) {
+        free(pool);
+        free(state);
+
+        return CONFETTI_EXECUTOR_ALLOCATION_FAILURE;
+    }
+
+    pool->executor.run = &confetti_thread_pool_run;
+    pool->executor.context = pool;
+    pool->threadCount = threadCount == 0 ? confetti_executor_default_thread_count() : threadCount;
+    pool->state = state;
+
+    state->batch = NULL;
+    state->generation = 0;
+    state->active = 0;
+    state->stopping = false;
+    state->startedThreads = 0;
+    state->threads = pool->threadCount > 1 
+        ? (confetti_thread_t*) malloc(sizeof(confetti_thread_t) * (pool->threadCount - 1)) 
+        : NULL;
+
+    if ((pool->threadCount > 1 && state->threads == NULL)
+        || !confetti_mutex_init(&state->runMutex)
+        || !confetti_mutex_init(&state->mutex)
+        || !confetti_condition_init(&state->wake)
+        || !confetti_condition_init(&state->idle)) {
+        // the primitives are simple enough that failing to initialize them only happens when out of memory.
+        free(state->threads);
+        free(state);
+        free(pool);
+
+        return CONFETTI_EXECUTOR_ALLOCATION_FAILURE;
+    }
+
+    while (state->startedThreads < pool->threadCount - 1) {
+        if (!confetti_thread_start(&state->threads[state->startedThreads], &confetti_thread_pool_main, state)) {
+            confetti_thread_pool_state_free(state);
+            free(pool);
+
+            return CONFETTI_EXECUTOR_ALLOCATION_FAILURE;
+        }
+
+        state->startedThreads++;
+    }
+
+    *poolOut = pool;
+    return CONFETTI_EXECUTOR_SUCCESS;
+}
+
+
+confetti_executor_result_t confetti_thread_pool_free(confetti_thread_pool_t** pool) {
+    if (pool == NULL || *pool == NULL)
+        return CONFETTI_EXECUTOR_NULL_ERROR;
+
+    confetti_thread_pool_state_free((confetti_thread_pool_state_t*) (*pool)->state);
+
+    free(*pool);
+    *pool = NULL;
+
+    return CONFETTI_EXECUTOR_SUCCESS;
+}
+
+#pragma endregion
@@ -0,0 +1,170 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+    #define _POSIX_C_SOURCE 200809L // mmap, open and fstat are only declared when posix interfaces are asked for.
+#endif
+
+#include "confetti_file.h"
+
+#if defined(_WIN32)
+    #include <windows.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// internal functions
+
+#pragma region internal functions
+
+bool confetti_file_header_check(const confetti_file_header_t* const header) {
+    if (header->magic != CONFETTI_FILE_MAGIC || header->version != CONFETTI_FILE_VERSION || header->count > (uint64_t) INT64_MAX)
+        return false;
+
+    if (header->stride != 0)
+        return header->count <= UINT64_MAX / header->stride && header->payloadSize == header->count * header->stride;
+
+    return header->count <= (UINT64_MAX - header->payloadSize) / sizeof(confetti_file_entry_t);
+}
+
+
+uint64_t confetti_file_body_size(const confetti_file_header_t* const header) {
+    const uint64_t tableSize = header->stride == 0 ? header->count * sizeof(confetti_file_entry_t) : 0;
+
+    return tableSize + header->payloadSize;
+}
+
+
+bool confetti_file_entries_check(const confetti_file_entry_t* const entries, const uint64_t count, const uint64_t payloadSize) {
+    for (uint64_t i = 0; i < count; i++) {
+        if (entries[i].offset == CONFETTI_FILE_NO_VALUE)
+            continue;
+
+        if (entries[i].offset > payloadSize || entries[i].size > payloadSize - entries[i].offset)
+            return false;
+    }
+
+    return true;
+}
+
+
+bool confetti_file_body_fits(FILE* const file, const confetti_file_header_t* const header) {
+#if defined(_WIN32)
+    struct _stat64 status;
+
+    if (_fstat64(_fileno(file), &status) != 0 || status.st_size < 0)
+        return false;
+#else
+    struct stat status;
+
+    if (fstat(fileno(file), &status) != 0 || status.st_size < 0)
+        return false;
+#endif
+
+    const uint64_t fileSize = (uint64_t) status.st_size;
+
+    return fileSize >= sizeof(confetti_file_header_t) 
+        && confetti_file_body_size(header) <= fileSize - sizeof(confetti_file_header_t);
+}
+
+
+bool confetti_file_map(const char* const path, confetti_file_map_t* const mapOut) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    // the mapping keeps the file open by itself.
+    CloseHandle(file);
+
+    if (mapping == NULL)
+        return false;
+
+    const void* const data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (data == NULL) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    mapOut->data = (const uint8_t*) data;
+    mapOut->size = (uint64_t) fileSize.QuadPart;
+    mapOut->handle = mapping;
+
+    return true;
+#else
+    const int file = open(path, O_RDONLY);
+
+    if (file < 0)
+        return false;
+
+    struct stat status;
+
+    if (fstat(file, &status) != 0 || status.st_size <= 0) {
+        close(file);
+        return false;
+    }
+
+    void* const data = mmap(NULL, (size_t) status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+
+    // the mapping keeps the file open by itself.
+    close(file);
+
+    if (data == MAP_FAILED)
+        return false;
+
+    mapOut->data = (const uint8_t*) data;
+    mapOut->size = (uint64_t) status.st_size;
+    mapOut->handle = NULL;
+
+    return true;
+#endif
+}
+
+
+void confetti_file_unmap(confetti_file_map_t* const map) {
+    if (map->data == NULL)
+        return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(map->data);
+    CloseHandle((HANDLE) map->handle);
+#else
+    munmap((void*) map->data, (size_t) map->size);
+#endif
+
+    map->data = NULL;
+    map->size = 0;
+    map->handle = NULL;
+}
+
+#pragma endregion
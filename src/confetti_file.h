@@ -0,0 +1,136 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+// constant definitions
+
+#define CONFETTI_FILE_MAGIC ((uint32_t) 0x4C464E43)        // "CNFL" in little endian, files written with another byte order don't match it.
+#define CONFETTI_FILE_VERSION ((uint32_t) 1)               // The version of the container file format.
+#define CONFETTI_FILE_NO_VALUE UINT64_MAX                  // Offset of an entry whose element has no value.
+#define CONFETTI_FILE_BUFFER_SIZE ((size_t) 1 << 20)       // The size of the stdio buffer container files are written and read through.
+
+// struct definitions
+
+// define all structs early to avoid errors relating to one of these structs not existing.
+typedef struct confetti_file_header confetti_file_header_t;
+typedef struct confetti_file_entry confetti_file_entry_t;
+typedef struct confetti_file_map confetti_file_map_t;
+
+/**
+ * @brief The header every container file starts with.
+ *
+ * The header is followed by one `confetti_file_entry_t` for every value unless the 
+ * values share a stride, then by the packed values themselves.
+ */
+typedef struct confetti_file_header {
+    uint32_t magic;       /* Always `CONFETTI_FILE_MAGIC`. */
+    uint32_t version;     /* Always `CONFETTI_FILE_VERSION`. */
+    uint64_t count;       /* Amount of values in the file. */
+    uint64_t stride;      /* Size of every value when they share one, 0 if the file has an entry table. */
+    uint64_t payloadSize; /* Size in bytes of the packed values. */
+} confetti_file_header_t;
+
+/**
+ * @brief Locates one value of a container file.
+ */
+typedef struct confetti_file_entry {
+    uint64_t offset; /* Offset of the value from the start of the packed values, `CONFETTI_FILE_NO_VALUE` for none. */
+    uint64_t size;   /* Size of the value in bytes. */
+} confetti_file_entry_t;
+
+/**
+ * @brief Represents a file mapped read only into memory.
+ */
+typedef struct confetti_file_map {
+    const uint8_t* data; /* The first byte of the file. */
+    uint64_t size;       /* The size of the file in bytes. */
+    void* handle;        /* Platform handle keeping the mapping alive, if the platform needs one. */
+} confetti_file_map_t;
+
+// private function definitions
+
+#pragma region internal function definitions
+
+/**
+ * @brief Returns whether a header describes a container file this version can read.
+ *
+ * @param header Pointer to the header.
+ *
+ * @return `true` if the magic and version match and the sizes it describes don't overflow.
+ */
+bool confetti_file_header_check(const confetti_file_header_t* const header);
+
+/**
+ * @brief Returns the size of the part of a container file following its header.
+ *
+ * @param header Pointer to a header `confetti_file_header_check` accepted.
+ *
+ * @return The size in bytes of the entry table and the packed values together.
+ */
+uint64_t confetti_file_body_size(const confetti_file_header_t* const header);
+
+/**
+ * @brief Returns whether every entry of a table lies within the packed values.
+ *
+ * @param entries Pointer to the first entry.
+ * @param count The amount of entries.
+ * @param payloadSize The size in bytes of the packed values.
+ *
+ * @return `true` if every value is in range, otherwise `false`.
+ */
+bool confetti_file_entries_check(const confetti_file_entry_t* const entries, const uint64_t count, const uint64_t payloadSize);
+
+/**
+ * @brief Returns whether an open container file is large enough for the body its header describes.
+ *
+ * Checked before anything is allocated for the body, so a corrupted header can't ask for more 
+ * memory than the file could fill.
+ *
+ * @param file The open file, whose header was read.
+ * @param header Pointer to a header `confetti_file_header_check` accepted.
+ *
+ * @return `true` if the file holds at least the header and its body, otherwise `false`.
+ */
+bool confetti_file_body_fits(FILE* const file, const confetti_file_header_t* const header);
+
+/**
+ * @brief Maps a whole file read only into memory.
+ *
+ * @param path The path of the file.
+ * @param mapOut Pointer to where the mapping will be stored.
+ *
+ * @return `true` if the file was mapped, `false` if it couldn't be opened or mapped or is empty.
+ */
+bool confetti_file_map(const char* const path, confetti_file_map_t* const mapOut);
+
+/**
+ * @brief Unmaps a file mapped by `confetti_file_map`.
+ *
+ * @param map Pointer to the mapping.
+ */
+void confetti_file_unmap(confetti_file_map_t* const map);
+
+#pragma endregion
@@ -0,0 +1,258 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "confetti_hash_index.h"
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Spreads the bits of a user supplied hash so nearby hashes land in distant slots.
+ *
+ * @param hash The hash to mix.
+ *
+ * @return The mixed hash.
+ */
+static uint64_t confetti_hash_index_mix(uint64_t hash);
+
+/**
+ * @brief Moves every live entry of a hash index into a table of a new capacity.
+ *
+ * @param allocator Pointer to the allocator the index was allocated with.
+ * @param index Pointer to the index.
+ * @param capacity The new amount of slots, a power of two.
+ *
+ * @return `true` if the table was rebuilt, `false` if the allocation failed.
+ */
+static bool confetti_hash_index_rehash(const confetti_allocator_t* const allocator, confetti_hash_index_t* const index, const uint64_t capacity);
+
+/**
+ * @brief Marks every slot of a table as empty.
+ *
+ * @param entries Pointer to the slots.
+ * @param capacity The amount of slots.
+ */
+static void confetti_hash_index_empty(confetti_hash_index_entry_t* const entries, const uint64_t capacity);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static uint64_t confetti_hash_index_mix(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+
+static void confetti_hash_index_empty(confetti_hash_index_entry_t* const entries, const uint64_t capacity) {
+    for (uint64_t i = 0; i < capacity; i++) {
+        entries[i].hash = 0;
+        entries[i].stamp = CONFETTI_HASH_INDEX_EMPTY;
+        entries[i].item = NULL;
+    }
+}
+
+
+static bool confetti_hash_index_rehash(const confetti_allocator_t* const allocator, confetti_hash_index_t* const index, const uint64_t capacity) {
+    confetti_hash_index_entry_t* entries = (confetti_hash_index_entry_t*) allocator->allocate(
+        allocator->context, 
+        sizeof(confetti_hash_index_entry_t) * capacity
+    );
+
+    if (entries == NULL)
+        return false;
+
+    confetti_hash_index_empty(entries, capacity);
+
+    for (uint64_t i = 0; i < index->capacity; i++) {
+        const confetti_hash_index_entry_t* const entry = &index->entries[i];
+
+        if (entry->stamp == CONFETTI_HASH_INDEX_EMPTY || entry->stamp == CONFETTI_HASH_INDEX_TOMBSTONE)
+            continue;
+
+        uint64_t slot = confetti_hash_index_mix(entry->hash) & (capacity - 1);
+
+        while (entries[slot].stamp != CONFETTI_HASH_INDEX_EMPTY)
+            slot = (slot + 1) & (capacity - 1);
+
+        entries[slot] = *entry;
+    }
+
+    allocator->deallocate(allocator->context, index->entries, sizeof(confetti_hash_index_entry_t) * index->capacity);
+
+    index->entries = entries;
+    index->capacity = capacity;
+    index->tombstones = 0;
+
+    return true;
+}
+
+#pragma endregion
+
+// internal functions
+
+#pragma region internal functions
+
+bool confetti_hash_index_create(const confetti_allocator_t* const allocator, const uint64_t capacity, confetti_hash_index_t** indexOut) {
+    confetti_hash_index_t* index = (confetti_hash_index_t*) allocator->allocate(allocator->context, sizeof(confetti_hash_index_t));
+
+    if (index == NULL)
+        return false;
+
+    // keep the table at most half full for the expected amount of elements.
+    uint64_t slots = DEFAULT_CONFETTI_HASH_INDEX_CAPACITY;
+
+    while (slots < capacity * 2 && slots < ((uint64_t) 1 << 62))
+        slots <<= 1;
+
+    index->entries = (confetti_hash_index_entry_t*) allocator->allocate(allocator->context, sizeof(confetti_hash_index_entry_t) * slots);
+
+    if (index->entries == NULL) {
+        allocator->deallocate(allocator->context, index, sizeof(confetti_hash_index_t));
+        return false;
+    }
+
+    index->capacity = slots;
+    confetti_hash_index_clear(index);
+
+    *indexOut = index;
+    return true;
+}
+
+
+void confetti_hash_index_free(const confetti_allocator_t* const allocator, confetti_hash_index_t** index) {
+    if (*index == NULL)
+        return;
+
+    allocator->deallocate(allocator->context, (*index)->entries, sizeof(confetti_hash_index_entry_t) * (*index)->capacity);
+    (*index)->entries = NULL;
+
+    allocator->deallocate(allocator->context, *index, sizeof(confetti_hash_index_t));
+    *index = NULL;
+}
+
+
+void confetti_hash_index_clear(confetti_hash_index_t* const index) {
+    confetti_hash_index_empty(index->entries, index->capacity);
+
+    index->count = 0;
+    index->tombstones = 0;
+    index->base = 0;
+    index->stale = false;
+}
+
+
+bool confetti_hash_index_insert(
+    const confetti_allocator_t* const allocator, 
+    confetti_hash_index_t* const index, 
+    const uint64_t hash, 
+    const int64_t position, 
+    void* const item
+) {
+    // grow once three quarters of the slots are in use, or just drop the tombstones if they are to blame.
+    if ((index->count + index->tombstones + 1) * 4 > index->capacity * 3) {
+        uint64_t capacity = index->capacity;
+
+        while ((index->count + 1) * 2 > capacity)
+            capacity <<= 1;
+
+        if (!confetti_hash_index_rehash(allocator, index, capacity))
+            return false;
+    }
+
+    uint64_t slot = confetti_hash_index_mix(hash) & (index->capacity - 1);
+
+    while (index->entries[slot].stamp != CONFETTI_HASH_INDEX_EMPTY && index->entries[slot].stamp != CONFETTI_HASH_INDEX_TOMBSTONE)
+        slot = (slot + 1) & (index->capacity - 1);
+
+    if (index->entries[slot].stamp == CONFETTI_HASH_INDEX_TOMBSTONE)
+        index->tombstones--;
+
+    index->entries[slot].hash = hash;
+    index->entries[slot].stamp = index->base + position;
+    index->entries[slot].item = item;
+    index->count++;
+
+    return true;
+}
+
+
+bool confetti_hash_index_erase(confetti_hash_index_t* const index, const uint64_t hash, const int64_t position) {
+    const int64_t stamp = index->base + position;
+    uint64_t slot = confetti_hash_index_mix(hash) & (index->capacity - 1);
+
+    while (index->entries[slot].stamp != CONFETTI_HASH_INDEX_EMPTY) {
+        if (index->entries[slot].stamp == stamp && index->entries[slot].hash == hash) {
+            index->entries[slot].stamp = CONFETTI_HASH_INDEX_TOMBSTONE;
+            index->entries[slot].item = NULL;
+            index->count--;
+            index->tombstones++;
+
+            return true;
+        }
+
+        slot = (slot + 1) & (index->capacity - 1);
+    }
+
+    return false;
+}
+
+
+void confetti_hash_index_shift(confetti_hash_index_t* const index, const int64_t position, const int64_t amount) {
+    const int64_t stamp = index->base + position;
+
+    for (uint64_t slot = 0; slot < index->capacity; slot++) {
+        confetti_hash_index_entry_t* const entry = &index->entries[slot];
+
+        if (entry->stamp != CONFETTI_HASH_INDEX_EMPTY && entry->stamp != CONFETTI_HASH_INDEX_TOMBSTONE && entry->stamp >= stamp)
+            entry->stamp += amount;
+    }
+}
+
+
+const confetti_hash_index_entry_t* confetti_hash_index_probe(const confetti_hash_index_t* const index, const uint64_t hash, uint64_t* const cursor) {
+    const uint64_t start = confetti_hash_index_mix(hash);
+
+    while (*cursor < index->capacity) {
+        const confetti_hash_index_entry_t* const entry = &index->entries[(start + *cursor) & (index->capacity - 1)];
+        (*cursor)++;
+
+        if (entry->stamp == CONFETTI_HASH_INDEX_EMPTY)
+            break;
+        else if (entry->stamp != CONFETTI_HASH_INDEX_TOMBSTONE && entry->hash == hash)
+            return entry;
+    }
+
+    *cursor = index->capacity;
+    return NULL;
+}
+
+
+int64_t confetti_hash_index_position(const confetti_hash_index_t* const index, const confetti_hash_index_entry_t* const entry) {
+    return entry->stamp - index->base;
+}
+
+#pragma endregion
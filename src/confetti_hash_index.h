@@ -0,0 +1,161 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Headers
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_allocator.h"
+
+// constant definitions
+
+#define CONFETTI_HASH_INDEX_EMPTY INT64_MIN             // Stamp of a slot that never held an entry.
+#define CONFETTI_HASH_INDEX_TOMBSTONE (INT64_MIN + 1)   // Stamp of a slot whose entry was erased.
+#define DEFAULT_CONFETTI_HASH_INDEX_CAPACITY ((uint64_t) 16) // The smallest amount of slots of an index.
+
+// struct definitions
+
+// define all structs early to avoid errors relating to one of these structs not existing.
+typedef struct confetti_hash_index confetti_hash_index_t;
+typedef struct confetti_hash_index_entry confetti_hash_index_entry_t;
+
+/**
+ * @brief Represents one element of a container tracked by a hash index.
+ *
+ * Positions are stored as stamps relative to the index's `base`, so elements 
+ * added or removed at the front of a container don't require touching every entry.
+ */
+typedef struct confetti_hash_index_entry {
+    uint64_t hash; /* Hash of the element's value. */
+    int64_t stamp; /* Position of the element plus the index's base, or one of the reserved stamps. */
+    void* item;    /* Container specific handle of the element, such as its node. */
+} confetti_hash_index_entry_t;
+
+/**
+ * @brief Represents an open addressing hash index over the elements of a container.
+ *
+ * This is shared by the containers of confetti and is not part of the public api.
+ * Every element has its own entry, duplicates included, found through linear probing.
+ */
+typedef struct confetti_hash_index {
+    confetti_hash_index_entry_t* entries; /* Slots of the table, a power of two in amount. */
+    uint64_t capacity;                    /* Amount of slots in the table. */
+    uint64_t count;                       /* Amount of live entries. */
+    uint64_t tombstones;                  /* Amount of erased slots that still break probe chains. */
+    int64_t base;                         /* Stamp of the element at position 0. */
+    bool stale;                           /* Whether the entries no longer match the container. */
+} confetti_hash_index_t;
+
+// private function definitions
+
+#pragma region internal function definitions
+
+/**
+ * @brief Creates a new, empty hash index.
+ *
+ * @param allocator Pointer to the allocator the index is allocated with.
+ * @param capacity The amount of elements the index should hold without growing.
+ * @param indexOut Double pointer to where the created index will be stored.
+ *
+ * @return `true` if the index was created, `false` if the allocation failed.
+ */
+bool confetti_hash_index_create(const confetti_allocator_t* const allocator, const uint64_t capacity, confetti_hash_index_t** indexOut);
+
+/**
+ * @brief Frees a hash index.
+ *
+ * @param allocator Pointer to the allocator the index was allocated with.
+ * @param index Double pointer to the index, which is set to NULL.
+ */
+void confetti_hash_index_free(const confetti_allocator_t* const allocator, confetti_hash_index_t** index);
+
+/**
+ * @brief Removes every entry of a hash index and marks it as up to date.
+ *
+ * @param index Pointer to the index.
+ */
+void confetti_hash_index_clear(confetti_hash_index_t* const index);
+
+/**
+ * @brief Adds the entry of an element to a hash index, growing it if needed.
+ *
+ * @param allocator Pointer to the allocator the index was allocated with.
+ * @param index Pointer to the index.
+ * @param hash The hash of the element's value.
+ * @param position The position of the element in its container.
+ * @param item The container specific handle of the element.
+ *
+ * @return `true` if the entry was added, `false` if growing the index failed.
+ */
+bool confetti_hash_index_insert(
+    const confetti_allocator_t* const allocator, 
+    confetti_hash_index_t* const index, 
+    const uint64_t hash, 
+    const int64_t position, 
+    void* const item
+);
+
+/**
+ * @brief Removes the entry of an element from a hash index.
+ *
+ * @param index Pointer to the index.
+ * @param hash The hash of the element's value.
+ * @param position The position of the element in its container.
+ *
+ * @return `true` if the entry was found and removed, otherwise `false`.
+ */
+bool confetti_hash_index_erase(confetti_hash_index_t* const index, const uint64_t hash, const int64_t position);
+
+/**
+ * @brief Moves every entry at or after a position by an amount of positions.
+ *
+ * Keeps the index up to date when elements are added or removed in the middle 
+ * of a container, every slot of the table is visited and nothing is rehashed.
+ *
+ * @param index Pointer to the index.
+ * @param position The position of the first entry to move.
+ * @param amount The amount of positions to move the entries by, negative to move them down.
+ */
+void confetti_hash_index_shift(confetti_hash_index_t* const index, const int64_t position, const int64_t amount);
+
+/**
+ * @brief Returns the next live entry with a given hash.
+ *
+ * @param index Pointer to the index.
+ * @param hash The hash to look for.
+ * @param cursor Pointer to the probe position, which must start at 0.
+ *
+ * @return A pointer to the next entry with the hash, or NULL once there are no more.
+ */
+const confetti_hash_index_entry_t* confetti_hash_index_probe(const confetti_hash_index_t* const index, const uint64_t hash, uint64_t* const cursor);
+
+/**
+ * @brief Returns the position of an entry within its container.
+ *
+ * @param index Pointer to the index.
+ * @param entry Pointer to a live entry of the index.
+ *
+ * @return The position of the element.
+ */
+int64_t confetti_hash_index_position(const confetti_hash_index_t* const index, const confetti_hash_index_entry_t* const entry);
+
+#pragma endregion
@@ -0,0 +1,406 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "confetti_search.h"
+
+// constant definitions
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define CONFETTI_SEARCH_SSE2 // SSE2 is always available on the target, 16 bytes are compared at once.
+    #include <emmintrin.h>
+
+    #if defined(__GNUC__) || defined(__clang__)
+        #define CONFETTI_SEARCH_AVX2 // AVX2 kernels are compiled in and picked if the cpu supports them, 32 bytes are compared at once.
+        #include <immintrin.h>
+    #endif
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+    #define CONFETTI_SEARCH_NEON // NEON is always available on the target, 16 bytes are compared at once.
+    #include <arm_neon.h>
+#endif
+
+#if defined(CONFETTI_SEARCH_SSE2) || defined(CONFETTI_SEARCH_NEON)
+    #define CONFETTI_SEARCH_VECTORIZED // Some vector kernel is compiled in, otherwise every search is scalar.
+#endif
+
+// private function definitions
+
+#pragma region private function definitions
+
+#if defined(CONFETTI_SEARCH_VECTORIZED)
+
+/**
+ * @brief Reduces a mask holding one bit per byte to one bit per matching element.
+ *
+ * @param mask The byte mask, bit `i` set if byte `i` of the block matched the key.
+ * @param width The size in bytes of every element.
+ *
+ * @return A mask with the bit of an element's first byte set if all of its bytes matched.
+ */
+static uint32_t confetti_search_fold(uint32_t mask, const uint64_t width);
+
+/**
+ * @brief Returns the index of the highest set bit of a non zero mask.
+ *
+ * @param mask The mask.
+ *
+ * @return The index of the highest set bit.
+ */
+static uint32_t confetti_search_highest_bit(const uint32_t mask);
+
+/**
+ * @brief Fills a buffer with copies of a key, so it can be compared against a whole vector at once.
+ *
+ * @param pattern Pointer to the buffer of `2 * CONFETTI_SEARCH_MAX_WIDTH` bytes.
+ * @param key Pointer to the key.
+ * @param width The size in bytes of the key.
+ */
+static void confetti_search_pattern(uint8_t* const pattern, const void* const key, const uint64_t width);
+
+#endif
+
+/**
+ * @brief Scans elements forward one at a time.
+ *
+ * @param data Pointer to the first element.
+ * @param start The index of the first element to compare.
+ * @param count The amount of elements.
+ * @param width The size in bytes of every element.
+ * @param key Pointer to the key.
+ *
+ * @return The index of the first matching element at or after `start`, or -1 if there is none.
+ */
+static int64_t confetti_search_first_scalar(const uint8_t* const data, const int64_t start, const int64_t count, const uint64_t width, const void* const key);
+
+/**
+ * @brief Scans elements backward one at a time.
+ *
+ * @param data Pointer to the first element.
+ * @param start The index of the first element to compare.
+ * @param end The index one past the element the scan starts at.
+ * @param width The size in bytes of every element.
+ * @param key Pointer to the key.
+ *
+ * @return The index of the last matching element between `start` and `end`, or -1 if there is none.
+ */
+static int64_t confetti_search_last_scalar(const uint8_t* const data, const int64_t start, const int64_t end, const uint64_t width, const void* const key);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+#if defined(CONFETTI_SEARCH_VECTORIZED)
+
+static uint32_t confetti_search_fold(uint32_t mask, const uint64_t width) {
+    // after folding, bit i covers bytes i to i + width - 1, only the bits where elements start are kept.
+    static const uint32_t starts[] = { 0xFFFFFFFFu, 0x55555555u, 0x11111111u, 0x01010101u, 0x00010001u };
+    uint32_t level = 0;
+
+    for (uint64_t span = 1; span < width; span <<= 1) {
+        mask &= mask >> span;
+        level++;
+    }
+
+    return mask & starts[level];
+}
+
+
+static uint32_t confetti_search_highest_bit(const uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 31u - (uint32_t) __builtin_clz(mask);
+#else
+    uint32_t bit = 31;
+
+    while ((mask & ((uint32_t) 1 << bit)) == 0)
+        bit--;
+
+    return bit;
+#endif
+}
+
+
+static void confetti_search_pattern(uint8_t* const pattern, const void* const key, const uint64_t width) {
+    for (uint64_t i = 0; i < 2 * CONFETTI_SEARCH_MAX_WIDTH; i += width)
+        memcpy(pattern + i, key, width);
+}
+
+#endif
+
+
+static int64_t confetti_search_first_scalar(const uint8_t* const data, const int64_t start, const int64_t count, const uint64_t width, const void* const key) {
+    for (int64_t i = start; i < count; i++) {
+        if (memcmp(data + width * (uint64_t) i, key, width) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+
+static int64_t confetti_search_last_scalar(const uint8_t* const data, const int64_t start, const int64_t end, const uint64_t width, const void* const key) {
+    for (int64_t i = end - 1; i >= start; i--) {
+        if (memcmp(data + width * (uint64_t) i, key, width) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+#if defined(CONFETTI_SEARCH_SSE2)
+
+/**
+ * @brief Compares 16 bytes against the pattern using SSE2.
+ *
+ * @param block Pointer to the bytes to compare.
+ * @param pattern The repeated key.
+ *
+ * @return The byte mask of the comparison.
+ */
+static uint32_t confetti_search_mask_sse2(const uint8_t* const block, const __m128i pattern) {
+    const __m128i chunk = _mm_loadu_si128((const __m128i*) block);
+
+    return (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, pattern));
+}
+
+#endif
+
+#if defined(CONFETTI_SEARCH_AVX2)
+
+/**
+ * @brief Compares 32 bytes against the pattern using AVX2.
+ *
+ * @param block Pointer to the bytes to compare.
+ * @param pattern The repeated key.
+ *
+ * @return The byte mask of the comparison.
+ */
+__attribute__((target("avx2")))
+static uint32_t confetti_search_mask_avx2(const uint8_t* const block, const __m256i pattern) {
+    const __m256i chunk = _mm256_loadu_si256((const __m256i*) block);
+
+    return (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, pattern));
+}
+
+
+/**
+ * @brief Finds the first match 32 bytes at a time using AVX2.
+ *
+ * @param data Pointer to the first element.
+ * @param count The amount of elements.
+ * @param width The size in bytes of every element.
+ * @param key Pointer to the key.
+ * @param pattern The repeated key.
+ *
+ * @return The index of the first match, or -1 if there is none.
+ */
+__attribute__((target("avx2")))
+static int64_t confetti_search_first_avx2(const uint8_t* const data, const int64_t count, const uint64_t width, const void* const key, const uint8_t* const pattern) {
+    const __m256i vector = _mm256_loadu_si256((const __m256i*) pattern);
+    const int64_t perVector = (int64_t) (32 / width);
+    int64_t i = 0;
+
+    for (; i + perVector <= count; i += perVector) {
+        const uint32_t mask = confetti_search_fold(confetti_search_mask_avx2(data + width * (uint64_t) i, vector), width);
+
+        if (mask != 0)
+            return i + (int64_t) (confetti_search_lowest_bit(mask) / width);
+    }
+
+    return confetti_search_first_scalar(data, i, count, width, key);
+}
+
+
+/**
+ * @brief Finds the last match 32 bytes at a time using AVX2.
+ *
+ * @param data Pointer to the first element.
+ * @param count The amount of elements.
+ * @param width The size in bytes of every element.
+ * @param key Pointer to the key.
+ * @param pattern The repeated key.
+ *
+ * @return The index of the last match, or -1 if there is none.
+ */
+__attribute__((target("avx2")))
+static int64_t confetti_search_last_avx2(const uint8_t* const data, const int64_t count, const uint64_t width, const void* const key, const uint8_t* const pattern) {
+    const __m256i vector = _mm256_loadu_si256((const __m256i*) pattern);
+    const int64_t perVector = (int64_t) (32 / width);
+    int64_t i = count - count % perVector;
+    int64_t found = confetti_search_last_scalar(data, i, count, width, key);
+
+    if (found != -1)
+        return found;
+
+    while (i > 0) {
+        i -= perVector;
+
+        const uint32_t mask = confetti_search_fold(confetti_search_mask_avx2(data + width * (uint64_t) i, vector), width);
+
+        if (mask != 0)
+            return i + (int64_t) (confetti_search_highest_bit(mask) / width);
+    }
+
+    return -1;
+}
+
+#endif
+
+#if defined(CONFETTI_SEARCH_NEON)
+
+/**
+ * @brief Compares 16 bytes against the pattern using NEON.
+ *
+ * @param block Pointer to the bytes to compare.
+ * @param pattern The repeated key.
+ *
+ * @return The byte mask of the comparison.
+ */
+static uint32_t confetti_search_mask_neon(const uint8_t* const block, const uint8x16_t pattern) {
+    static const uint8_t weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t bits = vandq_u8(vceqq_u8(vld1q_u8(block), pattern), vld1q_u8(weights));
+
+    return (uint32_t) vaddv_u8(vget_low_u8(bits)) | ((uint32_t) vaddv_u8(vget_high_u8(bits)) << 8);
+}
+
+#endif
+
+#pragma endregion
+
+// internal functions
+
+#pragma region internal functions
+
+uint32_t confetti_search_lowest_bit(const uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t) __builtin_ctz(mask);
+#else
+    uint32_t bit = 0;
+
+    while ((mask & ((uint32_t) 1 << bit)) == 0)
+        bit++;
+
+    return bit;
+#endif
+}
+
+
+bool confetti_search_supports(const uint64_t width) {
+    return width == 1 || width == 2 || width == 4 || width == 8 || width == 16;
+}
+
+
+int64_t confetti_search_first(const uint8_t* const data, const int64_t count, const uint64_t width, const void* const key) {
+#if defined(CONFETTI_SEARCH_VECTORIZED)
+    uint8_t pattern[2 * CONFETTI_SEARCH_MAX_WIDTH];
+    confetti_search_pattern(pattern, key, width);
+
+    #if defined(CONFETTI_SEARCH_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        return confetti_search_first_avx2(data, count, width, key, pattern);
+    #endif
+
+    const int64_t perVector = (int64_t) (16 / width);
+    int64_t i = 0;
+
+    #if defined(CONFETTI_SEARCH_SSE2)
+    const __m128i vector = _mm_loadu_si128((const __m128i*) pattern);
+    #else
+    const uint8x16_t vector = vld1q_u8(pattern);
+    #endif
+
+    for (; i + perVector <= count; i += perVector) {
+    #if defined(CONFETTI_SEARCH_SSE2)
+        const uint32_t mask = confetti_search_fold(confetti_search_mask_sse2(data + width * (uint64_t) i, vector), width);
+    #else
+        const uint32_t mask = confetti_search_fold(confetti_search_mask_neon(data + width * (uint64_t) i, vector), width);
+    #endif
+
+        if (mask != 0)
+            return i + (int64_t) (confetti_search_lowest_bit(mask) / width);
+    }
+
+    return confetti_search_first_scalar(data, i, count, width, key);
+#else
+    return confetti_search_first_scalar(data, 0, count, width, key);
+#endif
+}
+
+
+int64_t confetti_search_last(const uint8_t* const data, const int64_t count, const uint64_t width, const void* const key) {
+#if defined(CONFETTI_SEARCH_VECTORIZED)
+    uint8_t pattern[2 * CONFETTI_SEARCH_MAX_WIDTH];
+    confetti_search_pattern(pattern, key, width);
+
+    #if defined(CONFETTI_SEARCH_AVX2)
+    if (__builtin_cpu_supports("avx2"))
+        return confetti_search_last_avx2(data, count, width, key, pattern);
+    #endif
+
+    // the elements that don't fill a whole vector are at the end, so they are compared first.
+    const int64_t perVector = (int64_t) (16 / width);
+    int64_t i = count - count % perVector;
+    int64_t found = confetti_search_last_scalar(data, i, count, width, key);
+
+    if (found != -1)
+        return found;
+
+    #if defined(CONFETTI_SEARCH_SSE2)
+    const __m128i vector = _mm_loadu_si128((const __m128i*) pattern);
+    #else
+    const uint8x16_t vector = vld1q_u8(pattern);
+    #endif
+
+    while (i > 0) {
+        i -= perVector;
+
+    #if defined(CONFETTI_SEARCH_SSE2)
+        const uint32_t mask = confetti_search_fold(confetti_search_mask_sse2(data + width * (uint64_t) i, vector), width);
+    #else
+        const uint32_t mask = confetti_search_fold(confetti_search_mask_neon(data + width * (uint64_t) i, vector), width);
+    #endif
+
+        if (mask != 0)
+            return i + (int64_t) (confetti_search_highest_bit(mask) / width);
+    }
+
+    return -1;
+#else
+    return confetti_search_last_scalar(data, 0, count, width, key);
+#endif
+}
+
+
+uint32_t confetti_search_group(const uint8_t* const group, const uint8_t byte) {
+#if defined(CONFETTI_SEARCH_SSE2)
+    return confetti_search_mask_sse2(group, _mm_set1_epi8((char) byte));
+#elif defined(CONFETTI_SEARCH_NEON)
+    return confetti_search_mask_neon(group, vdupq_n_u8(byte));
+#else
+    uint32_t mask = 0;
+
+    for (uint32_t i = 0; i < CONFETTI_SEARCH_GROUP_WIDTH; i++) {
+        if (group[i] == byte)
+            mask |= (uint32_t) 1 << i;
+    }
+
+    return mask;
+#endif
+}
+
+#pragma endregion
@@ -0,0 +1,94 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Headers
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+// constant definitions
+
+#define CONFETTI_SEARCH_MAX_WIDTH ((uint64_t) 16) // The widest element the vectorized search kernels handle.
+#define CONFETTI_SEARCH_GROUP_WIDTH ((uint64_t) 16) // The amount of bytes `confetti_search_group` compares at once.
+
+// private function definitions
+
+#pragma region internal function definitions
+
+/**
+ * @brief Returns whether the search kernels handle elements of a given width.
+ *
+ * @param width The size in bytes of every element.
+ *
+ * @return `true` for widths of 1, 2, 4, 8 and 16 bytes, otherwise `false`.
+ */
+bool confetti_search_supports(const uint64_t width);
+
+/**
+ * @brief Finds the first element of a contiguous array that is bytewise equal to a key.
+ *
+ * The widest vector instructions the cpu supports are picked at runtime.
+ *
+ * @param data Pointer to the first element.
+ * @param count The amount of elements.
+ * @param width The size in bytes of every element, one `confetti_search_supports` accepts.
+ * @param key Pointer to `width` bytes to look for.
+ *
+ * @return The index of the first matching element, or -1 if there is none.
+ */
+int64_t confetti_search_first(const uint8_t* const data, const int64_t count, const uint64_t width, const void* const key);
+
+/**
+ * @brief Finds the last element of a contiguous array that is bytewise equal to a key.
+ *
+ * The array is scanned backward from its end and the scan stops at the first match.
+ *
+ * @param data Pointer to the first element.
+ * @param count The amount of elements.
+ * @param width The size in bytes of every element, one `confetti_search_supports` accepts.
+ * @param key Pointer to `width` bytes to look for.
+ *
+ * @return The index of the last matching element, or -1 if there is none.
+ */
+int64_t confetti_search_last(const uint8_t* const data, const int64_t count, const uint64_t width, const void* const key);
+
+/**
+ * @brief Compares a group of `CONFETTI_SEARCH_GROUP_WIDTH` bytes against a single byte.
+ *
+ * This is the probing kernel of open addressing tables keeping one control byte per slot.
+ *
+ * @param group Pointer to the bytes to compare, which don't need to be aligned.
+ * @param byte The byte to look for.
+ *
+ * @return A mask with bit `i` set if byte `i` of the group is equal to the byte.
+ */
+uint32_t confetti_search_group(const uint8_t* const group, const uint8_t byte);
+
+/**
+ * @brief Returns the index of the lowest set bit of a non zero mask.
+ *
+ * @param mask The mask.
+ *
+ * @return The index of the lowest set bit.
+ */
+uint32_t confetti_search_lowest_bit(const uint32_t mask);
+
+#pragma endregion
@@ -0,0 +1,1404 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "dlist.h"
+
+// constant definitions
+
+#define DLIST_MERGE_SLOTS 64 // Pending slot i of the merge sort holds 2^i runs, so 64 slots cover any list.
+
+// private struct definitions
+
+/**
+ * @brief The layout of the single allocation backing every doubly linked list node.
+ *
+ * The element lives right after the node and values small enough to fit are
+ * stored inline after the element, so the element's value points at `value`.
+ */
+typedef struct dlist_node_block {
+    dlist_node_t node;                          /* The node itself. */
+    dlist_element_t element;                    /* The element of the node. */
+    uint8_t value[DLIST_INLINE_VALUE_CAPACITY]; /* Storage for values that fit inline. */
+} dlist_node_block_t;
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Creates a new unlinked doubly linked list node.
+ *
+ * This function allocates a new node along with its element in a single block.
+ * Values of at most `DLIST_INLINE_VALUE_CAPACITY` bytes are copied into the block 
+ * itself, larger values are copied into a separately allocated memory region.
+ *
+ * @param allocator Pointer to the allocator the node is allocated with.
+ * @param nodeOut Pointer to where the newly allocated node will be stored.
+ * @param value Pointer to the data to be copied into the node's element, or NULL for no value.
+ * @param size Size in bytes of the value to be copied.
+ *
+ * @return
+ * - `DLIST_SUCCESS` if the node was successfully created.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if memory allocation failed.
+ */
+static dlist_result_t dlist_node_create(
+    const confetti_allocator_t* const allocator, 
+    dlist_node_t** nodeOut, 
+    const void* const value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Frees the memory associated with a doubly linked list node.
+ *
+ * @param allocator Pointer to the allocator the node was allocated with.
+ * @param node Pointer to the node pointer to be freed.
+ *
+ * @return
+ * - `DLIST_SUCCESS` if the node was successfully freed.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the node pointer is NULL.
+ * 
+ * @note The node must already be unlinked, its links are not updated.
+ */
+static dlist_result_t dlist_node_free(const confetti_allocator_t* const allocator, dlist_node_t** node);
+
+/**
+ * @brief Links a node into the doubly linked list before another node.
+ *
+ * @param dlist Pointer to the doubly linked list.
+ * @param node Pointer to the unlinked node to link in.
+ * @param before Pointer to the node the new node is linked before, or NULL to link it in as the tail.
+ */
+static void dlist_node_link(dlist_t* const dlist, dlist_node_t* const node, dlist_node_t* const before);
+
+/**
+ * @brief Unlinks a node from the doubly linked list without freeing it.
+ *
+ * @param dlist Pointer to the doubly linked list.
+ * @param node Pointer to the node to unlink.
+ */
+static void dlist_node_unlink(dlist_t* const dlist, dlist_node_t* const node);
+
+/**
+ * @brief Retrieves the node at an index, walking from whichever end is closer.
+ *
+ * @param dlist Pointer to the doubly linked list.
+ * @param index Index of the node, assumed to be in range.
+ *
+ * @return Pointer to the node at the index.
+ */
+static dlist_node_t* dlist_node_get(const dlist_t* const dlist, const int64_t index);
+
+/**
+ * @brief Creates a deep clone of a doubly linked list element.
+ *
+ * The value of the clone is stored in the same allocation as the clone.
+ *
+ * @param allocator Pointer to the allocator the clone is allocated with.
+ * @param element Pointer to the element to clone.
+ * @param elementOut Pointer to where the cloned element will be stored.
+ *
+ * @return
+ * - `DLIST_SUCCESS` if the element was successfully cloned.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+static dlist_result_t dlist_element_clone(
+    const confetti_allocator_t* const allocator, 
+    const dlist_element_t* const element, 
+    dlist_element_t** elementOut
+);
+
+/**
+ * @brief Frees a standalone doubly linked list element allocated with a specific allocator.
+ *
+ * @param allocator Pointer to the allocator the element was allocated with.
+ * @param element Double pointer to the element to be freed.
+ *
+ * @return
+ * - `DLIST_SUCCESS` if the element was successfully freed.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the element pointer is NULL.
+ */
+static dlist_result_t dlist_element_release(const confetti_allocator_t* const allocator, dlist_element_t** element);
+
+/**
+ * @brief Checks whether an element's value is stored directly after the element.
+ *
+ * @param element Pointer to the element to check.
+ *
+ * @return `true` if the value is stored inline, otherwise `false`.
+ */
+static bool dlist_element_is_inline(const dlist_element_t* const element);
+
+/**
+ * @brief Sets the value of an element living inside a node.
+ *
+ * Values that fit are stored inline in the node's block, otherwise the separately 
+ * allocated memory is (re)allocated accordingly.
+ *
+ * @param allocator Pointer to the allocator the node was allocated with.
+ * @param element Pointer to the element whose value will be set.
+ * @param value Pointer to the new value, or NULL to zero the value.
+ * @param size Size in bytes of the new value.
+ *
+ * @return
+ * - `DLIST_SUCCESS` if the value was successfully set.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if memory allocation or reallocation fails.
+ */
+static dlist_result_t dlist_element_set(
+    const confetti_allocator_t* const allocator, 
+    dlist_element_t* const element, 
+    const void* value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Default equality comparison function for memory blocks.
+ *
+ * If both pointers are NULL they are considered equal, if only one is NULL the 
+ * non-null value is considered greater, otherwise `memcmp` is used to compare them.
+ *
+ * @param data1 Pointer to the first data block.
+ * @param data2 Pointer to the second data block.
+ * @param size Number of bytes to compare.
+ *
+ * @return `0` if the blocks are equal, a negative value if `data1` is less 
+ * than `data2` and a positive value if `data1` is greater than `data2`.
+ */
+static int32_t default_equals(const void* const data1, const void* const data2, const uint64_t size);
+
+/**
+ * @brief Compares the elements of two nodes in the requested sorting order.
+ *
+ * @param equalityFunction Pointer to a function that compares two element values.
+ * @param node1 Pointer to the first node.
+ * @param node2 Pointer to the second node.
+ * @param ascending If `true`, ascending order is requested; otherwise, descending.
+ *
+ * @return A negative value if the first node must come before the second, 
+ * a positive value if it must come after it and `0` if their order does not matter.
+ */
+static int32_t dlist_node_order(
+    dlist_custom_equality_function_t* const equalityFunction, 
+    const dlist_node_t* const node1, 
+    const dlist_node_t* const node2, 
+    const bool ascending
+);
+
+/**
+ * @brief Merges two sorted chains into a single sorted chain along their `next` links.
+ *
+ * The merge is stable, nodes of the first chain come first when elements are equal.
+ *
+ * @param first Pointer to the head of the first sorted chain.
+ * @param firstTail Pointer to the tail of the first sorted chain.
+ * @param second Pointer to the head of the second sorted chain.
+ * @param secondTail Pointer to the tail of the second sorted chain.
+ * @param ascending If `true`, the merge will be in ascending order; otherwise, descending.
+ * @param equalityFunction Pointer to a function that compares two element values.
+ * @param tailOut Pointer to where the tail of the merged chain will be stored.
+ *
+ * @return Pointer to the head of the merged chain.
+ */
+static dlist_node_t* merge(
+    dlist_node_t* first, 
+    dlist_node_t* const firstTail, 
+    dlist_node_t* second, 
+    dlist_node_t* const secondTail, 
+    const bool ascending,
+    dlist_custom_equality_function_t* const equalityFunction,
+    dlist_node_t** tailOut
+);
+
+/**
+ * @brief Detaches the run of already sorted nodes at the start of a chain.
+ *
+ * Runs in the requested order are taken as they are, while strictly reversed 
+ * runs are reversed in place, which keeps equal elements in their original order.
+ *
+ * @param head Pointer to the head of the chain, which must not be NULL.
+ * @param ascending If `true`, ascending runs are detected; otherwise, descending runs.
+ * @param equalityFunction Pointer to a function that compares two element values.
+ * @param runTailOut Pointer to where the tail of the detached run will be stored.
+ * @param restOut Pointer to where the head of the remaining chain will be stored.
+ *
+ * @return Pointer to the head of the detached run.
+ */
+static dlist_node_t* merge_take_run(
+    dlist_node_t* const head, 
+    const bool ascending,
+    dlist_custom_equality_function_t* const equalityFunction,
+    dlist_node_t** runTailOut,
+    dlist_node_t** restOut
+);
+
+/**
+ * @brief Sorts a chain of nodes along their `next` links using a bottom-up natural merge sort.
+ *
+ * The `previous` links are left untouched and must be repaired by the caller.
+ *
+ * @param head Pointer to the head of the chain to be sorted.
+ * @param ascending If `true`, the sort will be in ascending order; otherwise, descending.
+ * @param equalityFunction Pointer to a function that compares two element values.
+ * @param tailOut Pointer to where the tail of the sorted chain will be stored.
+ *
+ * @return Pointer to the head of the sorted chain.
+ */
+static dlist_node_t* merge_sort(
+    dlist_node_t* const head, 
+    const bool ascending,
+    dlist_custom_equality_function_t* const equalityFunction,
+    dlist_node_t** tailOut
+);
+
+/**
+ * @brief Sorts a doubly linked list using the default sorting method.
+ *
+ * The nodes are sorted along their `next` links by `merge_sort`, after which 
+ * a single pass restores the `previous` links.
+ *
+ * @param dlist Pointer to the doubly linked list to be sorted.
+ * @param ascending If `true`, the sort will be in ascending order; otherwise, descending.
+ *
+ * @return 
+ * - `DLIST_SUCCESS` if the doubly linked list was successfully sorted.
+ */
+static dlist_result_t default_sort(dlist_t* const dlist, const bool ascending);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static dlist_result_t dlist_node_create(
+    const confetti_allocator_t* const allocator, 
+    dlist_node_t** nodeOut, 
+    const void* const value, 
+    const uint64_t size
+) {
+    dlist_node_block_t* block = (dlist_node_block_t*) allocator->allocate(allocator->context, DLIST_NODE_ALLOCATION_SIZE);
+
+    if (block == NULL)
+        return DLIST_ALLOCATION_FAILURE;
+
+    dlist_element_t* const element = &block->element;
+
+    element->size = size;
+    element->value = NULL;
+
+    if (value != NULL) {
+        element->value = size <= DLIST_INLINE_VALUE_CAPACITY 
+            ? block->value 
+            : allocator->allocate(allocator->context, size);
+
+        if (element->value == NULL) {
+            allocator->deallocate(allocator->context, block, DLIST_NODE_ALLOCATION_SIZE);
+            return DLIST_ALLOCATION_FAILURE;
+        }
+
+        memcpy(element->value, value, size);
+    }
+
+    dlist_node_t* const node = &block->node;
+
+    node->previous = NULL;
+    node->next = NULL;
+    node->element = element;
+
+    *nodeOut = node;
+    return DLIST_SUCCESS;
+}
+
+
+static dlist_result_t dlist_node_free(const confetti_allocator_t* const allocator, dlist_node_t** node) {
+    if (*node == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    dlist_element_t* const element = (*node)->element;
+
+    if (element != NULL && !dlist_element_is_inline(element))
+        allocator->deallocate(allocator->context, element->value, element->size);
+
+    (*node)->element = NULL;
+    (*node)->previous = NULL;
+    (*node)->next = NULL;
+
+    allocator->deallocate(allocator->context, *node, DLIST_NODE_ALLOCATION_SIZE);
+    (*node) = NULL;
+
+    return DLIST_SUCCESS;
+}
+
+
+static void dlist_node_link(dlist_t* const dlist, dlist_node_t* const node, dlist_node_t* const before) {
+    dlist_node_t* const after = before == NULL ? dlist->tail : before->previous;
+
+    node->previous = after;
+    node->next = before;
+
+    if (after != NULL)
+        after->next = node;
+    else
+        dlist->head = node;
+
+    if (before != NULL)
+        before->previous = node;
+    else
+        dlist->tail = node;
+
+    dlist->size++;
+}
+
+
+static void dlist_node_unlink(dlist_t* const dlist, dlist_node_t* const node) {
+    if (node->previous != NULL)
+        node->previous->next = node->next;
+    else
+        dlist->head = node->next;
+
+    if (node->next != NULL)
+        node->next->previous = node->previous;
+    else
+        dlist->tail = node->previous;
+
+    node->previous = NULL;
+    node->next = NULL;
+    dlist->size--;
+}
+
+
+static dlist_node_t* dlist_node_get(const dlist_t* const dlist, const int64_t index) {
+    dlist_node_t* node = NULL;
+
+    if (index < dlist->size / 2) {
+        node = dlist->head;
+
+        for (int64_t i = 0; i < index; i++)
+            node = node->next;
+    }
+    else {
+        node = dlist->tail;
+
+        for (int64_t i = dlist->size - 1; i > index; i--)
+            node = node->previous;
+    }
+
+    return node;
+}
+
+
+static dlist_result_t dlist_element_clone(
+    const confetti_allocator_t* const allocator, 
+    const dlist_element_t* const element, 
+    dlist_element_t** elementOut
+) {
+    const uint64_t valueSize = element->value != NULL ? element->size : 0;
+    dlist_element_t* elementClone = (dlist_element_t*) allocator->allocate(allocator->context, sizeof(dlist_element_t) + valueSize);
+
+    if (elementClone == NULL)
+        return DLIST_ALLOCATION_FAILURE;
+
+    elementClone->value = NULL;
+    elementClone->size = element->size;
+
+    if (element->value != NULL) {
+        elementClone->value = (void*) (elementClone + 1);
+        memcpy(elementClone->value, element->value, element->size);
+    }
+
+    *elementOut = elementClone;
+    return DLIST_SUCCESS;
+}
+
+
+static dlist_result_t dlist_element_release(const confetti_allocator_t* const allocator, dlist_element_t** element) {
+    if (*element == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    uint64_t allocationSize = sizeof(dlist_element_t);
+
+    if (dlist_element_is_inline(*element))
+        allocationSize += (*element)->size;
+    else
+        allocator->deallocate(allocator->context, (*element)->value, (*element)->size);
+
+    (*element)->size = 0;
+    (*element)->value = NULL;
+
+    allocator->deallocate(allocator->context, *element, allocationSize);
+    (*element) = NULL;
+
+    return DLIST_SUCCESS;
+}
+
+
+static bool dlist_element_is_inline(const dlist_element_t* const element) {
+    return element->value == (const void*) (element + 1);
+}
+
+
+static dlist_result_t dlist_element_set(
+    const confetti_allocator_t* const allocator, 
+    dlist_element_t* const element, 
+    const void* value, 
+    const uint64_t size
+) {
+    void* const inlineValue = (void*) (element + 1);
+
+    if (size <= DLIST_INLINE_VALUE_CAPACITY) {
+        if (element->value != NULL && element->value != inlineValue)
+            allocator->deallocate(allocator->context, element->value, element->size);
+
+        element->value = inlineValue;
+        element->size = size;
+    }
+    else if (size != element->size || element->value == NULL || element->value == inlineValue) {
+        void* newValue = element->value == NULL || element->value == inlineValue
+            ? allocator->allocate(allocator->context, size)
+            : allocator->reallocate(allocator->context, element->value, element->size, size);
+
+        if (newValue == NULL)
+            return DLIST_ALLOCATION_FAILURE;
+
+        element->value = newValue;
+        element->size = size;
+    }
+
+    if (value != NULL)
+        memcpy(element->value, value, size);
+    else
+        memset(element->value, 0, size);
+
+    return DLIST_SUCCESS;
+}
+
+
+static int32_t default_equals(const void* data1, const void* data2, uint64_t size) {
+    if (data1 == NULL && data2 != NULL)
+        return -1;
+    else if (data1 != NULL && data2 == NULL) 
+        return 1;
+    else if (data1 == NULL && data2 == NULL)
+        return 0;
+
+    return memcmp(data1, data2, size);
+}
+
+
+static int32_t dlist_node_order(
+    dlist_custom_equality_function_t* const equalityFunction, 
+    const dlist_node_t* const node1, 
+    const dlist_node_t* const node2, 
+    const bool ascending
+) {
+    int32_t equality = equalityFunction(node1->element->value, node2->element->value, node1->element->size);
+
+    if (equality == 0)
+        return 0;
+
+    return (equality > 0) == ascending ? 1 : -1;
+}
+
+
+static dlist_node_t* merge(
+    dlist_node_t* first, 
+    dlist_node_t* const firstTail, 
+    dlist_node_t* second, 
+    dlist_node_t* const secondTail, 
+    const bool ascending,
+    dlist_custom_equality_function_t* const equalityFunction,
+    dlist_node_t** tailOut
+) {
+    if (first == NULL) {
+        *tailOut = secondTail;
+        return second;
+    }
+    else if (second == NULL) {
+        *tailOut = firstTail;
+        return first;
+    }
+
+    // the chains are already in order.
+    if (dlist_node_order(equalityFunction, firstTail, second, ascending) <= 0) {
+        firstTail->next = second;
+        *tailOut = secondTail;
+
+        return first;
+    }
+
+    dlist_node_t head;
+    dlist_node_t* lastMergedNode = &head;
+
+    while (first != NULL && second != NULL) {
+        if (dlist_node_order(equalityFunction, first, second, ascending) <= 0) {
+            lastMergedNode->next = first;
+            first = first->next;
+        } else {
+            lastMergedNode->next = second;
+            second = second->next;
+        }
+
+        lastMergedNode = lastMergedNode->next;
+    }
+
+    if (first != NULL) {
+        lastMergedNode->next = first;
+        *tailOut = firstTail;
+    } 
+    else {
+        lastMergedNode->next = second;
+        *tailOut = secondTail;
+    }
+    
+    return head.next;
+}
+
+
+static dlist_node_t* merge_take_run(
+    dlist_node_t* const head, 
+    const bool ascending,
+    dlist_custom_equality_function_t* const equalityFunction,
+    dlist_node_t** runTailOut,
+    dlist_node_t** restOut
+) {
+    dlist_node_t* runHead = head;
+    dlist_node_t* runTail = head;
+    dlist_node_t* rest = head->next;
+
+    if (rest != NULL && dlist_node_order(equalityFunction, runTail, rest, ascending) > 0) {
+        // reverse the strictly reversed run while walking it.
+        runHead->next = NULL;
+
+        while (rest != NULL && dlist_node_order(equalityFunction, runHead, rest, ascending) > 0) {
+            dlist_node_t* next = rest->next;
+
+            rest->next = runHead;
+            runHead = rest;
+            rest = next;
+        }
+    }
+    else {
+        while (rest != NULL && dlist_node_order(equalityFunction, runTail, rest, ascending) <= 0) {
+            runTail = rest;
+            rest = rest->next;
+        }
+
+        runTail->next = NULL;
+    }
+
+    *runTailOut = runTail;
+    *restOut = rest;
+
+    return runHead;
+}
+
+
+static dlist_node_t* merge_sort(
+    dlist_node_t* const head, 
+    const bool ascending,
+    dlist_custom_equality_function_t* const equalityFunction,
+    dlist_node_t** tailOut
+) {
+    dlist_node_t* pending[DLIST_MERGE_SLOTS] = { NULL };
+    dlist_node_t* pendingTails[DLIST_MERGE_SLOTS] = { NULL };
+    int usedSlots = 0;
+
+    dlist_node_t* rest = head;
+
+    while (rest != NULL) {
+        dlist_node_t* runTail = NULL;
+        dlist_node_t* run = merge_take_run(rest, ascending, equalityFunction, &runTail, &rest);
+
+        int slot = 0;
+
+        // pending slots hold earlier nodes than the run, so they are merged in first.
+        while (slot < DLIST_MERGE_SLOTS - 1 && pending[slot] != NULL) {
+            run = merge(pending[slot], pendingTails[slot], run, runTail, ascending, equalityFunction, &runTail);
+            pending[slot] = NULL;
+            slot++;
+        }
+
+        if (pending[slot] != NULL)
+            run = merge(pending[slot], pendingTails[slot], run, runTail, ascending, equalityFunction, &runTail);
+
+        pending[slot] = run;
+        pendingTails[slot] = runTail;
+
+        if (slot + 1 > usedSlots)
+            usedSlots = slot + 1;
+    }
+
+    dlist_node_t* result = NULL;
+    dlist_node_t* resultTail = NULL;
+
+    for (int slot = 0; slot < usedSlots; slot++) {
+        if (pending[slot] != NULL)
+            result = merge(pending[slot], pendingTails[slot], result, resultTail, ascending, equalityFunction, &resultTail);
+    }
+
+    *tailOut = resultTail;
+    return result;
+}
+
+
+static dlist_result_t default_sort(dlist_t* const dlist, const bool ascending) {
+    dlist_node_t* newTail = NULL;
+    dlist_node_t* newHead = merge_sort(dlist->head, ascending, dlist->equalityFunction, &newTail);
+
+    // only the next links are merged, the previous links are restored in one pass.
+    dlist_node_t* previous = NULL;
+
+    for (dlist_node_t* node = newHead; node != NULL; node = node->next) {
+        node->previous = previous;
+        previous = node;
+    }
+
+    dlist->head = newHead;
+    dlist->tail = newTail;
+
+    return DLIST_SUCCESS;
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+dlist_result_t dlist_create(
+    dlist_t** dlistOut, 
+    dlist_custom_equality_function_t* const customEqualityFunction, 
+    dlist_custom_sorting_function_t* const customSortingFunction
+) {
+    dlist_options_t options = { customEqualityFunction, customSortingFunction, NULL };
+
+    return dlist_create_with_options(dlistOut, &options);
+}
+
+
+dlist_result_t dlist_create_with_options(dlist_t** dlistOut, const dlist_options_t* const options) {
+    if (options == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const allocator = options->allocator == NULL 
+        ? confetti_allocator_default() 
+        : options->allocator;
+
+    if (allocator->allocate == NULL || allocator->reallocate == NULL || allocator->deallocate == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    dlist_t* const dlist = (dlist_t*) allocator->allocate(allocator->context, sizeof(dlist_t));
+
+    if (dlist == NULL)
+        return DLIST_ALLOCATION_FAILURE;
+
+    dlist->head = NULL;
+    dlist->tail = NULL;
+    dlist->size = 0;
+    dlist->equalityFunction = options->equalityFunction == NULL 
+        ? (dlist_custom_equality_function_t*) &default_equals 
+        : options->equalityFunction;
+    dlist->sortingFunction = options->sortingFunction == NULL 
+        ? (dlist_custom_sorting_function_t*) &default_sort 
+        : options->sortingFunction;
+    dlist->allocator = *allocator;
+
+    *dlistOut = dlist;
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_free(dlist_t** dlist) {
+    if (*dlist == NULL)
+        return DLIST_NULL_ERROR;
+
+    dlist_result_t clearResult = dlist_clear(*dlist);
+
+    if (clearResult != DLIST_SUCCESS)
+        return clearResult;
+
+    confetti_allocator_t allocator = (*dlist)->allocator;
+
+    allocator.deallocate(allocator.context, *dlist, sizeof(dlist_t));
+    *dlist = NULL;
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_print(dlist_t* const dlist) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+
+    printf("[ ");
+
+    for (dlist_node_t* node = dlist->head; node != NULL; node = node->next) {
+        if (node->element->value != NULL)
+            printf(node->next != NULL ? "%p, " : "%p", node->element->value);
+        else
+            printf(node->next != NULL ? "NULL, " : "NULL");
+    }
+
+    printf(" ] -> %p\n", dlist);
+    
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_get(dlist_t* const dlist, dlist_element_t** elementOut, const int64_t index) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (index >= dlist->size || index < 0) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    dlist_node_t* const node = dlist_node_get(dlist, index);
+
+    return dlist_element_clone(confetti_allocator_default(), node->element, elementOut);
+}
+
+
+dlist_result_t dlist_peek(dlist_t* const dlist, const void** valueOut, uint64_t* const sizeOut, const int64_t index) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (index >= dlist->size || index < 0) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    dlist_node_t* const node = dlist_node_get(dlist, index);
+
+    *valueOut = node->element->value;
+
+    if (sizeOut != NULL)
+        *sizeOut = node->element->size;
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_set(dlist_t* const dlist, const int64_t index, void* const value, const uint64_t size) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (index >= dlist->size || index < 0) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    dlist_node_t* const node = dlist_node_get(dlist, index);
+
+    return dlist_element_set(&dlist->allocator, node->element, value, size);
+}
+
+
+dlist_result_t dlist_prepend(dlist_t* const dlist, void* const value, const uint64_t size) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+
+    dlist_node_t* node = NULL;
+    dlist_result_t nodeCreateResult = dlist_node_create(&dlist->allocator, &node, value, size);
+
+    if (nodeCreateResult != DLIST_SUCCESS)
+        return nodeCreateResult;
+
+    dlist_node_link(dlist, node, dlist->head);
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_append(dlist_t* const dlist, void* const value, const uint64_t size) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+
+    dlist_node_t* node = NULL;
+    dlist_result_t nodeCreateResult = dlist_node_create(&dlist->allocator, &node, value, size);
+
+    if (nodeCreateResult != DLIST_SUCCESS)
+        return nodeCreateResult;
+
+    dlist_node_link(dlist, node, NULL);
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_append_many(
+    dlist_t* const dlist, 
+    const void* const values, 
+    const uint64_t count, 
+    const uint64_t stride
+) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (stride == 0 || (values == NULL && count > 0) || count > (uint64_t) (INT64_MAX - dlist->size))
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    if (count == 0)
+        return DLIST_SUCCESS;
+
+    const uint8_t* const source = (const uint8_t*) values;
+    dlist_node_t* chainHead = NULL;
+    dlist_node_t* chainTail = NULL;
+
+    for (uint64_t i = 0; i < count; i++) {
+        dlist_node_t* node = NULL;
+        dlist_result_t nodeCreateResult = dlist_node_create(&dlist->allocator, &node, source + stride * i, stride);
+
+        if (nodeCreateResult != DLIST_SUCCESS) {
+            while (chainHead != NULL) {
+                dlist_node_t* nextNode = chainHead->next;
+
+                dlist_node_free(&dlist->allocator, &chainHead);
+                chainHead = nextNode;
+            }
+
+            return nodeCreateResult;
+        }
+
+        node->previous = chainTail;
+
+        if (chainHead == NULL)
+            chainHead = node;
+        else
+            chainTail->next = node;
+
+        chainTail = node;
+    }
+
+    chainHead->previous = dlist->tail;
+
+    if (dlist->head == NULL)
+        dlist->head = chainHead;
+    else
+        dlist->tail->next = chainHead;
+
+    dlist->tail = chainTail;
+    dlist->size += (int64_t) count;
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_insert(dlist_t* const dlist, const int64_t index, void* value, const uint64_t size) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (index > dlist->size || index < 0) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    dlist_node_t* node = NULL;
+    dlist_result_t nodeCreateResult = dlist_node_create(&dlist->allocator, &node, value, size);
+
+    if (nodeCreateResult != DLIST_SUCCESS)
+        return nodeCreateResult;
+
+    dlist_node_t* const before = index == dlist->size ? NULL : dlist_node_get(dlist, index);
+
+    dlist_node_link(dlist, node, before);
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_remove(dlist_t* const dlist, const uint64_t index) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (index >= (uint64_t) dlist->size) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    dlist_node_t* node = dlist_node_get(dlist, (int64_t) index);
+
+    return dlist_remove_node(dlist, &node);
+}
+
+
+dlist_result_t dlist_pop(dlist_t* const dlist, dlist_element_t** elementOut, const uint64_t index) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (index >= (uint64_t) dlist->size) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    dlist_node_t* node = dlist_node_get(dlist, (int64_t) index);
+    dlist_element_t* elementClone = NULL;
+    dlist_result_t cloneResult = dlist_element_clone(confetti_allocator_default(), node->element, &elementClone);
+
+    if (cloneResult != DLIST_SUCCESS)
+        return cloneResult;
+
+    dlist_result_t removeResult = dlist_remove_node(dlist, &node);
+
+    if (removeResult != DLIST_SUCCESS) {
+        dlist_element_free(&elementClone);
+        return removeResult;
+    }
+
+    *elementOut = elementClone;
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_take(dlist_t* const dlist, dlist_element_t** elementOut, const int64_t index) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (index >= dlist->size || index < 0) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    dlist_node_t* node = dlist_node_get(dlist, index);
+    const confetti_allocator_t* const defaultAllocator = confetti_allocator_default();
+    dlist_element_t* const element = node->element;
+
+    // inline values and values owned by another allocator can't be handed over.
+    if (
+        dlist->allocator.allocate != defaultAllocator->allocate 
+        || element->value == NULL 
+        || dlist_element_is_inline(element)
+    )
+        return dlist_pop(dlist, elementOut, (uint64_t) index);
+
+    dlist_element_t* const takenElement = (dlist_element_t*) defaultAllocator->allocate(defaultAllocator->context, sizeof(dlist_element_t));
+
+    if (takenElement == NULL)
+        return DLIST_ALLOCATION_FAILURE;
+
+    takenElement->value = element->value;
+    takenElement->size = element->size;
+    element->value = NULL;
+
+    dlist_result_t removeResult = dlist_remove_node(dlist, &node);
+
+    if (removeResult != DLIST_SUCCESS)
+        return removeResult;
+
+    *elementOut = takenElement;
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_clear(dlist_t* const dlist) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+
+    dlist_node_t* node = dlist->head;
+
+    while (node != NULL) {
+        dlist_node_t* nextNode = node->next;
+        dlist_result_t nodeFreeResult = dlist_node_free(&dlist->allocator, &node);
+
+        if (nodeFreeResult != DLIST_SUCCESS)
+            return nodeFreeResult;
+
+        node = nextNode;
+    }
+
+    dlist->head = NULL;
+    dlist->tail = NULL;
+    dlist->size = 0;
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_clone(dlist_t* const dlist, dlist_t** dlistOut) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+
+    dlist_options_t options = { dlist->equalityFunction, dlist->sortingFunction, &dlist->allocator };
+    dlist_t* dlistClone = NULL;
+    dlist_result_t createResult = dlist_create_with_options(&dlistClone, &options);
+
+    if (createResult != DLIST_SUCCESS)
+        return createResult;
+
+    for (dlist_node_t* node = dlist->head; node != NULL; node = node->next) {
+        dlist_node_t* nodeClone = NULL;
+        dlist_result_t nodeCreateResult = dlist_node_create(
+            &dlistClone->allocator, 
+            &nodeClone, 
+            node->element->value, 
+            node->element->size
+        );
+
+        if (nodeCreateResult != DLIST_SUCCESS) {
+            dlist_free(&dlistClone);
+            return nodeCreateResult;
+        }
+
+        dlist_node_link(dlistClone, nodeClone, NULL);
+    }
+
+    *dlistOut = dlistClone;
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_join(dlist_t* const dlist1, dlist_t* const dlist2, dlist_t** dlistOut) {
+    if (dlist1 == NULL || dlist2 == NULL)
+        return DLIST_NULL_ERROR;
+
+    dlist_t* dlistClone = NULL;
+    dlist_result_t cloneResult = dlist_clone(dlist1, &dlistClone);
+
+    if (cloneResult != DLIST_SUCCESS)
+        return cloneResult;
+
+    for (dlist_node_t* node = dlist2->head; node != NULL; node = node->next) {
+        dlist_node_t* nodeClone = NULL;
+        dlist_result_t nodeCreateResult = dlist_node_create(
+            &dlistClone->allocator, 
+            &nodeClone, 
+            node->element->value, 
+            node->element->size
+        );
+
+        if (nodeCreateResult != DLIST_SUCCESS) {
+            dlist_free(&dlistClone);
+            return nodeCreateResult;
+        }
+
+        dlist_node_link(dlistClone, nodeClone, NULL);
+    }
+
+    *dlistOut = dlistClone;
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_resize(dlist_t* const dlist, const uint64_t size) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+
+    if (size == (uint64_t) dlist->size) 
+        return DLIST_SUCCESS;
+
+    if (size == 0) 
+        return dlist_clear(dlist);
+    else if (size > (uint64_t) dlist->size) {
+        while ((uint64_t) dlist->size < size) {
+            dlist_result_t appendResult = dlist_append(dlist, NULL, sizeof(void*));
+
+            if (appendResult != DLIST_SUCCESS) 
+                return appendResult;
+        }
+    }
+    else {
+        // the excess nodes are freed from the tail, so no walk from the head is needed.
+        while ((uint64_t) dlist->size > size) {
+            dlist_node_t* node = dlist->tail;
+
+            dlist_node_unlink(dlist, node);
+            dlist_result_t nodeFreeResult = dlist_node_free(&dlist->allocator, &node);
+
+            if (nodeFreeResult != DLIST_SUCCESS)
+                return nodeFreeResult;
+        }
+    }
+
+    return DLIST_SUCCESS; 
+}
+
+
+dlist_result_t dlist_reverse(dlist_t* const dlist) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+
+    dlist_node_t* node = dlist->head;
+
+    while (node != NULL) {
+        dlist_node_t* nextNode = node->next;
+
+        node->next = node->previous;
+        node->previous = nextNode;
+        node = nextNode;
+    }
+
+    node = dlist->head;
+    dlist->head = dlist->tail;
+    dlist->tail = node;
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_includes(dlist_t* const dlist, void* const value, const uint64_t size) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+
+    for (dlist_node_t* node = dlist->head; node != NULL; node = node->next) {
+        if (dlist->equalityFunction(node->element->value, value, size) == 0) 
+            return DLIST_SUCCESS;
+    }
+    
+    return DLIST_ELEMENT_NOT_FOUND_ERROR;
+}
+
+
+dlist_result_t dlist_find_first(
+    dlist_t* const dlist, 
+    int64_t* const indexOut, 
+    const int64_t startFromIndex, 
+    void* const value, 
+    const uint64_t size
+) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (startFromIndex >= dlist->size || startFromIndex < 0) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    int64_t index = startFromIndex;
+
+    for (dlist_node_t* node = dlist_node_get(dlist, startFromIndex); node != NULL; node = node->next) {
+        if (dlist->equalityFunction(node->element->value, value, size) == 0) {
+            *indexOut = index;
+            return DLIST_SUCCESS;
+        }
+
+        index++;
+    }
+
+    *indexOut = -1;
+    return DLIST_ELEMENT_NOT_FOUND_ERROR;
+}
+
+
+dlist_result_t dlist_find_last(
+    dlist_t* const dlist, 
+    int64_t* const indexOut,
+    const int64_t startFromIndex, 
+    void* const value, 
+    const uint64_t size
+) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (startFromIndex >= dlist->size || startFromIndex < 0) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    int64_t index = dlist->size - 1;
+
+    for (dlist_node_t* node = dlist->tail; index >= startFromIndex; node = node->previous) {
+        if (dlist->equalityFunction(node->element->value, value, size) == 0) {
+            *indexOut = index;
+            return DLIST_SUCCESS;
+        }
+
+        index--;
+    }
+
+    *indexOut = -1;
+    return DLIST_ELEMENT_NOT_FOUND_ERROR;
+}
+
+
+dlist_result_t dlist_find_node(dlist_t* const dlist, dlist_node_t** nodeOut, void* const value, const uint64_t size) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+
+    for (dlist_node_t* node = dlist->head; node != NULL; node = node->next) {
+        if (dlist->equalityFunction(node->element->value, value, size) == 0) {
+            *nodeOut = node;
+            return DLIST_SUCCESS;
+        }
+    }
+
+    return DLIST_ELEMENT_NOT_FOUND_ERROR;
+}
+
+
+dlist_result_t dlist_node_at(dlist_t* const dlist, dlist_node_t** nodeOut, const int64_t index) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (index >= dlist->size || index < 0) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    *nodeOut = dlist_node_get(dlist, index);
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_remove_node(dlist_t* const dlist, dlist_node_t** node) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (node == NULL || *node == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    dlist_node_unlink(dlist, *node);
+
+    return dlist_node_free(&dlist->allocator, node);
+}
+
+
+dlist_result_t dlist_move_to_front(dlist_t* const dlist, dlist_node_t* const node) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (node == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    if (node == dlist->head)
+        return DLIST_SUCCESS;
+
+    dlist_node_unlink(dlist, node);
+    dlist_node_link(dlist, node, dlist->head);
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_move_to_back(dlist_t* const dlist, dlist_node_t* const node) {
+    if (dlist == NULL)
+        return DLIST_NULL_ERROR;
+    else if (node == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    if (node == dlist->tail)
+        return DLIST_SUCCESS;
+
+    dlist_node_unlink(dlist, node);
+    dlist_node_link(dlist, node, NULL);
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_sort(dlist_t* const dlist, const bool ascending) {
+    if (dlist == NULL) 
+        return DLIST_NULL_ERROR;
+    
+    if (dlist->size == 0 || dlist->size == 1) 
+        return DLIST_SUCCESS;
+
+    return dlist->sortingFunction(dlist, ascending);
+}
+
+
+dlist_result_t dlist_swap(dlist_t* const dlist, const int64_t index1, const int64_t index2) {
+    if (dlist == NULL) 
+        return DLIST_NULL_ERROR;
+    else if (index1 >= dlist->size || index1 < 0) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+    else if (index2 >= dlist->size || index2 < 0) 
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    if (index1 == index2) 
+        return DLIST_SUCCESS;
+
+    dlist_node_t* const first = dlist_node_get(dlist, index1 < index2 ? index1 : index2);
+    dlist_node_t* const second = dlist_node_get(dlist, index1 < index2 ? index2 : index1);
+
+    if (first->next == second) {
+        dlist_node_unlink(dlist, second);
+        dlist_node_link(dlist, second, first);
+    }
+    else {
+        dlist_node_t* const afterFirst = first->next;
+
+        dlist_node_unlink(dlist, first);
+        dlist_node_link(dlist, first, second);
+        dlist_node_unlink(dlist, second);
+        dlist_node_link(dlist, second, afterFirst);
+    }
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_element_free(dlist_element_t** element) {
+    return dlist_element_release(confetti_allocator_default(), element);
+}
+
+
+dlist_result_t dlist_iterator_create(dlist_iterator_t** iteratorOut, dlist_t* const list) {
+    if (list == NULL)
+        return DLIST_NULL_ERROR;
+
+    dlist_iterator_t* iterator = (dlist_iterator_t*) malloc(sizeof(dlist_iterator_t));
+
+    if (iterator == NULL)
+        return DLIST_ALLOCATION_FAILURE;
+
+    iterator->list = list;
+    iterator->node = NULL;
+    iterator->index = -1;
+
+    *iteratorOut = iterator;
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_iterator_next(dlist_iterator_t* const iterator) {
+    if (iterator == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    dlist_node_t* const node = iterator->node == NULL ? iterator->list->head : iterator->node->next;
+
+    if (node == NULL) {
+        iterator->node = NULL;
+        iterator->index = -1;
+
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+    }
+
+    iterator->index = iterator->node == NULL ? 0 : iterator->index + 1;
+    iterator->node = node;
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_iterator_previous(dlist_iterator_t* const iterator) {
+    if (iterator == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    dlist_node_t* const node = iterator->node == NULL ? iterator->list->tail : iterator->node->previous;
+
+    if (node == NULL) {
+        iterator->node = NULL;
+        iterator->index = -1;
+
+        return DLIST_INDEX_OUT_OF_RANGE_ERROR;
+    }
+
+    iterator->index = iterator->node == NULL ? iterator->list->size - 1 : iterator->index - 1;
+    iterator->node = node;
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_iterator_rewind(dlist_iterator_t* const iterator) {
+    if (iterator == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    iterator->node = NULL;
+    iterator->index = -1;
+
+    return DLIST_SUCCESS;
+}
+
+
+dlist_result_t dlist_iterator_free(dlist_iterator_t** iterator) {
+    if (iterator == NULL || *iterator == NULL)
+        return DLIST_INVALID_PARAMS_ERROR;
+
+    (*iterator)->list = NULL;
+    (*iterator)->node = NULL;
+    (*iterator)->index = 0;
+
+    free((*iterator));
+    *iterator = NULL;
+    return DLIST_SUCCESS;
+}
+
+#pragma endregion
@@ -0,0 +1,890 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "hashmap.h"
+#include "confetti_search.h"
+
+// constant definitions
+
+#define HASHMAP_CONTROL_EMPTY ((uint8_t) 0x80)   // Control byte of a slot that has never been filled.
+#define HASHMAP_CONTROL_DELETED ((uint8_t) 0xFE) // Control byte of a slot whose entry was removed.
+#define HASHMAP_MIN_CAPACITY CONFETTI_SEARCH_GROUP_WIDTH // The smallest amount of slots a table has, one control group.
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Returns the amount of entries a table can hold before it has to grow.
+ *
+ * Tables are kept at most seven eighths full so every probe sequence reaches an empty slot quickly.
+ *
+ * @param capacity The amount of slots of the table.
+ *
+ * @return The maximum amount of entries.
+ */
+static uint64_t hashmap_max_load(const uint64_t capacity);
+
+/**
+ * @brief Returns the smallest amount of slots holding a given amount of entries.
+ *
+ * @param count The amount of entries.
+ *
+ * @return A power of two amount of slots, at least `HASHMAP_MIN_CAPACITY`, or 0 if the count is too large.
+ */
+static uint64_t hashmap_capacity_for(const uint64_t count);
+
+/**
+ * @brief Returns the size of the single block holding the slots and control bytes of a table.
+ *
+ * @param capacity The amount of slots of the table.
+ *
+ * @return The size in bytes of the block.
+ */
+static uint64_t hashmap_table_allocation_size(const uint64_t capacity);
+
+/**
+ * @brief Hashes a key with the hash map's hash function and spreads its bits.
+ *
+ * Spreading the bits keeps custom hash functions that only vary in a few bits, 
+ * such as the identity of an integer, from piling entries into the same groups.
+ *
+ * @param hashmap Pointer to the hash map.
+ * @param key Pointer to the key.
+ * @param keySize Size in bytes of the key.
+ *
+ * @return The hash of the key.
+ */
+static uint64_t hashmap_hash_key(const hashmap_t* const hashmap, const void* const key, const uint64_t keySize);
+
+/**
+ * @brief Sets the control byte of a slot, keeping the repeated first group in sync.
+ *
+ * @param hashmap Pointer to the hash map.
+ * @param index The index of the slot.
+ * @param control The new control byte.
+ */
+static void hashmap_control_set(hashmap_t* const hashmap, const uint64_t index, const uint8_t control);
+
+/**
+ * @brief Returns the offset of an entry's value from the start of its data.
+ *
+ * @param keySize Size in bytes of the entry's key.
+ *
+ * @return The key size rounded up to `HASHMAP_VALUE_ALIGNMENT`.
+ */
+static uint64_t hashmap_value_offset(const uint64_t keySize);
+
+/**
+ * @brief Returns a pointer to the data of a slot, starting with its key.
+ *
+ * @param slot Pointer to the slot.
+ *
+ * @return Pointer to the key of the slot.
+ */
+static uint8_t* hashmap_slot_data(hashmap_slot_t* const slot);
+
+/**
+ * @brief Copies a key and value into a slot, replacing the data it held.
+ *
+ * The old data of the slot is only released once the new data is in place, so 
+ * the value may point into the slot's current value.
+ *
+ * @param hashmap Pointer to the hash map.
+ * @param slot Pointer to the slot.
+ * @param hasData If `true` the slot currently holds data that has to be released.
+ * @param hash The hash of the key.
+ * @param key Pointer to the key.
+ * @param keySize Size in bytes of the key.
+ * @param value Pointer to the value, or NULL to zero the value.
+ * @param valueSize Size in bytes of the value.
+ *
+ * @return
+ * - `HASHMAP_SUCCESS` if the data was stored successfully.
+ * 
+ * - `HASHMAP_ALLOCATION_FAILURE` if memory allocation failed, the slot is left untouched.
+ */
+static hashmap_result_t hashmap_slot_store(
+    hashmap_t* const hashmap, 
+    hashmap_slot_t* const slot, 
+    const bool hasData, 
+    const uint64_t hash, 
+    const void* const key, 
+    const uint64_t keySize, 
+    const void* const value, 
+    const uint64_t valueSize
+);
+
+/**
+ * @brief Releases the separately allocated data of a slot, if it has any.
+ *
+ * @param hashmap Pointer to the hash map.
+ * @param slot Pointer to the slot.
+ */
+static void hashmap_slot_release(hashmap_t* const hashmap, hashmap_slot_t* const slot);
+
+/**
+ * @brief Finds the slot holding a key.
+ *
+ * Control bytes are compared a group at a time, only the keys of slots whose 
+ * control byte matches the hash are compared, and the search stops at the first 
+ * group containing an empty slot.
+ *
+ * @param hashmap Pointer to the hash map.
+ * @param hash The hash of the key.
+ * @param key Pointer to the key.
+ * @param keySize Size in bytes of the key.
+ *
+ * @return The index of the slot, or -1 if no slot holds the key.
+ */
+static int64_t hashmap_slot_find(const hashmap_t* const hashmap, const uint64_t hash, const void* const key, const uint64_t keySize);
+
+/**
+ * @brief Finds the first empty or erased slot along the probe sequence of a hash.
+ *
+ * @param controls Pointer to the control bytes of the table.
+ * @param capacity The amount of slots of the table.
+ * @param hash The hash to probe for.
+ *
+ * @return The index of the slot.
+ */
+static uint64_t hashmap_slot_find_free(const uint8_t* const controls, const uint64_t capacity, const uint64_t hash);
+
+/**
+ * @brief Moves every entry of the hash map into a new table, dropping erased slots.
+ *
+ * @param hashmap Pointer to the hash map.
+ * @param capacity The amount of slots of the new table, at least `hashmap_capacity_for` the current size.
+ *
+ * @return
+ * - `HASHMAP_SUCCESS` if the table was rebuilt successfully.
+ * 
+ * - `HASHMAP_ALLOCATION_FAILURE` if memory allocation failed, the hash map is left untouched.
+ */
+static hashmap_result_t hashmap_rehash(hashmap_t* const hashmap, const uint64_t capacity);
+
+/**
+ * @brief Removes the entry of a slot and marks the slot as erased.
+ *
+ * @param hashmap Pointer to the hash map.
+ * @param index The index of the slot.
+ */
+static void hashmap_slot_erase(hashmap_t* const hashmap, const uint64_t index);
+
+/**
+ * @brief Default hash function for memory blocks.
+ *
+ * The block is consumed eight bytes at a time, with the remaining bytes zero padded.
+ *
+ * @param data Pointer to the data block.
+ * @param size Number of bytes to hash.
+ *
+ * @return The hash of the block.
+ */
+static uint64_t default_hash(const void* const data, const uint64_t size);
+
+/**
+ * @brief Default equality comparison function for memory blocks.
+ *
+ * If both pointers are NULL they are considered equal, if only one is NULL the 
+ * non-null value is considered greater, otherwise `memcmp` is used to compare them.
+ *
+ * @param data1 Pointer to the first data block.
+ * @param data2 Pointer to the second data block.
+ * @param size Number of bytes to compare.
+ *
+ * @return `0` if the blocks are equal, a negative value if `data1` is less 
+ * than `data2` and a positive value if `data1` is greater than `data2`.
+ */
+static int32_t default_equals(const void* const data1, const void* const data2, const uint64_t size);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static uint64_t hashmap_max_load(const uint64_t capacity) {
+    return capacity - capacity / 8;
+}
+
+
+static uint64_t hashmap_capacity_for(const uint64_t count) {
+    uint64_t capacity = HASHMAP_MIN_CAPACITY;
+
+    while (hashmap_max_load(capacity) < count) {
+        if (capacity > (UINT64_MAX / 2) / sizeof(hashmap_slot_t))
+            return 0;
+
+        capacity <<= 1;
+    }
+
+    return capacity;
+}
+
+
+static uint64_t hashmap_table_allocation_size(const uint64_t capacity) {
+    return sizeof(hashmap_slot_t) * capacity + capacity + CONFETTI_SEARCH_GROUP_WIDTH;
+}
+
+
+static uint64_t hashmap_hash_key(const hashmap_t* const hashmap, const void* const key, const uint64_t keySize) {
+    uint64_t hash = hashmap->hashFunction(key, keySize);
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+
+static void hashmap_control_set(hashmap_t* const hashmap, const uint64_t index, const uint8_t control) {
+    hashmap->controls[index] = control;
+
+    // the first group is repeated past the end so groups starting near the end can be read at once.
+    if (index < CONFETTI_SEARCH_GROUP_WIDTH)
+        hashmap->controls[hashmap->capacity + index] = control;
+}
+
+
+static uint64_t hashmap_value_offset(const uint64_t keySize) {
+    return (keySize + HASHMAP_VALUE_ALIGNMENT - 1) & ~(HASHMAP_VALUE_ALIGNMENT - 1);
+}
+
+
+static uint8_t* hashmap_slot_data(hashmap_slot_t* const slot) {
+    return slot->block != NULL ? slot->block : slot->inlineData;
+}
+
+
+static hashmap_result_t hashmap_slot_store(
+    hashmap_t* const hashmap, 
+    hashmap_slot_t* const slot, 
+    const bool hasData, 
+    const uint64_t hash, 
+    const void* const key, 
+    const uint64_t keySize, 
+    const void* const value, 
+    const uint64_t valueSize
+) {
+    const uint64_t valueOffset = hashmap_value_offset(keySize);
+    const uint64_t dataSize = valueOffset + valueSize;
+    uint8_t* block = NULL;
+
+    if (dataSize > HASHMAP_INLINE_CAPACITY) {
+        block = (uint8_t*) hashmap->allocator.allocate(hashmap->allocator.context, dataSize);
+
+        if (block == NULL)
+            return HASHMAP_ALLOCATION_FAILURE;
+    }
+
+    uint8_t* const oldBlock = hasData ? slot->block : NULL;
+    const uint64_t oldDataSize = hasData ? hashmap_value_offset(slot->keySize) + slot->valueSize : 0;
+    uint8_t* const data = block != NULL ? block : slot->inlineData;
+
+    memmove(data, key, keySize);
+
+    if (value != NULL)
+        memmove(data + valueOffset, value, valueSize);
+    else 
+        memset(data + valueOffset, 0, valueSize);
+
+    slot->hash = hash;
+    slot->keySize = keySize;
+    slot->valueSize = valueSize;
+    slot->block = block;
+
+    if (oldBlock != NULL)
+        hashmap->allocator.deallocate(hashmap->allocator.context, oldBlock, oldDataSize);
+
+    return HASHMAP_SUCCESS;
+}
+
+
+static void hashmap_slot_release(hashmap_t* const hashmap, hashmap_slot_t* const slot) {
+    if (slot->block == NULL)
+        return;
+
+    hashmap->allocator.deallocate(
+        hashmap->allocator.context, 
+        slot->block, 
+        hashmap_value_offset(slot->keySize) + slot->valueSize
+    );
+    slot->block = NULL;
+}
+
+
+static int64_t hashmap_slot_find(const hashmap_t* const hashmap, const uint64_t hash, const void* const key, const uint64_t keySize) {
+    const uint64_t mask = hashmap->capacity - 1;
+    const uint8_t control = (uint8_t) (hash & 0x7F);
+    uint64_t position = (hash >> 7) & mask;
+
+    // groups are visited at triangular offsets, which reaches every group of a power of two table.
+    for (uint64_t stride = CONFETTI_SEARCH_GROUP_WIDTH; ; stride += CONFETTI_SEARCH_GROUP_WIDTH) {
+        const uint8_t* const group = hashmap->controls + position;
+        uint32_t matches = confetti_search_group(group, control);
+
+        while (matches != 0) {
+            const uint64_t index = (position + confetti_search_lowest_bit(matches)) & mask;
+            hashmap_slot_t* const slot = &hashmap->slots[index];
+
+            if (slot->hash == hash
+                && slot->keySize == keySize
+                && hashmap->equalityFunction(hashmap_slot_data(slot), key, keySize) == 0)
+                return (int64_t) index;
+
+            matches &= matches - 1;
+        }
+
+        if (confetti_search_group(group, HASHMAP_CONTROL_EMPTY) != 0)
+            return -1;
+
+        position = (position + stride) & mask;
+    }
+}
+
+
+static uint64_t hashmap_slot_find_free(const uint8_t* const controls, const uint64_t capacity, const uint64_t hash) {
+    const uint64_t mask = capacity - 1;
+    uint64_t position = (hash >> 7) & mask;
+
+    for (uint64_t stride = CONFETTI_SEARCH_GROUP_WIDTH; ; stride += CONFETTI_SEARCH_GROUP_WIDTH) {
+        const uint8_t* const group = controls + position;
+        const uint32_t matches = confetti_search_group(group, HASHMAP_CONTROL_EMPTY) 
+            | confetti_search_group(group, HASHMAP_CONTROL_DELETED);
+
+        if (matches != 0)
+            return (position + confetti_search_lowest_bit(matches)) & mask;
+
+        position = (position + stride) & mask;
+    }
+}
+
+
+static hashmap_result_t hashmap_rehash(hashmap_t* const hashmap, const uint64_t capacity) {
+    uint8_t* const table = (uint8_t*) hashmap->allocator.allocate(hashmap->allocator.context, hashmap_table_allocation_size(capacity));
+
+    if (table == NULL)
+        return HASHMAP_ALLOCATION_FAILURE;
+
+    hashmap_slot_t* const slots = (hashmap_slot_t*) table;
+    uint8_t* const controls = table + sizeof(hashmap_slot_t) * capacity;
+
+    memset(controls, HASHMAP_CONTROL_EMPTY, capacity + CONFETTI_SEARCH_GROUP_WIDTH);
+
+    for (uint64_t i = 0; i < hashmap->capacity; i++) {
+        if ((hashmap->controls[i] & HASHMAP_CONTROL_EMPTY) != 0)
+            continue;
+
+        const hashmap_slot_t* const slot = &hashmap->slots[i];
+        const uint64_t index = hashmap_slot_find_free(controls, capacity, slot->hash);
+
+        // slots own their data through a pointer or inline, either way they can be moved bytewise.
+        memcpy(&slots[index], slot, sizeof(hashmap_slot_t));
+        controls[index] = hashmap->controls[i];
+
+        if (index < CONFETTI_SEARCH_GROUP_WIDTH)
+            controls[capacity + index] = hashmap->controls[i];
+    }
+
+    if (hashmap->slots != NULL)
+        hashmap->allocator.deallocate(hashmap->allocator.context, hashmap->slots, hashmap_table_allocation_size(hashmap->capacity));
+
+    hashmap->slots = slots;
+    hashmap->controls = controls;
+    hashmap->capacity = capacity;
+    hashmap->growthLeft = hashmap_max_load(capacity) - (uint64_t) hashmap->size;
+
+    return HASHMAP_SUCCESS;
+}
+
+
+static void hashmap_slot_erase(hashmap_t* const hashmap, const uint64_t index) {
+    hashmap_slot_release(hashmap, &hashmap->slots[index]);
+    hashmap_control_set(hashmap, index, HASHMAP_CONTROL_DELETED);
+    hashmap->size--;
+}
+
+
+static uint64_t default_hash(const void* const data, const uint64_t size) {
+    const uint8_t* bytes = (const uint8_t*) data;
+    uint64_t hash = 0x9e3779b97f4a7c15ULL ^ (size * 0xbf58476d1ce4e5b9ULL);
+    uint64_t remaining = size;
+
+    while (remaining > 0) {
+        uint64_t chunk = 0;
+        const uint64_t chunkSize = remaining < sizeof(uint64_t) ? remaining : sizeof(uint64_t);
+
+        memcpy(&chunk, bytes, chunkSize);
+
+        hash ^= chunk;
+        hash *= 0x94d049bb133111ebULL;
+        hash ^= hash >> 31;
+
+        bytes += chunkSize;
+        remaining -= chunkSize;
+    }
+
+    return hash;
+}
+
+
+static int32_t default_equals(const void* data1, const void* data2, uint64_t size) {
+    if (data1 == NULL && data2 != NULL)
+        return -1;
+    else if (data1 != NULL && data2 == NULL) 
+        return 1;
+    else if (data1 == NULL && data2 == NULL)
+        return 0;
+
+    return memcmp(data1, data2, size);
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+hashmap_result_t hashmap_create(
+    hashmap_t** hashmapOut, 
+    const uint64_t capacity, 
+    hashmap_custom_equality_function_t* const customEqualityFunction, 
+    hashmap_custom_hash_function_t* const customHashFunction
+) {
+    hashmap_options_t options = { capacity, customEqualityFunction, customHashFunction, NULL };
+
+    return hashmap_create_with_options(hashmapOut, &options);
+}
+
+
+hashmap_result_t hashmap_create_with_options(hashmap_t** hashmapOut, const hashmap_options_t* const options) {
+    if (options == NULL)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const allocator = options->allocator == NULL 
+        ? confetti_allocator_default() 
+        : options->allocator;
+
+    if (allocator->allocate == NULL || allocator->reallocate == NULL || allocator->deallocate == NULL)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    const uint64_t capacity = hashmap_capacity_for(options->capacity == 0 ? DEFAULT_HASHMAP_CAPACITY : options->capacity);
+
+    if (capacity == 0)
+        return HASHMAP_ALLOCATION_FAILURE;
+
+    hashmap_t* const hashmap = (hashmap_t*) allocator->allocate(allocator->context, sizeof(hashmap_t));
+
+    if (hashmap == NULL)
+        return HASHMAP_ALLOCATION_FAILURE;
+
+    hashmap->controls = NULL;
+    hashmap->slots = NULL;
+    hashmap->capacity = 0;
+    hashmap->size = 0;
+    hashmap->growthLeft = 0;
+    hashmap->equalityFunction = options->equalityFunction == NULL 
+        ? (hashmap_custom_equality_function_t*) &default_equals 
+        : options->equalityFunction;
+    hashmap->hashFunction = options->hashFunction == NULL 
+        ? (hashmap_custom_hash_function_t*) &default_hash 
+        : options->hashFunction;
+    hashmap->allocator = *allocator;
+
+    if (hashmap_rehash(hashmap, capacity) != HASHMAP_SUCCESS) {
+        allocator->deallocate(allocator->context, hashmap, sizeof(hashmap_t));
+        return HASHMAP_ALLOCATION_FAILURE;
+    }
+
+    *hashmapOut = hashmap;
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_free(hashmap_t** hashmap) {
+    if (*hashmap == NULL)
+        return HASHMAP_NULL_ERROR;
+
+    hashmap_result_t clearResult = hashmap_clear(*hashmap);
+
+    if (clearResult != HASHMAP_SUCCESS)
+        return clearResult;
+
+    confetti_allocator_t allocator = (*hashmap)->allocator;
+
+    allocator.deallocate(allocator.context, (*hashmap)->slots, hashmap_table_allocation_size((*hashmap)->capacity));
+    allocator.deallocate(allocator.context, *hashmap, sizeof(hashmap_t));
+    *hashmap = NULL;
+
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_print(hashmap_t* const hashmap) {
+    if (hashmap == NULL)
+        return HASHMAP_NULL_ERROR;
+
+    int64_t printed = 0;
+
+    printf("{ ");
+
+    for (uint64_t i = 0; i < hashmap->capacity; i++) {
+        if ((hashmap->controls[i] & HASHMAP_CONTROL_EMPTY) != 0)
+            continue;
+
+        hashmap_slot_t* const slot = &hashmap->slots[i];
+        uint8_t* const data = hashmap_slot_data(slot);
+
+        printed++;
+        printf(printed < hashmap->size ? "%p: %p, " : "%p: %p", data, data + hashmap_value_offset(slot->keySize));
+    }
+
+    printf(" } -> %p\n", hashmap);
+
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_reserve(hashmap_t* const hashmap, const uint64_t count) {
+    if (hashmap == NULL)
+        return HASHMAP_NULL_ERROR;
+
+    if (count <= (uint64_t) hashmap->size + hashmap->growthLeft)
+        return HASHMAP_SUCCESS;
+
+    uint64_t capacity = hashmap_capacity_for(count);
+
+    if (capacity == 0)
+        return HASHMAP_ALLOCATION_FAILURE;
+
+    // erased slots are dropped by rehashing, which may already make enough room at the current capacity.
+    return hashmap_rehash(hashmap, capacity > hashmap->capacity ? capacity : hashmap->capacity);
+}
+
+
+hashmap_result_t hashmap_insert(
+    hashmap_t* const hashmap, 
+    const void* const key, 
+    const uint64_t keySize, 
+    const void* const value, 
+    const uint64_t valueSize
+) {
+    if (hashmap == NULL)
+        return HASHMAP_NULL_ERROR;
+    else if (key == NULL)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    const uint64_t hash = hashmap_hash_key(hashmap, key, keySize);
+    const int64_t foundIndex = hashmap_slot_find(hashmap, hash, key, keySize);
+
+    if (foundIndex != -1)
+        return hashmap_slot_store(hashmap, &hashmap->slots[foundIndex], true, hash, key, keySize, value, valueSize);
+
+    uint64_t index = hashmap_slot_find_free(hashmap->controls, hashmap->capacity, hash);
+
+    // erased slots can be reused freely, only filling an empty slot uses up room.
+    if (hashmap->growthLeft == 0 && hashmap->controls[index] == HASHMAP_CONTROL_EMPTY) {
+        const uint64_t capacity = (uint64_t) hashmap->size < hashmap_max_load(hashmap->capacity) / 2 
+            ? hashmap->capacity 
+            : hashmap_capacity_for((uint64_t) hashmap->size + 1);
+
+        if (capacity == 0)
+            return HASHMAP_ALLOCATION_FAILURE;
+
+        hashmap_result_t rehashResult = hashmap_rehash(hashmap, capacity);
+
+        if (rehashResult != HASHMAP_SUCCESS)
+            return rehashResult;
+
+        index = hashmap_slot_find_free(hashmap->controls, hashmap->capacity, hash);
+    }
+
+    hashmap_result_t storeResult = hashmap_slot_store(hashmap, &hashmap->slots[index], false, hash, key, keySize, value, valueSize);
+
+    if (storeResult != HASHMAP_SUCCESS)
+        return storeResult;
+
+    if (hashmap->controls[index] == HASHMAP_CONTROL_EMPTY)
+        hashmap->growthLeft--;
+
+    hashmap_control_set(hashmap, index, (uint8_t) (hash & 0x7F));
+    hashmap->size++;
+
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_insert_many(
+    hashmap_t* const hashmap, 
+    const void* const keys, 
+    const uint64_t keyStride, 
+    const void* const values, 
+    const uint64_t valueStride, 
+    const uint64_t count
+) {
+    if (hashmap == NULL)
+        return HASHMAP_NULL_ERROR;
+    else if (count == 0)
+        return HASHMAP_SUCCESS;
+    else if (keys == NULL || keyStride == 0)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    hashmap_result_t reserveResult = hashmap_reserve(hashmap, (uint64_t) hashmap->size + count);
+
+    if (reserveResult != HASHMAP_SUCCESS)
+        return reserveResult;
+
+    const uint8_t* const keyBytes = (const uint8_t*) keys;
+    const uint8_t* const valueBytes = (const uint8_t*) values;
+
+    for (uint64_t i = 0; i < count; i++) {
+        hashmap_result_t insertResult = hashmap_insert(
+            hashmap, 
+            keyBytes + i * keyStride, 
+            keyStride, 
+            valueBytes != NULL ? valueBytes + i * valueStride : NULL, 
+            valueStride
+        );
+
+        if (insertResult != HASHMAP_SUCCESS)
+            return insertResult;
+    }
+
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_get(hashmap_t* const hashmap, hashmap_element_t** elementOut, const void* const key, const uint64_t keySize) {
+    void* value = NULL;
+    uint64_t size = 0;
+    hashmap_result_t peekResult = hashmap_peek(hashmap, &value, &size, key, keySize);
+
+    if (peekResult != HASHMAP_SUCCESS)
+        return peekResult;
+
+    const confetti_allocator_t* const defaultAllocator = confetti_allocator_default();
+    hashmap_element_t* const element = (hashmap_element_t*) defaultAllocator->allocate(
+        defaultAllocator->context, 
+        sizeof(hashmap_element_t) + size
+    );
+
+    if (element == NULL)
+        return HASHMAP_ALLOCATION_FAILURE;
+
+    element->value = (void*) (element + 1);
+    element->size = size;
+    memcpy(element->value, value, size);
+
+    *elementOut = element;
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_peek(
+    hashmap_t* const hashmap, 
+    void** valueOut, 
+    uint64_t* const sizeOut, 
+    const void* const key, 
+    const uint64_t keySize
+) {
+    if (hashmap == NULL)
+        return HASHMAP_NULL_ERROR;
+    else if (key == NULL)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    const int64_t index = hashmap_slot_find(hashmap, hashmap_hash_key(hashmap, key, keySize), key, keySize);
+
+    if (index == -1)
+        return HASHMAP_ELEMENT_NOT_FOUND_ERROR;
+
+    hashmap_slot_t* const slot = &hashmap->slots[index];
+
+    *valueOut = (void*) (hashmap_slot_data(slot) + hashmap_value_offset(slot->keySize));
+
+    if (sizeOut != NULL)
+        *sizeOut = slot->valueSize;
+
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_includes(hashmap_t* const hashmap, const void* const key, const uint64_t keySize) {
+    void* value = NULL;
+
+    return hashmap_peek(hashmap, &value, NULL, key, keySize);
+}
+
+
+hashmap_result_t hashmap_remove(hashmap_t* const hashmap, const void* const key, const uint64_t keySize) {
+    if (hashmap == NULL)
+        return HASHMAP_NULL_ERROR;
+    else if (key == NULL)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    const int64_t index = hashmap_slot_find(hashmap, hashmap_hash_key(hashmap, key, keySize), key, keySize);
+
+    if (index == -1)
+        return HASHMAP_ELEMENT_NOT_FOUND_ERROR;
+
+    hashmap_slot_erase(hashmap, (uint64_t) index);
+
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_pop(hashmap_t* const hashmap, hashmap_element_t** elementOut, const void* const key, const uint64_t keySize) {
+    if (hashmap == NULL)
+        return HASHMAP_NULL_ERROR;
+    else if (key == NULL)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    const int64_t index = hashmap_slot_find(hashmap, hashmap_hash_key(hashmap, key, keySize), key, keySize);
+
+    if (index == -1)
+        return HASHMAP_ELEMENT_NOT_FOUND_ERROR;
+
+    hashmap_slot_t* const slot = &hashmap->slots[index];
+    const confetti_allocator_t* const defaultAllocator = confetti_allocator_default();
+    hashmap_element_t* const element = (hashmap_element_t*) defaultAllocator->allocate(
+        defaultAllocator->context, 
+        sizeof(hashmap_element_t) + slot->valueSize
+    );
+
+    if (element == NULL)
+        return HASHMAP_ALLOCATION_FAILURE;
+
+    element->value = (void*) (element + 1);
+    element->size = slot->valueSize;
+    memcpy(element->value, hashmap_slot_data(slot) + hashmap_value_offset(slot->keySize), slot->valueSize);
+
+    hashmap_slot_erase(hashmap, (uint64_t) index);
+
+    *elementOut = element;
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_clear(hashmap_t* const hashmap) {
+    if (hashmap == NULL)
+        return HASHMAP_NULL_ERROR;
+
+    for (uint64_t i = 0; i < hashmap->capacity; i++) {
+        if ((hashmap->controls[i] & HASHMAP_CONTROL_EMPTY) == 0)
+            hashmap_slot_release(hashmap, &hashmap->slots[i]);
+    }
+
+    memset(hashmap->controls, HASHMAP_CONTROL_EMPTY, hashmap->capacity + CONFETTI_SEARCH_GROUP_WIDTH);
+
+    hashmap->size = 0;
+    hashmap->growthLeft = hashmap_max_load(hashmap->capacity);
+
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_element_free(hashmap_element_t** element) {
+    if (element == NULL || *element == NULL)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const defaultAllocator = confetti_allocator_default();
+
+    defaultAllocator->deallocate(defaultAllocator->context, *element, sizeof(hashmap_element_t) + (*element)->size);
+    *element = NULL;
+
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_iterator_create(hashmap_iterator_t** iteratorOut, hashmap_t* const hashmap) {
+    if (hashmap == NULL)
+        return HASHMAP_NULL_ERROR;
+
+    hashmap_iterator_t* iterator = (hashmap_iterator_t*) malloc(sizeof(hashmap_iterator_t));
+
+    if (iterator == NULL)
+        return HASHMAP_ALLOCATION_FAILURE;
+
+    iterator->map = hashmap;
+    iterator->index = -1;
+    iterator->key.value = NULL;
+    iterator->key.size = 0;
+    iterator->value.value = NULL;
+    iterator->value.size = 0;
+
+    *iteratorOut = iterator;
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_iterator_next(hashmap_iterator_t* const iterator) {
+    if (iterator == NULL)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    hashmap_t* const hashmap = iterator->map;
+
+    for (uint64_t i = (uint64_t) (iterator->index + 1); i < hashmap->capacity; i++) {
+        if ((hashmap->controls[i] & HASHMAP_CONTROL_EMPTY) != 0)
+            continue;
+
+        hashmap_slot_t* const slot = &hashmap->slots[i];
+        uint8_t* const data = hashmap_slot_data(slot);
+
+        iterator->index = (int64_t) i;
+        iterator->key.value = (void*) data;
+        iterator->key.size = slot->keySize;
+        iterator->value.value = (void*) (data + hashmap_value_offset(slot->keySize));
+        iterator->value.size = slot->valueSize;
+
+        return HASHMAP_SUCCESS;
+    }
+
+    hashmap_iterator_rewind(iterator);
+
+    return HASHMAP_INDEX_OUT_OF_RANGE_ERROR;
+}
+
+
+hashmap_result_t hashmap_iterator_rewind(hashmap_iterator_t* const iterator) {
+    if (iterator == NULL)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    iterator->index = -1;
+    iterator->key.value = NULL;
+    iterator->key.size = 0;
+    iterator->value.value = NULL;
+    iterator->value.size = 0;
+
+    return HASHMAP_SUCCESS;
+}
+
+
+hashmap_result_t hashmap_iterator_free(hashmap_iterator_t** iterator) {
+    if (iterator == NULL || *iterator == NULL)
+        return HASHMAP_INVALID_PARAMS_ERROR;
+
+    (*iterator)->map = NULL;
+
+    free((*iterator));
+    *iterator = NULL;
+    return HASHMAP_SUCCESS;
+}
+
+#pragma endregion
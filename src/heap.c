@@ -0,0 +1,546 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "heap.h"
+
+// constant definitions
+
+#define DEFAULT_HEAP_HANDLE_CAPACITY ((uint64_t) 16) // The amount of handles a heap has room for before its first growth.
+#define HEAP_HANDLE_ARRAYS ((uint64_t) 3)            // The amount of arrays kept in the handle block, `handles`, `positions` and `freeHandles`.
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Returns the size in bytes of a slot of the heap's list.
+ *
+ * @param heap A pointer to the heap.
+ * 
+ * @return The stride of a fixed stride list, the size of an element pointer otherwise.
+ */
+static uint64_t heap_slot_size(const heap_t* const heap);
+
+/**
+ * @brief Returns a pointer to the slot of the heap's list at an index.
+ *
+ * @param heap A pointer to the heap.
+ * @param index The index of the slot.
+ * 
+ * @return A pointer to the slot.
+ */
+static uint8_t* heap_slot(const heap_t* const heap, const int64_t index);
+
+/**
+ * @brief Orders two slots of the heap's list using its equality function.
+ *
+ * @param heap A pointer to the heap.
+ * @param slot1 A pointer to the first slot.
+ * @param slot2 A pointer to the second slot.
+ * 
+ * @return A negative value if the first slot belongs above the second, zero if they are equal, a positive value otherwise.
+ */
+static int32_t heap_order_slots(const heap_t* const heap, const uint8_t* const slot1, const uint8_t* const slot2);
+
+/**
+ * @brief Writes a slot and its handle to an index of the heap.
+ *
+ * @param heap A pointer to the heap.
+ * @param index The index to write to.
+ * @param slot A pointer to the slot to copy.
+ * @param handle The handle of the slot's value.
+ */
+static void heap_place(heap_t* const heap, const int64_t index, const uint8_t* const slot, const heap_handle_t handle);
+
+/**
+ * @brief Swaps two values of the heap along with their handles.
+ *
+ * @param heap A pointer to the heap.
+ * @param index1 The index of the first value.
+ * @param index2 The index of the second value.
+ */
+static void heap_swap(heap_t* const heap, const int64_t index1, const int64_t index2);
+
+/**
+ * @brief Moves a value towards the root until its parent is no greater than it.
+ *
+ * @param heap A pointer to the heap.
+ * @param index The index of the value to move.
+ * 
+ * @return The index the value ended up at.
+ */
+static int64_t heap_sift_up(heap_t* const heap, int64_t index);
+
+/**
+ * @brief Moves a value towards the leaves until none of its children are smaller than it.
+ *
+ * @param heap A pointer to the heap.
+ * @param index The index of the value to move.
+ * 
+ * @return The index the value ended up at.
+ */
+static int64_t heap_sift_down(heap_t* const heap, int64_t index);
+
+/**
+ * @brief Makes sure the handle block has room for at least a given amount of handles.
+ *
+ * @param heap A pointer to the heap.
+ * @param capacity The amount of handles needed.
+ * 
+ * @return `true` if there is enough room, `false` if the allocation failed.
+ */
+static bool heap_reserve_handles(heap_t* const heap, const uint64_t capacity);
+
+/**
+ * @brief Hands out a handle, preferring ones that were freed before.
+ *
+ * @param heap A pointer to the heap, which must have room for another handle.
+ * 
+ * @return The handle.
+ */
+static heap_handle_t heap_acquire_handle(heap_t* const heap);
+
+/**
+ * @brief Checks whether a handle refers to a value of the heap.
+ *
+ * @param heap A pointer to the heap.
+ * @param handle The handle to check.
+ * 
+ * @return `true` if the handle refers to a value, otherwise `false`.
+ */
+static bool heap_handle_valid(const heap_t* const heap, const heap_handle_t handle);
+
+/**
+ * @brief Allocates a heap around a list.
+ *
+ * @param heapOut A double pointer to where the created heap will be stored.
+ * @param list A pointer to the list the heap will own.
+ * @param arity Amount of children of every node, `DEFAULT_HEAP_ARITY` if less than 2.
+ * 
+ * @return `LIST_SUCCESS`, or `LIST_ALLOCATION_FAILURE` in which case the list is left untouched.
+ */
+static list_result_t heap_setup(heap_t** heapOut, list_t* const list, const uint32_t arity);
+
+/**
+ * @brief Removes the value at an index of the heap and frees its handle.
+ *
+ * @param heap A pointer to the heap.
+ * @param index The index of the value to remove.
+ * @param elementOut A double pointer to where the removed element will be stored, or NULL to discard it.
+ * 
+ * @return The result of taking or removing the value from the list, the heap is unchanged if it failed.
+ */
+static list_result_t heap_extract(heap_t* const heap, const int64_t index, list_element_t** elementOut);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static uint64_t heap_slot_size(const heap_t* const heap) {
+    return heap->list->stride != 0 ? heap->list->stride : sizeof(list_element_t*);
+}
+
+
+static uint8_t* heap_slot(const heap_t* const heap, const int64_t index) {
+    const list_t* const list = heap->list;
+
+    if (list->stride != 0)
+        return list->data + list->stride * (uint64_t) index;
+
+    return (uint8_t*) &list->items[index];
+}
+
+
+static int32_t heap_order_slots(const heap_t* const heap, const uint8_t* const slot1, const uint8_t* const slot2) {
+    const list_t* const list = heap->list;
+
+    if (list->stride != 0)
+        return list->equalityFunction(slot1, slot2, list->stride);
+
+    const list_element_t* const element1 = *(list_element_t* const*) slot1;
+    const list_element_t* const element2 = *(list_element_t* const*) slot2;
+    const uint64_t size1 = element1 != NULL ? element1->size : 0;
+    const uint64_t size2 = element2 != NULL ? element2->size : 0;
+
+    // values of different sizes are compared over the shorter one, like the sorted paths of list do.
+    return list->equalityFunction(
+        element1 != NULL ? element1->value : NULL, 
+        element2 != NULL ? element2->value : NULL, 
+        size1 < size2 ? size1 : size2
+    );
+}
+
+
+static void heap_place(heap_t* const heap, const int64_t index, const uint8_t* const slot, const heap_handle_t handle) {
+    memcpy(heap_slot(heap, index), slot, heap_slot_size(heap));
+    heap->handles[index] = handle;
+    heap->positions[handle] = index;
+}
+
+
+static void heap_swap(heap_t* const heap, const int64_t index1, const int64_t index2) {
+    const heap_handle_t handle = heap->handles[index1];
+
+    memcpy(heap->scratch, heap_slot(heap, index1), heap_slot_size(heap));
+    heap_place(heap, index1, heap_slot(heap, index2), heap->handles[index2]);
+    heap_place(heap, index2, heap->scratch, handle);
+}
+
+
+static int64_t heap_sift_up(heap_t* const heap, int64_t index) {
+    const heap_handle_t handle = heap->handles[index];
+
+    // the value is held aside so every parent moves down by a single copy.
+    memcpy(heap->scratch, heap_slot(heap, index), heap_slot_size(heap));
+
+    while (index > 0) {
+        const int64_t parent = (index - 1) / heap->arity;
+
+        if (heap_order_slots(heap, heap->scratch, heap_slot(heap, parent)) >= 0)
+            break;
+
+        heap_place(heap, index, heap_slot(heap, parent), heap->handles[parent]);
+        index = parent;
+    }
+
+    heap_place(heap, index, heap->scratch, handle);
+    return index;
+}
+
+
+static int64_t heap_sift_down(heap_t* const heap, int64_t index) {
+    const int64_t size = heap->list->size;
+    const heap_handle_t handle = heap->handles[index];
+
+    memcpy(heap->scratch, heap_slot(heap, index), heap_slot_size(heap));
+
+    while (true) {
+        const int64_t firstChild = index * heap->arity + 1;
+
+        if (firstChild >= size)
+            break;
+
+        const int64_t lastChild = (size - firstChild > heap->arity ? firstChild + heap->arity : size) - 1;
+        int64_t smallest = firstChild;
+
+        for (int64_t child = firstChild + 1; child <= lastChild; child++) {
+            if (heap_order_slots(heap, heap_slot(heap, child), heap_slot(heap, smallest)) < 0)
+                smallest = child;
+        }
+
+        if (heap_order_slots(heap, heap_slot(heap, smallest), heap->scratch) >= 0)
+            break;
+
+        heap_place(heap, index, heap_slot(heap, smallest), heap->handles[smallest]);
+        index = smallest;
+    }
+
+    heap_place(heap, index, heap->scratch, handle);
+    return index;
+}
+
+
+static bool heap_reserve_handles(heap_t* const heap, const uint64_t capacity) {
+    if (capacity <= heap->handleCapacity)
+        return true;
+
+    const confetti_allocator_t* const allocator = &heap->list->allocator;
+    uint64_t newCapacity = heap->handleCapacity != 0 ? heap->handleCapacity : DEFAULT_HEAP_HANDLE_CAPACITY;
+
+    while (newCapacity < capacity)
+        newCapacity *= 2;
+
+    // the three arrays share one block, so growing them either fails or succeeds as a whole.
+    uint64_t* const block = (uint64_t*) allocator->allocate(allocator->context, HEAP_HANDLE_ARRAYS * newCapacity * sizeof(uint64_t));
+
+    if (block == NULL)
+        return false;
+
+    heap_handle_t* const handles = block;
+    int64_t* const positions = (int64_t*) (block + newCapacity);
+    heap_handle_t* const freeHandles = block + 2 * newCapacity;
+
+    if (heap->handles != NULL) {
+        memcpy(handles, heap->handles, heap->handleCapacity * sizeof(heap_handle_t));
+        memcpy(positions, heap->positions, heap->handleCapacity * sizeof(int64_t));
+        memcpy(freeHandles, heap->freeHandles, heap->handleCapacity * sizeof(heap_handle_t));
+        allocator->deallocate(allocator->context, heap->handles, HEAP_HANDLE_ARRAYS * heap->handleCapacity * sizeof(uint64_t));
+    }
+
+    heap->handles = handles;
+    heap->positions = positions;
+    heap->freeHandles = freeHandles;
+    heap->handleCapacity = newCapacity;
+
+    return true;
+}
+
+
+static heap_handle_t heap_acquire_handle(heap_t* const heap) {
+    if (heap->freeCount != 0)
+        return heap->freeHandles[--heap->freeCount];
+
+    return (heap_handle_t) heap->handleCount++;
+}
+
+
+static bool heap_handle_valid(const heap_t* const heap, const heap_handle_t handle) {
+    return handle < heap->handleCount && heap->positions[handle] >= 0;
+}
+
+
+static list_result_t heap_setup(heap_t** heapOut, list_t* const list, const uint32_t arity) {
+    const confetti_allocator_t* const allocator = &list->allocator;
+    heap_t* const heap = (heap_t*) allocator->allocate(allocator->context, sizeof(heap_t));
+
+    if (heap == NULL)
+        return LIST_ALLOCATION_FAILURE;
+
+    *heap = (heap_t) { list, arity < 2 ? DEFAULT_HEAP_ARITY : arity, NULL, NULL, NULL, 0, 0, 0, NULL };
+    heap->scratch = (uint8_t*) allocator->allocate(allocator->context, heap_slot_size(heap));
+
+    if (heap->scratch == NULL || !heap_reserve_handles(heap, (uint64_t) list->size)) {
+        if (heap->scratch != NULL)
+            allocator->deallocate(allocator->context, heap->scratch, heap_slot_size(heap));
+
+        allocator->deallocate(allocator->context, heap, sizeof(heap_t));
+        return LIST_ALLOCATION_FAILURE;
+    }
+
+    *heapOut = heap;
+    return LIST_SUCCESS;
+}
+
+
+static list_result_t heap_extract(heap_t* const heap, const int64_t index, list_element_t** elementOut) {
+    const int64_t last = heap->list->size - 1;
+    const heap_handle_t handle = heap->handles[index];
+
+    // the value trades places with the last one so the list only ever loses its last slot.
+    if (index != last)
+        heap_swap(heap, index, last);
+
+    list_result_t result = elementOut != NULL 
+        ? list_take(heap->list, elementOut, last) 
+        : list_remove(heap->list, last);
+
+    if (result != LIST_SUCCESS) {
+        if (index != last)
+            heap_swap(heap, index, last);
+
+        return result;
+    }
+
+    heap->positions[handle] = -1;
+    heap->freeHandles[heap->freeCount++] = handle;
+
+    if (index < heap->list->size && heap_sift_up(heap, index) == index)
+        heap_sift_down(heap, index);
+
+    return LIST_SUCCESS;
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+list_result_t heap_create(heap_t** heapOut, const uint64_t elementSize, list_custom_equality_function_t* const comparator) {
+    heap_options_t options = { 0 };
+
+    options.list.elementSize = elementSize;
+    options.list.equalityFunction = comparator;
+
+    return heap_create_with_options(heapOut, &options);
+}
+
+
+list_result_t heap_create_with_options(heap_t** heapOut, const heap_options_t* const options) {
+    const heap_options_t defaults = { 0 };
+    const heap_options_t* const heapOptions = options != NULL ? options : &defaults;
+
+    if (heapOptions->list.hashFunction != NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    list_t* list = NULL;
+    list_result_t listCreateResult = list_create_with_options(&list, &heapOptions->list);
+
+    if (listCreateResult != LIST_SUCCESS)
+        return listCreateResult;
+
+    list_result_t setupResult = heap_setup(heapOut, list, heapOptions->arity);
+
+    if (setupResult != LIST_SUCCESS)
+        list_free(&list);
+
+    return setupResult;
+}
+
+
+list_result_t heap_create_from_list(heap_t** heapOut, list_t** list, const uint32_t arity) {
+    if (list == NULL || *list == NULL)
+        return LIST_NULL_ERROR;
+    else if ((*list)->embedded)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    heap_t* heap = NULL;
+    list_result_t setupResult = heap_setup(&heap, *list, arity);
+
+    if (setupResult != LIST_SUCCESS)
+        return setupResult;
+
+    list_index_detach(heap->list);
+    heap->list->sorted = false;
+
+    const int64_t size = heap->list->size;
+
+    for (int64_t index = 0; index < size; index++) {
+        heap->handles[index] = (heap_handle_t) index;
+        heap->positions[index] = index;
+    }
+
+    heap->handleCount = (uint64_t) size;
+
+    // sifting down every parent from the last one up builds the heap in linear time.
+    if (size > 1) {
+        for (int64_t index = (size - 2) / heap->arity; index >= 0; index--)
+            heap_sift_down(heap, index);
+    }
+
+    *list = NULL;
+    *heapOut = heap;
+    return LIST_SUCCESS;
+}
+
+
+list_result_t heap_free(heap_t** heap) {
+    if (heap == NULL || *heap == NULL)
+        return LIST_NULL_ERROR;
+
+    confetti_allocator_t allocator = (*heap)->list->allocator;
+
+    if ((*heap)->handles != NULL)
+        allocator.deallocate(allocator.context, (*heap)->handles, HEAP_HANDLE_ARRAYS * (*heap)->handleCapacity * sizeof(uint64_t));
+
+    allocator.deallocate(allocator.context, (*heap)->scratch, heap_slot_size(*heap));
+    list_free(&(*heap)->list);
+    allocator.deallocate(allocator.context, *heap, sizeof(heap_t));
+
+    *heap = NULL;
+    return LIST_SUCCESS;
+}
+
+
+list_result_t heap_push(heap_t* const heap, void* const value, const uint64_t size, heap_handle_t* const handleOut) {
+    if (heap == NULL)
+        return LIST_NULL_ERROR;
+    else if (heap->freeCount == 0 && !heap_reserve_handles(heap, heap->handleCount + 1))
+        return LIST_ALLOCATION_FAILURE;
+
+    list_result_t appendResult = list_append(heap->list, value, size);
+
+    if (appendResult != LIST_SUCCESS)
+        return appendResult;
+
+    const int64_t index = heap->list->size - 1;
+    const heap_handle_t handle = heap_acquire_handle(heap);
+
+    heap->handles[index] = handle;
+    heap->positions[handle] = index;
+    heap_sift_up(heap, index);
+
+    if (handleOut != NULL)
+        *handleOut = handle;
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t heap_peek(heap_t* const heap, const void** valueOut, uint64_t* const sizeOut) {
+    if (heap == NULL)
+        return LIST_NULL_ERROR;
+
+    return list_peek(heap->list, valueOut, sizeOut, 0);
+}
+
+
+list_result_t heap_pop(heap_t* const heap, list_element_t** elementOut) {
+    if (heap == NULL)
+        return LIST_NULL_ERROR;
+    else if (heap->list->size == 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    return heap_extract(heap, 0, elementOut);
+}
+
+
+list_result_t heap_decrease_key(heap_t* const heap, const heap_handle_t handle, void* const value, const uint64_t size) {
+    if (heap == NULL)
+        return LIST_NULL_ERROR;
+    else if (!heap_handle_valid(heap, handle))
+        return LIST_ELEMENT_NOT_FOUND_ERROR;
+    else if (value == NULL || (heap->list->stride != 0 && size != heap->list->stride))
+        return LIST_INVALID_PARAMS_ERROR;
+
+    const int64_t index = heap->positions[handle];
+    const void* current = NULL;
+    uint64_t currentSize = 0;
+
+    list_peek(heap->list, &current, &currentSize, index);
+
+    if (heap->list->equalityFunction(value, current, size < currentSize ? size : currentSize) > 0)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    list_result_t setResult = list_set(heap->list, index, value, size);
+
+    if (setResult != LIST_SUCCESS)
+        return setResult;
+
+    heap_sift_up(heap, index);
+    return LIST_SUCCESS;
+}
+
+
+list_result_t heap_remove(heap_t* const heap, const heap_handle_t handle, list_element_t** elementOut) {
+    if (heap == NULL)
+        return LIST_NULL_ERROR;
+    else if (!heap_handle_valid(heap, handle))
+        return LIST_ELEMENT_NOT_FOUND_ERROR;
+
+    return heap_extract(heap, heap->positions[handle], elementOut);
+}
+
+
+list_result_t heap_clear(heap_t* const heap) {
+    if (heap == NULL)
+        return LIST_NULL_ERROR;
+
+    list_result_t clearResult = list_clear(heap->list);
+
+    if (clearResult != LIST_SUCCESS)
+        return clearResult;
+
+    heap->handleCount = 0;
+    heap->freeCount = 0;
+
+    return LIST_SUCCESS;
+}
+
+#pragma endregion
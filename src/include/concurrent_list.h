@@ -0,0 +1,400 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_export.h"
+#include "confetti_allocator.h"
+#include "list.h"
+
+// constant definitions
+
+#define DEFAULT_CONCURRENT_LIST_BATCH_CAPACITY ((int64_t) 256) // The default amount of values a batch collects before flushing if one is not given.
+
+// struct definitions
+
+// define all structs early to avoid errors relating to one of these structs not existing.
+typedef struct concurrent_list concurrent_list_t;
+typedef struct concurrent_list_batch concurrent_list_batch_t;
+
+/**
+ * @brief Type definition for a function run on the list of a concurrent list while its lock is held.
+ *
+ * @param list A pointer to the wrapped list.
+ * @param context The context given along with the function.
+ *
+ * @return A list result, which is handed back to the caller as is.
+ */
+typedef list_result_t (concurrent_list_function_t)(list_t* const list, void* const context);
+
+/**
+ * @brief Represents a list guarded by a reader-writer lock.
+ *
+ * Any amount of threads may read the list at once, while functions modifying it 
+ * wait for exclusive access. Results are the same `list_result_t` values the 
+ * wrapped list returns.
+ *
+ * @warning Please do not access `list` directly while other threads may use the 
+ * concurrent list, use `concurrent_list_read` or `concurrent_list_write` instead.
+ */
+typedef struct concurrent_list {
+    list_t* list; /* The wrapped list. */
+    void* lock;   /* Reader-writer lock guarding the list. */
+} concurrent_list_t;
+
+/**
+ * @brief Represents a per thread batch of values appended to a concurrent list together.
+ *
+ * Values are collected without taking the list's lock and appended in one go once the 
+ * batch is full, so many threads appending at once contend for the lock far less often.
+ *
+ * @warning A batch belongs to a single thread, it must not be shared between threads.
+ */
+typedef struct concurrent_list_batch {
+    concurrent_list_t* list; /* The concurrent list values are flushed to. */
+    uint8_t* values;         /* Values collected so far, `stride` bytes apart. */
+    uint64_t stride;         /* Size in bytes of every value. */
+    int64_t count;           /* Amount of values collected so far. */
+    int64_t capacity;        /* Amount of values collected before flushing. */
+} concurrent_list_batch_t;
+
+// public function definitions
+
+#pragma region public function definitions
+
+/**
+ * @brief Creates a new concurrent list.
+ *
+ * @param concurrentListOut A double pointer to where the created concurrent list will be stored.
+ * @param capacity The initial capacity of the list. If less than 1, the `DEFAULT_LIST_CAPACITY` will be used.
+ * @param customEqualityFunction A pointer to a custom equality function, or NULL to use the default.
+ * @param customSortingFunction A pointer to a custom sorting function, or NULL to use the default.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the concurrent list was created successfully. 
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_create(
+    concurrent_list_t** concurrentListOut, 
+    const int64_t capacity, 
+    list_custom_equality_function_t* const customEqualityFunction, 
+    list_custom_sorting_function_t* const customSortingFunction
+);
+
+/**
+ * @brief Creates a new concurrent list whose list is described by a set of options.
+ *
+ * @param concurrentListOut A double pointer to where the created concurrent list will be stored.
+ * @param options A pointer to the options describing the wrapped list.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the concurrent list was created successfully. 
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the options or the allocator they describe are invalid.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note The concurrent list and its lock are requested from the same allocator as the list.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_create_with_options(concurrent_list_t** concurrentListOut, const list_options_t* const options);
+
+/**
+ * @brief Frees a concurrent list along with its list.
+ *
+ * @param concurrentList A double pointer to the concurrent list to be freed.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the concurrent list was freed successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ * 
+ * @note Sets the concurrent list pointer to NULL after freeing.
+ * @warning No other thread may be using the concurrent list while it is freed.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_free(concurrent_list_t** concurrentList);
+
+/**
+ * @brief Retrieves the amount of elements in the concurrent list.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param sizeOut A pointer to where the amount of elements will be stored.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the size was retrieved successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the size pointer is NULL.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_size(concurrent_list_t* const concurrentList, int64_t* const sizeOut);
+
+/**
+ * @brief Appends a copy of a value to the end of the concurrent list.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param value A pointer to the value to be appended.
+ * @param size The size of the value.
+ * 
+ * @return The result of `list_append`, or `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_append(concurrent_list_t* const concurrentList, void* const value, const uint64_t size);
+
+/**
+ * @brief Appends multiple values to the end of the concurrent list while taking its lock once.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param values A pointer to `count` values laid out contiguously, `stride` bytes apart.
+ * @param count The amount of values to append.
+ * @param stride The size of each value.
+ * 
+ * @return The result of `list_append_many`, or `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_append_many(
+    concurrent_list_t* const concurrentList, 
+    const void* const values, 
+    const int64_t count, 
+    const uint64_t stride
+);
+
+/**
+ * @brief Inserts a copy of a value at a specified index of the concurrent list.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param index The index at which the value will be inserted.
+ * @param value A pointer to the value to be inserted.
+ * @param size The size of the value.
+ * 
+ * @return The result of `list_insert`, or `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_insert(
+    concurrent_list_t* const concurrentList, 
+    const int64_t index, 
+    void* const value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Retrieves a clone of an element of the concurrent list.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param elementOut A double pointer to where the cloned element will be set.
+ * @param index The index of the element.
+ * 
+ * @return The result of `list_get`, or `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ * 
+ * @note A clone is handed out since a borrowed value could be changed by another thread 
+ *       as soon as the lock is released, it is recomended to free it with `list_element_free`.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_get(concurrent_list_t* const concurrentList, list_element_t** elementOut, const int64_t index);
+
+/**
+ * @brief Replaces the value of an element of the concurrent list.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param index The index of the element.
+ * @param value A pointer to the new value.
+ * @param size The size of the new value.
+ * 
+ * @return The result of `list_set`, or `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_set(
+    concurrent_list_t* const concurrentList, 
+    const int64_t index, 
+    void* const value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Removes an element from the concurrent list.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param index The index of the element.
+ * 
+ * @return The result of `list_remove`, or `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_remove(concurrent_list_t* const concurrentList, const int64_t index);
+
+/**
+ * @brief Removes an element from the concurrent list and hands it to the caller.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param elementOut A double pointer to where the removed element will be set.
+ * @param index The index of the element.
+ * 
+ * @return The result of `list_pop`, or `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ * 
+ * @note Freeing the outputted element is your responsibility, it is recomended to use `list_element_free` for this.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_pop(concurrent_list_t* const concurrentList, list_element_t** elementOut, const int64_t index);
+
+/**
+ * @brief Checks if the concurrent list contains a value.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param value A pointer to the value to search for.
+ * @param size The size of the value.
+ * 
+ * @return The result of `list_includes`, or `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ * 
+ * @note Searches of a list with a hash index attached may rebuild the index, so they wait for exclusive access.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_includes(concurrent_list_t* const concurrentList, void* const value, const uint64_t size);
+
+/**
+ * @brief Finds the first occurrence of a value in the concurrent list.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param indexOut A pointer to where the index of the found element will be stored.
+ * @param startIndex The index from which to start the search.
+ * @param value A pointer to the value to search for.
+ * @param size The size of the value.
+ * 
+ * @return The result of `list_find_first`, or `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ * 
+ * @note Searches of a list with a hash index attached may rebuild the index, so they wait for exclusive access.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_find_first(
+    concurrent_list_t* const concurrentList, 
+    int64_t* const indexOut, 
+    const int64_t startIndex, 
+    void* const value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Runs a function on the list while holding the lock for reading.
+ *
+ * Other readers may run at the same time, so the function must not modify the list.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param function The function to run.
+ * @param context The context handed to the function.
+ * 
+ * @return 
+ * - The result of the function.
+ * 
+ * - `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the function is NULL.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_read(
+    concurrent_list_t* const concurrentList, 
+    concurrent_list_function_t* const function, 
+    void* const context
+);
+
+/**
+ * @brief Runs a function on the list while holding the lock exclusively.
+ *
+ * This lets several operations, such as a search followed by a removal, happen as one.
+ *
+ * @param concurrentList A pointer to the concurrent list.
+ * @param function The function to run.
+ * @param context The context handed to the function.
+ * 
+ * @return 
+ * - The result of the function.
+ * 
+ * - `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the function is NULL.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_write(
+    concurrent_list_t* const concurrentList, 
+    concurrent_list_function_t* const function, 
+    void* const context
+);
+
+/**
+ * @brief Creates a new batch collecting values for a concurrent list.
+ *
+ * @param batchOut A double pointer to where the created batch will be stored.
+ * @param concurrentList A pointer to the concurrent list values are flushed to.
+ * @param capacity The amount of values collected before flushing. If less than 1, the `DEFAULT_CONCURRENT_LIST_BATCH_CAPACITY` will be used.
+ * @param stride The size in bytes of every value.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the batch was created successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided concurrent list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the stride is 0.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_batch_create(
+    concurrent_list_batch_t** batchOut, 
+    concurrent_list_t* const concurrentList, 
+    const int64_t capacity, 
+    const uint64_t stride
+);
+
+/**
+ * @brief Adds a copy of a value to a batch, flushing the batch first if it is full.
+ *
+ * @param batch A pointer to the batch.
+ * @param value A pointer to `stride` bytes to be copied into the batch.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the value was added successfully.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the batch or value is NULL.
+ * 
+ * - The result of flushing the batch if it failed, in which case the value isn't added.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_batch_append(concurrent_list_batch_t* const batch, const void* const value);
+
+/**
+ * @brief Appends every value collected by a batch to its concurrent list and empties the batch.
+ *
+ * @param batch A pointer to the batch.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the values were flushed successfully.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the batch is NULL.
+ * 
+ * - The result of `concurrent_list_append_many` if it failed, in which case the batch keeps its values.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_batch_flush(concurrent_list_batch_t* const batch);
+
+/**
+ * @brief Flushes a batch and frees it.
+ *
+ * @param batch A double pointer to the batch to be freed.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the batch was flushed and freed successfully.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the provided batch pointer is NULL.
+ * 
+ * - The result of `concurrent_list_batch_flush` if it failed, in which case the batch isn't freed.
+ * 
+ * @note Sets the batch pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT list_result_t concurrent_list_batch_free(concurrent_list_batch_t** batch);
+
+#pragma endregion
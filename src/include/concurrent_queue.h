@@ -0,0 +1,251 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_export.h"
+#include "confetti_allocator.h"
+
+// constant definitions
+
+#define CONCURRENT_QUEUE_CHUNK_CAPACITY ((uint64_t) 64) // The amount of nodes in the first chunk of a concurrent queue, every later chunk doubles it.
+#define CONCURRENT_QUEUE_MAX_CHUNKS ((uint32_t) 26)     // The most chunks a concurrent queue has, enough for every 32 bit node handle.
+#define CONCURRENT_QUEUE_PADDING_SIZE ((uint64_t) 56)   // Padding keeping the ends of a concurrent queue on separate cache lines.
+
+// struct definitions
+
+// define all structs early to avoid errors relating to one of these structs not existing.
+typedef struct concurrent_queue concurrent_queue_t;
+typedef struct concurrent_queue_node concurrent_queue_node_t;
+typedef struct concurrent_queue_element concurrent_queue_element_t;
+typedef struct concurrent_queue_options concurrent_queue_options_t;
+typedef enum concurrent_queue_result concurrent_queue_result_t;
+
+/**
+ * @brief Represents an element of a concurrent queue.
+ */
+typedef struct concurrent_queue_element {
+    void* value;   /* Pointer to the data stored in the element. */
+    uint64_t size; /* Size of the data in bytes. */
+} concurrent_queue_element_t;
+
+/**
+ * @brief Represents a node of a concurrent queue.
+ *
+ * Nodes are referred to by tagged handles, the low 32 bits of which are the node's 
+ * position in the queue's chunks plus one and the high 32 bits a counter bumped on 
+ * every change, so a node that is recycled between a thread reading a link and 
+ * swapping it is never mistaken for the node it used to be.
+ */
+typedef struct concurrent_queue_node {
+    volatile uint64_t next;                       /* Tagged handle of the next node, or of the next free node while recycled. */
+    concurrent_queue_element_t* volatile element; /* The element the node carries. */
+} concurrent_queue_node_t;
+
+/**
+ * @brief Represents an unbounded lock-free queue any amount of threads can push to and pop from.
+ *
+ * This is a Michael-Scott queue: a singly linked list of nodes starting at a dummy node, whose 
+ * ends are swung forward with compare and swap. Popped nodes are recycled through a lock-free 
+ * free list instead of being freed, and the chunks nodes are carved from are only released 
+ * when the queue is freed, which keeps reading a node that was popped by another thread safe.
+ * 
+ * Chunks, including the queue itself, are requested from `allocator`.
+ *
+ * @warning Please do not modify any field of this structure, every function but 
+ * `concurrent_queue_create`, `concurrent_queue_create_with_options` and `concurrent_queue_free` may be called concurrently.
+ */
+typedef struct concurrent_queue {
+    volatile uint64_t head;                                                /* Tagged handle of the dummy node in front of the first element. */
+    uint8_t padding0[CONCURRENT_QUEUE_PADDING_SIZE];                       /* Keeps the head and tail on separate lines. */
+    volatile uint64_t tail;                                                /* Tagged handle of the last node, or of a node shortly before it. */
+    uint8_t padding1[CONCURRENT_QUEUE_PADDING_SIZE];                       /* Keeps the tail and free list on separate lines. */
+    volatile uint64_t freeList;                                            /* Tagged handle of the first recycled node. */
+    volatile uint64_t nodeCount;                                           /* Amount of nodes handed out from the chunks so far. */
+    concurrent_queue_node_t* volatile chunks[CONCURRENT_QUEUE_MAX_CHUNKS]; /* Chunks of nodes, allocated as they are first needed. */
+    confetti_allocator_t allocator;                                        /* Allocator the queue's memory is requested from. */
+} concurrent_queue_t;
+
+/**
+ * @brief Represents the options a concurrent queue is created with.
+ *
+ * A zero initialized `concurrent_queue_options_t` describes a default concurrent queue.
+ */
+typedef struct concurrent_queue_options {
+    const confetti_allocator_t* allocator; /* Allocator to request memory from, or NULL to use the default. */
+} concurrent_queue_options_t;
+
+// enum definitions
+
+/**
+ * @brief Represents the result of a concurrent queue operation.
+ *
+ * Positive values indicate success, while negative values
+ * represent specific error conditions.
+ */
+typedef enum concurrent_queue_result {
+    /**
+     * @brief Completed successfully.
+     */
+    CONCURRENT_QUEUE_SUCCESS = 1,
+
+    /**
+     * @brief Error: Concurrent queue is null.
+     * 
+     * This error occurs when an operation is attempted on a concurrent queue
+     * that has not been initialized (i.e., it is null).
+     */
+    CONCURRENT_QUEUE_NULL_ERROR = -3,
+
+    /**
+     * @brief Error: Invalid parameters provided.
+     * 
+     * This error indicates that the parameters passed to a concurrent queue
+     * operation are not valid.
+     */
+    CONCURRENT_QUEUE_INVALID_PARAMS_ERROR = -4,
+
+    /**
+     * @brief Error: Memory allocation failure.
+     * 
+     * This error occurs when the system is unable to allocate
+     * the necessary memory for the operation.
+     */
+    CONCURRENT_QUEUE_ALLOCATION_FAILURE = -5,
+
+    /**
+     * @brief Error: Concurrent queue is empty.
+     * 
+     * This error occurs when an element is popped while the queue holds none.
+     */
+    CONCURRENT_QUEUE_EMPTY_ERROR = -7
+} concurrent_queue_result_t;
+
+// public function definitions
+
+#pragma region public function definitions
+
+/**
+ * @brief Creates a new concurrent queue.
+ *
+ * @param concurrentQueueOut A double pointer to where the created concurrent queue will be stored.
+ * 
+ * @return 
+ * - `CONCURRENT_QUEUE_SUCCESS` if the concurrent queue was created successfully. 
+ * 
+ * - `CONCURRENT_QUEUE_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT concurrent_queue_result_t concurrent_queue_create(concurrent_queue_t** concurrentQueueOut);
+
+/**
+ * @brief Creates a new concurrent queue described by a set of options.
+ *
+ * @param concurrentQueueOut A double pointer to where the created concurrent queue will be stored.
+ * @param options A pointer to the options describing the concurrent queue.
+ * 
+ * @return 
+ * - `CONCURRENT_QUEUE_SUCCESS` if the concurrent queue was created successfully. 
+ * 
+ * - `CONCURRENT_QUEUE_INVALID_PARAMS_ERROR` if the options or the allocator they describe are invalid.
+ * 
+ * - `CONCURRENT_QUEUE_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Elements are always allocated with the default allocator, since they are handed 
+ *       to the caller by `concurrent_queue_pop` and freed by `concurrent_queue_element_free`.
+ */
+CONFETTI_EXPORT concurrent_queue_result_t concurrent_queue_create_with_options(
+    concurrent_queue_t** concurrentQueueOut, 
+    const concurrent_queue_options_t* const options
+);
+
+/**
+ * @brief Frees a concurrent queue along with every element in it.
+ *
+ * @param concurrentQueue A double pointer to the concurrent queue to be freed.
+ * 
+ * @return 
+ * - `CONCURRENT_QUEUE_SUCCESS` if the concurrent queue was freed successfully.
+ * 
+ * - `CONCURRENT_QUEUE_NULL_ERROR` if the provided concurrent queue pointer is NULL.
+ * 
+ * @note Sets the concurrent queue pointer to NULL after freeing.
+ * @warning No other thread may be using the concurrent queue while it is freed.
+ */
+CONFETTI_EXPORT concurrent_queue_result_t concurrent_queue_free(concurrent_queue_t** concurrentQueue);
+
+/**
+ * @brief Pushes a copy of a value to the back of the concurrent queue.
+ *
+ * @param concurrentQueue A pointer to the concurrent queue.
+ * @param value A pointer to the value to be copied into the queue.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `CONCURRENT_QUEUE_SUCCESS` if the value was pushed successfully.
+ * 
+ * - `CONCURRENT_QUEUE_NULL_ERROR` if the provided concurrent queue pointer is NULL.
+ * 
+ * - `CONCURRENT_QUEUE_INVALID_PARAMS_ERROR` if the value is NULL.
+ * 
+ * - `CONCURRENT_QUEUE_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT concurrent_queue_result_t concurrent_queue_push(concurrent_queue_t* const concurrentQueue, const void* const value, const uint64_t size);
+
+/**
+ * @brief Removes the element at the front of the concurrent queue and hands it to the caller.
+ *
+ * The element pushed is handed over as is, without copying its value again.
+ *
+ * @param concurrentQueue A pointer to the concurrent queue.
+ * @param elementOut A double pointer where the element will be stored.
+ * 
+ * @return 
+ * - `CONCURRENT_QUEUE_SUCCESS` if an element was popped successfully.
+ * 
+ * - `CONCURRENT_QUEUE_NULL_ERROR` if the provided concurrent queue pointer is NULL.
+ * 
+ * - `CONCURRENT_QUEUE_INVALID_PARAMS_ERROR` if the element pointer is NULL.
+ * 
+ * - `CONCURRENT_QUEUE_EMPTY_ERROR` if the concurrent queue is empty.
+ * 
+ * @note Freeing the outputted element is your responsibility, it is recomended to use `concurrent_queue_element_free` for this.
+ */
+CONFETTI_EXPORT concurrent_queue_result_t concurrent_queue_pop(concurrent_queue_t* const concurrentQueue, concurrent_queue_element_t** elementOut);
+
+/**
+ * @brief Frees the memory allocated for a concurrent queue element.
+ *
+ * @param element A pointer to a pointer to the concurrent queue element to be freed.
+ * 
+ * @return 
+ * - `CONCURRENT_QUEUE_SUCCESS` if the element was successfully freed.
+ * 
+ * - `CONCURRENT_QUEUE_INVALID_PARAMS_ERROR` if the provided element pointer is NULL.
+ * 
+ * @note Sets the element pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT concurrent_queue_result_t concurrent_queue_element_free(concurrent_queue_element_t** element);
+
+#pragma endregion
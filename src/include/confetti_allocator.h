@@ -0,0 +1,281 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_export.h"
+
+// constant definitions
+
+#define CONFETTI_ALLOCATOR_ALIGNMENT ((uint64_t) 16) // The alignment of every block handed out by the arena and pool allocators.
+#define DEFAULT_CONFETTI_ARENA_BLOCK_SIZE ((uint64_t) 65536) // The default arena block size used if one is not given.
+#define DEFAULT_CONFETTI_POOL_SLAB_CAPACITY ((uint64_t) 256) // The default amount of blocks per pool slab used if one is not given.
+
+// struct definitions
+
+// define all structs early to avoid errors relating to one of these structs not existing.
+typedef struct confetti_allocator confetti_allocator_t;
+typedef struct confetti_arena confetti_arena_t;
+typedef struct confetti_arena_block confetti_arena_block_t;
+typedef struct confetti_pool confetti_pool_t;
+typedef enum confetti_allocator_result confetti_allocator_result_t;
+
+/**
+ * @brief Type definition for an allocation function.
+ *
+ * @param context The user context of the allocator.
+ * @param size The size in bytes of the block to allocate.
+ *
+ * @return A pointer to the allocated block, or NULL if the allocation failed.
+ */
+typedef void* (confetti_allocate_function_t)(void* const context, const uint64_t size);
+
+/**
+ * @brief Type definition for a reallocation function.
+ *
+ * The contents of the block are preserved up to the smaller of the two sizes.
+ * If the reallocation fails the original block is left untouched.
+ *
+ * @param context The user context of the allocator.
+ * @param block A pointer to the block to reallocate, or NULL to allocate a new block.
+ * @param oldSize The size in bytes the block was allocated with.
+ * @param newSize The new size in bytes of the block.
+ *
+ * @return A pointer to the reallocated block, or NULL if the reallocation failed.
+ */
+typedef void* (confetti_reallocate_function_t)(void* const context, void* const block, const uint64_t oldSize, const uint64_t newSize);
+
+/**
+ * @brief Type definition for a deallocation function.
+ *
+ * @param context The user context of the allocator.
+ * @param block A pointer to the block to free, may be NULL.
+ * @param size The size in bytes the block was allocated with.
+ */
+typedef void (confetti_deallocate_function_t)(void* const context, void* const block, const uint64_t size);
+
+/**
+ * @brief Represents a memory allocator used by confetti data structures.
+ *
+ * Every function is given the allocator's context along with the size of the
+ * block involved, so allocators which don't keep per block headers can be used.
+ */
+typedef struct confetti_allocator {
+    confetti_allocate_function_t* allocate;     /* Function allocating a new block. */
+    confetti_reallocate_function_t* reallocate; /* Function resizing an existing block. */
+    confetti_deallocate_function_t* deallocate; /* Function freeing a block. */
+    void* context;                              /* User context passed to every function. */
+} confetti_allocator_t;
+
+/**
+ * @brief Represents a block of memory owned by an arena.
+ */
+typedef struct confetti_arena_block {
+    confetti_arena_block_t* next; /* The previously filled block of the arena. */
+    uint64_t capacity;            /* Amount of usable bytes following this header. */
+    uint64_t used;                /* Amount of bytes already handed out from this block. */
+} confetti_arena_block_t;
+
+/**
+ * @brief Represents a bump arena allocator.
+ *
+ * An arena hands out memory by moving a cursor forward inside large blocks
+ * requested from the heap. Individual frees are ignored, instead every
+ * allocation is released at once by `confetti_arena_reset` or `confetti_arena_free`.
+ */
+typedef struct confetti_arena {
+    confetti_allocator_t allocator;  /* Allocator handing out memory from this arena. */
+    confetti_arena_block_t* current; /* The block allocations are currently made from. */
+    uint64_t blockSize;              /* The minimum capacity of every block. */
+} confetti_arena_t;
+
+/**
+ * @brief Represents a fixed size slab pool allocator.
+ *
+ * A pool hands out blocks of one fixed size from slabs it requests from its
+ * fallback allocator and recycles freed blocks through a free list. Requests
+ * larger than the block size are forwarded to the fallback allocator.
+ */
+typedef struct confetti_pool {
+    confetti_allocator_t allocator; /* Allocator handing out memory from this pool. */
+    confetti_allocator_t fallback;  /* Allocator slabs and large requests are served by. */
+    void* freeList;                 /* Singly linked list of free blocks. */
+    void* slabs;                    /* Singly linked list of allocated slabs. */
+    uint64_t blockSize;             /* The size of every block, rounded up to `CONFETTI_ALLOCATOR_ALIGNMENT`. */
+    uint64_t slabCapacity;          /* The amount of blocks in every slab. */
+} confetti_pool_t;
+
+// enum definitions
+
+/**
+ * @brief Represents the result of an allocator operation.
+ *
+ * Positive values indicate success, while negative values
+ * represent specific error conditions.
+ */
+typedef enum confetti_allocator_result {
+    /**
+     * @brief Completed successfully.
+     */
+    CONFETTI_ALLOCATOR_SUCCESS = 1,
+
+    /**
+     * @brief Error: Allocator is null.
+     *
+     * This error occurs when an operation is attempted on an
+     * arena or pool that has not been initialized (i.e., it is null).
+     */
+    CONFETTI_ALLOCATOR_NULL_ERROR = -3,
+
+    /**
+     * @brief Error: Invalid parameters provided.
+     *
+     * This error indicates that the parameters passed to an
+     * allocator operation are not valid.
+     */
+    CONFETTI_ALLOCATOR_INVALID_PARAMS_ERROR = -4,
+
+    /**
+     * @brief Error: Memory allocation failure.
+     *
+     * This error occurs when the system is unable to allocate
+     * the necessary memory for the operation.
+     */
+    CONFETTI_ALLOCATOR_ALLOCATION_FAILURE = -5
+} confetti_allocator_result_t;
+
+// public function definitions
+
+#pragma region public function definitions
+
+/**
+ * @brief Returns the allocator backed by `malloc`, `realloc` and `free`.
+ *
+ * This is the allocator data structures use when none is given to them.
+ *
+ * @return A pointer to the default allocator, it must not be modified.
+ */
+CONFETTI_EXPORT const confetti_allocator_t* confetti_allocator_default(void);
+
+/**
+ * @brief Creates a new arena allocator.
+ *
+ * @param arenaOut A double pointer to where the created arena will be stored.
+ * @param blockSize The minimum size of the blocks the arena requests from the heap.
+ *                  If 0, the `DEFAULT_CONFETTI_ARENA_BLOCK_SIZE` will be used.
+ *
+ * @return
+ * - `CONFETTI_ALLOCATOR_SUCCESS` if the arena was created successfully.
+ *
+ * - `CONFETTI_ALLOCATOR_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT confetti_allocator_result_t confetti_arena_create(confetti_arena_t** arenaOut, const uint64_t blockSize);
+
+/**
+ * @brief Releases every allocation made from the arena at once.
+ *
+ * The first block of the arena is kept for reuse and every other block is returned to the heap.
+ *
+ * @param arena A pointer to the arena to reset.
+ *
+ * @return
+ * - `CONFETTI_ALLOCATOR_SUCCESS` if the arena was reset successfully.
+ *
+ * - `CONFETTI_ALLOCATOR_NULL_ERROR` if the provided arena pointer is NULL.
+ *
+ * @warning Data structures allocated from the arena must not be used after it is reset.
+ */
+CONFETTI_EXPORT confetti_allocator_result_t confetti_arena_reset(confetti_arena_t* const arena);
+
+/**
+ * @brief Frees an arena along with every allocation made from it.
+ *
+ * @param arena A double pointer to the arena to be freed.
+ *
+ * @return
+ * - `CONFETTI_ALLOCATOR_SUCCESS` if the arena was freed successfully.
+ *
+ * - `CONFETTI_ALLOCATOR_NULL_ERROR` if the provided arena pointer is NULL.
+ *
+ * @note Sets the arena pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT confetti_allocator_result_t confetti_arena_free(confetti_arena_t** arena);
+
+/**
+ * @brief Creates a new pool allocator.
+ *
+ * @param poolOut A double pointer to where the created pool will be stored.
+ * @param blockSize The size of the blocks served by the pool.
+ * @param slabCapacity The amount of blocks allocated at once when the pool runs dry.
+ *                     If 0, the `DEFAULT_CONFETTI_POOL_SLAB_CAPACITY` will be used.
+ * @param fallback The allocator used for slabs and for requests larger than the
+ *                 block size, or NULL to use the default allocator.
+ *
+ * @return
+ * - `CONFETTI_ALLOCATOR_SUCCESS` if the pool was created successfully.
+ *
+ * - `CONFETTI_ALLOCATOR_INVALID_PARAMS_ERROR` if the block size is 0.
+ *
+ * - `CONFETTI_ALLOCATOR_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ *
+ * @note A pool serving linked list nodes should use `LINKED_LIST_NODE_ALLOCATION_SIZE` as its block size.
+ */
+CONFETTI_EXPORT confetti_allocator_result_t confetti_pool_create(
+    confetti_pool_t** poolOut,
+    const uint64_t blockSize,
+    const uint64_t slabCapacity,
+    const confetti_allocator_t* const fallback);
+
+/**
+ * @brief Returns every block to the pool at once by releasing its slabs.
+ *
+ * @param pool A pointer to the pool to reset.
+ *
+ * @return
+ * - `CONFETTI_ALLOCATOR_SUCCESS` if the pool was reset successfully.
+ *
+ * - `CONFETTI_ALLOCATOR_NULL_ERROR` if the provided pool pointer is NULL.
+ *
+ * @warning Data structures allocated from the pool must not be used after it is reset.
+ *          Requests that were forwarded to the fallback allocator are not released.
+ */
+CONFETTI_EXPORT confetti_allocator_result_t confetti_pool_reset(confetti_pool_t* const pool);
+
+/**
+ * @brief Frees a pool along with all of its slabs.
+ *
+ * @param pool A double pointer to the pool to be freed.
+ *
+ * @return
+ * - `CONFETTI_ALLOCATOR_SUCCESS` if the pool was freed successfully.
+ *
+ * - `CONFETTI_ALLOCATOR_NULL_ERROR` if the provided pool pointer is NULL.
+ *
+ * @note Sets the pool pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT confetti_allocator_result_t confetti_pool_free(confetti_pool_t** pool);
+
+#pragma endregion
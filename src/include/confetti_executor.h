@@ -0,0 +1,193 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_export.h"
+
+// struct definitions
+
+// define all structs early to avoid errors relating to one of these structs not existing.
+typedef struct confetti_executor confetti_executor_t;
+typedef struct confetti_thread_pool confetti_thread_pool_t;
+typedef enum confetti_executor_result confetti_executor_result_t;
+
+/**
+ * @brief Type definition for a task run by an executor.
+ *
+ * @param context The context given along with the task.
+ * @param index The index of the task, between 0 and the amount of tasks.
+ */
+typedef void (confetti_task_function_t)(void* const context, const uint64_t index);
+
+/**
+ * @brief Type definition for the function an executor runs a batch of tasks with.
+ *
+ * The function must call `task` once for every index from 0 up to `count`, in any order 
+ * and on any threads, and only return once every call has returned.
+ *
+ * @param context The user context of the executor.
+ * @param task The task to run.
+ * @param taskContext The context to hand to every call of the task.
+ * @param count The amount of tasks.
+ */
+typedef void (confetti_executor_function_t)(
+    void* const context, 
+    confetti_task_function_t* const task, 
+    void* const taskContext, 
+    const uint64_t count
+);
+
+/**
+ * @brief Represents a hook parallel algorithms run their tasks through.
+ *
+ * Pointing `run` at an existing thread pool lets confetti share the threads 
+ * of an application instead of starting its own.
+ */
+typedef struct confetti_executor {
+    confetti_executor_function_t* run; /* Function running a batch of tasks. */
+    void* context;                     /* User context passed to `run`. */
+} confetti_executor_t;
+
+/**
+ * @brief Represents a fixed set of worker threads running batches of tasks.
+ *
+ * The thread calling into the pool works through the batch alongside the workers,
+ * so a pool of `threadCount` threads starts `threadCount - 1` of them.
+ */
+typedef struct confetti_thread_pool {
+    confetti_executor_t executor; /* Executor running tasks on this pool. */
+    uint64_t threadCount;         /* Amount of threads working through every batch, including the caller. */
+    void* state;                  /* Worker threads and their synchronization, owned by the pool. */
+} confetti_thread_pool_t;
+
+// enum definitions
+
+/**
+ * @brief Represents the result of an executor operation.
+ *
+ * Positive values indicate success, while negative values
+ * represent specific error conditions.
+ */
+typedef enum confetti_executor_result {
+    /**
+     * @brief Completed successfully.
+     */
+    CONFETTI_EXECUTOR_SUCCESS = 1,
+
+    /**
+     * @brief Error: Thread pool is null.
+     *
+     * This error occurs when an operation is attempted on a
+     * thread pool that has not been initialized (i.e., it is null).
+     */
+    CONFETTI_EXECUTOR_NULL_ERROR = -3,
+
+    /**
+     * @brief Error: Invalid parameters provided.
+     *
+     * This error indicates that the parameters passed to an
+     * executor operation are not valid.
+     */
+    CONFETTI_EXECUTOR_INVALID_PARAMS_ERROR = -4,
+
+    /**
+     * @brief Error: Memory allocation failure.
+     *
+     * This error occurs when the system is unable to allocate the 
+     * necessary memory or threads for the operation.
+     */
+    CONFETTI_EXECUTOR_ALLOCATION_FAILURE = -5
+} confetti_executor_result_t;
+
+// public function definitions
+
+#pragma region public function definitions
+
+/**
+ * @brief Returns the amount of processors available to the process.
+ *
+ * @return The amount of online processors, at least 1.
+ */
+CONFETTI_EXPORT uint64_t confetti_executor_default_thread_count(void);
+
+/**
+ * @brief Runs a batch of tasks and waits for all of them to return.
+ *
+ * @param executor A pointer to the executor to run the tasks with, or NULL to start 
+ *                 up to `threadCount - 1` threads for the batch and work alongside them.
+ * @param threadCount The amount of threads used when no executor is given. If 0, 
+ *                    `confetti_executor_default_thread_count` will be used.
+ * @param task The task to run.
+ * @param taskContext The context to hand to every call of the task.
+ * @param count The amount of tasks.
+ *
+ * @return
+ * - `CONFETTI_EXECUTOR_SUCCESS` once every task has returned.
+ *
+ * - `CONFETTI_EXECUTOR_INVALID_PARAMS_ERROR` if the task is NULL.
+ *
+ * @note If threads can't be started the remaining tasks are run by the calling thread.
+ */
+CONFETTI_EXPORT confetti_executor_result_t confetti_executor_run(
+    const confetti_executor_t* const executor, 
+    const uint64_t threadCount, 
+    confetti_task_function_t* const task, 
+    void* const taskContext, 
+    const uint64_t count
+);
+
+/**
+ * @brief Creates a new thread pool.
+ *
+ * @param poolOut A double pointer to where the created thread pool will be stored.
+ * @param threadCount The amount of threads working through every batch, including the caller. 
+ *                    If 0, `confetti_executor_default_thread_count` will be used.
+ *
+ * @return
+ * - `CONFETTI_EXECUTOR_SUCCESS` if the thread pool was created successfully.
+ *
+ * - `CONFETTI_EXECUTOR_ALLOCATION_FAILURE` if the system couldn't allocate enough memory or threads for the operation.
+ *
+ * @warning Tasks run on a pool must not run another batch on the same pool.
+ */
+CONFETTI_EXPORT confetti_executor_result_t confetti_thread_pool_create(confetti_thread_pool_t** poolOut, const uint64_t threadCount);
+
+/**
+ * @brief Stops the workers of a thread pool and frees it.
+ *
+ * @param pool A double pointer to the thread pool to be freed.
+ *
+ * @return
+ * - `CONFETTI_EXECUTOR_SUCCESS` if the thread pool was freed successfully.
+ *
+ * - `CONFETTI_EXECUTOR_NULL_ERROR` if the provided thread pool pointer is NULL.
+ *
+ * @note Sets the thread pool pointer to NULL after freeing.
+ * @warning No batch may be running on the pool while it is freed.
+ */
+CONFETTI_EXPORT confetti_executor_result_t confetti_thread_pool_free(confetti_thread_pool_t** pool);
+
+#pragma endregion
@@ -0,0 +1,759 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_allocator.h"
+#include "list.h"
+#include "linked_list.h"
+
+// constant definitions
+
+#define CONFETTI_TEMPLATE_INSERTION_SORT_THRESHOLD ((int64_t) 16) // Portions of at most this many values are sorted with insertion sort.
+
+/**
+ * @brief Three way comparison of two numbers, usable as the comparator of the generated containers.
+ *
+ * @return `-1` if the first number is smaller, `1` if it is larger and `0` if both are equal.
+ */
+#define CONFETTI_COMPARE_NUMBERS(a, b) (((a) > (b)) - ((a) < (b)))
+
+// list generation
+
+/**
+ * @brief Defines a list storing values of one type by value, with its comparator inlined.
+ *
+ * Generates the type `name##_t` along with `static inline` functions named after 
+ * their `list.h` counterparts, returning the same `list_result_t` values:
+ * 
+ * `name##_create`, `name##_free`, `name##_init`, `name##_deinit`, `name##_reserve`, 
+ * `name##_shrink_to_fit`, `name##_append`, `name##_prepend`, `name##_insert`, `name##_get`, 
+ * `name##_peek`, `name##_set`, `name##_remove`, `name##_pop`, `name##_clear`, `name##_includes`, 
+ * `name##_find_first`, `name##_swap`, `name##_reverse` and `name##_sort`.
+ * 
+ * Values are passed and returned by value and compared by `compare`, so the compiler 
+ * sees every operation on them and no function is called through a pointer.
+ *
+ * @param name The prefix of the generated type and functions.
+ * @param type The type of the stored values, it must be copyable by assignment.
+ * @param compare A function or function-like macro taking two values, returning a negative value 
+ *                if the first comes before the second, a positive value if it comes after it and 
+ *                `0` if they are equal, such as `CONFETTI_COMPARE_NUMBERS`.
+ * 
+ * @note Must be used once per name at file scope, typically in a header shared by every user of the list.
+ */
+#define CONFETTI_DEFINE_LIST(name, type, compare) \
+    \
+    typedef struct name { \
+        type* values;                   /* Contiguous buffer of the values. */ \
+        int64_t size;                   /* Current number of values in the list. */ \
+        int64_t capacity;               /* Amount of values the buffer has room for. */ \
+        confetti_allocator_t allocator; /* Allocator the buffer is requested from. */ \
+    } name##_t; \
+    \
+    static inline list_result_t name##_init(name##_t* const list, const int64_t capacity, const confetti_allocator_t* const allocator) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        \
+        list->allocator = allocator == NULL ? *confetti_allocator_default() : *allocator; \
+        list->size = 0; \
+        list->capacity = capacity < 1 ? DEFAULT_LIST_CAPACITY : capacity; \
+        list->values = (type*) list->allocator.allocate(list->allocator.context, sizeof(type) * (uint64_t) list->capacity); \
+        \
+        if (list->values == NULL) \
+            return LIST_ALLOCATION_FAILURE; \
+        \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_deinit(name##_t* const list) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        \
+        list->allocator.deallocate(list->allocator.context, list->values, sizeof(type) * (uint64_t) list->capacity); \
+        list->values = NULL; \
+        list->size = 0; \
+        list->capacity = 0; \
+        \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_create(name##_t** listOut, const int64_t capacity, const confetti_allocator_t* const allocator) { \
+        const confetti_allocator_t* const source = allocator == NULL ? confetti_allocator_default() : allocator; \
+        name##_t* const list = (name##_t*) source->allocate(source->context, sizeof(name##_t)); \
+        \
+        if (list == NULL) \
+            return LIST_ALLOCATION_FAILURE; \
+        \
+        if (name##_init(list, capacity, source) != LIST_SUCCESS) { \
+            source->deallocate(source->context, list, sizeof(name##_t)); \
+            return LIST_ALLOCATION_FAILURE; \
+        } \
+        \
+        *listOut = list; \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_free(name##_t** list) { \
+        if (list == NULL || *list == NULL) \
+            return LIST_NULL_ERROR; \
+        \
+        confetti_allocator_t allocator = (*list)->allocator; \
+        \
+        name##_deinit(*list); \
+        allocator.deallocate(allocator.context, *list, sizeof(name##_t)); \
+        *list = NULL; \
+        \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_reserve(name##_t* const list, const int64_t capacity) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        else if (capacity < 0) \
+            return LIST_INVALID_PARAMS_ERROR; \
+        else if (capacity <= list->capacity) \
+            return LIST_SUCCESS; \
+        \
+        type* const values = (type*) list->allocator.reallocate( \
+            list->allocator.context, \
+            list->values, \
+            sizeof(type) * (uint64_t) list->capacity, \
+            sizeof(type) * (uint64_t) capacity \
+        ); \
+        \
+        if (values == NULL) \
+            return LIST_ALLOCATION_FAILURE; \
+        \
+        list->values = values; \
+        list->capacity = capacity; \
+        \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_shrink_to_fit(name##_t* const list) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        \
+        const int64_t capacity = list->size > 0 ? list->size : 1; \
+        \
+        if (capacity == list->capacity) \
+            return LIST_SUCCESS; \
+        \
+        type* const values = (type*) list->allocator.reallocate( \
+            list->allocator.context, \
+            list->values, \
+            sizeof(type) * (uint64_t) list->capacity, \
+            sizeof(type) * (uint64_t) capacity \
+        ); \
+        \
+        if (values == NULL) \
+            return LIST_ALLOCATION_FAILURE; \
+        \
+        list->values = values; \
+        list->capacity = capacity; \
+        \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_insert(name##_t* const list, const int64_t index, const type value) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        else if (index > list->size || index < 0) \
+            return LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        if (list->size == list->capacity) { \
+            if (list->capacity > INT64_MAX / 2) \
+                return LIST_ALLOCATION_FAILURE; \
+            \
+            list_result_t reserveResult = name##_reserve(list, list->capacity * 2); \
+            \
+            if (reserveResult != LIST_SUCCESS) \
+                return reserveResult; \
+        } \
+        \
+        memmove(list->values + index + 1, list->values + index, sizeof(type) * (uint64_t) (list->size - index)); \
+        list->values[index] = value; \
+        list->size++; \
+        \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_append(name##_t* const list, const type value) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        \
+        /* the common case stays free of the shifting done by insert. */ \
+        if (list->size < list->capacity) { \
+            list->values[list->size++] = value; \
+            return LIST_SUCCESS; \
+        } \
+        \
+        return name##_insert(list, list->size, value); \
+    } \
+    \
+    static inline list_result_t name##_prepend(name##_t* const list, const type value) { \
+        return name##_insert(list, 0, value); \
+    } \
+    \
+    static inline list_result_t name##_get(name##_t* const list, type* const valueOut, const int64_t index) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        else if (index >= list->size || index < 0) \
+            return LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        *valueOut = list->values[index]; \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_peek(name##_t* const list, type** valueOut, const int64_t index) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        else if (index >= list->size || index < 0) \
+            return LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        *valueOut = &list->values[index]; \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_set(name##_t* const list, const int64_t index, const type value) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        else if (index >= list->size || index < 0) \
+            return LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        list->values[index] = value; \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_pop(name##_t* const list, type* const valueOut, const int64_t index) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        else if (index >= list->size || index < 0) \
+            return LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        if (valueOut != NULL) \
+            *valueOut = list->values[index]; \
+        \
+        memmove(list->values + index, list->values + index + 1, sizeof(type) * (uint64_t) (list->size - index - 1)); \
+        list->size--; \
+        \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_remove(name##_t* const list, const int64_t index) { \
+        return name##_pop(list, NULL, index); \
+    } \
+    \
+    static inline list_result_t name##_clear(name##_t* const list) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        \
+        list->size = 0; \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_find_first(name##_t* const list, int64_t* const indexOut, const int64_t startIndex, const type value) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        else if (startIndex >= list->size || startIndex < 0) \
+            return LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        for (int64_t i = startIndex; i < list->size; i++) { \
+            if (compare(list->values[i], value) == 0) { \
+                *indexOut = i; \
+                return LIST_SUCCESS; \
+            } \
+        } \
+        \
+        return LIST_ELEMENT_NOT_FOUND_ERROR; \
+    } \
+    \
+    static inline list_result_t name##_includes(name##_t* const list, const type value) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        \
+        for (int64_t i = 0; i < list->size; i++) { \
+            if (compare(list->values[i], value) == 0) \
+                return LIST_SUCCESS; \
+        } \
+        \
+        return LIST_ELEMENT_NOT_FOUND_ERROR; \
+    } \
+    \
+    static inline bool name##_before(const type value1, const type value2, const bool ascending) { \
+        return ascending ? compare(value1, value2) < 0 : compare(value2, value1) < 0; \
+    } \
+    \
+    static inline void name##_exchange(type* const value1, type* const value2) { \
+        const type temporary = *value1; \
+        \
+        *value1 = *value2; \
+        *value2 = temporary; \
+    } \
+    \
+    static inline void name##_sift_down(type* const values, int64_t root, const int64_t count, const bool ascending) { \
+        const type value = values[root]; \
+        \
+        for (int64_t child = root * 2 + 1; child < count; child = root * 2 + 1) { \
+            if (child + 1 < count && name##_before(values[child], values[child + 1], ascending)) \
+                child++; \
+            \
+            if (!name##_before(value, values[child], ascending)) \
+                break; \
+            \
+            values[root] = values[child]; \
+            root = child; \
+        } \
+        \
+        values[root] = value; \
+    } \
+    \
+    static inline void name##_introsort(type* values, int64_t count, int64_t depth, const bool ascending) { \
+        while (count > CONFETTI_TEMPLATE_INSERTION_SORT_THRESHOLD) { \
+            /* portions that keep partitioning badly are heap sorted instead. */ \
+            if (depth-- == 0) { \
+                for (int64_t i = count / 2 - 1; i >= 0; i--) \
+                    name##_sift_down(values, i, count, ascending); \
+                \
+                for (int64_t i = count - 1; i > 0; i--) { \
+                    name##_exchange(&values[0], &values[i]); \
+                    name##_sift_down(values, 0, i, ascending); \
+                } \
+                \
+                return; \
+            } \
+            \
+            const int64_t middle = count / 2; \
+            \
+            if (name##_before(values[middle], values[0], ascending)) \
+                name##_exchange(&values[middle], &values[0]); \
+            \
+            if (name##_before(values[count - 1], values[middle], ascending)) \
+                name##_exchange(&values[count - 1], &values[middle]); \
+            \
+            if (name##_before(values[middle], values[0], ascending)) \
+                name##_exchange(&values[middle], &values[0]); \
+            \
+            const type pivot = values[middle]; \
+            int64_t low = 0; \
+            int64_t high = count - 1; \
+            \
+            while (low <= high) { \
+                while (name##_before(values[low], pivot, ascending)) \
+                    low++; \
+                \
+                while (name##_before(pivot, values[high], ascending)) \
+                    high--; \
+                \
+                if (low <= high) \
+                    name##_exchange(&values[low++], &values[high--]); \
+            } \
+            \
+            /* the smaller side is sorted first and the larger one is looped over, so the recursion stays logarithmic. */ \
+            if (high + 1 < count - low) { \
+                name##_introsort(values, high + 1, depth, ascending); \
+                values += low; \
+                count -= low; \
+            } \
+            else { \
+                name##_introsort(values + low, count - low, depth, ascending); \
+                count = high + 1; \
+            } \
+        } \
+        \
+        for (int64_t i = 1; i < count; i++) { \
+            const type value = values[i]; \
+            int64_t j = i; \
+            \
+            for (; j > 0 && name##_before(value, values[j - 1], ascending); j--) \
+                values[j] = values[j - 1]; \
+            \
+            values[j] = value; \
+        } \
+    } \
+    \
+    static inline list_result_t name##_swap(name##_t* const list, const int64_t index1, const int64_t index2) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        else if (index1 >= list->size || index1 < 0 || index2 >= list->size || index2 < 0) \
+            return LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        name##_exchange(&list->values[index1], &list->values[index2]); \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_reverse(name##_t* const list) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        \
+        for (int64_t low = 0, high = list->size - 1; low < high; low++, high--) \
+            name##_exchange(&list->values[low], &list->values[high]); \
+        \
+        return LIST_SUCCESS; \
+    } \
+    \
+    static inline list_result_t name##_sort(name##_t* const list, const bool ascending) { \
+        if (list == NULL) \
+            return LIST_NULL_ERROR; \
+        \
+        int64_t depth = 0; \
+        \
+        for (int64_t count = list->size; count > 1; count >>= 1) \
+            depth += 2; \
+        \
+        name##_introsort(list->values, list->size, depth, ascending); \
+        return LIST_SUCCESS; \
+    }
+
+// linked list generation
+
+/**
+ * @brief Defines a singly linked list storing values of one type by value, with its comparator inlined.
+ *
+ * Generates the types `name##_t` and `name##_node_t` along with `static inline` functions 
+ * named after their `linked_list.h` counterparts, returning the same `linked_list_result_t` values:
+ * 
+ * `name##_create`, `name##_free`, `name##_init`, `name##_deinit`, `name##_append`, `name##_prepend`, 
+ * `name##_insert`, `name##_get`, `name##_peek`, `name##_set`, `name##_remove`, `name##_pop`, 
+ * `name##_clear`, `name##_includes`, `name##_find_first`, `name##_reverse` and `name##_sort`.
+ * 
+ * Every value is stored inside its node, so each node takes a single allocation.
+ *
+ * @param name The prefix of the generated types and functions.
+ * @param type The type of the stored values, it must be copyable by assignment.
+ * @param compare A function or function-like macro taking two values, returning a negative value 
+ *                if the first comes before the second, a positive value if it comes after it and 
+ *                `0` if they are equal, such as `CONFETTI_COMPARE_NUMBERS`.
+ * 
+ * @note Must be used once per name at file scope, typically in a header shared by every user of the linked list.
+ */
+#define CONFETTI_DEFINE_LINKED_LIST(name, type, compare) \
+    \
+    typedef struct name##_node name##_node_t; \
+    \
+    typedef struct name##_node { \
+        name##_node_t* next; /* Pointer to the next node in the linked list. */ \
+        type value;          /* The value held by the node. */ \
+    } name##_node_t; \
+    \
+    typedef struct name { \
+        name##_node_t* head;            /* Pointer to the first node in the linked list. */ \
+        name##_node_t* tail;            /* Pointer to the last node in the linked list. */ \
+        int64_t size;                   /* Number of values currently in the linked list. */ \
+        confetti_allocator_t allocator; /* Allocator the nodes are requested from. */ \
+    } name##_t; \
+    \
+    static inline linked_list_result_t name##_init(name##_t* const linkedList, const confetti_allocator_t* const allocator) { \
+        if (linkedList == NULL) \
+            return LINKED_LIST_NULL_ERROR; \
+        \
+        linkedList->head = NULL; \
+        linkedList->tail = NULL; \
+        linkedList->size = 0; \
+        linkedList->allocator = allocator == NULL ? *confetti_allocator_default() : *allocator; \
+        \
+        return LINKED_LIST_SUCCESS; \
+    } \
+    \
+    static inline linked_list_result_t name##_clear(name##_t* const linkedList) { \
+        if (linkedList == NULL) \
+            return LINKED_LIST_NULL_ERROR; \
+        \
+        name##_node_t* node = linkedList->head; \
+        \
+        while (node != NULL) { \
+            name##_node_t* const next = node->next; \
+            \
+            linkedList->allocator.deallocate(linkedList->allocator.context, node, sizeof(name##_node_t)); \
+            node = next; \
+        } \
+        \
+        linkedList->head = NULL; \
+        linkedList->tail = NULL; \
+        linkedList->size = 0; \
+        \
+        return LINKED_LIST_SUCCESS; \
+    } \
+    \
+    static inline linked_list_result_t name##_deinit(name##_t* const linkedList) { \
+        return name##_clear(linkedList); \
+    } \
+    \
+    static inline linked_list_result_t name##_create(name##_t** linkedListOut, const confetti_allocator_t* const allocator) { \
+        const confetti_allocator_t* const source = allocator == NULL ? confetti_allocator_default() : allocator; \
+        name##_t* const linkedList = (name##_t*) source->allocate(source->context, sizeof(name##_t)); \
+        \
+        if (linkedList == NULL) \
+            return LINKED_LIST_ALLOCATION_FAILURE; \
+        \
+        name##_init(linkedList, source); \
+        \
+        *linkedListOut = linkedList; \
+        return LINKED_LIST_SUCCESS; \
+    } \
+    \
+    static inline linked_list_result_t name##_free(name##_t** linkedList) { \
+        if (linkedList == NULL || *linkedList == NULL) \
+            return LINKED_LIST_NULL_ERROR; \
+        \
+        confetti_allocator_t allocator = (*linkedList)->allocator; \
+        \
+        name##_clear(*linkedList); \
+        allocator.deallocate(allocator.context, *linkedList, sizeof(name##_t)); \
+        *linkedList = NULL; \
+        \
+        return LINKED_LIST_SUCCESS; \
+    } \
+    \
+    static inline name##_node_t* name##_node_at(name##_t* const linkedList, const int64_t index) { \
+        if (index == linkedList->size - 1) \
+            return linkedList->tail; \
+        \
+        name##_node_t* node = linkedList->head; \
+        \
+        for (int64_t i = 0; i < index; i++) \
+            node = node->next; \
+        \
+        return node; \
+    } \
+    \
+    static inline linked_list_result_t name##_insert(name##_t* const linkedList, const int64_t index, const type value) { \
+        if (linkedList == NULL) \
+            return LINKED_LIST_NULL_ERROR; \
+        else if (index > linkedList->size || index < 0) \
+            return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        name##_node_t* const node = (name##_node_t*) linkedList->allocator.allocate(linkedList->allocator.context, sizeof(name##_node_t)); \
+        \
+        if (node == NULL) \
+            return LINKED_LIST_ALLOCATION_FAILURE; \
+        \
+        node->value = value; \
+        \
+        if (index == 0) { \
+            node->next = linkedList->head; \
+            linkedList->head = node; \
+            \
+            if (linkedList->tail == NULL) \
+                linkedList->tail = node; \
+        } \
+        else { \
+            name##_node_t* const previous = name##_node_at(linkedList, index - 1); \
+            \
+            node->next = previous->next; \
+            previous->next = node; \
+            \
+            if (previous == linkedList->tail) \
+                linkedList->tail = node; \
+        } \
+        \
+        linkedList->size++; \
+        return LINKED_LIST_SUCCESS; \
+    } \
+    \
+    static inline linked_list_result_t name##_append(name##_t* const linkedList, const type value) { \
+        return name##_insert(linkedList, linkedList == NULL ? 0 : linkedList->size, value); \
+    } \
+    \
+    static inline linked_list_result_t name##_prepend(name##_t* const linkedList, const type value) { \
+        return name##_insert(linkedList, 0, value); \
+    } \
+    \
+    static inline linked_list_result_t name##_peek(name##_t* const linkedList, type** valueOut, const int64_t index) { \
+        if (linkedList == NULL) \
+            return LINKED_LIST_NULL_ERROR; \
+        else if (index >= linkedList->size || index < 0) \
+            return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        *valueOut = &name##_node_at(linkedList, index)->value; \
+        return LINKED_LIST_SUCCESS; \
+    } \
+    \
+    static inline linked_list_result_t name##_get(name##_t* const linkedList, type* const valueOut, const int64_t index) { \
+        type* value = NULL; \
+        linked_list_result_t peekResult = name##_peek(linkedList, &value, index); \
+        \
+        if (peekResult != LINKED_LIST_SUCCESS) \
+            return peekResult; \
+        \
+        *valueOut = *value; \
+        return LINKED_LIST_SUCCESS; \
+    } \
+    \
+    static inline linked_list_result_t name##_set(name##_t* const linkedList, const int64_t index, const type value) { \
+        type* slot = NULL; \
+        linked_list_result_t peekResult = name##_peek(linkedList, &slot, index); \
+        \
+        if (peekResult != LINKED_LIST_SUCCESS) \
+            return peekResult; \
+        \
+        *slot = value; \
+        return LINKED_LIST_SUCCESS; \
+    } \
+    \
+    static inline linked_list_result_t name##_pop(name##_t* const linkedList, type* const valueOut, const int64_t index) { \
+        if (linkedList == NULL) \
+            return LINKED_LIST_NULL_ERROR; \
+        else if (index >= linkedList->size || index < 0) \
+            return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        name##_node_t* const previous = index == 0 ? NULL : name##_node_at(linkedList, index - 1); \
+        name##_node_t* const node = previous == NULL ? linkedList->head : previous->next; \
+        \
+        if (previous == NULL) \
+            linkedList->head = node->next; \
+        else \
+            previous->next = node->next; \
+        \
+        if (node == linkedList->tail) \
+            linkedList->tail = previous; \
+        \
+        if (valueOut != NULL) \
+            *valueOut = node->value; \
+        \
+        linkedList->allocator.deallocate(linkedList->allocator.context, node, sizeof(name##_node_t)); \
+        linkedList->size--; \
+        \
+        return LINKED_LIST_SUCCESS; \
+    } \
+    \
+    static inline linked_list_result_t name##_remove(name##_t* const linkedList, const int64_t index) { \
+        return name##_pop(linkedList, NULL, index); \
+    } \
+    \
+    static inline linked_list_result_t name##_find_first(name##_t* const linkedList, int64_t* const indexOut, const int64_t startFromIndex, const type value) { \
+        if (linkedList == NULL) \
+            return LINKED_LIST_NULL_ERROR; \
+        else if (startFromIndex >= linkedList->size || startFromIndex < 0) \
+            return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR; \
+        \
+        int64_t index = startFromIndex; \
+        \
+        for (name##_node_t* node = name##_node_at(linkedList, startFromIndex); node != NULL; node = node->next, index++) { \
+            if (compare(node->value, value) == 0) { \
+                *indexOut = index; \
+                return LINKED_LIST_SUCCESS; \
+            } \
+        } \
+        \
+        return LINKED_LIST_ELEMENT_NOT_FOUND_ERROR; \
+    } \
+    \
+    static inline linked_list_result_t name##_includes(name##_t* const linkedList, const type value) { \
+        if (linkedList == NULL) \
+            return LINKED_LIST_NULL_ERROR; \
+        \
+        for (name##_node_t* node = linkedList->head; node != NULL; node = node->next) { \
+            if (compare(node->value, value) == 0) \
+                return LINKED_LIST_SUCCESS; \
+        } \
+        \
+        return LINKED_LIST_ELEMENT_NOT_FOUND_ERROR; \
+    } \
+    \
+    static inline linked_list_result_t name##_reverse(name##_t* const linkedList) { \
+        if (linkedList == NULL) \
+            return LINKED_LIST_NULL_ERROR; \
+        \
+        name##_node_t* previous = NULL; \
+        name##_node_t* node = linkedList->head; \
+        \
+        linkedList->tail = node; \
+        \
+        while (node != NULL) { \
+            name##_node_t* const next = node->next; \
+            \
+            node->next = previous; \
+            previous = node; \
+            node = next; \
+        } \
+        \
+        linkedList->head = previous; \
+        return LINKED_LIST_SUCCESS; \
+    } \
+    \
+    static inline linked_list_result_t name##_sort(name##_t* const linkedList, const bool ascending) { \
+        if (linkedList == NULL) \
+            return LINKED_LIST_NULL_ERROR; \
+        \
+        /* bottom up merge sort, merging runs of doubling width until a single run is left. */ \
+        for (int64_t width = 1; width < linkedList->size; width *= 2) { \
+            name##_node_t* remaining = linkedList->head; \
+            name##_node_t* head = NULL; \
+            name##_node_t* tail = NULL; \
+            \
+            while (remaining != NULL) { \
+                name##_node_t* first = remaining; \
+                name##_node_t* second = remaining; \
+                int64_t firstCount = 0; \
+                \
+                while (second != NULL && firstCount < width) { \
+                    second = second->next; \
+                    firstCount++; \
+                } \
+                \
+                int64_t secondCount = 0; \
+                remaining = second; \
+                \
+                while (remaining != NULL && secondCount < width) { \
+                    remaining = remaining->next; \
+                    secondCount++; \
+                } \
+                \
+                while (firstCount > 0 || secondCount > 0) { \
+                    name##_node_t* next; \
+                    \
+                    /* equal values keep their order by taking from the first run. */ \
+                    if (secondCount == 0 || (firstCount > 0 && (ascending \
+                        ? compare(second->value, first->value) >= 0 \
+                        : compare(first->value, second->value) >= 0))) { \
+                        next = first; \
+                        first = first->next; \
+                        firstCount--; \
+                    } \
+                    else { \
+                        next = second; \
+                        second = second->next; \
+                        secondCount--; \
+                    } \
+                    \
+                    if (tail == NULL) \
+                        head = next; \
+                    else \
+                        tail->next = next; \
+                    \
+                    tail = next; \
+                } \
+            } \
+            \
+            tail->next = NULL; \
+            linkedList->head = head; \
+            linkedList->tail = tail; \
+        } \
+        \
+        return LINKED_LIST_SUCCESS; \
+    }
@@ -0,0 +1,854 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_export.h"
+#include "confetti_allocator.h"
+
+// constant definitions
+
+#define DLIST_INLINE_VALUE_CAPACITY ((uint64_t) 48) // Values of at most this many bytes are stored inside the allocation of their node.
+
+/**
+ * @brief The size of the single block a doubly linked list requests from its allocator for every node.
+ * 
+ * Each block holds the node, its element and up to `DLIST_INLINE_VALUE_CAPACITY` 
+ * bytes of value, larger values are allocated separately. A `confetti_pool_t` created 
+ * with this block size serves every node of a doubly linked list.
+ */
+#define DLIST_NODE_ALLOCATION_SIZE ((uint64_t) (sizeof(dlist_node_t) + sizeof(dlist_element_t) + DLIST_INLINE_VALUE_CAPACITY))
+
+// definitions
+
+typedef struct dlist dlist_t;
+typedef struct dlist_node dlist_node_t;
+typedef struct dlist_element dlist_element_t; 
+typedef struct dlist_iterator dlist_iterator_t;
+typedef struct dlist_options dlist_options_t;
+typedef enum dlist_result dlist_result_t; 
+
+
+/**
+ * @brief Function type definition for a custom equality function.
+ *
+ * @param data1 Pointer to the first memory block.
+ * @param data2 Pointer to the second memory block.
+ * @param size Size in bytes of the data elements.
+ * 
+ * @return 
+ * - `0` if the elements are considered equal.
+ * 
+ * - A negative value if the first element is considered less than the second.
+ * 
+ * - A positive value if the first element is considered greater than the second.
+ */
+typedef int32_t (dlist_custom_equality_function_t)(const void* const data1, const void* const data2, const uint64_t size);
+
+
+/**
+ * @brief Function type definition for a custom sorting function for doubly linked lists.
+ *
+ * The function must leave the `previous` links, head and tail of the list consistent 
+ * with the `next` links.
+ *
+ * @param dlist A pointer to the doubly linked list to be sorted.
+ * @param ascending A boolean value indicating the sorting order. 
+ * 
+ * @return A dlist_result_t indicating the outcome of the sorting operation.
+ */
+typedef dlist_result_t (dlist_custom_sorting_function_t)(dlist_t* const dlist, const bool ascending);
+
+
+/**
+ * @brief Represents an element in a doubly linked list.
+ *
+ * This structure holds a value and its size, which can be used by the doubly linked list
+ * to store arbitrary data.
+ */
+typedef struct dlist_element {
+    void* value;   /* Pointer to the data stored in the element. */
+    uint64_t size; /* Size of the data in bytes. */
+} dlist_element_t;
+
+
+/**
+ * @brief Represents a node in a doubly linked list.
+ *
+ * Each node contains a pointer to a doubly linked list element along with pointers to 
+ * the nodes before and after it, so a node can be unlinked without walking the list.
+ */
+typedef struct dlist_node {
+    dlist_node_t* previous;   /* Pointer to the previous node in the list. */
+    dlist_node_t* next;       /* Pointer to the next node in the list. */
+    dlist_element_t* element; /* Pointer to the element contained in this node. */
+} dlist_node_t;
+
+
+/**
+ * @brief Represents a doubly linked list.
+ *
+ * This structure maintains pointers to the head and tail nodes, the total number
+ * of elements, an equality function and sorting function. Every node, element and value 
+ * kept by the doubly linked list, including the doubly linked list itself, is requested from its allocator.
+ */
+typedef struct dlist {
+    dlist_node_t* head;                                 /* Pointer to the first node in the doubly linked list. */
+    dlist_node_t* tail;                                 /* Pointer to the last node in the doubly linked list. */
+    int64_t size;                                       /* Number of elements currently in the doubly linked list. */
+    dlist_custom_equality_function_t* equalityFunction; /* Equality function for comparing elements. */
+    dlist_custom_sorting_function_t* sortingFunction;   /* Sorting function for sorting the doubly linked list. */
+    confetti_allocator_t allocator;                     /* Allocator the doubly linked list's memory is requested from. */
+} dlist_t;
+
+
+/**
+ * @brief Represents the options a doubly linked list is created with.
+ *
+ * A zero initialized `dlist_options_t` describes a default doubly linked list, 
+ * the same as calling `dlist_create` with NULL functions.
+ */
+typedef struct dlist_options {
+    dlist_custom_equality_function_t* equalityFunction; /* Custom equality function, or NULL to use the default. */
+    dlist_custom_sorting_function_t* sortingFunction;   /* Custom sorting function, or NULL to use the default. */
+    const confetti_allocator_t* allocator;              /* Allocator to request memory from, or NULL to use the default. */
+} dlist_options_t;
+
+
+/**
+ * @brief Represents an iterator for a doubly linked list.
+ * 
+ * The iterator can walk the doubly linked list in both directions.
+ *
+ * @param list A pointer to the doubly linked list being iterated over.
+ * @param index The index of the current node within the doubly linked list.
+ * @param node A pointer to the current node in the iteration.
+ * 
+ * @warning Please do not manually free anything witin this structure as 
+ * they are the internal values kept by the doubly linked list. If you wish 
+ * to deallocate memory from this structure please use `dlist_iterator_free` to safely do so.
+ */
+typedef struct dlist_iterator {
+    dlist_t* list;      /* The list being iterated through. */
+    int64_t index;      /* The index of the current iteration. */
+    dlist_node_t* node; /* The node of the current iteration. */
+} dlist_iterator_t;
+
+// enums
+
+/**
+ * @brief Represents the result of a doubly linked list operation.
+ *
+ * This enumeration defines status codes that indicate the outcome of operations
+ * on a doubly linked list. Positive values indicate success, while negative values
+ * correspond to specific error conditions.
+ */
+typedef enum dlist_result {
+    /**
+     * @brief Operation completed successfully.
+     */
+    DLIST_SUCCESS = 1,
+
+    /**
+     * @brief Error: Index is out of range.
+     *
+     * Returned when an attempt is made to access a node at an invalid index.
+     */
+    DLIST_INDEX_OUT_OF_RANGE_ERROR = -1,
+
+    /**
+     * @brief Error: Element not found in the doubly linked list.
+     *
+     * Indicates that the requested element could not be located in the list.
+     */
+    DLIST_ELEMENT_NOT_FOUND_ERROR = -2,
+
+    /**
+     * @brief Error: Doubly linked list is null.
+     *
+     * Returned when an operation is attempted on a null list.
+     */
+    DLIST_NULL_ERROR = -3,
+
+    /**
+     * @brief Error: Invalid parameters provided.
+     *
+     * Indicates that one or more parameters passed to the function are invalid.
+     */
+    DLIST_INVALID_PARAMS_ERROR = -4,
+
+    /**
+     * @brief Error: Memory allocation failure.
+     *
+     * Occurs when the system fails to allocate memory required for the operation.
+     */
+    DLIST_ALLOCATION_FAILURE = -5
+} dlist_result_t;
+
+// public function definitions
+
+/**
+ * @brief Creates a new doubly linked list.
+ *
+ * @param dlistOut A double pointer to where the doubly linked list will be stored.
+ * @param customEqualityFunction A pointer to a custom equality function
+ *                               for comparing elements in the doubly linked list.
+ *                               If NULL, a default equality function is used.
+ * @param customSortingFunction A pointer to a custom sorting function
+ *                              for sorting elements in the doubly linked list.
+ *                              If NULL, a default sorting function is used.
+ * 
+ * @return 
+ * `DLIST_SUCCESS` if the doubly linked list was created successfully.
+ * 
+ * `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_create(
+    dlist_t** dlistOut, 
+    dlist_custom_equality_function_t* const customEqualityFunction, 
+    dlist_custom_sorting_function_t* const customSortingFunction);
+
+/**
+ * @brief Creates a new doubly linked list described by a set of options.
+ *
+ * This is the general form of `dlist_create`, which additionally allows the 
+ * doubly linked list to request its memory from a custom allocator such as a 
+ * `confetti_arena_t` or a `confetti_pool_t`.
+ *
+ * @param dlistOut A double pointer to where the doubly linked list will be stored.
+ * @param options A pointer to the options describing the doubly linked list.
+ * 
+ * @return 
+ * `DLIST_SUCCESS` if the doubly linked list was created successfully.
+ * 
+ * `DLIST_INVALID_PARAMS_ERROR` if the options or the allocator they describe are invalid.
+ * 
+ * `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Elements handed to the caller by functions such as `dlist_get` or `dlist_pop` 
+ *       are always allocated with the default allocator, so `dlist_element_free` can free them.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_create_with_options(dlist_t** dlistOut, const dlist_options_t* const options);
+
+/**
+ * @brief Frees the memory allocated for a doubly linked list.
+ *
+ * @param dlist A double pointer to the doubly linked list to be freed.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the doubly linked list was freed successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * @note Sets the doubly linked list pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_free(dlist_t** dlist);
+
+/**
+ * @brief Prints the elements of a doubly linked list.
+ *
+ * @param dlist A pointer to the doubly linked list to be printed.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the doubly linked list was printed successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_print(dlist_t* const dlist);
+
+/**
+ * @brief Retrieves a clone of the element at a specified index.
+ *
+ * The node is reached by walking from whichever end of the doubly linked list is closer.
+ *
+ * @param dlist A pointer to the doubly linked list from which to retrieve the element.
+ * @param elementOut A double pointer where the cloned element will be stored.
+ * @param index The index of the element to retrieve.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the element was retrieved successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Freeing the outputted element is your responsibility, it is recomended to use `dlist_element_free` for this.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_get(dlist_t* const dlist, dlist_element_t** elementOut, const int64_t index);
+
+/**
+ * @brief Borrows the value stored in the doubly linked list at a specified index.
+ *
+ * @param dlist A pointer to the doubly linked list from which to borrow the value.
+ * @param valueOut A pointer to where the address of the value will be stored.
+ * @param sizeOut A pointer to where the size of the value will be stored, or NULL.
+ * @param index The index of the value to borrow.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the value was borrowed successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * @warning The borrowed value is owned by the doubly linked list and is only valid until 
+ * the doubly linked list is next modified, do not free it or write through it.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_peek(dlist_t* const dlist, const void** valueOut, uint64_t* const sizeOut, const int64_t index);
+
+/**
+ * @brief Sets the value of an element in the doubly linked list at a specified index.
+ *
+ * @param dlist A pointer to the doubly linked list in which to set the element.
+ * @param index The index of the element to update.
+ * @param value A pointer to the new value to be assigned to the element.
+ * @param size The size of the value to be assigned.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the element was updated successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_set(dlist_t* const dlist, const int64_t index, void* const value, const uint64_t size);
+
+/**
+ * @brief Prepends a new element to the beginning of the doubly linked list.
+ *
+ * @param dlist A pointer to the doubly linked list to which the element will be prepended.
+ * @param value A pointer to the value to be assigned to the new element.
+ * @param size The size of the value to be assigned.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the element was prepended successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note The new node is the head of the doubly linked list afterwards.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_prepend(dlist_t* const dlist, void* const value, const uint64_t size);
+
+/**
+ * @brief Appends a new element to the end of the doubly linked list.
+ *
+ * @param dlist A pointer to the doubly linked list to which the element will be appended.
+ * @param value A pointer to the value to be assigned to the new element.
+ * @param size The size of the value to be assigned.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the element was appended successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note The new node is the tail of the doubly linked list afterwards.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_append(dlist_t* const dlist, void* const value, const uint64_t size);
+
+/**
+ * @brief Appends multiple values to the end of the doubly linked list at once.
+ *
+ * @param dlist A pointer to the doubly linked list to which the values will be appended.
+ * @param values A pointer to `count` values laid out contiguously, `stride` bytes apart.
+ * @param count The amount of values to append.
+ * @param stride The size of each value.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the values were appended successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the stride is 0 or values is NULL.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note If the operation fails the doubly linked list is left unchanged.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_append_many(
+    dlist_t* const dlist, 
+    const void* const values, 
+    const uint64_t count, 
+    const uint64_t stride
+);
+
+/**
+ * @brief Inserts a new element at a specified index in the doubly linked list.
+ *
+ * @param dlist A pointer to the doubly linked list where the element will be inserted.
+ * @param index The index at which to insert the new element.
+ * @param value A pointer to the value to be assigned to the new element.
+ * @param size The size of the value to be assigned.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the element was inserted successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_insert(dlist_t* const dlist, const int64_t index, void* value, const uint64_t size);
+
+/**
+ * @brief Removes an element from the doubly linked list at a specified index.
+ *
+ * @param dlist A pointer to the doubly linked list from which the element will be removed.
+ * @param index The index of the element to remove.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the element was removed successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_remove(dlist_t* const dlist, const uint64_t index);
+
+/**
+ * @brief Removes and retrieves an element from the doubly linked list at a specified index.
+ *
+ * @param dlist A pointer to the doubly linked list from which the element will be removed.
+ * @param elementOut A double pointer where the cloned element will be stored.
+ * @param index The index of the element to remove and retrieve.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the element was removed and retrieved successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Freeing the outputted element is your responsibility, it is recomended to use `dlist_element_free` for this.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_pop(dlist_t* const dlist, dlist_element_t** elementOut, const uint64_t index);
+
+/**
+ * @brief Removes an element from the doubly linked list and hands it over to the caller.
+ *
+ * This function behaves like `dlist_pop` but transfers the value kept by the 
+ * doubly linked list to the caller instead of copying it when possible.
+ *
+ * @param dlist A pointer to the doubly linked list from which the element will be taken.
+ * @param elementOut A double pointer where the taken element will be stored.
+ * @param index The index of the element to take.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the element was taken successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Values of at most `DLIST_INLINE_VALUE_CAPACITY` bytes live inside their node and are 
+ * therefore still copied out, only larger values are handed over without a copy.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_take(dlist_t* const dlist, dlist_element_t** elementOut, const int64_t index);
+
+/**
+ * @brief Clears all elements from the doubly linked list.
+ *
+ * @param dlist A pointer to the doubly linked list to be cleared.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the doubly linked list was cleared successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_clear(dlist_t* const dlist);
+
+/**
+ * @brief Creates a clone of a doubly linked list.
+ *
+ * @param dlist A pointer to the doubly linked list to be cloned.
+ * @param dlistOut A double pointer where the address of the cloned doubly linked list will be stored.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the doubly linked list was cloned successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Each element is cloned to ensure that the list clone contains independent copies of the elements.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_clone(dlist_t* const dlist, dlist_t** dlistOut);
+
+/**
+ * @brief Joins two doubly linked lists into a new doubly linked list.
+ *
+ * @param dlist1 A pointer to the first doubly linked list to be joined.
+ * @param dlist2 A pointer to the second doubly linked list to be joined.
+ * @param dlistOut A double pointer to where the new doubly linked list will be stored.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the doubly linked lists were joined successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if either of the provided doubly linked list pointers is NULL.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note The new doubly linked list uses the functions and allocator of the first one.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_join(dlist_t* const dlist1, dlist_t* const dlist2, dlist_t** dlistOut);
+
+/**
+ * @brief Resizes the doubly linked list to a specified new size.
+ *
+ * If the new size is greater than the current size, nodes without a value are appended. 
+ * If the new size is smaller, nodes are removed from the tail.
+ *
+ * @param dlist A pointer to the doubly linked list to be resized.
+ * @param size The new size for the doubly linked list.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the doubly linked list was resized successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_resize(dlist_t* const dlist, const uint64_t size);
+
+/**
+ * @brief Reverses the order of elements in the doubly linked list.
+ *
+ * @param dlist A pointer to the doubly linked list to be reversed.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the doubly linked list was reversed successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_reverse(dlist_t* const dlist);
+
+/**
+ * @brief Checks if a value is included in the doubly linked list.
+ *
+ * @param dlist A pointer to the doubly linked list to be searched.
+ * @param value A pointer to the value to search for in the doubly linked list.
+ * @param size The size of the value to be compared.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the value was found in the doubly linked list.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_ELEMENT_NOT_FOUND_ERROR` if the value was not found in the doubly linked list.
+ * 
+ * @note It uses the doubly linked list's equality function to compare elements.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_includes(dlist_t* const dlist, void* const value, const uint64_t size);
+
+/**
+ * @brief Finds the first occurrence of a value in the doubly linked list starting from a specified index.
+ *
+ * @param dlist A pointer to the doubly linked list to be searched.
+ * @param indexOut A pointer to an integer where the index of the found value will be stored.
+ * @param startFromIndex The index from which to start the search.
+ * @param value A pointer to the value to search for in the doubly linked list.
+ * @param size The size of the value to be compared.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the value was found in the doubly linked list.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the starting index is out of range.
+ * 
+ * - `DLIST_ELEMENT_NOT_FOUND_ERROR` if the value was not found in the doubly linked list.
+ * 
+ * @note It uses the doubly linked list's equality function to compare elements.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_find_first(
+    dlist_t* const dlist, 
+    int64_t* const indexOut, 
+    const int64_t startFromIndex, 
+    void* const value, 
+    const uint64_t size);
+
+/**
+ * @brief Finds the last occurrence of a value in the doubly linked list at or after a specified index.
+ *
+ * The search walks backward from the tail and stops at the first match.
+ *
+ * @param dlist A pointer to the doubly linked list to be searched.
+ * @param indexOut A pointer to an integer where the index of the last found value will be stored.
+ * @param startFromIndex The lowest index the search considers.
+ * @param value A pointer to the value to search for in the doubly linked list.
+ * @param size The size of the value to be compared.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the value was found in the doubly linked list.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the starting index is out of range.
+ * 
+ * - `DLIST_ELEMENT_NOT_FOUND_ERROR` if the value was not found in the doubly linked list.
+ * 
+ * @note It uses the doubly linked list's equality function to compare elements.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_find_last(
+    dlist_t* const dlist, 
+    int64_t* const indexOut,
+    const int64_t startFromIndex, 
+    void* const value, 
+    const uint64_t size);
+
+/**
+ * @brief Finds the node holding the first occurrence of a value in the doubly linked list.
+ *
+ * The node can then be handed to `dlist_remove_node`, `dlist_move_to_front` or 
+ * `dlist_move_to_back` without walking the doubly linked list again.
+ *
+ * @param dlist A pointer to the doubly linked list to be searched.
+ * @param nodeOut A double pointer to where the found node will be stored.
+ * @param value A pointer to the value to search for in the doubly linked list.
+ * @param size The size of the value to be compared.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the value was found in the doubly linked list.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_ELEMENT_NOT_FOUND_ERROR` if the value was not found in the doubly linked list.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_find_node(dlist_t* const dlist, dlist_node_t** nodeOut, void* const value, const uint64_t size);
+
+/**
+ * @brief Retrieves the node at a specified index.
+ *
+ * The node is reached by walking from whichever end of the doubly linked list is closer.
+ *
+ * @param dlist A pointer to the doubly linked list.
+ * @param nodeOut A double pointer to where the node will be stored.
+ * @param index The index of the node.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the node was retrieved successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * @warning The node belongs to the doubly linked list and stays valid until it is removed, 
+ *          do not free it or change its links.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_node_at(dlist_t* const dlist, dlist_node_t** nodeOut, const int64_t index);
+
+/**
+ * @brief Removes a node from the doubly linked list in constant time.
+ *
+ * @param dlist A pointer to the doubly linked list the node belongs to.
+ * @param node A double pointer to the node to be removed.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the node was removed successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the node is NULL.
+ * 
+ * @note Sets the node pointer to NULL after freeing.
+ * @warning The node must belong to the doubly linked list.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_remove_node(dlist_t* const dlist, dlist_node_t** node);
+
+/**
+ * @brief Moves a node to the head of the doubly linked list in constant time.
+ *
+ * Together with `dlist_remove_node` on the tail this is the building block of a 
+ * least recently used cache.
+ *
+ * @param dlist A pointer to the doubly linked list the node belongs to.
+ * @param node A pointer to the node to be moved.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the node was moved successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the node is NULL.
+ * 
+ * @warning The node must belong to the doubly linked list.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_move_to_front(dlist_t* const dlist, dlist_node_t* const node);
+
+/**
+ * @brief Moves a node to the tail of the doubly linked list in constant time.
+ *
+ * @param dlist A pointer to the doubly linked list the node belongs to.
+ * @param node A pointer to the node to be moved.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the node was moved successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the node is NULL.
+ * 
+ * @warning The node must belong to the doubly linked list.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_move_to_back(dlist_t* const dlist, dlist_node_t* const node);
+
+/**
+ * @brief Sorts the doubly linked list using the specified sorting function.
+ *
+ * @param dlist A pointer to the doubly linked list to be sorted.
+ * @param ascending A boolean value indicating the sort order.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the sorting operation completed successfully.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * @warning The actual errors returned depend on the implementation of the sorting function. 
+ * 
+ * @note The default sorting function is a stable natural merge sort and only returns `DLIST_SUCCESS`.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_sort(dlist_t* const dlist, const bool ascending);
+
+/**
+ * @brief Swaps two nodes in the doubly linked list at the specified indices.
+ *
+ * @param dlist A pointer to the doubly linked list containing the nodes to be swapped.
+ * @param index1 The index of the first node to swap.
+ * @param index2 The index of the second node to swap.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the nodes were successfully swapped.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if either index is out of the valid range of the list.
+ * 
+ * @note If index1 and index2 are the same `DLIST_SUCCESS` is returned without modifying anything.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_swap(dlist_t* const dlist, const int64_t index1, const int64_t index2);
+
+/**
+ * @brief Frees the memory allocated for a doubly linked list element.
+ *
+ * @param element A pointer to a pointer to the doubly linked list element to be freed.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the element was successfully freed.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the provided element pointer is NULL.
+ * 
+ * @note Sets the element pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_element_free(dlist_element_t** element);
+
+/**
+ * @brief Creates a new doubly linked list iterator.
+ *
+ * @param iteratorOut A double pointer where the created iterator will be stored.
+ * @param list A pointer to the doubly linked list to be iterated over.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the iterator was successfully created.
+ * 
+ * - `DLIST_NULL_ERROR` if the provided doubly linked list pointer is NULL.
+ * 
+ * - `DLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_iterator_create(dlist_iterator_t** iteratorOut, dlist_t* const list);
+
+/**
+ * @brief Advances the iterator to the next element in the doubly linked list.
+ *
+ * A rewound iterator moves to the head.
+ *
+ * @param iterator A pointer to the doubly linked list iterator to be advanced.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the iterator was successfully advanced to the next element.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the iterator is already at the end of the list.
+ * 
+ * @note When the iterator reaches the end of a doubly linked list it will rewind itself.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_iterator_next(dlist_iterator_t* const iterator);
+
+/**
+ * @brief Moves the iterator to the previous element in the doubly linked list.
+ *
+ * A rewound iterator moves to the tail.
+ *
+ * @param iterator A pointer to the doubly linked list iterator to be moved.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the iterator was successfully moved to the previous element.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * - `DLIST_INDEX_OUT_OF_RANGE_ERROR` if the iterator is already at the start of the list.
+ * 
+ * @note When the iterator reaches the start of a doubly linked list it will rewind itself.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_iterator_previous(dlist_iterator_t* const iterator);
+
+/**
+ * @brief Resets the iterator to its initial state.
+ *
+ * @param iterator A pointer to the doubly linked list iterator to be reset.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the iterator was successfully reset.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the iterator is NULL.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_iterator_rewind(dlist_iterator_t* const iterator);
+
+/**
+ * @brief Frees the memory allocated for a doubly linked list iterator.
+ *
+ * @param iterator A double pointer to the doubly linked list iterator to be freed.
+ * 
+ * @return 
+ * - `DLIST_SUCCESS` if the iterator was successfully freed.
+ * 
+ * - `DLIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * @note Sets the iterator pointer to NULL after freeing.
+ * @note Only the iterator is freed, the doubly linked list used does not get freed.
+ */
+CONFETTI_EXPORT dlist_result_t dlist_iterator_free(dlist_iterator_t** iterator);
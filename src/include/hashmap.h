@@ -0,0 +1,546 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_export.h"
+#include "confetti_allocator.h"
+
+// constant definitions
+
+#define DEFAULT_HASHMAP_CAPACITY ((uint64_t) 16)   // The default amount of entries a hash map holds without growing if one is not given.
+#define HASHMAP_INLINE_CAPACITY ((uint64_t) 32)    // Keys and values taking at most this many bytes together are stored inside their slot.
+#define HASHMAP_VALUE_ALIGNMENT ((uint64_t) 8)     // Values are stored at an offset from their key rounded up to this alignment.
+
+// struct definitions
+
+// define all structs early to avoid errors relating to one of these structs not existing.
+typedef struct hashmap hashmap_t;
+typedef struct hashmap_slot hashmap_slot_t;
+typedef struct hashmap_element hashmap_element_t;
+typedef struct hashmap_iterator hashmap_iterator_t;
+typedef struct hashmap_options hashmap_options_t;
+typedef enum hashmap_result hashmap_result_t;
+
+/**
+ * @brief Function type definition for a custom equality function.
+ *
+ * The hash map only compares keys of the same size.
+ *
+ * @param data1 Pointer to the first memory block.
+ * @param data2 Pointer to the second memory block.
+ * @param size Size in bytes of the data elements.
+ * 
+ * @return 
+ * - `0` if the elements are considered equal.
+ * 
+ * - A negative value if the first element is considered less than the second.
+ * 
+ * - A positive value if the first element is considered greater than the second.
+ */
+typedef int32_t (hashmap_custom_equality_function_t)(const void* const data1, const void* const data2, const uint64_t size);
+
+/**
+ * @brief Function type definition for a custom hash function.
+ *
+ * Keys that the hash map's equality function considers equal must produce the same hash.
+ *
+ * @param data Pointer to the memory block to hash.
+ * @param size Size in bytes of the data.
+ * 
+ * @return The hash of the data.
+ */
+typedef uint64_t (hashmap_custom_hash_function_t)(const void* const data, const uint64_t size);
+
+/**
+ * @brief Represents a value handed out by a hash map.
+ */
+typedef struct hashmap_element {
+    uint64_t size; /* Size of the value in bytes. */
+    void* value;   /* Pointer to the data of the element. */
+} hashmap_element_t;
+
+/**
+ * @brief Represents a slot of a hash map.
+ *
+ * The key of an entry is stored at the start of its data, followed by its value at 
+ * an offset rounded up to `HASHMAP_VALUE_ALIGNMENT`. Data that fits in `HASHMAP_INLINE_CAPACITY` 
+ * bytes is stored inside the slot itself, otherwise it is allocated separately.
+ */
+typedef struct hashmap_slot {
+    uint64_t hash;                                /* Full hash of the key. */
+    uint64_t keySize;                             /* Size of the key in bytes. */
+    uint64_t valueSize;                           /* Size of the value in bytes. */
+    uint8_t* block;                               /* Separately allocated data of the entry, NULL if it is stored inline. */
+    uint8_t inlineData[HASHMAP_INLINE_CAPACITY];  /* Storage for entries that fit inline. */
+} hashmap_slot_t;
+
+/**
+ * @brief Represents an open addressing hash map.
+ *
+ * Every slot has a control byte telling whether it is empty, erased or full, in which case 
+ * it holds 7 bits of the key's hash. Lookups compare these control bytes a group of 16 at a 
+ * time using vector instructions where available, and only compare the keys of matching slots.
+ * 
+ * Every block of memory kept by the hash map, including the hash map itself, is
+ * requested from `allocator`.
+ */
+typedef struct hashmap {
+    uint8_t* controls;                                    /* Control byte of every slot, with the first group repeated at the end. */
+    hashmap_slot_t* slots;                                /* The slots of the table. */
+    uint64_t capacity;                                    /* Amount of slots, a power of two. */
+    int64_t size;                                         /* Amount of entries in the hash map. */
+    uint64_t growthLeft;                                  /* Amount of empty slots that can be filled before the table grows. */
+    hashmap_custom_equality_function_t* equalityFunction; /* Equality function for comparing keys. */
+    hashmap_custom_hash_function_t* hashFunction;         /* Hash function for hashing keys. */
+    confetti_allocator_t allocator;                       /* Allocator the hash map's memory is requested from. */
+} hashmap_t;
+
+/**
+ * @brief Represents the options a hash map is created with.
+ *
+ * A zero initialized `hashmap_options_t` describes a default hash map, the same
+ * as calling `hashmap_create` with a capacity of 0 and NULL functions.
+ */
+typedef struct hashmap_options {
+    uint64_t capacity;                                    /* Amount of entries to hold without growing, `DEFAULT_HASHMAP_CAPACITY` if 0. */
+    hashmap_custom_equality_function_t* equalityFunction; /* Custom equality function, or NULL to use the default. */
+    hashmap_custom_hash_function_t* hashFunction;         /* Custom hash function, or NULL to use the default. */
+    const confetti_allocator_t* allocator;                /* Allocator to request memory from, or NULL to use the default. */
+} hashmap_options_t;
+
+/**
+ * @brief Represents an iterator over the entries of a hash map.
+ *
+ * Entries are visited in no particular order.
+ *
+ * @warning Please do not manually free anything witin this structure as 
+ * they are the internal values kept by the hash map. If you wish 
+ * to deallocate memory from this structure please use `hashmap_iterator_free` to safely do so.
+ */
+typedef struct hashmap_iterator {
+    hashmap_t* map;          /* The hash map being iterated through. */
+    int64_t index;           /* The slot of the current iteration, -1 before the first one. */
+    hashmap_element_t key;   /* Describes the key of the current entry. */
+    hashmap_element_t value; /* Describes the value of the current entry. */
+} hashmap_iterator_t;
+
+// enum definitions
+
+/**
+ * @brief Represents the result of a hash map operation.
+ *
+ * Positive values indicate success, while negative values
+ * represent specific error conditions.
+ */
+typedef enum hashmap_result {
+    /**
+     * @brief Completed successfully.
+     */
+    HASHMAP_SUCCESS = 1,
+
+    /**
+     * @brief Error: Index is out of range.
+     * 
+     * This error occurs when an iterator is advanced past the last entry.
+     */
+    HASHMAP_INDEX_OUT_OF_RANGE_ERROR = -1,
+
+    /**
+     * @brief Error: Element not found in the hash map.
+     * 
+     * This error indicates that no entry has the specified key.
+     */
+    HASHMAP_ELEMENT_NOT_FOUND_ERROR = -2,
+
+    /**
+     * @brief Error: Hash map is null.
+     * 
+     * This error occurs when an operation is attempted on a hash map
+     * that has not been initialized (i.e., it is null).
+     */
+    HASHMAP_NULL_ERROR = -3,
+
+    /**
+     * @brief Error: Invalid parameters provided.
+     * 
+     * This error indicates that the parameters passed to a hash map
+     * operation are not valid.
+     */
+    HASHMAP_INVALID_PARAMS_ERROR = -4,
+
+    /**
+     * @brief Error: Memory allocation failure.
+     * 
+     * This error occurs when the system is unable to allocate
+     * the necessary memory for the operation.
+     */
+    HASHMAP_ALLOCATION_FAILURE = -5
+} hashmap_result_t;
+
+// public function definitions
+
+#pragma region public function definitions
+
+/**
+ * @brief Creates a new hash map.
+ *
+ * @param hashmapOut A double pointer to where the created hash map will be stored.
+ * @param capacity The amount of entries the hash map holds without growing. If 0, the `DEFAULT_HASHMAP_CAPACITY` will be used.
+ * @param customEqualityFunction A pointer to a custom equality function for keys, or NULL to use the default.
+ * @param customHashFunction A pointer to a custom hash function for keys, or NULL to use the default.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the hash map was created successfully. 
+ * 
+ * - `HASHMAP_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_create(
+    hashmap_t** hashmapOut, 
+    const uint64_t capacity, 
+    hashmap_custom_equality_function_t* const customEqualityFunction, 
+    hashmap_custom_hash_function_t* const customHashFunction
+);
+
+/**
+ * @brief Creates a new hash map described by a set of options.
+ *
+ * @param hashmapOut A double pointer to where the created hash map will be stored.
+ * @param options A pointer to the options describing the hash map.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the hash map was created successfully. 
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the options or the allocator they describe are invalid.
+ * 
+ * - `HASHMAP_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Elements handed to the caller by functions such as `hashmap_get` or `hashmap_pop` 
+ *       are always allocated with the default allocator, so `hashmap_element_free` can free them.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_create_with_options(hashmap_t** hashmapOut, const hashmap_options_t* const options);
+
+/**
+ * @brief Frees a hash map along with every entry in it.
+ *
+ * @param hashmap A double pointer to the hash map to be freed.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the hash map was freed successfully.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ * 
+ * @note Sets the hash map pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_free(hashmap_t** hashmap);
+
+/**
+ * @brief Prints the entries of a hash map.
+ *
+ * @param hashmap A pointer to the hash map to be printed.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the hash map was printed successfully.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_print(hashmap_t* const hashmap);
+
+/**
+ * @brief Grows the hash map so it holds a total amount of entries without growing again.
+ *
+ * Reserving ahead of a known amount of insertions avoids rehashing the table several times.
+ *
+ * @param hashmap A pointer to the hash map.
+ * @param count The total amount of entries the hash map should hold without growing.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the hash map reserved enough room successfully.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ * 
+ * - `HASHMAP_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note The hash map never shrinks, a count below its current room does nothing.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_reserve(hashmap_t* const hashmap, const uint64_t count);
+
+/**
+ * @brief Inserts a copy of a key and value into the hash map, replacing the value of an equal key.
+ *
+ * @param hashmap A pointer to the hash map.
+ * @param key A pointer to the key.
+ * @param keySize The size of the key.
+ * @param value A pointer to the value, or NULL to store `valueSize` zeroed bytes.
+ * @param valueSize The size of the value.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the entry was inserted or replaced successfully.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the key is NULL.
+ * 
+ * - `HASHMAP_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_insert(
+    hashmap_t* const hashmap, 
+    const void* const key, 
+    const uint64_t keySize, 
+    const void* const value, 
+    const uint64_t valueSize
+);
+
+/**
+ * @brief Inserts many keys and values into the hash map at once.
+ *
+ * Room for every entry is reserved up front, so the table grows at most once.
+ *
+ * @param hashmap A pointer to the hash map.
+ * @param keys A pointer to `count` keys laid out contiguously, `keyStride` bytes apart.
+ * @param keyStride The size of each key.
+ * @param values A pointer to `count` values laid out contiguously, `valueStride` bytes apart, or NULL for zeroed values.
+ * @param valueStride The size of each value.
+ * @param count The amount of entries to insert.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the entries were inserted successfully.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the keys are NULL or the key stride is 0 while count isn't.
+ * 
+ * - `HASHMAP_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Later entries replace the values of earlier ones with an equal key. If the operation fails 
+ *       while storing an entry, the entries before it remain inserted.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_insert_many(
+    hashmap_t* const hashmap, 
+    const void* const keys, 
+    const uint64_t keyStride, 
+    const void* const values, 
+    const uint64_t valueStride, 
+    const uint64_t count
+);
+
+/**
+ * @brief Retrieves a clone of the value stored for a key.
+ *
+ * @param hashmap A pointer to the hash map.
+ * @param elementOut A double pointer where the cloned value will be stored.
+ * @param key A pointer to the key.
+ * @param keySize The size of the key.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the value was retrieved successfully.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the key is NULL.
+ * 
+ * - `HASHMAP_ELEMENT_NOT_FOUND_ERROR` if no entry has the key.
+ * 
+ * - `HASHMAP_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Freeing the outputted element is your responsibility, it is recomended to use `hashmap_element_free` for this.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_get(hashmap_t* const hashmap, hashmap_element_t** elementOut, const void* const key, const uint64_t keySize);
+
+/**
+ * @brief Borrows the value stored for a key.
+ *
+ * @param hashmap A pointer to the hash map.
+ * @param valueOut A pointer to where the address of the value will be stored.
+ * @param sizeOut A pointer to where the size of the value will be stored, or NULL.
+ * @param key A pointer to the key.
+ * @param keySize The size of the key.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the value was borrowed successfully.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the key is NULL.
+ * 
+ * - `HASHMAP_ELEMENT_NOT_FOUND_ERROR` if no entry has the key.
+ * 
+ * @warning The borrowed value is owned by the hash map and is only valid until 
+ * the hash map is next modified, do not free it. The value may be written through.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_peek(
+    hashmap_t* const hashmap, 
+    void** valueOut, 
+    uint64_t* const sizeOut, 
+    const void* const key, 
+    const uint64_t keySize
+);
+
+/**
+ * @brief Checks if the hash map has an entry for a key.
+ *
+ * @param hashmap A pointer to the hash map.
+ * @param key A pointer to the key.
+ * @param keySize The size of the key.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if an entry has the key.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the key is NULL.
+ * 
+ * - `HASHMAP_ELEMENT_NOT_FOUND_ERROR` if no entry has the key.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_includes(hashmap_t* const hashmap, const void* const key, const uint64_t keySize);
+
+/**
+ * @brief Removes the entry of a key from the hash map.
+ *
+ * @param hashmap A pointer to the hash map.
+ * @param key A pointer to the key.
+ * @param keySize The size of the key.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the entry was removed successfully.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the key is NULL.
+ * 
+ * - `HASHMAP_ELEMENT_NOT_FOUND_ERROR` if no entry has the key.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_remove(hashmap_t* const hashmap, const void* const key, const uint64_t keySize);
+
+/**
+ * @brief Removes the entry of a key from the hash map and retrieves a clone of its value.
+ *
+ * @param hashmap A pointer to the hash map.
+ * @param elementOut A double pointer where the cloned value will be stored.
+ * @param key A pointer to the key.
+ * @param keySize The size of the key.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the entry was removed and its value retrieved successfully.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the key is NULL.
+ * 
+ * - `HASHMAP_ELEMENT_NOT_FOUND_ERROR` if no entry has the key.
+ * 
+ * - `HASHMAP_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Freeing the outputted element is your responsibility, it is recomended to use `hashmap_element_free` for this.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_pop(hashmap_t* const hashmap, hashmap_element_t** elementOut, const void* const key, const uint64_t keySize);
+
+/**
+ * @brief Removes every entry from the hash map, keeping its capacity.
+ *
+ * @param hashmap A pointer to the hash map to be cleared.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the hash map was cleared successfully.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_clear(hashmap_t* const hashmap);
+
+/**
+ * @brief Frees the memory allocated for a hash map element.
+ *
+ * @param element A pointer to a pointer to the hash map element to be freed.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the element was successfully freed.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the provided element pointer is NULL.
+ * 
+ * @note Sets the element pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_element_free(hashmap_element_t** element);
+
+/**
+ * @brief Creates a new hash map iterator.
+ *
+ * @param iteratorOut A double pointer where the created iterator will be stored.
+ * @param hashmap A pointer to the hash map to be iterated over.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the iterator was successfully created.
+ * 
+ * - `HASHMAP_NULL_ERROR` if the provided hash map pointer is NULL.
+ * 
+ * - `HASHMAP_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_iterator_create(hashmap_iterator_t** iteratorOut, hashmap_t* const hashmap);
+
+/**
+ * @brief Advances the iterator to the next entry of the hash map.
+ *
+ * @param iterator A pointer to the hash map iterator to be advanced.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the iterator was successfully advanced to the next entry.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * - `HASHMAP_INDEX_OUT_OF_RANGE_ERROR` if the iterator is already at the last entry.
+ * 
+ * @note When the iterator reaches the end of a hash map it will rewind itself to avoid 
+ *       lots of calls to `hashmap_iterator_rewind`.
+ * @warning Inserting into or removing from the hash map while iterating invalidates the iterator.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_iterator_next(hashmap_iterator_t* const iterator);
+
+/**
+ * @brief Resets the iterator to its initial state.
+ *
+ * @param iterator A pointer to the hash map iterator to be reset.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the iterator was successfully reset.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the iterator is NULL.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_iterator_rewind(hashmap_iterator_t* const iterator);
+
+/**
+ * @brief Frees the memory allocated for a hash map iterator.
+ *
+ * @param iterator A double pointer to the hash map iterator to be freed.
+ * 
+ * @return 
+ * - `HASHMAP_SUCCESS` if the iterator was successfully freed.
+ * 
+ * - `HASHMAP_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * @note Sets the iterator pointer to NULL after freeing.
+ * @note Only the iterator is freed, the hash map used does not get freed.
+ */
+CONFETTI_EXPORT hashmap_result_t hashmap_iterator_free(hashmap_iterator_t** iterator);
+
+#pragma endregion
@@ -0,0 +1,270 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_export.h"
+#include "confetti_allocator.h"
+#include "list.h"
+
+// constant definitions
+
+#define DEFAULT_HEAP_ARITY ((uint32_t) 4)                // The default amount of children of every node if an arity is not given.
+#define HEAP_INVALID_HANDLE ((heap_handle_t) UINT64_MAX) // A handle that never refers to a value of a heap.
+
+// struct definitions
+
+// define all structs early to avoid errors relating to one of these structs not existing.
+typedef struct heap heap_t;
+typedef struct heap_options heap_options_t;
+
+/**
+ * @brief Type definition for a handle referring to a value of a heap.
+ *
+ * A handle keeps referring to the same value while the heap reorders its values,
+ * until that value is popped or removed, after which the handle may be reused.
+ */
+typedef uint64_t heap_handle_t;
+
+/**
+ * @brief Represents a d-ary min heap kept in the storage of a list.
+ *
+ * Every node has up to `arity` children, so a wide heap is shallower and visits 
+ * fewer cache lines per operation than a binary heap. The smallest value according
+ * to the list's equality function is always at index 0 of `list`, and results are 
+ * the same `list_result_t` values the list returns.
+ *
+ * @warning Please do not modify `list` directly, doing so breaks the heap order 
+ * and the handles of its values. Reading it, such as through `list_peek`, is fine.
+ */
+typedef struct heap {
+    list_t* list;               /* The list holding the values in heap order. */
+    uint32_t arity;             /* Amount of children of every node. */
+    heap_handle_t* handles;     /* The handle of the value at every index of the list. */
+    int64_t* positions;         /* The index of the value of every handle, -1 for free handles. */
+    heap_handle_t* freeHandles; /* Stack of handles free to be reused. */
+    uint64_t freeCount;         /* Amount of handles in `freeHandles`. */
+    uint64_t handleCount;       /* Amount of handles handed out so far, free or not. */
+    uint64_t handleCapacity;    /* Amount of handles `handles`, `positions` and `freeHandles` have room for. */
+    uint8_t* scratch;           /* Room for one slot of the list, used while sifting. */
+} heap_t;
+
+/**
+ * @brief Represents the options a heap is created with.
+ *
+ * A zero initialized `heap_options_t` describes a default heap of pointer elements.
+ */
+typedef struct heap_options {
+    uint32_t arity;      /* Amount of children of every node, `DEFAULT_HEAP_ARITY` if less than 2. */
+    list_options_t list; /* Options of the list holding the values, its equality function orders the heap. */
+} heap_options_t;
+
+// public function definitions
+
+#pragma region public function definitions
+
+/**
+ * @brief Creates a new heap.
+ *
+ * @param heapOut A double pointer to where the created heap will be stored.
+ * @param elementSize The size in bytes of every value for a fixed stride heap, or 0 to store list elements.
+ * @param comparator A pointer to the function ordering the values, or NULL to use the list's default.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the heap was created successfully. 
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT list_result_t heap_create(heap_t** heapOut, const uint64_t elementSize, list_custom_equality_function_t* const comparator);
+
+/**
+ * @brief Creates a new heap described by a set of options.
+ *
+ * @param heapOut A double pointer to where the created heap will be stored.
+ * @param options A pointer to the options describing the heap, or NULL to use the defaults.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the heap was created successfully. 
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the list options are invalid, as described by `list_create_with_options`,
+ *   or if they attach a hash index, which the heap would leave out of date.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note The heap and its handles are requested from the same allocator as the list.
+ */
+CONFETTI_EXPORT list_result_t heap_create_with_options(heap_t** heapOut, const heap_options_t* const options);
+
+/**
+ * @brief Creates a heap out of the values of an existing list in O(n).
+ *
+ * The list is reordered in place, so none of its values are copied.
+ *
+ * @param heapOut A double pointer to where the created heap will be stored.
+ * @param list A double pointer to the list to build the heap from.
+ * @param arity Amount of children of every node. If less than 2, the `DEFAULT_HEAP_ARITY` will be used.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the heap was created successfully. 
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the list was set up by `list_init`.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note On success the heap takes ownership of the list and sets the list pointer to NULL. 
+ *       The handle of every value is the index it had in the list, a hash index 
+ *       attached to the list is detached and the list is no longer marked `sorted`.
+ */
+CONFETTI_EXPORT list_result_t heap_create_from_list(heap_t** heapOut, list_t** list, const uint32_t arity);
+
+/**
+ * @brief Frees the memory for a `heap_t` along with its list.
+ *
+ * @param heap A double pointer to the heap to be freed.
+ * 
+ * @return
+ * - `LIST_SUCCESS` if the heap was successfully freed.
+ *
+ * - `LIST_NULL_ERROR` if the provided heap is NULL.
+ * 
+ * @note Sets the heap pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT list_result_t heap_free(heap_t** heap);
+
+/**
+ * @brief Pushes a value onto the heap in O(log n).
+ *
+ * @param heap A pointer to the heap.
+ * @param value A pointer to the value to push.
+ * @param size The size of the value.
+ * @param handleOut A pointer to where the handle of the value will be stored, or NULL.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the value was pushed successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided heap pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the list rejects the value, as described by `list_append`.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT list_result_t heap_push(heap_t* const heap, void* const value, const uint64_t size, heap_handle_t* const handleOut);
+
+/**
+ * @brief Borrows the smallest value of the heap.
+ *
+ * @param heap A pointer to the heap.
+ * @param valueOut A pointer to where the address of the value will be stored.
+ * @param sizeOut A pointer to where the size of the value will be stored, or NULL.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the value was borrowed successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided heap pointer is NULL.
+ * 
+ * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if the heap is empty.
+ * 
+ * @warning The borrowed value is owned by the heap and is only valid until the 
+ * heap is next modified, do not free it or write through it.
+ */
+CONFETTI_EXPORT list_result_t heap_peek(heap_t* const heap, const void** valueOut, uint64_t* const sizeOut);
+
+/**
+ * @brief Pops the smallest value of the heap in O(d log n).
+ *
+ * @param heap A pointer to the heap.
+ * @param elementOut A double pointer to where the popped element will be stored, or NULL to discard it.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the value was popped successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided heap pointer is NULL.
+ * 
+ * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if the heap is empty.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if a fixed stride heap couldn't allocate the outputted element.
+ * 
+ * @note The outputted `list_element_t` belongs to the caller as described by `list_take`,
+ *       it is recomended to use `list_element_free` to free it.
+ */
+CONFETTI_EXPORT list_result_t heap_pop(heap_t* const heap, list_element_t** elementOut);
+
+/**
+ * @brief Replaces a value of the heap with a smaller or equal one in O(log n).
+ *
+ * @param heap A pointer to the heap.
+ * @param handle The handle of the value to replace.
+ * @param value A pointer to the new value.
+ * @param size The size of the new value.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the value was replaced successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided heap pointer is NULL.
+ * 
+ * - `LIST_ELEMENT_NOT_FOUND_ERROR` if the handle doesn't refer to a value of the heap.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the new value is greater than the current one,
+ *   or if the list rejects it, as described by `list_set`.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT list_result_t heap_decrease_key(heap_t* const heap, const heap_handle_t handle, void* const value, const uint64_t size);
+
+/**
+ * @brief Removes the value a handle refers to from the heap in O(d log n).
+ *
+ * @param heap A pointer to the heap.
+ * @param handle The handle of the value to remove.
+ * @param elementOut A double pointer to where the removed element will be stored, or NULL to discard it.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the value was removed successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided heap pointer is NULL.
+ * 
+ * - `LIST_ELEMENT_NOT_FOUND_ERROR` if the handle doesn't refer to a value of the heap.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if a fixed stride heap couldn't allocate the outputted element.
+ */
+CONFETTI_EXPORT list_result_t heap_remove(heap_t* const heap, const heap_handle_t handle, list_element_t** elementOut);
+
+/**
+ * @brief Removes every value of the heap.
+ *
+ * @param heap A pointer to the heap.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the heap was cleared successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided heap pointer is NULL.
+ * 
+ * @note Every handle handed out so far becomes free to be reused.
+ */
+CONFETTI_EXPORT list_result_t heap_clear(heap_t* const heap);
+
+#pragma endregion
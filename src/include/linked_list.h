@@ -27,6 +27,24 @@ If not, see <https://www.gnu.org/licenses/>.
 #include <string.h>
 
 #include "confetti_export.h"
+#include "confetti_allocator.h"
+#include "confetti_executor.h"
+
+// constant definitions
+
+#define LINKED_LIST_INLINE_VALUE_CAPACITY ((uint64_t) 48) // Values of at most this many bytes are stored inside the allocation of their node.
+
+#define LINKED_LIST_FLAG_NONE ((uint32_t) 0)                // No optional linked list behaviour.
+#define LINKED_LIST_FLAG_STORE_POINTERS ((uint32_t) 1 << 0) // Keep the caller's value pointers instead of copying the values they point to.
+
+/**
+ * @brief The size of the single block a linked list requests from its allocator for every node.
+ * 
+ * Each block holds the node, a reference count, a value destructor, its element and up to 
+ * `LINKED_LIST_INLINE_VALUE_CAPACITY` bytes of value, larger values are allocated separately. 
+ * A `confetti_pool_t` created with this block size serves every node of a linked list.
+ */
+#define LINKED_LIST_NODE_ALLOCATION_SIZE ((uint64_t) (sizeof(linked_list_node_t) + sizeof(uint64_t) + sizeof(linked_list_value_destructor_t*) + sizeof(linked_list_element_t) + LINKED_LIST_INLINE_VALUE_CAPACITY))
 
 // definitions
 
@@ -34,6 +52,8 @@ typedef struct linked_list linked_list_t;
 typedef struct linked_list_node linked_list_node_t;
 typedef struct linked_list_element linked_list_element_t; 
 typedef struct linked_list_iterator linked_list_iterator_t;
+typedef struct linked_list_cursor linked_list_cursor_t;
+typedef struct linked_list_options linked_list_options_t;
 typedef enum linked_list_result linked_list_result_t; 
 
 
@@ -54,6 +74,42 @@ typedef enum linked_list_result linked_list_result_t;
 typedef int32_t (linked_list_custom_equality_function_t)(const void* const data1, const void* const data2, const uint64_t size);
 
 
+/**
+ * @brief Function type definition for a custom hash function.
+ *
+ * Values that the linked list's equality function considers equal must produce the same hash.
+ *
+ * @param data Pointer to the memory block to hash, NULL if the element has no value.
+ * @param size Size in bytes of the data.
+ * 
+ * @return The hash of the data.
+ */
+typedef uint64_t (linked_list_custom_hash_function_t)(const void* const data, const uint64_t size);
+
+/**
+ * @brief Function type definition for a function releasing a value stored by pointer.
+ *
+ * Used by linked lists created with `LINKED_LIST_FLAG_STORE_POINTERS`, it is called once 
+ * for every stored pointer the linked list lets go of, when the node holding it is freed,
+ * removed or set to another value.
+ *
+ * @param value The pointer that was given to the linked list, may be NULL.
+ * @param size The size the value was stored with.
+ */
+typedef void (linked_list_value_destructor_t)(void* const value, const uint64_t size);
+
+/**
+ * @brief Function type definition for a function deciding whether a value of a linked list matches.
+ *
+ * @param context The context given along with the function.
+ * @param value Pointer to the value, NULL if the element has no value.
+ * @param size Size in bytes of the value.
+ * 
+ * @return `true` if the value matches, otherwise `false`.
+ */
+typedef bool (linked_list_predicate_function_t)(void* const context, const void* const value, const uint64_t size);
+
+
 /**
  * @brief Function type definition for a custom sorting function for linked lists.
  *
@@ -88,11 +144,28 @@ typedef struct linked_list_node {
 } linked_list_node_t;
 
 
+/**
+ * @brief Represents a position within a linked list.
+ *
+ * A cursor remembers the node at its position along with the node before it, so 
+ * accessing, inserting and removing at or near the position doesn't walk the list 
+ * from its head. Positions range from 0 to the size of the list, where the last 
+ * position is past the tail and has no node.
+ */
+typedef struct linked_list_cursor {
+    linked_list_t* list;          /* The linked list the cursor moves through. */
+    linked_list_node_t* previous; /* The node before the position, NULL at the head. */
+    linked_list_node_t* node;     /* The node at the position, NULL past the tail. */
+    int64_t index;                /* The position of the cursor. */
+} linked_list_cursor_t;
+
+
 /**
  * @brief Represents a singly linked list.
  *
  * This structure maintains pointers to the head and tail nodes, the total number
- * of elements, an equality function and sorting function.
+ * of elements, an equality function and sorting function. Every node, element and value 
+ * kept by the linked list, including the linked list itself, is requested from its allocator.
  */
 typedef struct linked_list {
     linked_list_node_t* head;                                 /* Pointer to the first node in the linked list. */
@@ -100,9 +173,31 @@ typedef struct linked_list {
     int64_t size;                                             /* Number of elements currently in the linked list. */
     linked_list_custom_equality_function_t* equalityFunction; /* Equality function for comparing elements. */
     linked_list_custom_sorting_function_t* sortingFunction;   /* Sorting function for sorting the linked list. */
+    confetti_allocator_t allocator;                           /* Allocator the linked list's memory is requested from. */
+    linked_list_custom_hash_function_t* hashFunction;         /* Hash function of the attached hash index, NULL without one. */
+    struct confetti_hash_index* index;                        /* Optional hash index speeding up searches, NULL without one. */
+    linked_list_cursor_t finger;                              /* The last accessed position, index based operations start walking from it. */
+    uint32_t flags;                                           /* Combination of `LINKED_LIST_FLAG_*` values the linked list was created with. */
+    linked_list_value_destructor_t* destructor;               /* Releases the values of a `LINKED_LIST_FLAG_STORE_POINTERS` linked list, NULL for none. */
 } linked_list_t;
 
 
+/**
+ * @brief Represents the options a linked list is created with.
+ *
+ * A zero initialized `linked_list_options_t` describes a default linked list, 
+ * the same as calling `linked_list_create` with NULL functions.
+ */
+typedef struct linked_list_options {
+    linked_list_custom_equality_function_t* equalityFunction; /* Custom equality function, or NULL to use the default. */
+    linked_list_custom_sorting_function_t* sortingFunction;   /* Custom sorting function, or NULL to use the default. */
+    const confetti_allocator_t* allocator;                    /* Allocator to request memory from, or NULL to use the default. */
+    linked_list_custom_hash_function_t* hashFunction;         /* Hash function to attach a hash index with, or NULL for none. */
+    uint32_t flags;                                           /* Combination of `LINKED_LIST_FLAG_*` values. */
+    linked_list_value_destructor_t* destructor;               /* Releases stored pointers with `LINKED_LIST_FLAG_STORE_POINTERS`, or NULL for none. */
+} linked_list_options_t;
+
+
 /**
  * @brief Represents an iterator for a linked list.
  * 
@@ -172,7 +267,14 @@ typedef enum linked_list_result {
      *
      * Occurs when the system fails to allocate memory required for the operation.
      */
-    LINKED_LIST_ALLOCATION_FAILURE = -5
+    LINKED_LIST_ALLOCATION_FAILURE = -5,
+
+    /**
+     * @brief Error: File operation failure.
+     *
+     * Occurs when a file couldn't be opened, read or written, or doesn't hold a list in the expected format.
+     */
+    LINKED_LIST_FILE_ERROR = -6
 } linked_list_result_t;
 
 // public function definitions
@@ -199,6 +301,35 @@ CONFETTI_EXPORT linked_list_result_t linked_list_create(
     linked_list_custom_equality_function_t* const customEqualityFunction, 
     linked_list_custom_sorting_function_t* const customSortingFunction);
 
+/**
+ * @brief Creates a new linked list described by a set of options.
+ *
+ * This is the general form of `linked_list_create`, which additionally allows the 
+ * linked list to request its memory from a custom allocator such as a 
+ * `confetti_arena_t` or a `confetti_pool_t`.
+ *
+ * @param linkedListOut A double pointer to where the linked list will be stored.
+ * @param options A pointer to the options describing the linked list, or NULL to use the defaults.
+ * 
+ * @return 
+ * `LINKED_LIST_SUCCESS` if the linked list was created successfully.
+ * 
+ * `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Elements handed to the caller by functions such as `linked_list_get` or `linked_list_pop` 
+ *       are always allocated with the default allocator, so `linked_list_element_free` can free them.
+ * 
+ * @note A linked list created with `LINKED_LIST_FLAG_STORE_POINTERS` keeps the pointers given to
+ *       `linked_list_append`, `linked_list_prepend`, `linked_list_insert`, `linked_list_set` and
+ *       the cursor functions as they are, so large values aren't copied and the linked list never
+ *       frees them itself. Instead the destructor, if there is one, is called with every stored
+ *       pointer once the linked list lets go of it. Every other function adding values, as well 
+ *       as clones, still copies them.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_create_with_options(
+    linked_list_t** linkedListOut, 
+    const linked_list_options_t* const options);
+
 /**
  * @brief Frees the memory allocated for a linked list.
  *
@@ -258,6 +389,29 @@ CONFETTI_EXPORT linked_list_result_t linked_list_print(linked_list_t* const link
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_get(linked_list_t* const linkedList, linked_list_element_t** elementOut, const int64_t index);
 
+/**
+ * @brief Borrows the value stored in the linked list at a specified index.
+ *
+ * Unlike `linked_list_get` this function does not clone the element, it outputs
+ * a pointer to the value kept by the linked list and its size, making reads allocation free.
+ *
+ * @param linkedList A pointer to the linked list from which to borrow the value.
+ * @param valueOut A pointer to where the address of the value will be stored.
+ * @param sizeOut A pointer to where the size of the value will be stored, or NULL.
+ * @param index The index of the value to borrow.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the value was borrowed successfully.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ * 
+ * - `LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * @warning The borrowed value is owned by the linked list and is only valid until 
+ * the linked list is next modified, do not free it or write through it.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_peek(linked_list_t* const linkedList, const void** valueOut, uint64_t* const sizeOut, const int64_t index);
+
 /**
  * @brief Sets the value of an element in the linked list at a specified index.
  *
@@ -274,6 +428,9 @@ CONFETTI_EXPORT linked_list_result_t linked_list_get(linked_list_t* const linked
  * - `LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
  * 
  * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Setting an element of a `LINKED_LIST_FLAG_STORE_POINTERS` linked list to the pointer 
+ *       it already stores only updates its size, the destructor isn't called.
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_set(linked_list_t* const linkedList, const int64_t index, void* const value, const uint64_t size);
 
@@ -309,6 +466,34 @@ CONFETTI_EXPORT linked_list_result_t linked_list_prepend(linked_list_t* const li
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_append(linked_list_t* const linkedList, void* const value, const uint64_t size);
 
+/**
+ * @brief Appends multiple values to the end of the linked list at once.
+ *
+ * The new nodes are chained together first and then spliced onto the tail in one step.
+ *
+ * @param linkedList A pointer to the linked list to which the values will be appended.
+ * @param values A pointer to `count` values laid out contiguously, `stride` bytes apart.
+ * @param count The amount of values to append.
+ * @param stride The size of each value.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the values were appended successfully.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ * 
+ * - `LINKED_LIST_INVALID_PARAMS_ERROR` if the stride is 0 or values is NULL.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note If the operation fails the linked list is left unchanged.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_append_many(
+    linked_list_t* const linkedList, 
+    const void* const values, 
+    const uint64_t count, 
+    const uint64_t stride
+);
+
 /**
  * @brief Inserts a new element at a specified index in the linked list.
  *
@@ -341,6 +526,30 @@ CONFETTI_EXPORT linked_list_result_t linked_list_insert(linked_list_t* const lin
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_remove(linked_list_t* const linkedList, const uint64_t index);
 
+/**
+ * @brief Removes every element of the linked list a predicate matches.
+ *
+ * The linked list is walked once from its head, unlinking and freeing every 
+ * matching node as it goes, and the order of the remaining elements is kept.
+ *
+ * @param linkedList A pointer to the linked list from which the elements will be removed.
+ * @param predicate A pointer to the function deciding whether a value is removed.
+ * @param context The context handed to every call of the predicate.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the elements were removed successfully.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ * 
+ * - `LINKED_LIST_INVALID_PARAMS_ERROR` if the predicate is NULL.
+ * 
+ * @note The predicate must not modify the linked list.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_remove_if(
+    linked_list_t* const linkedList, 
+    linked_list_predicate_function_t* const predicate, 
+    void* const context);
+
 /**
  * @brief Removes and retrieves an element from the linked list at a specified index.
  *
@@ -361,6 +570,31 @@ CONFETTI_EXPORT linked_list_result_t linked_list_remove(linked_list_t* const lin
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_pop(linked_list_t* const linkedList, linked_list_element_t** elementOut, const uint64_t index);
 
+/**
+ * @brief Removes an element from the linked list and hands it over to the caller.
+ *
+ * This function behaves like `linked_list_pop` but transfers the element kept 
+ * by the linked list to the caller instead of cloning it and freeing the original.
+ *
+ * @param linkedList A pointer to the linked list from which the element will be taken.
+ * @param elementOut A double pointer where the taken element will be stored.
+ * @param index The index of the element to take.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the element was taken successfully.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ * 
+ * - `LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * @note The outputted `linked_list_element_t` now belongs to the caller, 
+ * it is recomended to use `linked_list_element_free` to free it. Values of at most 
+ * `LINKED_LIST_INLINE_VALUE_CAPACITY` bytes live inside their node and are therefore 
+ * still copied out, only larger values are handed over without a copy. Stored pointers
+ * are copied out as well before the destructor is called with them.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_take(linked_list_t* const linkedList, linked_list_element_t** elementOut, const int64_t index);
+
 /**
  * @brief Clears all elements from the linked list.
  *
@@ -394,6 +628,31 @@ CONFETTI_EXPORT linked_list_result_t linked_list_clear(linked_list_t* const link
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_clone(linked_list_t* const linkedList, linked_list_t** linkedListOut);
 
+/**
+ * @brief Creates a clone of a linked list without copying its values.
+ *
+ * Every node of the clone points at the element of the matching node of the linked list, 
+ * elements keep a reference count and are only copied once `linked_list_set` or 
+ * `linked_list_cursor_set` replaces them in either linked list.
+ *
+ * @param linkedList A pointer to the linked list to be cloned.
+ * @param linkedListOut A double pointer where the address of the cloned linked list will be stored.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the linked list was cloned successfully.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @warning Values of shared elements must not be modified in place, such as through an iterator, 
+ *          as the change would show in every linked list holding them.
+ * @note Either linked list may be freed first and they may be used from different threads.
+ * @note A stored pointer replaced in the node it was first added to is only handed to the  
+ *       destructor once that node is freed or set again, even if the clone let go of it earlier.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_clone_shallow(linked_list_t* const linkedList, linked_list_t** linkedListOut);
+
 /**
  * @brief Joins two linked lists into a new linked list.
  *
@@ -416,6 +675,26 @@ CONFETTI_EXPORT linked_list_result_t linked_list_clone(linked_list_t* const link
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_join(linked_list_t* const linkedList1, linked_list_t* const linkedList2, linked_list_t** linkedListOut);
 
+/**
+ * @brief Moves every node of a linked list to the end of another linked list in O(1).
+ *
+ * Unlike `linked_list_join` no element is cloned, the chain of the source is linked after the tail of the destination.
+ *
+ * @param destination A pointer to the linked list the nodes are appended to.
+ * @param source A pointer to the linked list the nodes are taken from, which is left empty.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the nodes were moved successfully.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if either of the provided linked list pointers is NULL.
+ * 
+ * - `LINKED_LIST_INVALID_PARAMS_ERROR` if both linked lists are the same linked list or they use 
+ *   different allocators, as the destination has to be able to free the nodes it takes over.
+ *
+ * @note A hash index attached to the destination is rebuilt by its next search.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_splice(linked_list_t* const destination, linked_list_t* const source);
+
 /**
  * @brief Resizes the linked list to a specified new size.
  *
@@ -469,7 +748,8 @@ CONFETTI_EXPORT linked_list_result_t linked_list_reverse(linked_list_t* const li
  * 
  * - `LINKED_LIST_ELEMENT_NOT_FOUND_ERROR` if the value was not found in the linked list.
  * 
- * @note It uses the linked list's equality function to compare elements.
+ * @note It uses the linked list's equality function to compare elements, only
+ *       elements whose size matches the given size are compared.
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_includes(linked_list_t* const linkedList, void* const value, const uint64_t size);
 
@@ -491,7 +771,8 @@ CONFETTI_EXPORT linked_list_result_t linked_list_includes(linked_list_t* const l
  * 
  * - `LINKED_LIST_ELEMENT_NOT_FOUND_ERROR` if the value was not found in the linked list.
  * 
- * @note It uses the linked list's equality function to compare elements.
+ * @note It uses the linked list's equality function to compare elements, only
+ *       elements whose size matches the given size are compared.
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_find_first(
     linked_list_t* const linkedList, 
@@ -521,7 +802,8 @@ CONFETTI_EXPORT linked_list_result_t linked_list_find_first(
  * 
  * - `LINKED_LIST_ELEMENT_NOT_FOUND_ERROR` if the value was not found in the linked list.
  * 
- * @note It uses the linked list's equality function to compare elements.
+ * @note It uses the linked list's equality function to compare elements, only
+ *       elements whose size matches the given size are compared.
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_find_last(
     linked_list_t* const linkedList, 
@@ -530,6 +812,46 @@ CONFETTI_EXPORT linked_list_result_t linked_list_find_last(
     void* const value, 
     const uint64_t size);
 
+/**
+ * @brief Attaches a hash index to the linked list.
+ *
+ * While attached, `linked_list_includes`, `linked_list_find_first` and `linked_list_find_last`
+ * find values in O(1) on average instead of walking the linked list, and only match elements 
+ * of the searched size. Appending, prepending, setting, swapping and removing the first or last 
+ * node keep the index up to date in O(1). Inserting or removing in the middle keeps it up to date 
+ * by moving the positions of the entries after the node, which costs a pass over the whole index. 
+ * Operations that reorder the linked list as a whole, such as sorting or `linked_list_remove_if`, 
+ * mark the index as stale and it is rebuilt in O(n) by the next search.
+ *
+ * @param linkedList A pointer to the linked list.
+ * @param hashFunction A pointer to a hash function consistent with the linked list's equality function.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the index was attached successfully.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ * 
+ * - `LINKED_LIST_INVALID_PARAMS_ERROR` if the hash function is NULL.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note An index that is already attached is replaced.
+ * @warning Values modified directly through the nodes are not seen by the index.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_index_attach(linked_list_t* const linkedList, linked_list_custom_hash_function_t* const hashFunction);
+
+/**
+ * @brief Detaches and frees the hash index of the linked list, if it has one.
+ *
+ * @param linkedList A pointer to the linked list.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the linked list no longer has an index.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_index_detach(linked_list_t* const linkedList);
+
 /**
  * @brief Sorts the linked list using the specified sorting function.
  *
@@ -557,6 +879,38 @@ CONFETTI_EXPORT linked_list_result_t linked_list_find_last(
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_sort(linked_list_t* const linkedList, const bool ascending);
 
+/**
+ * @brief Sorts the linked list across several threads.
+ *
+ * The chain is cut into one sublist per thread, the sublists are sorted with the default 
+ * merge sort at the same time and then merged pairwise, every pair of a level on its own thread. 
+ * Elements are compared with the linked list's equality function. Linked lists too small to 
+ * benefit are sorted on the calling thread, as are linked lists with a custom sorting function, 
+ * which is called like `linked_list_sort` does so switching to this function never changes the order.
+ *
+ * @param linkedList A pointer to the linked list to be sorted.
+ * @param ascending A boolean value indicating the sort order.
+ * @param threadCount The amount of threads to sort with. If 0, `confetti_executor_default_thread_count` will be used.
+ * @param executor A pointer to the executor the work is run by, or NULL to start threads for the sort.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the linked list was sorted successfully.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ *
+ * @warning The equality function is called from several threads at once.
+ * @warning With a custom sorting function the errors returned depend on its implementation.
+ * @note The sort with the default sorting function is stable, equal elements keep their original order.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_sort_parallel(
+    linked_list_t* const linkedList, 
+    const bool ascending, 
+    const uint64_t threadCount, 
+    const confetti_executor_t* const executor
+);
+
 /**
  * @brief Swaps two nodes in the list at the specified indices.
  *
@@ -577,6 +931,54 @@ CONFETTI_EXPORT linked_list_result_t linked_list_sort(linked_list_t* const linke
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_swap(linked_list_t* const linkedList, const int64_t index1, const int64_t index2);
 
+/**
+ * @brief Saves every value of a linked list to a file.
+ *
+ * The file uses the format of `list_save`, a header, a table with the offset and size 
+ * of every value and the values packed one after another, so it can be loaded by 
+ * `list_load` or mapped by `list_open_mapped` as well. It is written through a single large buffer.
+ *
+ * @param linkedList A pointer to the linked list to save.
+ * @param path The path of the file, which is replaced if it exists.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the linked list was saved successfully.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ * 
+ * - `LINKED_LIST_INVALID_PARAMS_ERROR` if the path is NULL.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * - `LINKED_LIST_FILE_ERROR` if the file couldn't be written.
+ * 
+ * @note Values are written in the byte order of the machine, files are only readable on machines sharing it.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_save(linked_list_t* const linkedList, const char* const path);
+
+/**
+ * @brief Creates a new linked list holding the values of a file written by `linked_list_save` or `list_save`.
+ *
+ * The file is read in a single pass and the nodes are linked up before the linked list takes them over.
+ *
+ * @param linkedListOut A double pointer to where the loaded linked list will be stored.
+ * @param path The path of the file.
+ * @param options A pointer to the options to create the linked list with, or NULL to use the defaults.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the linked list was loaded successfully.
+ * 
+ * - `LINKED_LIST_INVALID_PARAMS_ERROR` if the linked list out pointer or path is NULL.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * - `LINKED_LIST_FILE_ERROR` if the file couldn't be read or doesn't hold a list.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_load(
+    linked_list_t** linkedListOut, 
+    const char* const path, 
+    const linked_list_options_t* const options);
+
 /**
  * @brief Frees the memory allocated for a linked list element.
  *
@@ -601,6 +1003,8 @@ CONFETTI_EXPORT linked_list_result_t linked_list_element_free(linked_list_elemen
  * - `LINKED_LIST_SUCCESS` if the iterator was successfully created.
  * 
  * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_iterator_create(linked_list_iterator_t** iteratorOut, linked_list_t* const list);
 
@@ -653,3 +1057,190 @@ CONFETTI_EXPORT linked_list_result_t linked_list_iterator_rewind(linked_list_ite
  * @note Only the iterator is freed, the linked list used does not get freed.
  */
 CONFETTI_EXPORT linked_list_result_t linked_list_iterator_free(linked_list_iterator_t** iterator);
+
+/**
+ * @brief Creates a new cursor positioned at the head of a linked list.
+ *
+ * @param cursorOut A double pointer where the created cursor will be stored.
+ * @param linkedList A pointer to the linked list the cursor moves through.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the cursor was successfully created.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ *
+ * @warning Changes made to the linked list other than through the cursor invalidate it, 
+ *          use `linked_list_cursor_seek` with an index of 0 to reposition it afterwards.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_cursor_create(linked_list_cursor_t** cursorOut, linked_list_t* const linkedList);
+
+/**
+ * @brief Moves the cursor to a position.
+ *
+ * Positions after the current one are reached by walking forward from the cursor, 
+ * earlier ones by walking from the head. The position past the tail is reached in O(1).
+ *
+ * @param cursor A pointer to the cursor.
+ * @param index The position to move to, from 0 to the size of the linked list.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the cursor was moved.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided cursor pointer is NULL.
+ * 
+ * - `LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the index is not a valid position.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_cursor_seek(linked_list_cursor_t* const cursor, const int64_t index);
+
+/**
+ * @brief Moves the cursor to the next position.
+ *
+ * @param cursor A pointer to the cursor.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the cursor was moved.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided cursor pointer is NULL.
+ * 
+ * - `LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the cursor is already past the tail.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_cursor_next(linked_list_cursor_t* const cursor);
+
+/**
+ * @brief Retrieves the value at the position of the cursor without copying it.
+ *
+ * @param cursor A pointer to the cursor.
+ * @param valueOut A pointer to where the pointer to the value will be stored.
+ * @param sizeOut A pointer to where the size of the value will be stored, may be NULL.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the value was retrieved.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided cursor pointer is NULL.
+ * 
+ * - `LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the cursor is past the tail.
+ *
+ * @warning The value is owned by the linked list, it must not be freed.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_cursor_peek(linked_list_cursor_t* const cursor, const void** valueOut, uint64_t* const sizeOut);
+
+/**
+ * @brief Sets the value at the position of the cursor.
+ *
+ * @param cursor A pointer to the cursor.
+ * @param value A pointer to the new value.
+ * @param size The size of the new value.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the value was set.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided cursor pointer is NULL.
+ * 
+ * - `LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the cursor is past the tail.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_cursor_set(linked_list_cursor_t* const cursor, void* const value, const uint64_t size);
+
+/**
+ * @brief Inserts a value at the position of the cursor.
+ *
+ * The new node is linked before the node at the position, and the cursor is left on the new node.
+ *
+ * @param cursor A pointer to the cursor.
+ * @param value A pointer to the value to insert.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the value was inserted.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided cursor pointer is NULL.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_cursor_insert(linked_list_cursor_t* const cursor, void* const value, const uint64_t size);
+
+/**
+ * @brief Removes the node at the position of the cursor.
+ *
+ * The cursor is left on the node that followed the removed one.
+ *
+ * @param cursor A pointer to the cursor.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the node was removed.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided cursor pointer is NULL.
+ * 
+ * - `LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the cursor is past the tail.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_cursor_remove(linked_list_cursor_t* const cursor);
+
+/**
+ * @brief Frees a cursor.
+ *
+ * @param cursor A double pointer to the cursor to be freed.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the cursor was successfully freed.
+ * 
+ * - `LINKED_LIST_INVALID_PARAMS_ERROR` if the provided cursor pointer is NULL.
+ * 
+ * @note Sets the cursor pointer to NULL after freeing.
+ * @note Only the cursor is freed, the linked list used does not get freed.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_cursor_free(linked_list_cursor_t** cursor);
+
+/**
+ * @brief Sets up an iterator over a linked list in storage owned by the caller.
+ *
+ * @param iterator A pointer to the storage of the iterator.
+ * @param list A pointer to the linked list to be iterated over.
+ * 
+ * @return 
+ * - `LINKED_LIST_SUCCESS` if the iterator was successfully set up.
+ * 
+ * - `LINKED_LIST_NULL_ERROR` if the provided linked list pointer is NULL, the iterator is then set up to yield nothing.
+ * 
+ * - `LINKED_LIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * @note An iterator set up this way must not be freed with `linked_list_iterator_free`.
+ */
+CONFETTI_EXPORT linked_list_result_t linked_list_iterator_init(linked_list_iterator_t* const iterator, linked_list_t* const list);
+
+// inline function definitions
+
+/**
+ * @brief Advances the iterator to the next node of its linked list.
+ *
+ * Does the same as `linked_list_iterator_next` without checking the iterator, 
+ * and is defined here so loops over a linked list can be inlined completely.
+ *
+ * @param iterator A pointer to a linked list iterator.
+ * 
+ * @return `true` if the iterator moved to another node, `false` once it ran out of nodes and rewound itself.
+ */
+static inline bool linked_list_iterator_step(linked_list_iterator_t* const iterator) {
+    if (iterator->list == NULL)
+        return false;
+
+    iterator->node = iterator->node == NULL ? iterator->list->head : iterator->node->next;
+
+    if (iterator->node == NULL) {
+        iterator->index = -1;
+        return false;
+    }
+
+    iterator->index++;
+    return true;
+}
+
+/**
+ * @brief Loops over every node of a linked list with an iterator in storage owned by the caller.
+ *
+ * The current node is found in `iterator.node` and its index in `iterator.index`.
+ */
+#define LINKED_LIST_FOREACH(iterator, list) \
+    for (linked_list_iterator_init(&(iterator), (list)); linked_list_iterator_step(&(iterator)); )
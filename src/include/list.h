@@ -27,10 +27,20 @@ If not, see <https://www.gnu.org/licenses/>.
 #include <string.h>
 
 #include "confetti_export.h"
+#include "confetti_allocator.h"
+#include "confetti_executor.h"
 
 // constant definitions
 
-#define DEFAULT_LIST_CAPACITY ((int64_t) 8) // The default list capacity used if one is not given.
+#define DEFAULT_LIST_CAPACITY ((int64_t) 8)         // The default list capacity used if one is not given.
+#define DEFAULT_LIST_GROWTH_FACTOR ((uint32_t) 200) // The default percentage a list's capacity is multiplied by when it grows.
+#define LIST_INLINE_BUFFER_SIZE ((uint64_t) 64)     // Size in bytes of the slot buffer embedded in every list, used while the slots fit in it.
+
+#define LIST_FLAG_NONE ((uint32_t) 0)                // No optional list behaviour.
+#define LIST_FLAG_DEQUE ((uint32_t) 1 << 0)          // Reserve room in front of the elements so prepending is amortized O(1).
+#define LIST_FLAG_STORE_POINTERS ((uint32_t) 1 << 1) // Keep the caller's value pointers instead of copying the values they point to.
+
+#define LIST_PARALLEL_CHUNK_SIZE ((int64_t) 16384) // The least amount of elements parallel operations hand to a single task.
 
 // struct definitions
 
@@ -38,6 +48,9 @@ If not, see <https://www.gnu.org/licenses/>.
 typedef struct list list_t;
 typedef struct list_element list_element_t;
 typedef struct list_iterator list_iterator_t;
+typedef struct list_options list_options_t;
+typedef struct list_growth_policy list_growth_policy_t;
+typedef struct list_mapped list_mapped_t;
 typedef enum list_result list_result_t;
 
 /**
@@ -59,6 +72,31 @@ typedef enum list_result list_result_t;
  */
 typedef int32_t (list_custom_equality_function_t)(const void* const data1, const void* const data2, const uint64_t size);
 
+/**
+ * @brief Type definition for a custom hash function for list elements.
+ *
+ * This function type is used by a list's hash index. Values that the list's equality 
+ * function considers equal must produce the same hash.
+ *
+ * @param data A pointer to the data to hash, NULL if the element has no value.
+ * @param size The size of the data.
+ * 
+ * @return The hash of the data.
+ */
+typedef uint64_t (list_custom_hash_function_t)(const void* const data, const uint64_t size);
+
+/**
+ * @brief Type definition for a function releasing a value stored by pointer.
+ *
+ * Used by lists created with `LIST_FLAG_STORE_POINTERS`, it is called once for 
+ * every stored pointer the list lets go of, when the element holding it is freed,
+ * removed or replaced.
+ *
+ * @param value The pointer that was given to the list, may be NULL.
+ * @param size The size the value was stored with.
+ */
+typedef void (list_value_destructor_t)(void* const value, const uint64_t size);
+
 /**
  * @brief Type definition for a custom sorting function for a list.
  *
@@ -72,6 +110,66 @@ typedef int32_t (list_custom_equality_function_t)(const void* const data1, const
  */
 typedef list_result_t (list_custom_sorting_function_t)(list_t* const list, const bool ascending);
 
+/**
+ * @brief Type definition for a sort key extraction function for a list.
+ *
+ * This function type is used by `list_sort_by_key` to map every value to an unsigned
+ * integer whose natural order is the desired order of the values. `list_key_from_int64` 
+ * and `list_key_from_double` convert signed integers and floating point numbers into such keys.
+ *
+ * @param value A pointer to the value, NULL if the element has no value.
+ * @param size The size of the value.
+ * 
+ * @return The sort key of the value.
+ */
+typedef uint64_t (list_key_function_t)(const void* const value, const uint64_t size);
+
+/**
+ * @brief Type definition for a function visiting the elements of a list.
+ *
+ * Used by `list_for_each_parallel`, the value may be modified in place. Values shared with a 
+ * shallow clone are copied before the function is called, so a change never shows in the clone.
+ *
+ * @param context The context given along with the function.
+ * @param value A pointer to the value, NULL if the element has no value.
+ * @param size The size of the value.
+ * @param index The index of the element.
+ */
+typedef void (list_for_each_function_t)(void* const context, void* const value, const uint64_t size, const int64_t index);
+
+/**
+ * @brief Type definition for a function folding a value of a list into an accumulator.
+ *
+ * @param context The context given along with the function.
+ * @param accumulator A pointer to the accumulator to update.
+ * @param value A pointer to the value, NULL if the element has no value.
+ * @param size The size of the value.
+ */
+typedef void (list_reduce_function_t)(void* const context, void* const accumulator, const void* const value, const uint64_t size);
+
+/**
+ * @brief Type definition for a function combining two accumulators of `list_reduce`.
+ *
+ * The function must be associative, `partial` holds the result of elements following 
+ * the ones already folded into `accumulator`.
+ *
+ * @param context The context given along with the function.
+ * @param accumulator A pointer to the accumulator to update.
+ * @param partial A pointer to the accumulator to combine into it.
+ */
+typedef void (list_combine_function_t)(void* const context, void* const accumulator, const void* const partial);
+
+/**
+ * @brief Type definition for a function deciding whether a value of a list is kept.
+ *
+ * @param context The context given along with the function.
+ * @param value A pointer to the value, NULL if the element has no value.
+ * @param size The size of the value.
+ * 
+ * @return `true` if the value is kept, otherwise `false`.
+ */
+typedef bool (list_predicate_function_t)(void* const context, const void* const value, const uint64_t size);
+
 /**
  * @brief Represents an element in a list.
  *
@@ -82,20 +180,74 @@ typedef struct list_element {
     void* value;   /* Pointer to the data stored in the list element. */
 } list_element_t;
 
+/**
+ * @brief Represents how the capacity of a list grows and shrinks.
+ *
+ * A zero initialized `list_growth_policy_t` doubles the capacity whenever 
+ * the list is full and never gives memory back on its own.
+ * 
+ * A list with a `shrinkDivisor` shrinks once its size falls to a `shrinkDivisor`th 
+ * of its capacity, down to the capacity growing from its size would reach. The 
+ * divisor must exceed the growth factor so a shrunk list doesn't grow again right away.
+ */
+typedef struct list_growth_policy {
+    uint32_t factor;        /* Percentage the capacity is multiplied by when growing, `DEFAULT_LIST_GROWTH_FACTOR` if 0. */
+    int64_t maxStep;        /* The most slots a single growth adds, 0 for no limit. */
+    uint32_t shrinkDivisor; /* Shrink once the size falls to this fraction of the capacity, 0 to never shrink. */
+} list_growth_policy_t;
+
 /**
  * @brief Represents a dynamic list data structure.
  *
  * This structure maintains a dynamic array of pointers to list elements,
  * along with metadata for managing size, capacity, and custom behavior.
+ * 
+ * A list created with `list_create_fixed` instead stores every value inline 
+ * in `data`, one after another `stride` bytes apart, and leaves `items` NULL.
+ * 
+ * Every block of memory kept by the list, including the list itself, is
+ * requested from `allocator`. Lists whose slots fit in `LIST_INLINE_BUFFER_SIZE` 
+ * bytes keep them in `inlineSlots` instead, so a small fixed stride list set up 
+ * with `list_init` doesn't allocate at all.
  */
 typedef struct list {
     int64_t size;                                      /* Current number of elements in the list. */
-    int64_t capacity;                                  /* Total allocated capacity for elements. */
-    list_element_t** items;                            /* Array of pointers to list elements. */
+    int64_t capacity;                                  /* Allocated capacity for elements, counted from the first element. */
+    list_element_t** items;                            /* Array of pointers to list elements, NULL for fixed stride lists. */
     list_custom_equality_function_t* equalityFunction; /* Optional custom equality function for comparing elements. */
     list_custom_sorting_function_t* sortingFunction;   /* Optional custom sorting function for ordering elements. */
+    uint64_t stride;                                   /* Size in bytes of every value of a fixed stride list, 0 otherwise. */
+    uint8_t* data;                                     /* Contiguous value buffer of a fixed stride list, NULL otherwise. */
+    confetti_allocator_t allocator;                    /* Allocator the list's memory is requested from. */
+    int64_t offset;                                    /* Amount of unused slots allocated in front of the first element. */
+    uint32_t flags;                                    /* Combination of `LIST_FLAG_*` values the list was created with. */
+    list_custom_hash_function_t* hashFunction;         /* Hash function of the attached hash index, NULL without one. */
+    struct confetti_hash_index* index;                 /* Optional hash index speeding up searches, NULL without one. */
+    list_value_destructor_t* destructor;               /* Releases the values of a `LIST_FLAG_STORE_POINTERS` list, NULL for none. */
+    list_growth_policy_t growth;                       /* How the capacity grows and shrinks, with its defaults filled in. */
+    bool embedded;                                     /* Whether the list lives in caller storage set up by `list_init`. */
+    bool sorted;                                       /* Whether the values are known to be in ascending order, letting searches binary search. */
+    uint64_t inlineSlots[LIST_INLINE_BUFFER_SIZE / 8]; /* Slot buffer used instead of an allocation while the slots fit in it. */
 } list_t;
 
+/**
+ * @brief Represents the options a list is created with.
+ *
+ * A zero initialized `list_options_t` describes a default list, the same
+ * as calling `list_create` with a capacity of 0 and NULL functions.
+ */
+typedef struct list_options {
+    int64_t capacity;                                  /* The initial capacity, `DEFAULT_LIST_CAPACITY` if less than 1. */
+    uint64_t elementSize;                              /* Size of every value for a fixed stride list, 0 for a pointer list. */
+    list_custom_equality_function_t* equalityFunction; /* Custom equality function, or NULL to use the default. */
+    list_custom_sorting_function_t* sortingFunction;   /* Custom sorting function, or NULL to use the default. */
+    const confetti_allocator_t* allocator;             /* Allocator to request memory from, or NULL to use the default. */
+    uint32_t flags;                                    /* Combination of `LIST_FLAG_*` values. */
+    list_custom_hash_function_t* hashFunction;         /* Hash function to attach a hash index with, or NULL for none. */
+    list_value_destructor_t* destructor;               /* Releases stored pointers with `LIST_FLAG_STORE_POINTERS`, or NULL for none. */
+    list_growth_policy_t growth;                       /* How the capacity grows and shrinks, zero initialized for the defaults. */
+} list_options_t;
+
 /**
  * @brief Represents an iterator for a list.
  * 
@@ -106,6 +258,13 @@ typedef struct list {
  * @param list A pointer to the list being iterated over.
  * @param index The current index.
  * @param element A pointer to the current element.
+ * @param view The element `element` points to when iterating a fixed stride list.
+ * @param startIndex The index of the first element of the iterated range.
+ * @param endIndex The index one past the last element of the iterated range, -1 for the size of the list.
+ * @param reverse Whether the range is iterated from its last element to its first.
+ * 
+ * An iterator set up by `list_iterator_init` lives in storage owned by the caller, 
+ * such as a local variable, and must not be freed with `list_iterator_free`.
  * 
  * @warning Please do not manually free anything witin this structure as 
  * they are the internal values kept by the linked list. If you wish 
@@ -115,8 +274,28 @@ typedef struct list_iterator {
     list_t* list;            /* The list being iterated through. */
     int64_t index;           /* The index of the current iteration. */
     list_element_t* element; /* The element of the current iteration. */
+    list_element_t view;     /* Element describing the current value of a fixed stride list. */
+    int64_t startIndex;      /* The index of the first element of the iterated range. */
+    int64_t endIndex;        /* The index one past the last element of the iterated range, -1 for the size of the list. */
+    bool reverse;            /* Whether the range is iterated from its last element to its first. */
 } list_iterator_t;
 
+/**
+ * @brief Represents a list file mapped read only into memory by `list_open_mapped`.
+ *
+ * Values are served straight from the mapping through `list_mapped_peek`,
+ * nothing is allocated or copied per element.
+ */
+typedef struct list_mapped {
+    int64_t size;           /* Amount of values in the file. */
+    uint64_t stride;        /* Size of every value of a file saved from a fixed stride list, 0 otherwise. */
+    const uint64_t* table;  /* Offset and size of every value one after another, NULL for fixed stride files. */
+    const uint8_t* payload; /* The packed values. */
+    const uint8_t* data;    /* The first byte of the mapping. */
+    uint64_t mappedSize;    /* Size of the mapping in bytes. */
+    void* handle;           /* Platform handle keeping the mapping alive, if the platform needs one. */
+} list_mapped_t;
+
 // enum definitions
 
 /**
@@ -170,7 +349,15 @@ typedef enum list_result {
      * This error occurs when the system is unable to allocate
      * the necessary memory for the operation.
      */
-    LIST_ALLOCATION_FAILURE = -5
+    LIST_ALLOCATION_FAILURE = -5,
+
+    /**
+     * @brief Error: File operation failure.
+     * 
+     * This error occurs when a file couldn't be opened, read, written 
+     * or mapped, or doesn't hold a list in the expected format.
+     */
+    LIST_FILE_ERROR = -6
 } list_result_t;
 
 // public function definitions
@@ -200,6 +387,97 @@ CONFETTI_EXPORT list_result_t list_create(
     list_custom_equality_function_t* const customEqualityFunction,
     list_custom_sorting_function_t* const customSortingFunction);
 
+/**
+ * @brief Creates a new fixed stride list whose values are stored inline.
+ * 
+ * Instead of allocating a `list_element_t` and a value buffer for every element,
+ * a fixed stride list copies each value into one contiguous buffer that grows 
+ * with the list. Appending becomes a single `memcpy` and searching or sorting 
+ * walks memory linearly. Every value stored in the list must be exactly
+ * `elementSize` bytes.
+ *
+ * @param listOut A double pointer to where the created list will be stored.
+ * @param capacity The initial capacity of the list. If less than 1, the `DEFAULT_LIST_CAPACITY` will be used.
+ * @param elementSize The size in bytes of every value stored in the list.
+ * @param customEqualityFunction A pointer to a custom equality function, or NULL to use the default.
+ * @param customSortingFunction A pointer to a custom sorting function, or NULL to use the default.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was created successfully. 
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the element size is 0.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Functions adding or setting values return `LIST_INVALID_PARAMS_ERROR` when 
+ *       given a size other than `elementSize`, and a NULL value is stored as zeroed bytes.
+ * @note The `items` array of a fixed stride list is NULL, custom sorting functions 
+ *       should reorder it through `list_swap` or by working on `data` directly.
+ */
+CONFETTI_EXPORT list_result_t list_create_fixed(
+    list_t** listOut,
+    const int64_t capacity,
+    const uint64_t elementSize,
+    list_custom_equality_function_t* const customEqualityFunction,
+    list_custom_sorting_function_t* const customSortingFunction);
+
+/**
+ * @brief Creates a new list described by a set of options.
+ * 
+ * This is the general form of `list_create` and `list_create_fixed`, which 
+ * additionally allows the list to request its memory from a custom allocator
+ * such as a `confetti_arena_t` or a `confetti_pool_t`.
+ *
+ * @param listOut A double pointer to where the created list will be stored.
+ * @param options A pointer to the options describing the list, or NULL to use the defaults.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was created successfully. 
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if `LIST_FLAG_STORE_POINTERS` is given for a fixed stride list,
+ *   or if the growth policy has a factor of 100 or less, a negative maximum step or a shrink 
+ *   divisor that doesn't exceed its growth factor.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Elements handed to the caller by functions such as `list_get` or `list_pop` 
+ *       are always allocated with the default allocator, so `list_element_free` can free them.
+ * 
+ * @note A list created with `LIST_FLAG_STORE_POINTERS` keeps the pointers given to
+ *       `list_append`, `list_prepend`, `list_insert` and `list_set` as they are, so large 
+ *       values aren't copied and the list never frees them itself. Instead the destructor,
+ *       if there is one, is called with every stored pointer once the list lets go of it.
+ *       Every other function adding values, as well as clones, still copies them.
+ */
+CONFETTI_EXPORT list_result_t list_create_with_options(list_t** listOut, const list_options_t* const options);
+
+/**
+ * @brief Sets up a list in storage owned by the caller, such as a local variable or a struct field.
+ * 
+ * Behaves like `list_create_with_options` without allocating the `list_t` itself.
+ * While its slots fit in `LIST_INLINE_BUFFER_SIZE` bytes no memory is allocated for 
+ * them either, the list only moves them to memory from its allocator once it outgrows them.
+ *
+ * @param list A pointer to the storage of the list.
+ * @param options A pointer to the options describing the list, or NULL to use the defaults.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was set up successfully. 
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the options are invalid, as described by `list_create_with_options`.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note A pointer list still allocates every element it holds, only the values of 
+ *       fixed stride lists are kept in the slots themselves.
+ * 
+ * @warning A list set up by `list_init` must be released with `list_deinit` and must not be 
+ *          copied by value, as its slots may point into the list itself.
+ */
+CONFETTI_EXPORT list_result_t list_init(list_t* const list, const list_options_t* const options);
+
 /**
  * @brief frees the memory for a `list_t` and its elements.
  *
@@ -210,10 +488,28 @@ CONFETTI_EXPORT list_result_t list_create(
  *
  * - `LIST_NULL_ERROR` if the provided list is NULL.
  * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the list was set up by `list_init`.
+ * 
  * @note Sets the list pointer to NULL after freeing.
  */
 CONFETTI_EXPORT list_result_t list_free(list_t** listOut);
 
+/**
+ * @brief Releases the elements and memory of a list set up by `list_init`.
+ * 
+ * The storage of the list itself is left to the caller, it may be set up again with `list_init`.
+ *
+ * @param list A pointer to the list to be released.
+ * 
+ * @return
+ * - `LIST_SUCCESS` if the list was successfully released.
+ *
+ * - `LIST_NULL_ERROR` if the provided list is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the list wasn't set up by `list_init`.
+ */
+CONFETTI_EXPORT list_result_t list_deinit(list_t* const list);
+
 /**
  * @brief Prints the contents of the list to the standard output.
  * 
@@ -248,6 +544,44 @@ CONFETTI_EXPORT list_result_t list_print(list_t* const list);
  */
 CONFETTI_EXPORT list_result_t list_resize(list_t* const list, const int64_t size);
 
+/**
+ * @brief Makes sure the list can hold an amount of elements without reallocating.
+ * 
+ * Unlike growing through appends, the capacity is set to exactly the amount asked for.
+ * 
+ * @param list A pointer to the list to reserve room in.
+ * @param capacity The amount of elements the list must be able to hold.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list can hold the given amount of elements. 
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the capacity is negative.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note A list that is already large enough is left untouched.
+ */
+CONFETTI_EXPORT list_result_t list_reserve(list_t* const list, const int64_t capacity);
+
+/**
+ * @brief Shrinks the capacity of the list down to its size.
+ * 
+ * Room kept in front of the elements is given back as well. An empty 
+ * list keeps room for a single element.
+ * 
+ * @param list A pointer to the list to be shrunk.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was shrunk successfully. 
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT list_result_t list_shrink_to_fit(list_t* const list);
+
 /**
  * @brief Prepends a new element to the beginning of the list.
  *
@@ -261,6 +595,9 @@ CONFETTI_EXPORT list_result_t list_resize(list_t* const list, const int64_t size
  * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
  * 
  * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Lists created with `LIST_FLAG_DEQUE` reserve room in front of their elements,
+ * making prepending amortized O(1). Removing the first element is O(1) for every list.
  */
 CONFETTI_EXPORT list_result_t list_prepend(list_t* const list, void* const value, const uint64_t size);
 
@@ -298,6 +635,62 @@ CONFETTI_EXPORT list_result_t list_append(list_t* const list, void* const value,
  */
 CONFETTI_EXPORT list_result_t list_insert(list_t* const list, const int64_t index, void* const value, const uint64_t size);
 
+/**
+ * @brief Appends multiple values to the end of the list at once.
+ *
+ * The list grows at most once and every value is copied in a single pass, 
+ * making this far cheaper than calling `list_append` for each value.
+ *
+ * @param list A pointer to the list to which the values will be appended.
+ * @param values A pointer to `count` values laid out contiguously, `stride` bytes apart.
+ * @param count The amount of values to append.
+ * @param stride The size of each value, which must match the element size of fixed stride lists.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the values were appended successfully. 
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the count is negative, the stride is invalid or values is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note If the operation fails the list is left unchanged.
+ */
+CONFETTI_EXPORT list_result_t list_append_many(list_t* const list, const void* const values, const int64_t count, const uint64_t stride);
+
+/**
+ * @brief Inserts multiple values at a specified index in the list at once.
+ *
+ * The existing elements are shifted a single time to make room for every value.
+ *
+ * @param list A pointer to the list where the values will be inserted.
+ * @param index The index at which the first value will be inserted.
+ * @param values A pointer to `count` values laid out contiguously, `stride` bytes apart.
+ * @param count The amount of values to insert.
+ * @param stride The size of each value, which must match the element size of fixed stride lists.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the values were inserted successfully. 
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if the index is out of range.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the count is negative, the stride is invalid or values is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note If the operation fails the list is left unchanged.
+ */
+CONFETTI_EXPORT list_result_t list_insert_many(
+    list_t* const list, 
+    const int64_t index, 
+    const void* const values, 
+    const int64_t count, 
+    const uint64_t stride
+);
+
 /**
  * @brief Retrieves an element from the list at the specified index.
  * 
@@ -321,6 +714,29 @@ CONFETTI_EXPORT list_result_t list_insert(list_t* const list, const int64_t inde
  */
 CONFETTI_EXPORT list_result_t list_get(list_t* const list, list_element_t** elementOut, const int64_t index);
 
+/**
+ * @brief Borrows the value stored in the list at the specified index.
+ * 
+ * Unlike `list_get` this function does not clone the element, it outputs a 
+ * pointer to the value kept by the list and its size, making reads allocation free.
+ *
+ * @param list A pointer to the list from which to borrow the value.
+ * @param valueOut A pointer to where the address of the value will be stored.
+ * @param sizeOut A pointer to where the size of the value will be stored, or NULL.
+ * @param index The index of the list to borrow.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the value was borrowed successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if the given index is out of range.
+ * 
+ * @warning The borrowed value is owned by the list and is only valid until the 
+ * list is next modified, do not free it or write through it.
+ */
+CONFETTI_EXPORT list_result_t list_peek(list_t* const list, const void** valueOut, uint64_t* const sizeOut, const int64_t index);
+
 /**
  * @brief Sets the value of an element in the list at the specified index.
  * 
@@ -337,6 +753,9 @@ CONFETTI_EXPORT list_result_t list_get(list_t* const list, list_element_t** elem
  * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if the index is out of range.
  * 
  * - `LIST_INVALID_PARAMS_ERROR` if the value size is zero.
+ * 
+ * @note Setting an element of a `LIST_FLAG_STORE_POINTERS` list to the pointer it 
+ *       already stores only updates its size, the destructor isn't called.
  */
 CONFETTI_EXPORT list_result_t list_set(list_t* const list, const int64_t index, void* const value, const uint64_t size);
 
@@ -355,6 +774,45 @@ CONFETTI_EXPORT list_result_t list_set(list_t* const list, const int64_t index,
  */
 CONFETTI_EXPORT list_result_t list_remove(list_t* const list, const int64_t index);
 
+/**
+ * @brief Removes every element between two indices from the list at once.
+ *
+ * Whichever side of the range holds fewer elements is moved, in a single pass.
+ *
+ * @param list A pointer to the list from which the elements will be removed.
+ * @param startIndex The index of the first element to remove.
+ * @param endIndex The index one past the last element to remove.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the elements were removed successfully. 
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ *  
+ * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if either index is out of range or the start index is past the end index.
+ */
+CONFETTI_EXPORT list_result_t list_remove_range(list_t* const list, const int64_t startIndex, const int64_t endIndex);
+
+/**
+ * @brief Removes every element of the list a predicate doesn't keep.
+ *
+ * The list is compacted in a single pass, keeping the order of the remaining 
+ * elements, and every removed element is freed as soon as the predicate rejects it.
+ *
+ * @param list A pointer to the list to filter.
+ * @param predicate A pointer to the function deciding whether a value is kept.
+ * @param context The context handed to every call of the predicate.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was filtered successfully. 
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ *  
+ * - `LIST_INVALID_PARAMS_ERROR` if the predicate is NULL.
+ * 
+ * @note The predicate must not modify the list.
+ */
+CONFETTI_EXPORT list_result_t list_retain_if(list_t* const list, list_predicate_function_t* const predicate, void* const context);
+
 /**
  * @brief Pops an element from the list at the specified index.
  *
@@ -375,6 +833,32 @@ CONFETTI_EXPORT list_result_t list_remove(list_t* const list, const int64_t inde
  */
 CONFETTI_EXPORT list_result_t list_pop(list_t* const list, list_element_t** elementOut, const int64_t index);
 
+/**
+ * @brief Takes an element out of the list at the specified index.
+ * 
+ * This function behaves like `list_pop` but hands the element kept by the 
+ * list over to the caller instead of cloning it and freeing the original.
+ *
+ * @param list A pointer to the list from which the element will be taken.
+ * @param elementOut A double pointer to where the taken element will be stored.
+ * @param index The index of the element to take.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the element was taken successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if the index is out of range.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if a fixed stride list couldn't allocate the outputted element.
+ * 
+ * @note The outputted `list_element_t` now belongs to the caller, it is 
+ * recomended to use `list_element_free` to free it. A fixed stride list has no
+ * element to hand over so a new one is allocated for its value, the same goes for
+ * stored pointers, which are copied before the destructor is called with them.
+ */
+CONFETTI_EXPORT list_result_t list_take(list_t* const list, list_element_t** elementOut, const int64_t index);
+
 /**
  * @brief Reverses the order of elements inside the list in-place.
  *
@@ -407,6 +891,30 @@ CONFETTI_EXPORT list_result_t list_reverse(list_t* const list);
  */
 CONFETTI_EXPORT list_result_t list_clone(list_t* const list, list_t** listOut);
 
+/**
+ * @brief Clones the specified list without copying its values.
+ * 
+ * The clone holds the same elements as the list, every element keeps a reference count 
+ * and is only copied once `list_set` replaces it in either list, so a clone costs one pointer 
+ * copy per element. Fixed stride lists store their values inline and are cloned like `list_clone` does.
+ *
+ * @param list A pointer to the list to be cloned.
+ * @param listOut A pointer to a pointer where the cloned list will be stored.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was cloned successfully. 
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if memory allocation fails during the process.
+ * 
+ * @warning Values of shared elements must not be modified in place, such as through an iterator, 
+ *          as the change would show in every list holding them. `list_for_each_parallel` copies 
+ *          them first.
+ * @note Either list may be freed first and they may be used from different threads.
+ */
+CONFETTI_EXPORT list_result_t list_clone_shallow(list_t* const list, list_t** listOut);
+
 /**
  * @brief Clears all elements from the list.
  * 
@@ -442,6 +950,31 @@ CONFETTI_EXPORT list_result_t list_clear(list_t* const list);
  */
 CONFETTI_EXPORT list_result_t list_join(list_t* const list1, list_t* const list2, list_t** listOut);
 
+/**
+ * @brief Moves every element of a list to the end of another list.
+ * 
+ * Unlike `list_join` no element is cloned. When both lists store their elements the same way 
+ * the slots of the source are moved over with a single copy, and an empty destination takes over the 
+ * storage of the source without copying at all. Elements only have to be copied when one list 
+ * is a fixed stride list and the other isn't, or when pointer lists use different allocators.
+ *
+ * @param destination A pointer to the list the elements are appended to.
+ * @param source A pointer to the list the elements are taken from, which is left empty.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the elements were moved successfully.
+ * 
+ * - `LIST_NULL_ERROR` if either of the provided list pointers is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if both lists are the same list or a fixed stride destination 
+ *   can't hold the values of the source.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ *
+ * @note On error both lists are left untouched.
+ */
+CONFETTI_EXPORT list_result_t list_concat_into(list_t* const destination, list_t* const source);
+
 /**
  * @brief Checks if the list includes a specific value.
  * 
@@ -495,11 +1028,12 @@ CONFETTI_EXPORT list_result_t list_find_first(
     const uint64_t size);
 
 /**
- * @brief Finds the last occurrence of a specific value in the list.
- * 
- * This function searches the specified list for the last element that
- * matches the provided value, starting from a given index. It uses the
- * list's equality function to compare the elements.
+ * @brief Finds the first occurrence of a specific value in the list across several threads.
+ *
+ * The searched part of the list is cut into chunks of `LIST_PARALLEL_CHUNK_SIZE` elements
+ * which are searched in order of their index. Once a match is found, chunks after it 
+ * are skipped, so the earliest match is found without scanning the rest of the list.
+ * Lists with a hash index are searched through it on the calling thread instead.
  *
  * @param list A pointer to the list to be searched.
  * @param indexOut A pointer to an integer where the index of the found element
@@ -507,13 +1041,50 @@ CONFETTI_EXPORT list_result_t list_find_first(
  * @param startIndex The index from which to start the search.
  * @param value A pointer to a value to search for in the list.
  * @param size The size of the value to be searched.
+ * @param threadCount The amount of threads to search with. If 0, `confetti_executor_default_thread_count` will be used.
+ * @param executor A pointer to the executor the work is run by, or NULL to start threads for the search.
  * 
- * @return
+ * @return 
  * - `LIST_SUCCESS` if the value is found.
  * 
  * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
  * 
- * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if the start index is out of range.
+ * - `LIST_INVALID_PARAMS_ERROR` if the start index or size is invalid.
+ * 
+ * - `LIST_ELEMENT_NOT_FOUND_ERROR` if the value is not found.
+ * 
+ * @note On error indexOut will be set to -1.
+ * @warning The equality function is called from several threads at once.
+ */
+CONFETTI_EXPORT list_result_t list_find_first_parallel(
+    list_t* const list, 
+    int64_t* const indexOut, 
+    const int64_t startIndex,
+    void* const value, 
+    const uint64_t size,
+    const uint64_t threadCount,
+    const confetti_executor_t* const executor);
+
+/**
+ * @brief Finds the last occurrence of a specific value in the list.
+ * 
+ * This function searches the specified list for the last element that
+ * matches the provided value, starting from a given index. It uses the
+ * list's equality function to compare the elements.
+ *
+ * @param list A pointer to the list to be searched.
+ * @param indexOut A pointer to an integer where the index of the found element
+ *                 will be stored.
+ * @param startIndex The index from which to start the search.
+ * @param value A pointer to a value to search for in the list.
+ * @param size The size of the value to be searched.
+ * 
+ * @return
+ * - `LIST_SUCCESS` if the value is found.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if the start index is out of range.
  * 
  * - `LIST_INVALID_PARAMS_ERROR` if the size is less than or equal to 0.
  * 
@@ -526,6 +1097,234 @@ CONFETTI_EXPORT list_result_t list_find_last(
     void* const value, 
     const uint64_t size);
 
+/**
+ * @brief Inserts a value into an ascending list at the position keeping it in order.
+ * 
+ * The position is found by binary search using the list's equality function and 
+ * the value is placed after every value equal to it, so equal values keep the order 
+ * they were inserted in. Inserting into an empty list marks it `sorted`.
+ *
+ * @param list A pointer to the list.
+ * @param indexOut A pointer to where the index of the inserted value will be stored, or NULL.
+ * @param value A pointer to the value to insert.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the value was inserted successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the list rejects the value, as described by `list_insert`.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @warning The list must already be in ascending order, such as after `list_sort`, 
+ *          otherwise the position the value is inserted at is unspecified.
+ */
+CONFETTI_EXPORT list_result_t list_sorted_insert(list_t* const list, int64_t* const indexOut, void* const value, const uint64_t size);
+
+/**
+ * @brief Finds the first occurrence of a value in an ascending list in O(log n).
+ *
+ * @param list A pointer to the list to be searched.
+ * @param indexOut A pointer to where the index of the found element, or -1, will be stored.
+ * @param value A pointer to the value to search for.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the value is found.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_ELEMENT_NOT_FOUND_ERROR` if the value is not found.
+ * 
+ * @note `list_includes`, `list_find_first` and `list_find_last` binary search on their own 
+ *       while the list is marked `sorted`, this function does so regardless of the mark.
+ * @warning The list must be in ascending order, otherwise the result is unspecified.
+ */
+CONFETTI_EXPORT list_result_t list_binary_search(list_t* const list, int64_t* const indexOut, void* const value, const uint64_t size);
+
+/**
+ * @brief Finds the first position of an ascending list whose value isn't less than a given value.
+ *
+ * @param list A pointer to the list to be searched.
+ * @param indexOut A pointer to where the position, between 0 and the size of the list, will be stored.
+ * @param value A pointer to the value to compare against.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the position was found.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * @warning The list must be in ascending order, otherwise the result is unspecified.
+ */
+CONFETTI_EXPORT list_result_t list_lower_bound(list_t* const list, int64_t* const indexOut, void* const value, const uint64_t size);
+
+/**
+ * @brief Finds the first position of an ascending list whose value is greater than a given value.
+ *
+ * @param list A pointer to the list to be searched.
+ * @param indexOut A pointer to where the position, between 0 and the size of the list, will be stored.
+ * @param value A pointer to the value to compare against.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the position was found.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * @warning The list must be in ascending order, otherwise the result is unspecified.
+ */
+CONFETTI_EXPORT list_result_t list_upper_bound(list_t* const list, int64_t* const indexOut, void* const value, const uint64_t size);
+
+/**
+ * @brief Calls a function for every element of the list across several threads.
+ *
+ * The list is cut into one chunk per thread, with chunks of at least `LIST_PARALLEL_CHUNK_SIZE` 
+ * elements, and every chunk is visited in order by a single thread.
+ *
+ * @param list A pointer to the list to visit.
+ * @param function A pointer to the function called for every element.
+ * @param context The context handed to every call of the function.
+ * @param threadCount The amount of threads to visit with. If 0, `confetti_executor_default_thread_count` will be used.
+ * @param executor A pointer to the executor the work is run by, or NULL to start threads for the call.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` once the function was called for every element.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the function is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ *
+ * @note Elements shared with a shallow clone get a copy of their own before any value is visited, 
+ *       stored pointers stay shared as the list doesn't own what they point to.
+ * @note A hash index is rebuilt by its next search and the list is no longer treated as sorted, 
+ *       as the function may have changed the values.
+ * @warning The function is called from several threads at once and must not modify the list itself.
+ * @warning Values of stored pointers shared with a shallow clone are modified for every list holding them.
+ */
+CONFETTI_EXPORT list_result_t list_for_each_parallel(
+    list_t* const list, 
+    list_for_each_function_t* const function, 
+    void* const context, 
+    const uint64_t threadCount, 
+    const confetti_executor_t* const executor);
+
+/**
+ * @brief Folds every value of the list into an accumulator across several threads.
+ *
+ * The list is cut into chunks like `list_for_each_parallel` does. Every chunk is folded 
+ * into its own copy of the initial accumulator, and the copies are then combined into 
+ * the accumulator in the order of the chunks on the calling thread.
+ *
+ * @param list A pointer to the list to reduce.
+ * @param accumulator A pointer to the accumulator, which must hold the identity of the combine function 
+ *                    (such as 0 for a sum) and will hold the result.
+ * @param accumulatorSize The size in bytes of the accumulator.
+ * @param reduce A pointer to the function folding a value into an accumulator.
+ * @param combine A pointer to the function combining two accumulators.
+ * @param context The context handed to every call of both functions.
+ * @param threadCount The amount of threads to reduce with. If 0, `confetti_executor_default_thread_count` will be used.
+ * @param executor A pointer to the executor the work is run by, or NULL to start threads for the call.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was reduced successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the accumulator or a function is NULL or the accumulator size is 0.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate the accumulators of the chunks.
+ *
+ * @warning Both functions are called from several threads at once.
+ */
+CONFETTI_EXPORT list_result_t list_reduce(
+    list_t* const list, 
+    void* const accumulator, 
+    const uint64_t accumulatorSize, 
+    list_reduce_function_t* const reduce, 
+    list_combine_function_t* const combine, 
+    void* const context, 
+    const uint64_t threadCount, 
+    const confetti_executor_t* const executor);
+
+/**
+ * @brief Appends copies of the values of the list a predicate keeps to another list.
+ *
+ * The predicate is evaluated across several threads, with the list cut into chunks like 
+ * `list_for_each_parallel` does, and the kept values are then appended in their original order.
+ *
+ * @param list A pointer to the list to filter.
+ * @param destination A pointer to the list the kept values are appended to.
+ * @param predicate A pointer to the function deciding whether a value is kept.
+ * @param context The context handed to every call of the predicate.
+ * @param threadCount The amount of threads to filter with. If 0, `confetti_executor_default_thread_count` will be used.
+ * @param executor A pointer to the executor the work is run by, or NULL to start threads for the call.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if every kept value was appended.
+ * 
+ * - `LIST_NULL_ERROR` if either list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the predicate is NULL, both lists are the same list 
+ *   or a kept value doesn't match the stride of a fixed stride destination.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ *
+ * @warning The predicate is called from several threads at once.
+ * @note If appending fails part way, the values kept before the failure stay appended.
+ */
+CONFETTI_EXPORT list_result_t list_filter_into(
+    list_t* const list, 
+    list_t* const destination, 
+    list_predicate_function_t* const predicate, 
+    void* const context, 
+    const uint64_t threadCount, 
+    const confetti_executor_t* const executor);
+
+/**
+ * @brief Attaches a hash index to the list.
+ * 
+ * While attached, `list_includes`, `list_find_first` and `list_find_last` find values
+ * in O(1) on average instead of scanning the list. Appending, prepending, setting, swapping 
+ * and removing the first or last element keep the index up to date in O(1). Inserting or 
+ * removing in the middle keeps it up to date by moving the positions of the entries after 
+ * the change, which costs a pass over the whole index, about as much as the list's own shift. 
+ * Operations that reorder the list as a whole, such as sorting, reversing or `list_retain_if`, 
+ * mark the index as stale and it is rebuilt in O(n) by the next search.
+ *
+ * @param list A pointer to the list.
+ * @param hashFunction A pointer to a hash function consistent with the list's equality function.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the index was attached successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the hash function is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note An index that is already attached is replaced.
+ * @warning Values modified directly through `items` or `data` are not seen by the index.
+ */
+CONFETTI_EXPORT list_result_t list_index_attach(list_t* const list, list_custom_hash_function_t* const hashFunction);
+
+/**
+ * @brief Detaches and frees the hash index of the list, if it has one.
+ *
+ * @param list A pointer to the list.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list no longer has an index.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ */
+CONFETTI_EXPORT list_result_t list_index_detach(list_t* const list);
+
 /**
  * @brief Sorts the elements of the list.
  * 
@@ -555,9 +1354,107 @@ CONFETTI_EXPORT list_result_t list_find_last(
  * @note If the default sorting function is used only `LIST_SUCCESS` should be returned.
  * @note If the list is empty or contains only one element,
  *       the function returns success without performing any operations.
+ * @note Sorting in ascending order with the default sorting function marks the list `sorted`, 
+ *       until a function adding or setting values puts one out of order or the list is reordered.
+ *       A custom sorting function leaves the list unmarked, as its order may differ from the
+ *       equality function's.
  */
 CONFETTI_EXPORT list_result_t list_sort(list_t* const list, const bool ascending);
 
+/**
+ * @brief Sorts the elements of the list while keeping equal elements in their original order.
+ *
+ * This function uses a natural merge sort. Runs that are already in order, or strictly in 
+ * the reverse order, are detected and kept as they are, so partially sorted lists 
+ * sort in close to linear time. Elements are compared with the list's equality function.
+ *
+ * @param list A pointer to the list to be sorted.
+ * @param ascending A boolean value indicating the sort order; true for
+ *                  ascending order and false for descending order.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was sorted successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate the merge buffer.
+ */
+CONFETTI_EXPORT list_result_t list_sort_stable(list_t* const list, const bool ascending);
+
+/**
+ * @brief Sorts the elements of the list across several threads.
+ *
+ * The list is cut into one run per thread, the runs are sorted with `introsort` at the same 
+ * time and then merged pairwise, with every merge level split evenly between the threads. 
+ * Elements are compared with the list's equality function. Lists too small to benefit are 
+ * sorted on the calling thread, as are lists with a custom sorting function, which is called 
+ * like `list_sort` does so switching to this function never changes the order.
+ *
+ * @param list A pointer to the list to be sorted.
+ * @param ascending A boolean value indicating the sort order; true for
+ *                  ascending order and false for descending order.
+ * @param threadCount The amount of threads to sort with. If 0, `confetti_executor_default_thread_count` will be used.
+ * @param executor A pointer to the executor the work is run by, or NULL to start threads for the sort.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was sorted successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate the merge buffer.
+ *
+ * @warning The equality function is called from several threads at once.
+ * @warning With a custom sorting function the errors returned depend on its implementation.
+ * @note The sort is not stable.
+ */
+CONFETTI_EXPORT list_result_t list_sort_parallel(
+    list_t* const list, 
+    const bool ascending, 
+    const uint64_t threadCount, 
+    const confetti_executor_t* const executor
+);
+
+/**
+ * @brief Sorts the elements of the list by a key extracted from every value.
+ *
+ * The key function is called exactly once per element and the keys are then sorted
+ * with a least significant digit radix sort, without calling a comparison function at all. 
+ * The sort is stable, elements with equal keys keep their original order.
+ *
+ * @param list A pointer to the list to be sorted.
+ * @param keyFunction A pointer to the function extracting the key of a value.
+ * @param ascending A boolean value indicating the sort order; true for
+ *                  ascending order and false for descending order.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was sorted successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the key function is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT list_result_t list_sort_by_key(list_t* const list, list_key_function_t* const keyFunction, const bool ascending);
+
+/**
+ * @brief Converts a signed integer into a sort key preserving its order.
+ *
+ * @param value The integer to convert.
+ * 
+ * @return A key for use by a `list_key_function_t`.
+ */
+CONFETTI_EXPORT uint64_t list_key_from_int64(const int64_t value);
+
+/**
+ * @brief Converts a floating point number into a sort key preserving its order.
+ *
+ * @param value The number to convert, NaN sorts after every other value.
+ * 
+ * @return A key for use by a `list_key_function_t`.
+ */
+CONFETTI_EXPORT uint64_t list_key_from_double(const double value);
+
 /**
  * @brief Fills the list with a specified value up to its capacity.
  *
@@ -594,6 +1491,114 @@ CONFETTI_EXPORT list_result_t list_fill(list_t* const list, void* const value, c
  */
 CONFETTI_EXPORT list_result_t list_swap(list_t* const list, const int64_t index1, const int64_t index2);
 
+/**
+ * @brief Saves every value of a list to a file.
+ * 
+ * The file holds a header, a table with the offset and size of every value, 
+ * unless the list is fixed stride, followed by the values packed one after another.
+ * It is written through a single large buffer.
+ *
+ * @param list A pointer to the list to save.
+ * @param path The path of the file, which is replaced if it exists.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was saved successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the path is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * - `LIST_FILE_ERROR` if the file couldn't be written.
+ * 
+ * @note Values are written in the byte order of the machine, files are only
+ *       readable on machines sharing it.
+ */
+CONFETTI_EXPORT list_result_t list_save(list_t* const list, const char* const path);
+
+/**
+ * @brief Creates a new list holding the values of a file written by `list_save` or `linked_list_save`.
+ * 
+ * The list is created with room for every value up front and the file is read
+ * in a single pass, rather than appending its values one by one.
+ *
+ * @param listOut A double pointer to where the loaded list will be stored.
+ * @param path The path of the file.
+ * @param options A pointer to the options to create the list with, or NULL to use the defaults.
+ *                The capacity and element size are taken from the file.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was loaded successfully.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the list out pointer or path is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * - `LIST_FILE_ERROR` if the file couldn't be read or doesn't hold a list.
+ */
+CONFETTI_EXPORT list_result_t list_load(list_t** listOut, const char* const path, const list_options_t* const options);
+
+/**
+ * @brief Maps a file written by `list_save` or `linked_list_save` read only into memory.
+ * 
+ * Opening the file only checks its header and table, values stay in the file
+ * until they're peeked, so even very large files are ready right away.
+ *
+ * @param mappedOut A double pointer to where the mapped list will be stored.
+ * @param path The path of the file.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the file was mapped successfully.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the mapped out pointer or path is NULL.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * - `LIST_FILE_ERROR` if the file couldn't be mapped or doesn't hold a list.
+ * 
+ * @warning The file must not be modified while it is mapped.
+ */
+CONFETTI_EXPORT list_result_t list_open_mapped(list_mapped_t** mappedOut, const char* const path);
+
+/**
+ * @brief Returns a pointer straight into the mapping to the value at the specified index.
+ *
+ * @param mapped A pointer to the mapped list.
+ * @param valueOut A pointer to where the value pointer will be stored, NULL if the element has no value.
+ * @param sizeOut A pointer to where the size of the value will be stored, or NULL.
+ * @param index The index of the value.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the value was peeked successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided mapped list pointer is NULL.
+ * 
+ * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if the given index is out of range.
+ * 
+ * @warning The value is only valid until the mapped list is closed, it must not be written through
+ *          and is not aligned, copy it out before reading it as anything wider than bytes.
+ */
+CONFETTI_EXPORT list_result_t list_mapped_peek(
+    const list_mapped_t* const mapped, 
+    const void** valueOut, 
+    uint64_t* const sizeOut, 
+    const int64_t index);
+
+/**
+ * @brief Unmaps a file mapped by `list_open_mapped`.
+ *
+ * @param mapped A double pointer to the mapped list to be closed.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the mapped list was closed successfully.
+ * 
+ * - `LIST_NULL_ERROR` if the provided mapped list pointer is NULL.
+ * 
+ * @note Sets the mapped list pointer to NULL after closing.
+ */
+CONFETTI_EXPORT list_result_t list_mapped_close(list_mapped_t** mapped);
+
 /**
  * @brief frees the memory allocated for a `list_element_t`.
  *
@@ -672,4 +1677,127 @@ CONFETTI_EXPORT list_result_t list_iterator_rewind(list_iterator_t* const iterat
  */
 CONFETTI_EXPORT list_result_t list_iterator_free(list_iterator_t** iterator);
 
+/**
+ * @brief Sets up an iterator over every element of a list in storage owned by the caller.
+ *
+ * @param iterator A pointer to the storage of the iterator.
+ * @param list A pointer to the list to be iterated over.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the iterator was successfully set up.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL, the iterator is then set up to yield nothing.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ */
+CONFETTI_EXPORT list_result_t list_iterator_init(list_iterator_t* const iterator, list_t* const list);
+
+/**
+ * @brief Sets up an iterator over every element of a list from its last element to its first.
+ *
+ * @param iterator A pointer to the storage of the iterator.
+ * @param list A pointer to the list to be iterated over.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the iterator was successfully set up.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL, the iterator is then set up to yield nothing.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ */
+CONFETTI_EXPORT list_result_t list_iterator_init_reverse(list_iterator_t* const iterator, list_t* const list);
+
+/**
+ * @brief Sets up an iterator over the elements between two indices of a list.
+ *
+ * @param iterator A pointer to the storage of the iterator.
+ * @param list A pointer to the list to be iterated over.
+ * @param startIndex The index of the first element to iterate over.
+ * @param endIndex The index one past the last element to iterate over.
+ * @param reverse Whether to iterate from the last element of the range to its first.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the iterator was successfully set up.
+ * 
+ * - `LIST_NULL_ERROR` if the provided list pointer is NULL, the iterator is then set up to yield nothing.
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * - `LIST_INDEX_OUT_OF_RANGE_ERROR` if either index is out of range or the start index is past the end index.
+ * 
+ * @note Elements removed from the end of the list while iterating are skipped, the range never goes past the size of the list.
+ */
+CONFETTI_EXPORT list_result_t list_iterator_init_range(
+    list_iterator_t* const iterator, 
+    list_t* const list, 
+    const int64_t startIndex, 
+    const int64_t endIndex, 
+    const bool reverse);
+
+#pragma endregion
+
+// inline function definitions
+
+#pragma region inline function definitions
+
+/**
+ * @brief Advances the iterator to the next element of its range.
+ *
+ * Does the same as `list_iterator_next` without checking the iterator, 
+ * and is defined here so loops over a list can be inlined completely.
+ *
+ * @param iterator A pointer to a list iterator.
+ * 
+ * @return `true` if the iterator moved to another element, `false` once it ran out of elements and rewound itself.
+ */
+static inline bool list_iterator_step(list_iterator_t* const iterator) {
+    const list_t* const list = iterator->list;
+
+    if (list == NULL)
+        return false;
+
+    const int64_t end = iterator->endIndex < 0 || iterator->endIndex > list->size ? list->size : iterator->endIndex;
+    int64_t index;
+
+    if (iterator->reverse)
+        index = iterator->index < 0 ? end - 1 : iterator->index - 1;
+    else
+        index = iterator->index < 0 ? iterator->startIndex : iterator->index + 1;
+
+    if (index < iterator->startIndex || index >= end) {
+        iterator->index = -1;
+        iterator->element = NULL;
+
+        return false;
+    }
+
+    iterator->index = index;
+
+    if (list->stride != 0) {
+        iterator->view.value = list->data + list->stride * (uint64_t) index;
+        iterator->view.size = list->stride;
+        iterator->element = &iterator->view;
+    }
+    else
+        iterator->element = list->items[index];
+
+    return true;
+}
+
+/**
+ * @brief Loops over every element of a list with an iterator in storage owned by the caller.
+ *
+ * The current element is found in `iterator.element` and its index in `iterator.index`.
+ */
+#define LIST_FOREACH(iterator, list) \
+    for (list_iterator_init(&(iterator), (list)); list_iterator_step(&(iterator)); )
+
+/**
+ * @brief Loops over every element of a list from its last element to its first.
+ *
+ * The current element is found in `iterator.element` and its index in `iterator.index`.
+ */
+#define LIST_FOREACH_REVERSE(iterator, list) \
+    for (list_iterator_init_reverse(&(iterator), (list)); list_iterator_step(&(iterator)); )
+
 #pragma endregion
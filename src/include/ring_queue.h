@@ -0,0 +1,233 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_export.h"
+#include "confetti_allocator.h"
+
+// constant definitions
+
+#define DEFAULT_RING_QUEUE_CAPACITY ((uint64_t) 1024) // The default amount of values a ring queue holds if one is not given.
+#define RING_QUEUE_PADDING_SIZE ((uint64_t) 56)       // Padding keeping the positions of a ring queue on separate cache lines.
+
+// struct definitions
+
+// define all structs early to avoid errors relating to one of these structs not existing.
+typedef struct ring_queue ring_queue_t;
+typedef struct ring_queue_options ring_queue_options_t;
+typedef enum ring_queue_result ring_queue_result_t;
+
+/**
+ * @brief Represents a bounded lock-free queue any amount of threads can push to and pop from.
+ *
+ * Values of a fixed size are copied into a ring of cells. Every cell carries a sequence 
+ * number telling producers and consumers whether it is free to write or ready to read, so 
+ * threads only contend on the position they claim a cell from and the cells themselves 
+ * are handed off without locks.
+ * 
+ * The ring, including the queue itself, is requested from `allocator`.
+ *
+ * @warning Please do not modify any field of this structure, every function but 
+ * `ring_queue_create`, `ring_queue_create_with_options` and `ring_queue_free` may be called concurrently.
+ */
+typedef struct ring_queue {
+    uint8_t* cells;                                 /* Contiguous cells, each a sequence number followed by a value. */
+    uint64_t capacity;                              /* Amount of cells, a power of two. */
+    uint64_t stride;                                /* Size in bytes of every value. */
+    uint64_t cellSize;                              /* Size in bytes of every cell. */
+    confetti_allocator_t allocator;                 /* Allocator the queue's memory is requested from. */
+    uint8_t padding0[RING_QUEUE_PADDING_SIZE];      /* Keeps the read only fields off the line of the push position. */
+    volatile uint64_t pushPosition;                 /* Position of the next cell to push to. */
+    uint8_t padding1[RING_QUEUE_PADDING_SIZE];      /* Keeps the push and pop positions on separate lines. */
+    volatile uint64_t popPosition;                  /* Position of the next cell to pop from. */
+    uint8_t padding2[RING_QUEUE_PADDING_SIZE];      /* Keeps the pop position off the line of neighbouring allocations. */
+} ring_queue_t;
+
+/**
+ * @brief Represents the options a ring queue is created with.
+ */
+typedef struct ring_queue_options {
+    uint64_t capacity;                     /* Amount of values the queue holds, rounded up to a power of two, `DEFAULT_RING_QUEUE_CAPACITY` if 0. */
+    uint64_t stride;                       /* Size in bytes of every value, must not be 0. */
+    const confetti_allocator_t* allocator; /* Allocator to request memory from, or NULL to use the default. */
+} ring_queue_options_t;
+
+// enum definitions
+
+/**
+ * @brief Represents the result of a ring queue operation.
+ *
+ * Positive values indicate success, while negative values
+ * represent specific error conditions.
+ */
+typedef enum ring_queue_result {
+    /**
+     * @brief Completed successfully.
+     */
+    RING_QUEUE_SUCCESS = 1,
+
+    /**
+     * @brief Error: Ring queue is null.
+     * 
+     * This error occurs when an operation is attempted on a ring queue
+     * that has not been initialized (i.e., it is null).
+     */
+    RING_QUEUE_NULL_ERROR = -3,
+
+    /**
+     * @brief Error: Invalid parameters provided.
+     * 
+     * This error indicates that the parameters passed to a ring queue
+     * operation are not valid.
+     */
+    RING_QUEUE_INVALID_PARAMS_ERROR = -4,
+
+    /**
+     * @brief Error: Memory allocation failure.
+     * 
+     * This error occurs when the system is unable to allocate
+     * the necessary memory for the operation.
+     */
+    RING_QUEUE_ALLOCATION_FAILURE = -5,
+
+    /**
+     * @brief Error: Ring queue is full.
+     * 
+     * This error occurs when a value is pushed while every cell holds a value 
+     * that hasn't been popped yet.
+     */
+    RING_QUEUE_FULL_ERROR = -6,
+
+    /**
+     * @brief Error: Ring queue is empty.
+     * 
+     * This error occurs when a value is popped while no cell holds a pushed value.
+     */
+    RING_QUEUE_EMPTY_ERROR = -7
+} ring_queue_result_t;
+
+// public function definitions
+
+#pragma region public function definitions
+
+/**
+ * @brief Creates a new ring queue.
+ *
+ * @param ringQueueOut A double pointer to where the created ring queue will be stored.
+ * @param capacity The amount of values the queue holds, rounded up to a power of two. If 0, the `DEFAULT_RING_QUEUE_CAPACITY` will be used.
+ * @param stride The size in bytes of every value.
+ * 
+ * @return 
+ * - `RING_QUEUE_SUCCESS` if the ring queue was created successfully. 
+ * 
+ * - `RING_QUEUE_INVALID_PARAMS_ERROR` if the stride is 0.
+ * 
+ * - `RING_QUEUE_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT ring_queue_result_t ring_queue_create(ring_queue_t** ringQueueOut, const uint64_t capacity, const uint64_t stride);
+
+/**
+ * @brief Creates a new ring queue described by a set of options.
+ *
+ * @param ringQueueOut A double pointer to where the created ring queue will be stored.
+ * @param options A pointer to the options describing the ring queue.
+ * 
+ * @return 
+ * - `RING_QUEUE_SUCCESS` if the ring queue was created successfully. 
+ * 
+ * - `RING_QUEUE_INVALID_PARAMS_ERROR` if the options, their stride or the allocator they describe are invalid.
+ * 
+ * - `RING_QUEUE_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT ring_queue_result_t ring_queue_create_with_options(ring_queue_t** ringQueueOut, const ring_queue_options_t* const options);
+
+/**
+ * @brief Frees a ring queue along with every value in it.
+ *
+ * @param ringQueue A double pointer to the ring queue to be freed.
+ * 
+ * @return 
+ * - `RING_QUEUE_SUCCESS` if the ring queue was freed successfully.
+ * 
+ * - `RING_QUEUE_NULL_ERROR` if the provided ring queue pointer is NULL.
+ * 
+ * @note Sets the ring queue pointer to NULL after freeing.
+ * @warning No other thread may be using the ring queue while it is freed.
+ */
+CONFETTI_EXPORT ring_queue_result_t ring_queue_free(ring_queue_t** ringQueue);
+
+/**
+ * @brief Copies a value to the back of the ring queue.
+ *
+ * @param ringQueue A pointer to the ring queue.
+ * @param value A pointer to `stride` bytes to be copied into the queue.
+ * 
+ * @return 
+ * - `RING_QUEUE_SUCCESS` if the value was pushed successfully.
+ * 
+ * - `RING_QUEUE_NULL_ERROR` if the provided ring queue pointer is NULL.
+ * 
+ * - `RING_QUEUE_INVALID_PARAMS_ERROR` if the value is NULL.
+ * 
+ * - `RING_QUEUE_FULL_ERROR` if the ring queue is full.
+ */
+CONFETTI_EXPORT ring_queue_result_t ring_queue_push(ring_queue_t* const ringQueue, const void* const value);
+
+/**
+ * @brief Copies the value at the front of the ring queue out and removes it.
+ *
+ * @param ringQueue A pointer to the ring queue.
+ * @param valueOut A pointer to `stride` bytes where the value will be copied to.
+ * 
+ * @return 
+ * - `RING_QUEUE_SUCCESS` if a value was popped successfully.
+ * 
+ * - `RING_QUEUE_NULL_ERROR` if the provided ring queue pointer is NULL.
+ * 
+ * - `RING_QUEUE_INVALID_PARAMS_ERROR` if the value pointer is NULL.
+ * 
+ * - `RING_QUEUE_EMPTY_ERROR` if the ring queue is empty.
+ */
+CONFETTI_EXPORT ring_queue_result_t ring_queue_pop(ring_queue_t* const ringQueue, void* const valueOut);
+
+/**
+ * @brief Retrieves the amount of values in the ring queue.
+ *
+ * @param ringQueue A pointer to the ring queue.
+ * @param sizeOut A pointer to where the amount of values will be stored.
+ * 
+ * @return 
+ * - `RING_QUEUE_SUCCESS` if the size was retrieved successfully.
+ * 
+ * - `RING_QUEUE_NULL_ERROR` if the provided ring queue pointer is NULL.
+ * 
+ * - `RING_QUEUE_INVALID_PARAMS_ERROR` if the size pointer is NULL.
+ * 
+ * @note While other threads push or pop the size is only a snapshot, it may be stale as soon as it is returned.
+ */
+CONFETTI_EXPORT ring_queue_result_t ring_queue_size(ring_queue_t* const ringQueue, uint64_t* const sizeOut);
+
+#pragma endregion
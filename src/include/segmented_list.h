@@ -0,0 +1,529 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_export.h"
+#include "confetti_allocator.h"
+
+// constant definitions
+
+#define DEFAULT_SEGMENTED_LIST_BLOCK_CAPACITY ((uint64_t) 4096)  // The default amount of elements every block holds if one is not given.
+#define DEFAULT_SEGMENTED_LIST_DIRECTORY_CAPACITY ((uint64_t) 8) // The amount of block pointers the directory starts with.
+
+// definitions
+
+typedef struct segmented_list segmented_list_t;
+typedef struct segmented_list_element segmented_list_element_t;
+typedef struct segmented_list_iterator segmented_list_iterator_t;
+typedef struct segmented_list_options segmented_list_options_t;
+typedef enum segmented_list_result segmented_list_result_t;
+
+
+/**
+ * @brief Function type definition for a custom equality function.
+ *
+ * @param data1 Pointer to the first memory block.
+ * @param data2 Pointer to the second memory block.
+ * @param size Size in bytes of the data elements.
+ * 
+ * @return 
+ * - `0` if the elements are considered equal.
+ * 
+ * - A negative value if the first element is considered less than the second.
+ * 
+ * - A positive value if the first element is considered greater than the second.
+ */
+typedef int32_t (segmented_list_custom_equality_function_t)(const void* const data1, const void* const data2, const uint64_t size);
+
+
+/**
+ * @brief Represents an element in a segmented list.
+ *
+ * A segmented list of variable sized values keeps one element per value inside its 
+ * blocks, the value itself is allocated separately.
+ */
+typedef struct segmented_list_element {
+    void* value;   /* Pointer to the data stored in the element. */
+    uint64_t size; /* Size of the data in bytes. */
+} segmented_list_element_t;
+
+
+/**
+ * @brief Represents a segmented list.
+ *
+ * Elements are stored in fixed size blocks found through a directory of block pointers.
+ * Growing the segmented list only ever allocates new blocks and, once in a while, a larger
+ * directory, so elements already stored are never copied and never move. Blocks no longer 
+ * needed are returned to the allocator one by one as the segmented list shrinks.
+ *
+ * A segmented list created with an element size stores its values inline in the blocks, 
+ * `stride` bytes apart, otherwise the blocks hold a `segmented_list_element_t` for every value.
+ */
+typedef struct segmented_list {
+    int64_t size;                                                /* Number of elements currently in the segmented list. */
+    uint64_t stride;                                             /* Size in bytes of every value stored inline, 0 for variable sized values. */
+    uint64_t slotSize;                                           /* Size in bytes every element takes up inside a block. */
+    uint64_t blockCapacity;                                      /* Amount of elements every block holds, a power of two. */
+    uint32_t blockShift;                                         /* Base two logarithm of `blockCapacity`. */
+    uint8_t** blocks;                                            /* Directory of the allocated blocks. */
+    uint64_t blockCount;                                         /* Amount of allocated blocks. */
+    uint64_t directoryCapacity;                                  /* Amount of block pointers the directory has room for. */
+    segmented_list_custom_equality_function_t* equalityFunction; /* Equality function for comparing elements. */
+    confetti_allocator_t allocator;                              /* Allocator the segmented list's memory is requested from. */
+} segmented_list_t;
+
+
+/**
+ * @brief Represents the options a segmented list is created with.
+ *
+ * A zero initialized `segmented_list_options_t` describes a default segmented list 
+ * of variable sized values, the same as calling `segmented_list_create` with an element size of 0.
+ */
+typedef struct segmented_list_options {
+    uint64_t elementSize;                                        /* Size of every value stored inline, 0 for variable sized values. */
+    uint64_t blockCapacity;                                      /* Elements per block, rounded up to a power of two, `DEFAULT_SEGMENTED_LIST_BLOCK_CAPACITY` if 0. */
+    segmented_list_custom_equality_function_t* equalityFunction; /* Custom equality function, or NULL to use the default. */
+    const confetti_allocator_t* allocator;                       /* Allocator to request memory from, or NULL to use the default. */
+} segmented_list_options_t;
+
+
+/**
+ * @brief Represents an iterator for a segmented list.
+ * 
+ * The iterator walks the segmented list one block at a time, handing out every 
+ * element of the block at once so they can be processed as a contiguous run.
+ *
+ * @param list A pointer to the segmented list being iterated over.
+ * @param block The index of the current block, -1 if the iterator is rewound.
+ * @param index The index of the first element of the current block.
+ * @param count The amount of elements of the current block.
+ * @param values A pointer to the first element of the current block, values for inline 
+ *               segmented lists and `segmented_list_element_t` otherwise, `slotSize` bytes apart.
+ * 
+ * @warning Please do not manually free anything witin this structure as 
+ * they are the internal values kept by the segmented list. If you wish 
+ * to deallocate memory from this structure please use `segmented_list_iterator_free` to safely do so.
+ */
+typedef struct segmented_list_iterator {
+    segmented_list_t* list; /* The segmented list being iterated through. */
+    int64_t block;          /* The index of the current block. */
+    int64_t index;          /* The index of the first element of the current block. */
+    int64_t count;          /* The amount of elements in the current block. */
+    void* values;           /* The first element of the current block. */
+} segmented_list_iterator_t;
+
+// enums
+
+/**
+ * @brief Represents the result of a segmented list operation.
+ *
+ * This enumeration defines status codes that indicate the outcome of operations
+ * on a segmented list. Positive values indicate success, while negative values
+ * correspond to specific error conditions.
+ */
+typedef enum segmented_list_result {
+    /**
+     * @brief Operation completed successfully.
+     */
+    SEGMENTED_LIST_SUCCESS = 1,
+
+    /**
+     * @brief Error: Index is out of range.
+     *
+     * Returned when an attempt is made to access an element at an invalid index.
+     */
+    SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR = -1,
+
+    /**
+     * @brief Error: Element not found in the segmented list.
+     *
+     * Indicates that the requested element could not be located in the list.
+     */
+    SEGMENTED_LIST_ELEMENT_NOT_FOUND_ERROR = -2,
+
+    /**
+     * @brief Error: Segmented list is null.
+     *
+     * Returned when an operation is attempted on a null list.
+     */
+    SEGMENTED_LIST_NULL_ERROR = -3,
+
+    /**
+     * @brief Error: Invalid parameters provided.
+     *
+     * Indicates that one or more parameters passed to the function are invalid.
+     */
+    SEGMENTED_LIST_INVALID_PARAMS_ERROR = -4,
+
+    /**
+     * @brief Error: Memory allocation failure.
+     *
+     * Occurs when the system fails to allocate memory required for the operation.
+     */
+    SEGMENTED_LIST_ALLOCATION_FAILURE = -5
+} segmented_list_result_t;
+
+// public function definitions
+
+/**
+ * @brief Creates a new segmented list.
+ *
+ * @param listOut A double pointer to where the segmented list will be stored.
+ * @param elementSize The size of every value to store them inline in the blocks, 
+ *                    or 0 to store variable sized values.
+ * @param customEqualityFunction A pointer to a custom equality function
+ *                               for comparing elements in the segmented list.
+ *                               If NULL, a default equality function is used.
+ * 
+ * @return 
+ * `SEGMENTED_LIST_SUCCESS` if the segmented list was created successfully.
+ * 
+ * `SEGMENTED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_create(
+    segmented_list_t** listOut, 
+    const uint64_t elementSize, 
+    segmented_list_custom_equality_function_t* const customEqualityFunction);
+
+/**
+ * @brief Creates a new segmented list described by a set of options.
+ *
+ * This is the general form of `segmented_list_create`, which additionally allows the 
+ * block size to be chosen and the segmented list to request its memory from a custom 
+ * allocator such as a `confetti_pool_t` serving blocks.
+ *
+ * @param listOut A double pointer to where the segmented list will be stored.
+ * @param options A pointer to the options describing the segmented list, or NULL to use the defaults.
+ * 
+ * @return 
+ * `SEGMENTED_LIST_SUCCESS` if the segmented list was created successfully.
+ * 
+ * `SEGMENTED_LIST_INVALID_PARAMS_ERROR` if the options or the allocator they describe are invalid.
+ * 
+ * `SEGMENTED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Elements handed to the caller by functions such as `segmented_list_get` or `segmented_list_pop` 
+ *       are always allocated with the default allocator, so `segmented_list_element_free` can free them.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_create_with_options(
+    segmented_list_t** listOut, 
+    const segmented_list_options_t* const options);
+
+/**
+ * @brief Frees the memory allocated for a segmented list.
+ *
+ * @param list A double pointer to the segmented list to be freed.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the segmented list was freed successfully.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ * 
+ * @note Sets the segmented list pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_free(segmented_list_t** list);
+
+/**
+ * @brief Prints the elements of a segmented list.
+ *
+ * @param list A pointer to the segmented list to be printed.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the segmented list was printed successfully.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_print(segmented_list_t* const list);
+
+/**
+ * @brief Appends a new element to the end of the segmented list.
+ *
+ * A new block is allocated when the last one is full, no element is ever moved.
+ *
+ * @param list A pointer to the segmented list to which the element will be appended.
+ * @param value A pointer to the value to be copied into the new element, 
+ *              if NULL an inline value is zeroed and a variable sized element has no value.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the element was appended successfully.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ * 
+ * - `SEGMENTED_LIST_INVALID_PARAMS_ERROR` if the size doesn't match the element size of an inline segmented list.
+ * 
+ * - `SEGMENTED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_append(segmented_list_t* const list, const void* const value, const uint64_t size);
+
+/**
+ * @brief Appends values laid out one after another in memory to the end of the segmented list.
+ *
+ * Inline segmented lists copy the values a whole block at a time.
+ *
+ * @param list A pointer to the segmented list to which the values will be appended.
+ * @param values A pointer to the first value.
+ * @param count The amount of values.
+ * @param stride The size of every value, which must match the element size of an inline segmented list.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the values were appended successfully.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ * 
+ * - `SEGMENTED_LIST_INVALID_PARAMS_ERROR` if the values are NULL, the stride is 0 or doesn't match the element size.
+ * 
+ * - `SEGMENTED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation, 
+ *   the segmented list is left as it was.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_append_many(
+    segmented_list_t* const list, 
+    const void* const values, 
+    const int64_t count, 
+    const uint64_t stride);
+
+/**
+ * @brief Retrieves a clone of the element at a specified index.
+ *
+ * @param list A pointer to the segmented list from which to retrieve the element.
+ * @param elementOut A double pointer where the cloned element will be stored.
+ * @param index The index of the element to retrieve.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the element was retrieved successfully.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ * 
+ * - `SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * - `SEGMENTED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Freeing the outputted element is your responsibility, it is recomended to use `segmented_list_element_free` for this.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_get(segmented_list_t* const list, segmented_list_element_t** elementOut, const int64_t index);
+
+/**
+ * @brief Borrows the value at a specified index without copying it.
+ *
+ * @param list A pointer to the segmented list.
+ * @param valueOut A pointer to where a pointer to the value will be stored.
+ * @param sizeOut A pointer to where the size of the value will be stored, or NULL.
+ * @param index The index of the value.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the value was borrowed successfully.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ * 
+ * - `SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * @warning The borrowed value is owned by the segmented list, do not free it. Since elements
+ *          never move it stays valid until the element is removed or set.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_peek(
+    segmented_list_t* const list, 
+    const void** valueOut, 
+    uint64_t* const sizeOut, 
+    const int64_t index);
+
+/**
+ * @brief Sets the value of an element in the segmented list at a specified index.
+ *
+ * @param list A pointer to the segmented list in which to set the element.
+ * @param index The index of the element to update.
+ * @param value A pointer to the new value to be copied into the element.
+ * @param size The size of the new value.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the element was updated successfully.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ * 
+ * - `SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the specified index is out of range.
+ * 
+ * - `SEGMENTED_LIST_INVALID_PARAMS_ERROR` if the size doesn't match the element size of an inline segmented list.
+ * 
+ * - `SEGMENTED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_set(
+    segmented_list_t* const list, 
+    const int64_t index, 
+    const void* const value, 
+    const uint64_t size);
+
+/**
+ * @brief Removes the last element of the segmented list and hands it to the caller.
+ *
+ * Blocks are returned to the allocator as they empty, one spare block is kept so popping 
+ * and appending around a block boundary doesn't allocate and free a block every time.
+ *
+ * @param list A pointer to the segmented list from which the element will be removed.
+ * @param elementOut A double pointer where the removed element will be stored, or NULL to discard it.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the element was removed successfully.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ * 
+ * - `SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the segmented list is empty.
+ * 
+ * - `SEGMENTED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Freeing the outputted element is your responsibility, it is recomended to use `segmented_list_element_free` for this.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_pop(segmented_list_t* const list, segmented_list_element_t** elementOut);
+
+/**
+ * @brief Removes every element from the segmented list and returns every block to the allocator.
+ *
+ * @param list A pointer to the segmented list to be cleared.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the segmented list was cleared successfully.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_clear(segmented_list_t* const list);
+
+/**
+ * @brief Changes the amount of elements in the segmented list.
+ *
+ * Growing adds zeroed inline values or elements without a value at the end, shrinking 
+ * removes elements from the end and returns every block no longer needed to the allocator.
+ *
+ * @param list A pointer to the segmented list to be resized.
+ * @param size The new amount of elements.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the segmented list was resized successfully.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ * 
+ * - `SEGMENTED_LIST_INVALID_PARAMS_ERROR` if the size is negative.
+ * 
+ * - `SEGMENTED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_resize(segmented_list_t* const list, const int64_t size);
+
+/**
+ * @brief Finds the index of the first element equal to a value, starting from a specified index.
+ *
+ * @param list A pointer to the segmented list to be searched.
+ * @param indexOut A pointer to where the index of the found element will be stored.
+ * @param startIndex The index to start searching from.
+ * @param value A pointer to the value to search for.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the element was found.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ * 
+ * - `SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the start index is out of range.
+ * 
+ * - `SEGMENTED_LIST_ELEMENT_NOT_FOUND_ERROR` if no element is equal to the value.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_find_first(
+    segmented_list_t* const list, 
+    int64_t* const indexOut, 
+    const int64_t startIndex, 
+    const void* const value, 
+    const uint64_t size);
+
+/**
+ * @brief Frees a segmented list element allocated by the segmented list.
+ *
+ * @param element A double pointer to the element to be freed.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the element was successfully freed.
+ * 
+ * - `SEGMENTED_LIST_INVALID_PARAMS_ERROR` if the provided element pointer is NULL.
+ * 
+ * @note Sets the element pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_element_free(segmented_list_element_t** element);
+
+/**
+ * @brief Creates a new segmented list iterator.
+ *
+ * @param iteratorOut A double pointer where the created iterator will be stored.
+ * @param list A pointer to the segmented list to be iterated over.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the iterator was successfully created.
+ * 
+ * - `SEGMENTED_LIST_NULL_ERROR` if the provided segmented list pointer is NULL.
+ * 
+ * - `SEGMENTED_LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_iterator_create(segmented_list_iterator_t** iteratorOut, segmented_list_t* const list);
+
+/**
+ * @brief Advances the iterator to the next block of the segmented list.
+ *
+ * A rewound iterator moves to the first block.
+ *
+ * @param iterator A pointer to the segmented list iterator to be advanced.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the iterator was successfully advanced to the next block.
+ * 
+ * - `SEGMENTED_LIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * - `SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR` if the iterator is already at the last block.
+ * 
+ * @note When the iterator reaches the end of a segmented list it will rewind itself.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_iterator_next(segmented_list_iterator_t* const iterator);
+
+/**
+ * @brief Resets the iterator to its initial state.
+ *
+ * @param iterator A pointer to the segmented list iterator to be reset.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the iterator was successfully reset.
+ * 
+ * - `SEGMENTED_LIST_INVALID_PARAMS_ERROR` if the iterator is NULL.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_iterator_rewind(segmented_list_iterator_t* const iterator);
+
+/**
+ * @brief Frees the memory allocated for a segmented list iterator.
+ *
+ * @param iterator A double pointer to the segmented list iterator to be freed.
+ * 
+ * @return 
+ * - `SEGMENTED_LIST_SUCCESS` if the iterator was successfully freed.
+ * 
+ * - `SEGMENTED_LIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * @note Sets the iterator pointer to NULL after freeing.
+ * @note Only the iterator is freed, the segmented list used does not get freed.
+ */
+CONFETTI_EXPORT segmented_list_result_t segmented_list_iterator_free(segmented_list_iterator_t** iterator);
@@ -0,0 +1,483 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#pragma once
+
+// Headers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "confetti_export.h"
+#include "confetti_allocator.h"
+
+// constant definitions
+
+#define SKIPLIST_MAX_LEVEL ((uint32_t) 32) // The maximum amount of levels a skip list node can be linked into.
+#define DEFAULT_SKIPLIST_SEED ((uint64_t) 0x9E3779B97F4A7C15) // The default seed of the level generator used if one is not given.
+
+// definitions
+
+typedef struct skiplist skiplist_t;
+typedef struct skiplist_node skiplist_node_t;
+typedef struct skiplist_element skiplist_element_t; 
+typedef struct skiplist_iterator skiplist_iterator_t;
+typedef struct skiplist_options skiplist_options_t;
+typedef enum skiplist_result skiplist_result_t; 
+
+
+/**
+ * @brief Function type definition for a custom equality function.
+ *
+ * The skip list keeps its elements ordered by this function, so it must describe a total order.
+ * When two values of different sizes compare equal over the smaller size, the smaller value comes first.
+ *
+ * @param data1 Pointer to the first memory block.
+ * @param data2 Pointer to the second memory block.
+ * @param size Size in bytes of the data elements.
+ * 
+ * @return 
+ * - `0` if the elements are considered equal.
+ * 
+ * - A negative value if the first element is considered less than the second.
+ * 
+ * - A positive value if the first element is considered greater than the second.
+ */
+typedef int32_t (skiplist_custom_equality_function_t)(const void* const data1, const void* const data2, const uint64_t size);
+
+
+/**
+ * @brief Represents an element in a skip list.
+ */
+typedef struct skiplist_element {
+    void* value;   /* Pointer to the data stored in the element. */
+    uint64_t size; /* Size of the data in bytes. */
+} skiplist_element_t;
+
+
+/**
+ * @brief Represents a node in a skip list.
+ *
+ * Every node is a single allocation holding the node, its forward links and its value.
+ */
+typedef struct skiplist_node {
+    skiplist_element_t element; /* The element contained in this node, its value is stored after the links. */
+    uint32_t level;             /* Amount of levels the node is linked into. */
+    skiplist_node_t* next[];    /* The next node on each level the node is linked into. */
+} skiplist_node_t;
+
+
+/**
+ * @brief Represents a skip list.
+ *
+ * A skip list keeps its elements ordered by its equality function and finds, inserts 
+ * and removes them in O(log n) on average. Every node is linked into a random amount of 
+ * levels, where each level skips over roughly four times as many nodes as the one below it. 
+ * Every node, element and value kept by the skip list, including the skip list itself, 
+ * is requested from its allocator.
+ */
+typedef struct skiplist {
+    skiplist_node_t* head[SKIPLIST_MAX_LEVEL];             /* The first node on every level. */
+    uint32_t level;                                        /* Amount of levels currently in use. */
+    int64_t size;                                          /* Number of elements currently in the skip list. */
+    skiplist_custom_equality_function_t* equalityFunction; /* Equality function ordering the elements. */
+    confetti_allocator_t allocator;                        /* Allocator the skip list's memory is requested from. */
+    uint64_t seed;                                         /* State of the generator picking the level of new nodes. */
+} skiplist_t;
+
+
+/**
+ * @brief Represents the options a skip list is created with.
+ *
+ * A zero initialized `skiplist_options_t` describes a default skip list, 
+ * the same as calling `skiplist_create` with a NULL function.
+ */
+typedef struct skiplist_options {
+    skiplist_custom_equality_function_t* equalityFunction; /* Custom equality function, or NULL to use the default. */
+    const confetti_allocator_t* allocator;                 /* Allocator to request memory from, or NULL to use the default. */
+    uint64_t seed;                                         /* Seed of the level generator, or 0 to use `DEFAULT_SKIPLIST_SEED`. */
+} skiplist_options_t;
+
+
+/**
+ * @brief Represents an iterator walking a skip list in order.
+ *
+ * @warning Please do not manually free anything witin this structure as 
+ * they are the internal values kept by the skip list. If you wish 
+ * to deallocate memory from this structure please use `skiplist_iterator_free` to safely do so.
+ */
+typedef struct skiplist_iterator {
+    skiplist_t* list;      /* The skip list being iterated through. */
+    skiplist_node_t* node; /* The node of the current iteration, NULL before the first one. */
+} skiplist_iterator_t;
+
+// enums
+
+/**
+ * @brief Represents the result of a skip list operation.
+ *
+ * Positive values indicate success, while negative values
+ * correspond to specific error conditions.
+ */
+typedef enum skiplist_result {
+    /**
+     * @brief Operation completed successfully.
+     */
+    SKIPLIST_SUCCESS = 1,
+
+    /**
+     * @brief Error: Index is out of range.
+     *
+     * Returned when an iterator is moved past the end of the skip list.
+     */
+    SKIPLIST_INDEX_OUT_OF_RANGE_ERROR = -1,
+
+    /**
+     * @brief Error: Element not found in the skip list.
+     *
+     * Indicates that the requested element could not be located in the skip list.
+     */
+    SKIPLIST_ELEMENT_NOT_FOUND_ERROR = -2,
+
+    /**
+     * @brief Error: Skip list is null.
+     *
+     * Returned when an operation is attempted on a null skip list.
+     */
+    SKIPLIST_NULL_ERROR = -3,
+
+    /**
+     * @brief Error: Invalid parameters provided.
+     *
+     * Indicates that one or more parameters passed to the function are invalid.
+     */
+    SKIPLIST_INVALID_PARAMS_ERROR = -4,
+
+    /**
+     * @brief Error: Memory allocation failure.
+     *
+     * Occurs when the system fails to allocate memory required for the operation.
+     */
+    SKIPLIST_ALLOCATION_FAILURE = -5
+} skiplist_result_t;
+
+// public function definitions
+
+/**
+ * @brief Creates a new skip list.
+ *
+ * @param skiplistOut A double pointer to where the skip list will be stored.
+ * @param customEqualityFunction A pointer to a custom equality function ordering 
+ *                               the elements of the skip list. If NULL, a default 
+ *                               bytewise equality function is used.
+ * 
+ * @return 
+ * `SKIPLIST_SUCCESS` if the skip list was created successfully.
+ * 
+ * `SKIPLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_create(skiplist_t** skiplistOut, skiplist_custom_equality_function_t* const customEqualityFunction);
+
+/**
+ * @brief Creates a new skip list described by a set of options.
+ *
+ * @param skiplistOut A double pointer to where the skip list will be stored.
+ * @param options A pointer to the options describing the skip list.
+ * 
+ * @return 
+ * `SKIPLIST_SUCCESS` if the skip list was created successfully.
+ * 
+ * `SKIPLIST_INVALID_PARAMS_ERROR` if the options or the allocator they describe are invalid.
+ * 
+ * `SKIPLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Elements handed to the caller by `skiplist_pop_first` are always allocated 
+ *       with the default allocator, so `skiplist_element_free` can free them.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_create_with_options(skiplist_t** skiplistOut, const skiplist_options_t* const options);
+
+/**
+ * @brief Frees the memory allocated for a skip list.
+ *
+ * @param skiplist A double pointer to the skip list to be freed.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the skip list was freed successfully.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ * 
+ * @note Sets the skip list pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_free(skiplist_t** skiplist);
+
+/**
+ * @brief Prints the elements of a skip list in order.
+ *
+ * @param skiplist A pointer to the skip list to be printed.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the skip list was printed successfully.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_print(skiplist_t* const skiplist);
+
+/**
+ * @brief Inserts a copy of a value into the skip list in O(log n) on average.
+ *
+ * Values equal to ones already in the skip list are inserted after them.
+ *
+ * @param skiplist A pointer to the skip list.
+ * @param value A pointer to the value to insert.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the value was inserted successfully.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ * 
+ * - `SKIPLIST_INVALID_PARAMS_ERROR` if the value is NULL.
+ * 
+ * - `SKIPLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_insert(skiplist_t* const skiplist, void* const value, const uint64_t size);
+
+/**
+ * @brief Removes the first element equal to a value from the skip list in O(log n) on average.
+ *
+ * @param skiplist A pointer to the skip list.
+ * @param value A pointer to the value to remove.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if an element was removed successfully.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ * 
+ * - `SKIPLIST_INVALID_PARAMS_ERROR` if the value is NULL.
+ * 
+ * - `SKIPLIST_ELEMENT_NOT_FOUND_ERROR` if no element is equal to the value.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_remove(skiplist_t* const skiplist, void* const value, const uint64_t size);
+
+/**
+ * @brief Checks if a value is included in the skip list in O(log n) on average.
+ *
+ * @param skiplist A pointer to the skip list to be searched.
+ * @param value A pointer to the value to search for.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the value was found in the skip list.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ * 
+ * - `SKIPLIST_INVALID_PARAMS_ERROR` if the value is NULL.
+ * 
+ * - `SKIPLIST_ELEMENT_NOT_FOUND_ERROR` if the value was not found in the skip list.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_includes(skiplist_t* const skiplist, void* const value, const uint64_t size);
+
+/**
+ * @brief Borrows the first element equal to a value in O(log n) on average.
+ *
+ * This allows a custom equality function comparing only part of a value, 
+ * such as a key, to look up the rest of it.
+ *
+ * @param skiplist A pointer to the skip list to be searched.
+ * @param valueOut A pointer to where the address of the found value will be stored.
+ * @param sizeOut A pointer to where the size of the found value will be stored, or NULL.
+ * @param value A pointer to the value to search for.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the value was found in the skip list.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ * 
+ * - `SKIPLIST_INVALID_PARAMS_ERROR` if the value is NULL.
+ * 
+ * - `SKIPLIST_ELEMENT_NOT_FOUND_ERROR` if the value was not found in the skip list.
+ * 
+ * @warning The borrowed value is owned by the skip list and is only valid until 
+ * the skip list is next modified, do not free it or change how it is ordered.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_peek(
+    skiplist_t* const skiplist, 
+    const void** valueOut, 
+    uint64_t* const sizeOut, 
+    void* const value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Borrows the smallest element of the skip list in O(1).
+ *
+ * @param skiplist A pointer to the skip list.
+ * @param valueOut A pointer to where the address of the value will be stored.
+ * @param sizeOut A pointer to where the size of the value will be stored, or NULL.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the value was borrowed successfully.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ * 
+ * - `SKIPLIST_INDEX_OUT_OF_RANGE_ERROR` if the skip list is empty.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_peek_first(skiplist_t* const skiplist, const void** valueOut, uint64_t* const sizeOut);
+
+/**
+ * @brief Borrows the largest element of the skip list in O(log n) on average.
+ *
+ * @param skiplist A pointer to the skip list.
+ * @param valueOut A pointer to where the address of the value will be stored.
+ * @param sizeOut A pointer to where the size of the value will be stored, or NULL.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the value was borrowed successfully.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ * 
+ * - `SKIPLIST_INDEX_OUT_OF_RANGE_ERROR` if the skip list is empty.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_peek_last(skiplist_t* const skiplist, const void** valueOut, uint64_t* const sizeOut);
+
+/**
+ * @brief Removes the smallest element of the skip list and retrieves a copy of it.
+ *
+ * @param skiplist A pointer to the skip list.
+ * @param elementOut A double pointer where the removed element will be stored.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the element was removed and retrieved successfully.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ * 
+ * - `SKIPLIST_INDEX_OUT_OF_RANGE_ERROR` if the skip list is empty.
+ * 
+ * - `SKIPLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ * 
+ * @note Freeing the outputted element is your responsibility, it is recomended to use `skiplist_element_free` for this.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_pop_first(skiplist_t* const skiplist, skiplist_element_t** elementOut);
+
+/**
+ * @brief Clears all elements from the skip list.
+ *
+ * @param skiplist A pointer to the skip list to be cleared.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the skip list was cleared successfully.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_clear(skiplist_t* const skiplist);
+
+/**
+ * @brief Frees the memory allocated for a skip list element.
+ *
+ * @param element A pointer to a pointer to the skip list element to be freed.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the element was successfully freed.
+ * 
+ * - `SKIPLIST_INVALID_PARAMS_ERROR` if the provided element pointer is NULL.
+ * 
+ * @note Sets the element pointer to NULL after freeing.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_element_free(skiplist_element_t** element);
+
+/**
+ * @brief Creates a new skip list iterator.
+ *
+ * @param iteratorOut A double pointer where the created iterator will be stored.
+ * @param list A pointer to the skip list to be iterated over.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the iterator was successfully created.
+ * 
+ * - `SKIPLIST_NULL_ERROR` if the provided skip list pointer is NULL.
+ * 
+ * - `SKIPLIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_iterator_create(skiplist_iterator_t** iteratorOut, skiplist_t* const list);
+
+/**
+ * @brief Advances the iterator to the next element of the skip list in order.
+ *
+ * @param iterator A pointer to the skip list iterator to be advanced.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the iterator was successfully advanced to the next element.
+ * 
+ * - `SKIPLIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * - `SKIPLIST_INDEX_OUT_OF_RANGE_ERROR` if the iterator is already at the end of the skip list.
+ * 
+ * @note When the iterator reaches the end of a skip list it will rewind itself.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_iterator_next(skiplist_iterator_t* const iterator);
+
+/**
+ * @brief Moves the iterator to the first element not less than a value in O(log n) on average.
+ *
+ * Following calls to `skiplist_iterator_next` continue from that element, 
+ * which makes walking a range of the skip list cheap.
+ *
+ * @param iterator A pointer to the skip list iterator to be moved.
+ * @param value A pointer to the value to seek to.
+ * @param size The size of the value.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the iterator was moved successfully.
+ * 
+ * - `SKIPLIST_INVALID_PARAMS_ERROR` if the provided iterator pointer or the value is NULL.
+ * 
+ * - `SKIPLIST_INDEX_OUT_OF_RANGE_ERROR` if every element is less than the value, 
+ *   in which case the iterator is rewound.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_iterator_seek(skiplist_iterator_t* const iterator, void* const value, const uint64_t size);
+
+/**
+ * @brief Resets the iterator to its initial state.
+ *
+ * @param iterator A pointer to the skip list iterator to be reset.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the iterator was successfully reset.
+ * 
+ * - `SKIPLIST_INVALID_PARAMS_ERROR` if the iterator is NULL.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_iterator_rewind(skiplist_iterator_t* const iterator);
+
+/**
+ * @brief Frees the memory allocated for a skip list iterator.
+ *
+ * @param iterator A double pointer to the skip list iterator to be freed.
+ * 
+ * @return 
+ * - `SKIPLIST_SUCCESS` if the iterator was successfully freed.
+ * 
+ * - `SKIPLIST_INVALID_PARAMS_ERROR` if the provided iterator pointer is NULL.
+ * 
+ * @note Sets the iterator pointer to NULL after freeing.
+ * @note Only the iterator is freed, the skip list used does not get freed.
+ */
+CONFETTI_EXPORT skiplist_result_t skiplist_iterator_free(skiplist_iterator_t** iterator);
@@ -17,6 +17,46 @@ If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "linked_list.h"
+#include "confetti_hash_index.h"
+#include "confetti_atomic.h"
+#include "confetti_file.h"
+
+#include <stddef.h>
+
+// constant definitions
+
+#define LINKED_LIST_MERGE_SLOTS 64 // Pending slot i of the merge sort holds 2^i runs, so 64 slots cover any list.
+#define LINKED_LIST_PARALLEL_SORT_THRESHOLD ((int64_t) 4096) // The parallel sort never cuts the linked list into sublists smaller than this.
+
+// private struct definitions
+
+/**
+ * @brief The layout of the single allocation backing every linked list node.
+ *
+ * The element lives right after the node and values small enough to fit are
+ * stored inline after the element, so the element's value points at `value`.
+ * 
+ * The node of a shallow clone points at the element of another block instead of its own.
+ * Every live node holds one reference on its own block and one on the block of the element 
+ * it points at, and a block is freed once both its node and every node sharing its element are gone.
+ */
+typedef struct linked_list_node_block {
+    linked_list_node_t node;                           /* The node itself. */
+    volatile uint64_t references;                      /* References held on this block by live nodes. */
+    linked_list_value_destructor_t* destructor;        /* Releases a stored pointer value, NULL if the element owns its value. */
+    linked_list_element_t element;                     /* The element of the node. */
+    uint8_t value[LINKED_LIST_INLINE_VALUE_CAPACITY];  /* Storage for values that fit inline. */
+} linked_list_node_block_t;
+
+/**
+ * @brief Shares the state of a `linked_list_sort_parallel` call with its tasks.
+ */
+typedef struct linked_list_parallel_sort {
+    linked_list_node_t** heads;                               /* The head of every sublist. */
+    linked_list_node_t** tails;                               /* The tail of every sublist. */
+    bool ascending;                                           /* The sort order. */
+    linked_list_custom_equality_function_t* equalityFunction; /* Function comparing element values. */
+} linked_list_parallel_sort_t;
 
 // private function definitions
 
@@ -25,10 +65,12 @@ If not, see <https://www.gnu.org/licenses/>.
 /**
  * @brief Creates a new linked list node.
  *
- * This function allocates and initializes a new linked list node and its associated element.
- * It copies the provided value into a newly allocated memory region of the specified size.
+ * This function allocates a new linked list node along with its element in a single block.
+ * Values of at most `LINKED_LIST_INLINE_VALUE_CAPACITY` bytes are copied into the block 
+ * itself, larger values are copied into a separately allocated memory region.
  * The newly created node points to the provided `next` node.
  *
+ * @param allocator Pointer to the allocator the node is allocated with.
  * @param nodeOut Pointer to where the newly allocated node will be stored.
  * @param value Pointer to the data to be copied into the node's element.
  * @param size Size in bytes of the value to be copied.
@@ -39,11 +81,108 @@ If not, see <https://www.gnu.org/licenses/>.
  * 
  * - `LINKED_LIST_ALLOCATION_FAILURE` if memory allocation failed.
  */
-static linked_list_result_t linked_list_node_create(linked_list_node_t** nodeOut, const void* const value, const uint64_t size, linked_list_node_t* const next);
+static linked_list_result_t linked_list_node_create(
+    const confetti_allocator_t* const allocator, 
+    linked_list_node_t** nodeOut, 
+    const void* const value, 
+    const uint64_t size, 
+    linked_list_node_t* const next
+);
+
+/**
+ * @brief Creates a new node for a value added to a linked list.
+ *
+ * Linked lists created with `LINKED_LIST_FLAG_STORE_POINTERS` keep the value pointer 
+ * as it is, every other linked list copies the value with `linked_list_node_create`.
+ *
+ * @param linkedList Pointer to the linked list the node is created for.
+ * @param nodeOut Pointer to where the newly allocated node will be stored.
+ * @param value Pointer to the value of the node.
+ * @param size Size in bytes of the value.
+ * @param next Pointer to the next node in the list.
+ *
+ * @return
+ * - `LINKED_LIST_SUCCESS` if the node was successfully created.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if memory allocation failed.
+ */
+static linked_list_result_t linked_list_node_store(
+    linked_list_t* const linkedList, 
+    linked_list_node_t** nodeOut, 
+    void* const value, 
+    const uint64_t size, 
+    linked_list_node_t* const next
+);
+
+/**
+ * @brief Destructor of stored pointers of linked lists created without one, it leaves the value alone.
+ *
+ * @param value The stored pointer.
+ * @param size The size of the value.
+ */
+static void linked_list_keep_value(void* const value, const uint64_t size);
+
+/**
+ * @brief Releases the value of the element of a block and leaves the element empty.
+ *
+ * Stored pointers are handed to the block's destructor, owned values are freed.
+ *
+ * @param allocator Pointer to the allocator the block was allocated with.
+ * @param block Pointer to the block.
+ */
+static void linked_list_block_clear(const confetti_allocator_t* const allocator, linked_list_node_block_t* const block);
+
+/**
+ * @brief Returns the block an element of a linked list lives in.
+ *
+ * @param element Pointer to the element.
+ *
+ * @return Pointer to the block holding the element.
+ */
+static linked_list_node_block_t* linked_list_block_of(linked_list_element_t* const element);
+
+/**
+ * @brief Drops references held on a node block, freeing it along with its value once none are left.
+ *
+ * @param allocator Pointer to the allocator the block was allocated with.
+ * @param block Pointer to the block.
+ * @param count The amount of references to drop.
+ */
+static void linked_list_block_release(const confetti_allocator_t* const allocator, linked_list_node_block_t* const block, const uint64_t count);
+
+/**
+ * @brief Returns whether the element of a node may be shared with a shallow clone.
+ *
+ * @param node Pointer to the node.
+ *
+ * @return `true` if the element is not the node's own or other nodes point at it.
+ */
+static bool linked_list_node_is_shared(linked_list_node_t* const node);
+
+/**
+ * @brief Creates a node sharing the element of another node.
+ *
+ * @param allocator Pointer to the allocator the node is allocated with, which must be the one of the shared node.
+ * @param node Pointer to the node whose element is shared.
+ * @param nodeOut Pointer to where the new node will be stored.
+ *
+ * @return
+ * - `LINKED_LIST_SUCCESS` if the node was successfully created.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if memory allocation fails during the process.
+ */
+static linked_list_result_t linked_list_node_share(
+    const confetti_allocator_t* const allocator, 
+    linked_list_node_t* const node, 
+    linked_list_node_t** nodeOut
+);
 
 /**
  * @brief Frees the memory associated with a linked list node.
  *
+ * An element shared with other nodes is kept alive until the last of them is freed.
+ *
+ * @param allocator Pointer to the allocator the node was allocated with.
  * @param node Pointer to the node pointer to be freed.
  *
  * @return
@@ -53,11 +192,50 @@ static linked_list_result_t linked_list_node_create(linked_list_node_t** nodeOut
  * 
  * @note sets the node to NULL and node.next to NULL, be aware of this if looping and freeing nodes.
  */
-static linked_list_result_t linked_list_node_free(linked_list_node_t** node);
+static linked_list_result_t linked_list_node_free(const confetti_allocator_t* const allocator, linked_list_node_t** node);
+
+/**
+ * @brief Moves a cursor back to the head of its linked list.
+ *
+ * @param cursor Pointer to the cursor.
+ */
+static void linked_list_cursor_reset(linked_list_cursor_t* const cursor);
+
+/**
+ * @brief Moves a cursor to a position, walking forward from it when the position isn't behind it.
+ *
+ * @param cursor Pointer to a cursor that is up to date with its linked list.
+ * @param index The position to move to, assumed to be between 0 and the size of the linked list.
+ */
+static void linked_list_cursor_walk(linked_list_cursor_t* const cursor, const int64_t index);
+
+/**
+ * @brief Links a node in before the node at the position of a cursor.
+ *
+ * The head, tail and size of the linked list are updated and the cursor is left on the node.
+ *
+ * @param cursor Pointer to the cursor.
+ * @param node Pointer to the node to link in.
+ */
+static void linked_list_cursor_link(linked_list_cursor_t* const cursor, linked_list_node_t* const node);
+
+/**
+ * @brief Unlinks the node at the position of a cursor without freeing it.
+ *
+ * The head, tail and size of the linked list are updated and the cursor is left on the next node.
+ *
+ * @param cursor Pointer to a cursor that isn't past the tail.
+ *
+ * @return Pointer to the unlinked node.
+ */
+static linked_list_node_t* linked_list_cursor_unlink(linked_list_cursor_t* const cursor);
 
 /**
  * @brief Retrieves a node from the linked list at the specified index.
  *
+ * The walk starts from the linked list's finger when the index isn't behind it, 
+ * and the finger is left on the node.
+ *
  * @param linkedList Double pointer to the linked list to retrieve the node from.
  * @param nodeOut Double pointer to where the node will be stored.
  * @param index Index of the node to retrieve.
@@ -71,12 +249,26 @@ static linked_list_result_t linked_list_node_free(linked_list_node_t** node);
  */
 static linked_list_result_t linked_list_node_get(linked_list_t* const linkedList, linked_list_node_t** nodeOut, const int64_t index);
 
+/**
+ * @brief Unlinks a node from the linked list at the specified index.
+ *
+ * The node is removed from the list without being freed, the head, tail 
+ * and size of the list are updated accordingly. The linked list's finger 
+ * is left on the node that followed it.
+ *
+ * @param linkedList Pointer to the linked list to unlink the node from.
+ * @param nodeOut Double pointer to where the unlinked node will be stored.
+ * @param index Index of the node to unlink, assumed to be in range.
+ */
+static void linked_list_node_detach(linked_list_t* const linkedList, linked_list_node_t** nodeOut, const int64_t index);
+
 /**
  * @brief Creates a deep clone of a linked list node.
  *
  * This function allocates memory and creates a new node that is a deep copy of the
  * provided node. The element within the node is also cloned using. 
  *
+ * @param allocator Pointer to the allocator the clone is allocated with.
  * @param node Pointer to the node to be cloned.
  * @param nodeOut Pointer to where the cloned node will be stored.
  *
@@ -87,15 +279,20 @@ static linked_list_result_t linked_list_node_get(linked_list_t* const linkedList
  * 
  * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
  */
-static linked_list_result_t linked_list_node_clone(linked_list_node_t* const node, linked_list_node_t** nodeOut);
+static linked_list_result_t linked_list_node_clone(
+    const confetti_allocator_t* const allocator, 
+    linked_list_node_t* const node, 
+    linked_list_node_t** nodeOut
+);
 
 /**
  * @brief Creates a deep clone of a linked list element.
  *
  * This function allocates and initializes a new linked list element by copying the
  * contents and size of the input element. If the element contains a value, a deep copy
- * of the value is also performed.
+ * of the value is also performed and stored in the same allocation as the clone.
  *
+ * @param allocator Pointer to the allocator the clone is allocated with.
  * @param element Pointer to the element to clone.
  * @param elementOut Pointer to where the cloned element will be stored.
  *
@@ -104,16 +301,46 @@ static linked_list_result_t linked_list_node_clone(linked_list_node_t* const nod
  * 
  * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation.
  */
-static linked_list_result_t linked_list_element_clone(linked_list_element_t* const element, linked_list_element_t** elementOut);
+static linked_list_result_t linked_list_element_clone(
+    const confetti_allocator_t* const allocator, 
+    linked_list_element_t* const element, 
+    linked_list_element_t** elementOut
+);
+
+/**
+ * @brief Frees a standalone linked list element allocated with a specific allocator.
+ *
+ * Only elements created by `linked_list_element_clone` may be released, elements 
+ * living inside a node are freed together with their node.
+ *
+ * @param allocator Pointer to the allocator the element was allocated with.
+ * @param element Double pointer to the element to be freed.
+ *
+ * @return
+ * - `LINKED_LIST_SUCCESS` if the element was successfully freed.
+ * 
+ * - `LINKED_LIST_INVALID_PARAMS_ERROR` if the element pointer is NULL.
+ */
+static linked_list_result_t linked_list_element_release(const confetti_allocator_t* const allocator, linked_list_element_t** element);
+
+/**
+ * @brief Checks whether an element's value is stored directly after the element.
+ *
+ * @param element Pointer to the element to check.
+ *
+ * @return `true` if the value is stored inline, otherwise `false`.
+ */
+static bool linked_list_element_is_inline(const linked_list_element_t* const element);
 
 /**
  * @brief Sets the value of a linked list element.
  *
- * This function assigns a new value to an existing linked list element. If the new
- * value's size differs from the current one, the internal memory is reallocated
- * accordingly. The value is then copied into the element.
+ * This function assigns a new value to the element of a node. Values that fit are 
+ * stored inline in the node's block, otherwise the separately allocated memory is 
+ * (re)allocated accordingly. The value is then copied into the element.
  *
- * @param element Pointer to the element whose value will be set.
+ * @param allocator Pointer to the allocator the node was allocated with.
+ * @param element Pointer to the element, living inside a node, whose value will be set.
  * @param value Pointer to the new value to be copied into the element.
  * @param size Size in bytes of the new value.
  *
@@ -122,7 +349,116 @@ static linked_list_result_t linked_list_element_clone(linked_list_element_t* con
  * 
  * - `LINKED_LIST_ALLOCATION_FAILURE` if memory allocation or reallocation fails.
  */
-static linked_list_result_t linked_list_element_set(linked_list_element_t* const element, const void* value, const uint64_t size);
+static linked_list_result_t linked_list_element_set(
+    const confetti_allocator_t* const allocator, 
+    linked_list_element_t* const element, 
+    const void* value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Sets the value of a node of the linked list, keeping its hash index up to date.
+ *
+ * @param linkedList Pointer to the linked list.
+ * @param node Pointer to the node.
+ * @param index The index of the node.
+ * @param value Pointer to the new value.
+ * @param size Size in bytes of the new value.
+ *
+ * @return
+ * - `LINKED_LIST_SUCCESS` if the value was successfully set.
+ * 
+ * - `LINKED_LIST_ALLOCATION_FAILURE` if memory allocation or reallocation fails.
+ */
+static linked_list_result_t linked_list_node_set(
+    linked_list_t* const linkedList, 
+    linked_list_node_t* const node, 
+    const int64_t index, 
+    const void* const value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Marks the hash index of the linked list as stale, if it has one.
+ *
+ * @param linkedList Pointer to the linked list.
+ */
+static void linked_list_index_invalidate(linked_list_t* const linkedList);
+
+/**
+ * @brief Adds a node to the hash index of the linked list.
+ *
+ * Does nothing if the linked list has no index or it is stale, and marks it as stale if growing it fails.
+ *
+ * @param linkedList Pointer to the linked list.
+ * @param node Pointer to the node.
+ * @param index The index of the node.
+ */
+static void linked_list_index_insert_at(linked_list_t* const linkedList, linked_list_node_t* const node, const int64_t index);
+
+/**
+ * @brief Removes a node from the hash index of the linked list.
+ *
+ * Does nothing if the linked list has no index or it is stale, and marks it as stale if the node isn't found.
+ *
+ * @param linkedList Pointer to the linked list.
+ * @param node Pointer to the node.
+ * @param index The index of the node.
+ */
+static void linked_list_index_erase_at(linked_list_t* const linkedList, const linked_list_node_t* const node, const int64_t index);
+
+/**
+ * @brief Updates the hash index of the linked list after a node was added.
+ *
+ * Nodes added at either end are indexed in O(1), anywhere else the entries after the node 
+ * are shifted first, which visits every slot of the index.
+ *
+ * @param linkedList Pointer to the linked list, whose size already includes the new node.
+ * @param node Pointer to the added node.
+ * @param index The index the node was added at.
+ */
+static void linked_list_index_added(linked_list_t* const linkedList, linked_list_node_t* const node, const int64_t index);
+
+/**
+ * @brief Updates the hash index of the linked list before a node is removed.
+ *
+ * The head and tail are dropped in O(1), any other node is found through the finger and the 
+ * entries after it are shifted afterwards, which visits every slot of the index.
+ *
+ * @param linkedList Pointer to the linked list, which still holds the node.
+ * @param index The index of the node about to be removed.
+ */
+static void linked_list_index_removing(linked_list_t* const linkedList, const int64_t index);
+
+/**
+ * @brief Rebuilds the hash index of the linked list from every node.
+ *
+ * @param linkedList Pointer to a linked list with an index.
+ *
+ * @return `true` if the index is up to date, `false` if growing it failed.
+ */
+static bool linked_list_index_rebuild(linked_list_t* const linkedList);
+
+/**
+ * @brief Looks up a value through the hash index of the linked list.
+ *
+ * @param linkedList Pointer to the linked list.
+ * @param value Pointer to the value to look for.
+ * @param size Size in bytes of the value.
+ * @param startFromIndex The lowest index a match may have.
+ * @param last If `true`, the last match is wanted instead of the first.
+ * @param indexOut Pointer to where the index of the match, or -1, will be stored.
+ *
+ * @return `true` if the index was used, `false` if the linked list has to be walked without it.
+ */
+static bool linked_list_index_find(
+    linked_list_t* const linkedList, 
+    const void* const value, 
+    const uint64_t size, 
+    const int64_t startFromIndex, 
+    const bool last, 
+    int64_t* const indexOut
+);
 
 /**
  * @brief Default equality comparison function for memory blocks.
@@ -149,16 +485,36 @@ static linked_list_result_t linked_list_element_set(linked_list_element_t* const
  */
 static int32_t default_equals(const void* const data1, const void* const data2, const uint64_t size);
 
+/**
+ * @brief Compares the elements of two nodes in the requested sorting order.
+ *
+ * @param equalityFunction Pointer to a function that compares two element values.
+ * @param node1 Pointer to the first node.
+ * @param node2 Pointer to the second node.
+ * @param ascending If `true`, ascending order is requested; otherwise, descending.
+ *
+ * @return A negative value if the first node must come before the second, 
+ * a positive value if it must come after it and `0` if their order does not matter.
+ */
+static int32_t linked_list_node_order(
+    linked_list_custom_equality_function_t* const equalityFunction, 
+    const linked_list_node_t* const node1, 
+    const linked_list_node_t* const node2, 
+    const bool ascending
+);
+
 /**
  * @brief Merges two sorted linked list sublists into a single sorted list.
  *
  * This function performs a stable merge of two sorted singly-linked sublists,
- * using the provided equality function and sort order. The merged list maintains
- * sort order as defined by the `ascending` flag. It also outputs a pointer to
- * the last node of the merged list.
+ * using the provided equality function and sort order. Nodes of the first sublist 
+ * come first when elements are equal. The tail of the merged list is known from 
+ * the tails of the sublists, so no extra walk is needed to find it.
  *
- * @param firstHalf Pointer to the head of the first sorted sublist.
- * @param secondHalf Pointer to the head of the second sorted sublist.
+ * @param first Pointer to the head of the first sorted sublist.
+ * @param firstTail Pointer to the tail of the first sorted sublist.
+ * @param second Pointer to the head of the second sorted sublist.
+ * @param secondTail Pointer to the tail of the second sorted sublist.
  * @param ascending If `true`, the merge will be in ascending order; otherwise, descending.
  * @param equalityFunction Pointer to a function that compares two element values.
  * @param tailOut Pointer to where the tail of the merged list will be stored.
@@ -166,54 +522,81 @@ static int32_t default_equals(const void* const data1, const void* const data2,
  * @return Pointer to the head of the newly merged linked list.
  */
 static linked_list_node_t* merge(
-    linked_list_node_t* firstHalf, 
-    linked_list_node_t* secondHalf, 
+    linked_list_node_t* first, 
+    linked_list_node_t* const firstTail, 
+    linked_list_node_t* second, 
+    linked_list_node_t* const secondTail, 
     const bool ascending,
-    const linked_list_custom_equality_function_t* equalityFunction,
+    linked_list_custom_equality_function_t* const equalityFunction,
     linked_list_node_t** tailOut
 );
 
 /**
- * @brief Splits a linked list into two halves.
+ * @brief Detaches the run of already sorted nodes at the start of a chain.
  *
- * This function takes a source linked list and splits it into two sublists,
- * assigning the heads of the two sublists to the provided pointers. The split
- * is done in such a way that the first half contains the first half of the
- * nodes, and the second half contains the remaining nodes.
+ * Runs in the requested order are taken as they are, while strictly reversed 
+ * runs are reversed in place, which keeps equal elements in their original order.
  *
- * @param source Pointer to the head of the source linked list to be split.
- * @param firstHalfOut Double pointer to where the head of the first half will be stored.
- * @param secondHalfOut Double pointer to where the head of the second half will be stored.
+ * @param head Pointer to the head of the chain, which must not be NULL.
+ * @param ascending If `true`, ascending runs are detected; otherwise, descending runs.
+ * @param equalityFunction Pointer to a function that compares two element values.
+ * @param runTailOut Pointer to where the tail of the detached run will be stored.
+ * @param restOut Pointer to where the head of the remaining chain will be stored.
+ *
+ * @return Pointer to the head of the detached run.
  */
-static void merge_split(linked_list_node_t* const source, linked_list_node_t** firstHalfOut, linked_list_node_t** secondHalfOut);
+static linked_list_node_t* merge_take_run(
+    linked_list_node_t* const head, 
+    const bool ascending,
+    linked_list_custom_equality_function_t* const equalityFunction,
+    linked_list_node_t** runTailOut,
+    linked_list_node_t** restOut
+);
 
 /**
- * @brief Sorts a linked list using the merge sort algorithm.
+ * @brief Sorts a chain of nodes using a bottom-up natural merge sort.
  *
- * This function recursively sorts a linked list by dividing it into two halves,
- * sorting each half, and then merging the sorted halves back together. The sort
- * order is determined by the `ascending` flag, and the provided equality function
- * is used to compare element values. The function also outputs a pointer to the
- * last node of the sorted list.
+ * The chain is cut into its naturally sorted runs, which are merged like a binary
+ * counter: pending slot `i` holds a sorted list built from `2^i` runs. The sort is 
+ * iterative, stable, and runs in linear time on chains that are already sorted.
  *
- * @param head Pointer to the head of the linked list to be sorted.
+ * @param head Pointer to the head of the chain to be sorted.
  * @param ascending If `true`, the sort will be in ascending order; otherwise, descending.
  * @param equalityFunction Pointer to a function that compares two element values.
- * @param tailOut Pointer to where the tail of the sorted list will be stored.
+ * @param tailOut Pointer to where the tail of the sorted chain will be stored.
  *
- * @return Pointer to the head of the newly sorted linked list.
+ * @return Pointer to the head of the newly sorted chain.
  */
 static linked_list_node_t* merge_sort(
     linked_list_node_t* const head, 
     const bool ascending,
-    const linked_list_custom_equality_function_t* equalityFunction,
+    linked_list_custom_equality_function_t* const equalityFunction,
     linked_list_node_t** tailOut
 );
 
+/**
+ * @brief Task of `linked_list_sort_parallel` sorting one of the sublists.
+ *
+ * @param context A pointer to the `linked_list_parallel_sort_t` of the sort.
+ * @param index The index of the sublist.
+ */
+static void linked_list_parallel_sort_sublist(void* const context, const uint64_t index);
+
+/**
+ * @brief Task of `linked_list_sort_parallel` merging a pair of neighbouring sublists.
+ *
+ * The merged sublist is stored in place of the first sublist of the pair.
+ *
+ * @param context A pointer to the `linked_list_parallel_sort_t` of the sort.
+ * @param index The index of the pair.
+ */
+static void linked_list_parallel_merge_pair(void* const context, const uint64_t index);
+
 /**
  * @brief Sorts a linked list using the default sorting method.
  *
- * This function sorts the linked list by calling the `merge_sort` function.
+ * This function sorts the linked list by calling the `merge_sort` function,
+ * a stable bottom-up natural merge sort.
  * It updates the head and tail pointers of the linked list to reflect the
  * newly sorted order. The sort order is determined by the `ascending` flag.
  *
@@ -231,21 +614,34 @@ static linked_list_result_t default_sort(linked_list_t* const linkedList, const
 
 #pragma region private functions
 
-static linked_list_result_t linked_list_node_create(linked_list_node_t** nodeOut, const void* const value, const uint64_t size, linked_list_node_t* const next) {
-    linked_list_element_t* element = (linked_list_element_t*) malloc(sizeof(linked_list_element_t));
+static linked_list_result_t linked_list_node_create(
+    const confetti_allocator_t* const allocator, 
+    linked_list_node_t** nodeOut, 
+    const void* const value, 
+    const uint64_t size, 
+    linked_list_node_t* const next
+) {
+    linked_list_node_block_t* block = (linked_list_node_block_t*) allocator->allocate(allocator->context, LINKED_LIST_NODE_ALLOCATION_SIZE);
 
-    if (element == NULL)
+    if (block == NULL)
         return LINKED_LIST_ALLOCATION_FAILURE;
 
+    linked_list_element_t* const element = &block->element;
+
+    // the node holds one reference on its block for living in it and one for using its element.
+    block->references = 2;
+    block->destructor = NULL;
     element->size = size;
     element->value = NULL;
 
     if (value != NULL) {
-        element->value = (void*) malloc(size);
+        element->value = size <= LINKED_LIST_INLINE_VALUE_CAPACITY 
+            ? block->value 
+            : allocator->allocate(allocator->context, size);
 
         if (element->value == NULL) {
-            free(element);
-            element = NULL;
+            allocator->deallocate(allocator->context, block, LINKED_LIST_NODE_ALLOCATION_SIZE);
+            block = NULL;
 
             return LINKED_LIST_ALLOCATION_FAILURE;
         }
@@ -253,17 +649,7 @@ static linked_list_result_t linked_list_node_create(linked_list_node_t** nodeOut
         memcpy(element->value, value, size);
     }
 
-    linked_list_node_t* node = (linked_list_node_t*) malloc(sizeof(linked_list_node_t));
-
-    if (node == NULL) {
-        free(element->value);
-        element->value = NULL;
-
-        free(element);
-        element = NULL;
-        
-        return LINKED_LIST_ALLOCATION_FAILURE;
-    }   
+    linked_list_node_t* const node = &block->node;
 
     node->next = next;
     node->element = element;
@@ -273,236 +659,695 @@ static linked_list_result_t linked_list_node_create(linked_list_node_t** nodeOut
 }
 
 
-static linked_list_result_t linked_list_node_free(linked_list_node_t** node) {
-    if (*node == NULL)
-        return LINKED_LIST_INVALID_PARAMS_ERROR;
+static linked_list_result_t linked_list_node_store(
+    linked_list_t* const linkedList, 
+    linked_list_node_t** nodeOut, 
+    void* const value, 
+    const uint64_t size, 
+    linked_list_node_t* const next
+) {
+    if ((linkedList->flags & LINKED_LIST_FLAG_STORE_POINTERS) == 0)
+        return linked_list_node_create(&linkedList->allocator, nodeOut, value, size, next);
 
-    linked_list_element_free(&(*node)->element);
-    (*node)->next = NULL;
-        
-    free((*node));
-    (*node) = NULL;
+    linked_list_node_block_t* const block = (linked_list_node_block_t*) linkedList->allocator.allocate(
+        linkedList->allocator.context, 
+        LINKED_LIST_NODE_ALLOCATION_SIZE
+    );
 
-    return LINKED_LIST_SUCCESS;
-}
+    if (block == NULL)
+        return LINKED_LIST_ALLOCATION_FAILURE;
 
+    block->references = 2;
+    block->destructor = linkedList->destructor == NULL ? &linked_list_keep_value : linkedList->destructor;
+    block->element.value = value;
+    block->element.size = size;
+    block->node.next = next;
+    block->node.element = &block->element;
 
-static linked_list_result_t linked_list_element_clone(linked_list_element_t* const element, linked_list_element_t** elementOut) {
-    linked_list_element_t* elementClone = (linked_list_element_t*)malloc(sizeof(linked_list_element_t));
+    *nodeOut = &block->node;
+    return LINKED_LIST_SUCCESS;
+}
 
-    if (elementClone == NULL)
-        return LINKED_LIST_ALLOCATION_FAILURE;
 
-    elementClone->value = NULL;
-    elementClone->size = element->size;
+static void linked_list_keep_value(void* const value, const uint64_t size) {
+    (void) value;
+    (void) size;
+}
 
-    if (element->value != NULL) {
-        elementClone->value = (void*)malloc(element->size);
 
-        if (elementClone->value == NULL)
-            return LINKED_LIST_ALLOCATION_FAILURE;
+static void linked_list_block_clear(const confetti_allocator_t* const allocator, linked_list_node_block_t* const block) {
+    linked_list_element_t* const element = &block->element;
 
-        memcpy(elementClone->value, element->value, element->size);
-    }
+    if (block->destructor != NULL)
+        block->destructor(element->value, element->size);
+    else if (!linked_list_element_is_inline(element))
+        allocator->deallocate(allocator->context, element->value, element->size);
 
-    *elementOut = elementClone;
-    return LINKED_LIST_SUCCESS;
+    block->destructor = NULL;
+    element->value = NULL;
+    element->size = 0;
 }
 
 
-static linked_list_result_t linked_list_element_set(linked_list_element_t* const element, const void* value, const uint64_t size) {
-    if (size != element->size) {
-        if (element->value == NULL)
-            element->value = (void*)malloc(size);
-        else
-            element->value = (void*)realloc(element->value, size);
+static linked_list_node_block_t* linked_list_block_of(linked_list_element_t* const element) {
+    return (linked_list_node_block_t*) ((uint8_t*) element - offsetof(linked_list_node_block_t, element));
+}
 
-        element->size = size;
 
-        if (element->value == NULL)
-            return LINKED_LIST_ALLOCATION_FAILURE;
-    }
+static void linked_list_block_release(const confetti_allocator_t* const allocator, linked_list_node_block_t* const block, const uint64_t count) {
+    // holding every reference means no other list can race the release.
+    if (confetti_atomic_load(&block->references) != count && confetti_atomic_fetch_add(&block->references, (uint64_t) 0 - count) != count)
+        return;
 
-    memcpy(element->value, value, size);
-    return LINKED_LIST_SUCCESS;
+    linked_list_block_clear(allocator, block);
+    allocator->deallocate(allocator->context, block, LINKED_LIST_NODE_ALLOCATION_SIZE);
 }
 
 
-static linked_list_result_t linked_list_node_get(linked_list_t* const linkedList, linked_list_node_t** nodeOut, int64_t index) {
-    if (linkedList == NULL)
-        return LINKED_LIST_NULL_ERROR;
-    else if (index >= linkedList->size || index < 0) 
-        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
-
-    int64_t currentIndex = 0;
+static bool linked_list_node_is_shared(linked_list_node_t* const node) {
+    linked_list_node_block_t* const block = (linked_list_node_block_t*) node;
 
-    for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next) {
-        if (currentIndex == index) {
-            *nodeOut = node;
-            return LINKED_LIST_SUCCESS;
-        }
-            
-        currentIndex++;
-    }
+    return node->element != &block->element || confetti_atomic_load(&block->references) != 2;
 }
 
 
-static linked_list_result_t linked_list_node_clone(linked_list_node_t* const node, linked_list_node_t** nodeOut) {
-    if (node == NULL)
-        return LINKED_LIST_INVALID_PARAMS_ERROR;
-
-    linked_list_node_t* nodeClone = (linked_list_node_t*) malloc(sizeof(linked_list_node_t));
+static linked_list_result_t linked_list_node_share(
+    const confetti_allocator_t* const allocator, 
+    linked_list_node_t* const node, 
+    linked_list_node_t** nodeOut
+) {
+    linked_list_node_block_t* const block = (linked_list_node_block_t*) allocator->allocate(allocator->context, LINKED_LIST_NODE_ALLOCATION_SIZE);
 
-    if (nodeClone == NULL)
+    if (block == NULL)
         return LINKED_LIST_ALLOCATION_FAILURE;
 
-    linked_list_result_t elementCloneResult = linked_list_element_clone(node->element, &nodeClone->element);
+    // the element of the block stays unused until the node is set.
+    block->references = 1;
+    block->destructor = NULL;
+    block->element.value = NULL;
+    block->element.size = 0;
 
-    if (elementCloneResult != LINKED_LIST_SUCCESS)
-        return elementCloneResult;
+    confetti_atomic_fetch_add(&linked_list_block_of(node->element)->references, 1);
 
-    nodeClone->next = NULL;
+    block->node.next = NULL;
+    block->node.element = node->element;
 
-    *nodeOut = nodeClone;
+    *nodeOut = &block->node;
     return LINKED_LIST_SUCCESS;
 }
 
 
-static int32_t default_equals(const void* data1, const void* data2, uint64_t size) {
-    if (data1 == NULL && data2 != NULL)
-        return -1;
-    else if (data1 != NULL && data2 == NULL) 
-        return 1;
-    else if (data1 == NULL && data2 == NULL)
-        return 0;
-
-    return memcmp(data1, data2, size);
-}
-
+static linked_list_result_t linked_list_node_free(const confetti_allocator_t* const allocator, linked_list_node_t** node) {
+    if (*node == NULL)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
 
-static linked_list_node_t* merge(
-    linked_list_node_t* firstHalf, 
-    linked_list_node_t* secondHalf, 
-    const bool ascending,
-    const linked_list_custom_equality_function_t* equalityFunction,
-    linked_list_node_t** tailOut
-) {
-    if (firstHalf == NULL) {
-        linked_list_node_t* current = secondHalf;
+    linked_list_node_block_t* const block = (linked_list_node_block_t*) *node;
+    linked_list_node_block_t* const elementBlock = linked_list_block_of((*node)->element);
 
-        while (current != NULL && current->next != NULL) {
-            current = current->next;
-        }
+    (*node)->element = NULL;
+    (*node)->next = NULL;
 
-        *tailOut = current;
-        return secondHalf;
+    if (elementBlock == block)
+        linked_list_block_release(allocator, block, 2);
+    else {
+        linked_list_block_release(allocator, elementBlock, 1);
+        linked_list_block_release(allocator, block, 1);
     }
-    else if (secondHalf == NULL) {
-        linked_list_node_t* current = firstHalf;
-
-        while (current != NULL && current->next != NULL) {
-            current = current->next;
-        }
 
-        *tailOut = current;
-        return firstHalf;
-    }
+    (*node) = NULL;
 
-    linked_list_node_t* newHead = NULL;
-    linked_list_node_t* lastMergedNode = NULL;
-
-    int8_t equality = equalityFunction(firstHalf->element->value, secondHalf->element->value, firstHalf->element->size);
-    bool takeFromFirstHalf = ascending
-        ? (equality <= 0)
-        : (equality >= 0);
-
-    if (takeFromFirstHalf) {
-        newHead = firstHalf;
-        firstHalf = firstHalf->next;
-    } else {
-        newHead = secondHalf;
-        secondHalf = secondHalf->next;
-    }
-    lastMergedNode = newHead;
+    return LINKED_LIST_SUCCESS;
+}
 
 
-    while (firstHalf != NULL && secondHalf != NULL) {
-        equality = equalityFunction(firstHalf->element->value, secondHalf->element->value, firstHalf->element->size);
-        takeFromFirstHalf = ascending
-            ? (equality <= 0)
-            : (equality >= 0);
+static linked_list_result_t linked_list_element_clone(
+    const confetti_allocator_t* const allocator, 
+    linked_list_element_t* const element, 
+    linked_list_element_t** elementOut
+) {
+    const uint64_t valueSize = element->value != NULL ? element->size : 0;
+    linked_list_element_t* elementClone = (linked_list_element_t*) allocator->allocate(allocator->context, sizeof(linked_list_element_t) + valueSize);
 
-        if (takeFromFirstHalf) {
-            lastMergedNode->next = firstHalf;
-            firstHalf = firstHalf->next;
-        } else {
-            lastMergedNode->next = secondHalf;
-            secondHalf = secondHalf->next;
+    if (elementClone == NULL)
+        return LINKED_LIST_ALLOCATION_FAILURE;
+
+    elementClone->value = NULL;
+    elementClone->size = element->size;
+
+    if (element->value != NULL) {
+        elementClone->value = (void*) (elementClone + 1);
+        memcpy(elementClone->value, element->value, element->size);
+    }
+
+    *elementOut = elementClone;
+    return LINKED_LIST_SUCCESS;
+}
+
+
+static linked_list_result_t linked_list_element_release(const confetti_allocator_t* const allocator, linked_list_element_t** element) {
+    if (*element == NULL)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
+
+    uint64_t allocationSize = sizeof(linked_list_element_t);
+
+    if (linked_list_element_is_inline(*element))
+        allocationSize += (*element)->size;
+    else
+        allocator->deallocate(allocator->context, (*element)->value, (*element)->size);
+
+    (*element)->size = 0;
+    (*element)->value = NULL;
+
+    allocator->deallocate(allocator->context, *element, allocationSize);
+    (*element) = NULL;
+
+    return LINKED_LIST_SUCCESS;
+}
+
+
+static bool linked_list_element_is_inline(const linked_list_element_t* const element) {
+    return element->value == (const void*) (element + 1);
+}
+
+
+static linked_list_result_t linked_list_element_set(
+    const confetti_allocator_t* const allocator, 
+    linked_list_element_t* const element, 
+    const void* value, 
+    const uint64_t size
+) {
+    void* const inlineValue = (void*) (element + 1);
+
+    if (size <= LINKED_LIST_INLINE_VALUE_CAPACITY) {
+        if (element->value != NULL && element->value != inlineValue)
+            allocator->deallocate(allocator->context, element->value, element->size);
+
+        element->value = inlineValue;
+        element->size = size;
+    }
+    else if (size != element->size || element->value == NULL || element->value == inlineValue) {
+        void* newValue = element->value == NULL || element->value == inlineValue
+            ? allocator->allocate(allocator->context, size)
+            : allocator->reallocate(allocator->context, element->value, element->size, size);
+
+        if (newValue == NULL)
+            return LINKED_LIST_ALLOCATION_FAILURE;
+
+        element->value = newValue;
+        element->size = size;
+    }
+
+    if (value != NULL)
+        memcpy(element->value, value, size);
+    else
+        memset(element->value, 0, size);
+
+    return LINKED_LIST_SUCCESS;
+}
+
+
+static void linked_list_cursor_reset(linked_list_cursor_t* const cursor) {
+    cursor->previous = NULL;
+    cursor->node = cursor->list->head;
+    cursor->index = 0;
+}
+
+
+static void linked_list_cursor_walk(linked_list_cursor_t* const cursor, const int64_t index) {
+    linked_list_t* const linkedList = cursor->list;
+
+    // the position past the tail is known without walking.
+    if (index == linkedList->size) {
+        cursor->previous = linkedList->tail;
+        cursor->node = NULL;
+        cursor->index = index;
+
+        return;
+    }
+
+    if (index < cursor->index)
+        linked_list_cursor_reset(cursor);
+
+    while (cursor->index < index) {
+        cursor->previous = cursor->node;
+        cursor->node = cursor->node->next;
+        cursor->index++;
+    }
+}
+
+
+static void linked_list_cursor_link(linked_list_cursor_t* const cursor, linked_list_node_t* const node) {
+    linked_list_t* const linkedList = cursor->list;
+
+    node->next = cursor->node;
+
+    if (cursor->previous == NULL)
+        linkedList->head = node;
+    else
+        cursor->previous->next = node;
+
+    if (cursor->node == NULL)
+        linkedList->tail = node;
+
+    cursor->node = node;
+    linkedList->size++;
+}
+
+
+static linked_list_node_t* linked_list_cursor_unlink(linked_list_cursor_t* const cursor) {
+    linked_list_t* const linkedList = cursor->list;
+    linked_list_node_t* const node = cursor->node;
+
+    if (cursor->previous == NULL)
+        linkedList->head = node->next;
+    else
+        cursor->previous->next = node->next;
+
+    if (node == linkedList->tail)
+        linkedList->tail = cursor->previous;
+
+    cursor->node = node->next;
+    node->next = NULL;
+    linkedList->size--;
+
+    return node;
+}
+
+
+static linked_list_result_t linked_list_node_get(linked_list_t* const linkedList, linked_list_node_t** nodeOut, int64_t index) {
+    if (linkedList == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (index >= linkedList->size || index < 0) 
+        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    linked_list_cursor_walk(&linkedList->finger, index);
+
+    *nodeOut = linkedList->finger.node;
+    return LINKED_LIST_SUCCESS;
+}
+
+
+static void linked_list_node_detach(linked_list_t* const linkedList, linked_list_node_t** nodeOut, const int64_t index) {
+    linked_list_cursor_walk(&linkedList->finger, index);
+
+    *nodeOut = linked_list_cursor_unlink(&linkedList->finger);
+}
+
+
+static linked_list_result_t linked_list_node_clone(
+    const confetti_allocator_t* const allocator, 
+    linked_list_node_t* const node, 
+    linked_list_node_t** nodeOut
+) {
+    if (node == NULL)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
+
+    return linked_list_node_create(allocator, nodeOut, node->element->value, node->element->size, NULL);
+}
+
+
+static linked_list_result_t linked_list_node_set(
+    linked_list_t* const linkedList, 
+    linked_list_node_t* const node, 
+    const int64_t index, 
+    const void* const value, 
+    const uint64_t size
+) {
+    // the old entry can't be told apart from the new one, so the index is erased around the write.
+    linked_list_index_erase_at(linkedList, node, index);
+
+    linked_list_node_block_t* const block = (linked_list_node_block_t*) node;
+    linked_list_node_block_t* const elementBlock = linked_list_block_of(node->element);
+    linked_list_node_block_t* targetBlock = elementBlock;
+    const bool storePointer = (linkedList->flags & LINKED_LIST_FLAG_STORE_POINTERS) != 0;
+
+    // the pointer is already stored, a shared element keeps the size its other nodes know.
+    if (elementBlock->destructor != NULL && elementBlock->element.value == value) {
+        if (!linked_list_node_is_shared(node))
+            elementBlock->element.size = size;
+
+        linked_list_index_insert_at(linkedList, node, index);
+        return LINKED_LIST_SUCCESS;
+    }
+
+    // an element shared with a shallow clone is copied on write, into the node's own element if nothing else uses it.
+    // a node that moved off its own element returns to it once it's unused, so a value left behind there is let go of.
+    if (elementBlock != block && confetti_atomic_load(&block->references) == 1)
+        targetBlock = block;
+    else if (confetti_atomic_load(&elementBlock->references) != (elementBlock == block ? 2 : 1)) {
+        targetBlock = (linked_list_node_block_t*) linkedList->allocator.allocate(linkedList->allocator.context, LINKED_LIST_NODE_ALLOCATION_SIZE);
+
+        if (targetBlock == NULL) {
+            linked_list_index_invalidate(linkedList);
+            return LINKED_LIST_ALLOCATION_FAILURE;
         }
 
-        lastMergedNode = lastMergedNode->next;
+        targetBlock->references = 0;
+        targetBlock->destructor = NULL;
+        targetBlock->element.value = NULL;
+        targetBlock->element.size = 0;
     }
 
-    if (firstHalf == NULL) {
-        lastMergedNode->next = secondHalf;
-    } 
-    else if (secondHalf == NULL) {
-        lastMergedNode->next = firstHalf;
+    // stored pointers are let go of rather than written over, as are owned values a pointer replaces.
+    if (targetBlock->destructor != NULL || storePointer)
+        linked_list_block_clear(&linkedList->allocator, targetBlock);
+
+    linked_list_result_t setResult = LINKED_LIST_SUCCESS;
+
+    if (storePointer) {
+        targetBlock->destructor = linkedList->destructor == NULL ? &linked_list_keep_value : linkedList->destructor;
+        targetBlock->element.value = (void*) value;
+        targetBlock->element.size = size;
     }
+    else
+        setResult = linked_list_element_set(&linkedList->allocator, &targetBlock->element, value, size);
 
-    while (lastMergedNode->next != NULL) {
-        lastMergedNode = lastMergedNode->next;
+    if (setResult != LINKED_LIST_SUCCESS) {
+        if (targetBlock != elementBlock && targetBlock != block)
+            linkedList->allocator.deallocate(linkedList->allocator.context, targetBlock, LINKED_LIST_NODE_ALLOCATION_SIZE);
+
+        linked_list_index_invalidate(linkedList);
+        return setResult;
+    }
+
+    if (targetBlock != elementBlock) {
+        targetBlock->references++;
+        node->element = &targetBlock->element;
+        linked_list_block_release(&linkedList->allocator, elementBlock, 1);
+    }
+
+    linked_list_index_insert_at(linkedList, node, index);
+    return LINKED_LIST_SUCCESS;
+}
+
+
+static void linked_list_index_invalidate(linked_list_t* const linkedList) {
+    if (linkedList->index != NULL)
+        linkedList->index->stale = true;
+}
+
+
+static void linked_list_index_insert_at(linked_list_t* const linkedList, linked_list_node_t* const node, const int64_t index) {
+    if (linkedList->index == NULL || linkedList->index->stale)
+        return;
+
+    const uint64_t hash = linkedList->hashFunction(node->element->value, node->element->size);
+
+    if (!confetti_hash_index_insert(&linkedList->allocator, linkedList->index, hash, index, node))
+        linkedList->index->stale = true;
+}
+
+
+static void linked_list_index_erase_at(linked_list_t* const linkedList, const linked_list_node_t* const node, const int64_t index) {
+    if (linkedList->index == NULL || linkedList->index->stale)
+        return;
+
+    const uint64_t hash = linkedList->hashFunction(node->element->value, node->element->size);
+
+    if (!confetti_hash_index_erase(linkedList->index, hash, index))
+        linkedList->index->stale = true;
+}
+
+
+static void linked_list_index_added(linked_list_t* const linkedList, linked_list_node_t* const node, const int64_t index) {
+    if (linkedList->index == NULL || linkedList->index->stale)
+        return;
+
+    if (index == linkedList->size - 1)
+        linked_list_index_insert_at(linkedList, node, index);
+    else if (index == 0) {
+        // moving the base back shifts every other node up by one at once.
+        linkedList->index->base--;
+        linked_list_index_insert_at(linkedList, node, 0);
+    }
+    else {
+        // the nodes after the new one are moved up in place, nothing is rehashed.
+        confetti_hash_index_shift(linkedList->index, index, 1);
+        linked_list_index_insert_at(linkedList, node, index);
     }
-    *tailOut = lastMergedNode;
-    
-    return newHead;
 }
 
 
-static void merge_split(linked_list_node_t* const source, linked_list_node_t** firstHalfOut, linked_list_node_t** secondHalfOut) {
-    if (source == NULL || source->next == NULL) {
-        *firstHalfOut = source;
-        *secondHalfOut = NULL;
+static void linked_list_index_removing(linked_list_t* const linkedList, const int64_t index) {
+    if (linkedList->index == NULL || linkedList->index->stale)
         return;
+
+    const linked_list_node_t* node = index == 0 ? linkedList->head : linkedList->tail;
+
+    // the walk leaves the finger on the node, so unlinking it afterwards doesn't walk again.
+    if (index != 0 && index != linkedList->size - 1) {
+        linked_list_cursor_walk(&linkedList->finger, index);
+        node = linkedList->finger.node;
     }
 
-    linked_list_node_t* singleStep = source;
-    linked_list_node_t* doubleStep = source->next;
+    const uint64_t hash = linkedList->hashFunction(node->element->value, node->element->size);
+
+    if (!confetti_hash_index_erase(linkedList->index, hash, index))
+        linkedList->index->stale = true;
+    else if (index == 0)
+        linkedList->index->base++;
+    else if (index != linkedList->size - 1)
+        confetti_hash_index_shift(linkedList->index, index + 1, -1);
+}
+
+
+static bool linked_list_index_rebuild(linked_list_t* const linkedList) {
+    confetti_hash_index_clear(linkedList->index);
+
+    int64_t index = 0;
+
+    for (linked_list_node_t* node = linkedList->head; node != NULL && !linkedList->index->stale; node = node->next)
+        linked_list_index_insert_at(linkedList, node, index++);
+
+    return !linkedList->index->stale;
+}
 
-    while (doubleStep != NULL && doubleStep->next != NULL) {
-        singleStep = singleStep->next;
-        doubleStep = doubleStep->next->next;
+
+static bool linked_list_index_find(
+    linked_list_t* const linkedList, 
+    const void* const value, 
+    const uint64_t size, 
+    const int64_t startFromIndex, 
+    const bool last, 
+    int64_t* const indexOut
+) {
+    if (linkedList->index == NULL)
+        return false;
+    else if (linkedList->index->stale && !linked_list_index_rebuild(linkedList))
+        return false;
+
+    const uint64_t hash = linkedList->hashFunction(value, size);
+    const confetti_hash_index_entry_t* entry;
+    uint64_t cursor = 0;
+    int64_t found = -1;
+
+    // the entries keep their node, so candidates are compared without walking the linked list.
+    while ((entry = confetti_hash_index_probe(linkedList->index, hash, &cursor)) != NULL) {
+        const int64_t position = confetti_hash_index_position(linkedList->index, entry);
+        const linked_list_node_t* const node = (const linked_list_node_t*) entry->item;
+
+        if (position < startFromIndex || (found != -1 && (last ? position < found : position > found)))
+            continue;
+
+        if (node->element->size != size)
+            continue;
+
+        if (linkedList->equalityFunction(node->element->value, value, size) == 0)
+            found = position;
     }
 
-    *firstHalfOut = source;
-    *secondHalfOut = singleStep->next;
-    singleStep->next = NULL;
+    *indexOut = found;
+    return true;
+}
+
+
+static int32_t default_equals(const void* data1, const void* data2, uint64_t size) {
+    if (data1 == NULL && data2 != NULL)
+        return -1;
+    else if (data1 != NULL && data2 == NULL) 
+        return 1;
+    else if (data1 == NULL && data2 == NULL)
+        return 0;
+
+    return memcmp(data1, data2, size);
+}
+
+
+static int32_t linked_list_node_order(
+    linked_list_custom_equality_function_t* const equalityFunction, 
+    const linked_list_node_t* const node1, 
+    const linked_list_node_t* const node2, 
+    const bool ascending
+) {
+    int32_t equality = equalityFunction(node1->element->value, node2->element->value, node1->element->size);
+
+    if (equality == 0)
+        return 0;
+
+    return (equality > 0) == ascending ? 1 : -1;
+}
+
+
+static linked_list_node_t* merge(
+    linked_list_node_t* first, 
+    linked_list_node_t* const firstTail, 
+    linked_list_node_t* second, 
+    linked_list_node_t* const secondTail, 
+    const bool ascending,
+    linked_list_custom_equality_function_t* const equalityFunction,
+    linked_list_node_t** tailOut
+) {
+    if (first == NULL) {
+        *tailOut = secondTail;
+        return second;
+    }
+    else if (second == NULL) {
+        *tailOut = firstTail;
+        return first;
+    }
+
+    // the sublists are already in order.
+    if (linked_list_node_order(equalityFunction, firstTail, second, ascending) <= 0) {
+        firstTail->next = second;
+        *tailOut = secondTail;
+
+        return first;
+    }
+
+    linked_list_node_t head;
+    linked_list_node_t* lastMergedNode = &head;
+
+    while (first != NULL && second != NULL) {
+        if (linked_list_node_order(equalityFunction, first, second, ascending) <= 0) {
+            lastMergedNode->next = first;
+            first = first->next;
+        } else {
+            lastMergedNode->next = second;
+            second = second->next;
+        }
+
+        lastMergedNode = lastMergedNode->next;
+    }
+
+    if (first != NULL) {
+        lastMergedNode->next = first;
+        *tailOut = firstTail;
+    } 
+    else {
+        lastMergedNode->next = second;
+        *tailOut = secondTail;
+    }
+    
+    return head.next;
+}
+
+
+static linked_list_node_t* merge_take_run(
+    linked_list_node_t* const head, 
+    const bool ascending,
+    linked_list_custom_equality_function_t* const equalityFunction,
+    linked_list_node_t** runTailOut,
+    linked_list_node_t** restOut
+) {
+    linked_list_node_t* runHead = head;
+    linked_list_node_t* runTail = head;
+    linked_list_node_t* rest = head->next;
+
+    if (rest != NULL && linked_list_node_order(equalityFunction, runTail, rest, ascending) > 0) {
+        // reverse the strictly reversed run while walking it.
+        runHead->next = NULL;
+
+        while (rest != NULL && linked_list_node_order(equalityFunction, runHead, rest, ascending) > 0) {
+            linked_list_node_t* next = rest->next;
+
+            rest->next = runHead;
+            runHead = rest;
+            rest = next;
+        }
+    }
+    else {
+        while (rest != NULL && linked_list_node_order(equalityFunction, runTail, rest, ascending) <= 0) {
+            runTail = rest;
+            rest = rest->next;
+        }
+
+        runTail->next = NULL;
+    }
+
+    *runTailOut = runTail;
+    *restOut = rest;
+
+    return runHead;
 }
 
 
 static linked_list_node_t* merge_sort(
     linked_list_node_t* const head, 
     const bool ascending,
-    const linked_list_custom_equality_function_t* equalityFunction,
+    linked_list_custom_equality_function_t* const equalityFunction,
     linked_list_node_t** tailOut
 ) {
-    if (head == NULL || head->next == NULL) {
-        *tailOut = head;
-        return head;
+    linked_list_node_t* pending[LINKED_LIST_MERGE_SLOTS] = { NULL };
+    linked_list_node_t* pendingTails[LINKED_LIST_MERGE_SLOTS] = { NULL };
+    int usedSlots = 0;
+
+    linked_list_node_t* rest = head;
+
+    while (rest != NULL) {
+        linked_list_node_t* runTail = NULL;
+        linked_list_node_t* run = merge_take_run(rest, ascending, equalityFunction, &runTail, &rest);
+
+        int slot = 0;
+
+        // pending slots hold earlier nodes than the run, so they are merged in first.
+        while (slot < LINKED_LIST_MERGE_SLOTS - 1 && pending[slot] != NULL) {
+            run = merge(pending[slot], pendingTails[slot], run, runTail, ascending, equalityFunction, &runTail);
+            pending[slot] = NULL;
+            slot++;
+        }
+
+        if (pending[slot] != NULL)
+            run = merge(pending[slot], pendingTails[slot], run, runTail, ascending, equalityFunction, &runTail);
+
+        pending[slot] = run;
+        pendingTails[slot] = runTail;
+
+        if (slot + 1 > usedSlots)
+            usedSlots = slot + 1;
     }
-    
-    linked_list_node_t* firstHalf = NULL;
-    linked_list_node_t* secondHalf = NULL;
 
-    merge_split(head, &firstHalf, &secondHalf);
+    linked_list_node_t* result = NULL;
+    linked_list_node_t* resultTail = NULL;
 
-    linked_list_node_t* firstHalfTail = NULL;
-    linked_list_node_t* secondHalfTail = NULL;
+    for (int slot = 0; slot < usedSlots; slot++) {
+        if (pending[slot] != NULL)
+            result = merge(pending[slot], pendingTails[slot], result, resultTail, ascending, equalityFunction, &resultTail);
+    }
 
-    firstHalf = merge_sort(firstHalf, ascending, equalityFunction, &firstHalfTail);
-    secondHalf = merge_sort(secondHalf, ascending, equalityFunction, &secondHalfTail);
+    *tailOut = resultTail;
+    return result;
+}
 
-    return merge(firstHalf, secondHalf, ascending, equalityFunction, tailOut);
+
+static void linked_list_parallel_sort_sublist(void* const context, const uint64_t index) {
+    linked_list_parallel_sort_t* const sort = (linked_list_parallel_sort_t*) context;
+
+    sort->heads[index] = merge_sort(sort->heads[index], sort->ascending, sort->equalityFunction, &sort->tails[index]);
+}
+
+
+static void linked_list_parallel_merge_pair(void* const context, const uint64_t index) {
+    linked_list_parallel_sort_t* const sort = (linked_list_parallel_sort_t*) context;
+
+    sort->heads[index * 2] = merge(
+        sort->heads[index * 2], 
+        sort->tails[index * 2], 
+        sort->heads[index * 2 + 1], 
+        sort->tails[index * 2 + 1], 
+        sort->ascending, 
+        sort->equalityFunction, 
+        &sort->tails[index * 2]
+    );
 }
 
 
@@ -510,7 +1355,7 @@ static linked_list_result_t default_sort(linked_list_t* const linkedList, const
     linked_list_node_t* newHead = NULL;
     linked_list_node_t* newTail = NULL;
 
-    newHead = merge_sort(linkedList->head, ascending, (const linked_list_custom_equality_function_t*) linkedList->equalityFunction, &newTail);
+    newHead = merge_sort(linkedList->head, ascending, linkedList->equalityFunction, &newTail);
     linkedList->head = newHead;
     linkedList->tail = newTail;
 
@@ -528,7 +1373,24 @@ linked_list_result_t linked_list_create(
     linked_list_custom_equality_function_t* const customEqualityFunction, 
     linked_list_custom_sorting_function_t* const customSortingFunction
 ) {
-    linked_list_t* const linkedList = (linked_list_t*) malloc(sizeof(linked_list_t));
+    linked_list_options_t options = { customEqualityFunction, customSortingFunction, NULL, NULL, LINKED_LIST_FLAG_NONE, NULL };
+
+    return linked_list_create_with_options(linkedListOut, &options);
+}
+
+
+linked_list_result_t linked_list_create_with_options(linked_list_t** linkedListOut, const linked_list_options_t* const options) {
+    if (options == NULL)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const allocator = options->allocator == NULL 
+        ? confetti_allocator_default() 
+        : options->allocator;
+
+    if (allocator->allocate == NULL || allocator->reallocate == NULL || allocator->deallocate == NULL)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
+
+    linked_list_t* const linkedList = (linked_list_t*) allocator->allocate(allocator->context, sizeof(linked_list_t));
 
     if (linkedList == NULL)
         return LINKED_LIST_ALLOCATION_FAILURE;
@@ -536,12 +1398,28 @@ linked_list_result_t linked_list_create(
     linkedList->head = NULL;
     linkedList->tail = NULL;
     linkedList->size = 0;
-    linkedList->equalityFunction = customEqualityFunction == NULL 
+    linkedList->equalityFunction = options->equalityFunction == NULL 
         ? (linked_list_custom_equality_function_t*) &default_equals 
-        : customEqualityFunction;
-    linkedList->sortingFunction = customSortingFunction == NULL 
+        : options->equalityFunction;
+    linkedList->sortingFunction = options->sortingFunction == NULL 
         ? (linked_list_custom_sorting_function_t*) &default_sort 
-        : customSortingFunction;
+        : options->sortingFunction;
+    linkedList->allocator = *allocator;
+    linkedList->hashFunction = NULL;
+    linkedList->index = NULL;
+    linkedList->flags = options->flags;
+    linkedList->destructor = options->destructor;
+    linkedList->finger.list = linkedList;
+    linked_list_cursor_reset(&linkedList->finger);
+
+    if (options->hashFunction != NULL) {
+        linked_list_result_t indexResult = linked_list_index_attach(linkedList, options->hashFunction);
+
+        if (indexResult != LINKED_LIST_SUCCESS) {
+            allocator->deallocate(allocator->context, linkedList, sizeof(linked_list_t));
+            return indexResult;
+        }
+    }
 
     *linkedListOut = linkedList;
     return LINKED_LIST_SUCCESS;
@@ -552,24 +1430,15 @@ linked_list_result_t linked_list_free(linked_list_t** linkedList) {
     if (*linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
 
-    linked_list_node_t* previousNode = NULL;
-
-    for (linked_list_node_t* node = (*linkedList)->head; node != NULL; node = node->next) {
-        if (previousNode != NULL) {
-            linked_list_result_t nodeFreeResult = linked_list_node_free(&previousNode);
-
-            if (nodeFreeResult != LINKED_LIST_SUCCESS)
-                return nodeFreeResult;
-        }
+    linked_list_result_t clearResult = linked_list_clear(*linkedList);
 
-        previousNode = node;
-    }
+    if (clearResult != LINKED_LIST_SUCCESS)
+        return clearResult;
 
-    (*linkedList)->head = NULL;
-    (*linkedList)->tail = NULL;
-    (*linkedList)->size = 0;
+    confetti_allocator_t allocator = (*linkedList)->allocator;
 
-    free(*linkedList);
+    confetti_hash_index_free(&allocator, &(*linkedList)->index);
+    allocator.deallocate(allocator.context, *linkedList, sizeof(linked_list_t));
     *linkedList = NULL;
 
     return LINKED_LIST_SUCCESS;
@@ -601,56 +1470,69 @@ linked_list_result_t linked_list_get(linked_list_t* const linkedList, linked_lis
     else if (index >= linkedList->size || index < 0) 
         return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
 
-    int64_t currentIndex = 0;
+    linked_list_node_t* node = NULL;
+    linked_list_result_t getResult = linked_list_node_get(linkedList, &node, index);
 
-    for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next) {
-        if (currentIndex == index) {
-            linked_list_element_t* elementClone = NULL;
-            linked_list_result_t cloneResult = linked_list_element_clone(node->element, &elementClone);
+    if (getResult != LINKED_LIST_SUCCESS)
+        return getResult;
 
-            if (cloneResult != LINKED_LIST_SUCCESS)
-                return cloneResult;
+    linked_list_element_t* elementClone = NULL;
+    linked_list_result_t cloneResult = linked_list_element_clone(confetti_allocator_default(), node->element, &elementClone);
 
-            *elementOut = elementClone;
-            return LINKED_LIST_SUCCESS;
-        }
-            
-        currentIndex++;
-    }
+    if (cloneResult != LINKED_LIST_SUCCESS)
+        return cloneResult;
+
+    *elementOut = elementClone;
+    return LINKED_LIST_SUCCESS;
 }
 
 
-linked_list_result_t linked_list_set(linked_list_t* const linkedList, const int64_t index, void* const value, const uint64_t size) {
+linked_list_result_t linked_list_peek(linked_list_t* const linkedList, const void** valueOut, uint64_t* const sizeOut, const int64_t index) {
     if (linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
     else if (index >= linkedList->size || index < 0) 
         return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
 
-    int64_t currentIndex = 0;
+    linked_list_node_t* node = index == linkedList->size - 1 ? linkedList->tail : NULL;
 
-    for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next) {
-        if (currentIndex == index) {
-            linked_list_result_t setResult = linked_list_element_set(node->element, value, size);
+    if (node == NULL) {
+        linked_list_result_t getResult = linked_list_node_get(linkedList, &node, index);
 
-            if (setResult != LINKED_LIST_SUCCESS)
-                return setResult;
+        if (getResult != LINKED_LIST_SUCCESS)
+            return getResult;
+    }
 
-            break;
-        }   
+    *valueOut = node->element->value;
 
-        currentIndex++;
-    }
+    if (sizeOut != NULL)
+        *sizeOut = node->element->size;
 
     return LINKED_LIST_SUCCESS;
 }
 
 
+linked_list_result_t linked_list_set(linked_list_t* const linkedList, const int64_t index, void* const value, const uint64_t size) {
+    if (linkedList == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (index >= linkedList->size || index < 0) 
+        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    linked_list_node_t* node = NULL;
+    linked_list_result_t getResult = linked_list_node_get(linkedList, &node, index);
+
+    if (getResult != LINKED_LIST_SUCCESS)
+        return getResult;
+
+    return linked_list_node_set(linkedList, node, index, value, size);
+}
+
+
 linked_list_result_t linked_list_prepend(linked_list_t* const linkedList, void* const value, const uint64_t size) {
     if (linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
 
     linked_list_node_t* node = NULL;
-    linked_list_result_t nodeCreateResult = linked_list_node_create(&node, value, size, linkedList->head);
+    linked_list_result_t nodeCreateResult = linked_list_node_store(linkedList, &node, value, size, linkedList->head);
 
     if (nodeCreateResult != LINKED_LIST_SUCCESS)
         return nodeCreateResult;
@@ -662,7 +1544,14 @@ linked_list_result_t linked_list_prepend(linked_list_t* const linkedList, void*
     else 
         linkedList->head = node;
 
+    // every position shifts by one, the node before the finger only changes if the finger was at the head.
+    if (linkedList->finger.previous == NULL)
+        linkedList->finger.previous = node;
+
+    linkedList->finger.index++;
     linkedList->size++;
+    linked_list_index_added(linkedList, node, 0);
+
     return LINKED_LIST_SUCCESS;
 }
 
@@ -672,7 +1561,7 @@ linked_list_result_t linked_list_append(linked_list_t* const linkedList, void* c
         return LINKED_LIST_NULL_ERROR;
 
     linked_list_node_t* node = NULL;
-    linked_list_result_t nodeCreateResult = linked_list_node_create(&node, value, size, NULL);
+    linked_list_result_t nodeCreateResult = linked_list_node_store(linkedList, &node, value, size, NULL);
 
     if (nodeCreateResult != LINKED_LIST_SUCCESS)
         return nodeCreateResult;
@@ -686,239 +1575,244 @@ linked_list_result_t linked_list_append(linked_list_t* const linkedList, void* c
         linkedList->tail = node;
     }
 
+    if (linkedList->finger.node == NULL)
+        linkedList->finger.node = node;
+
     linkedList->size++;
+    linked_list_index_added(linkedList, node, linkedList->size - 1);
+
     return LINKED_LIST_SUCCESS;
 }
 
 
-linked_list_result_t linked_list_insert(linked_list_t* const linkedList, const int64_t index, void* value, const uint64_t size) {
+linked_list_result_t linked_list_append_many(
+    linked_list_t* const linkedList, 
+    const void* const values, 
+    const uint64_t count, 
+    const uint64_t stride
+) {
     if (linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
-    else if (index > linkedList->size || index < 0) 
-        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+    else if (stride == 0 || (values == NULL && count > 0) || count > (uint64_t) (INT64_MAX - linkedList->size))
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
 
-    linked_list_node_t* newNode = NULL;
-    linked_list_result_t nodeCreateResult = linked_list_node_create(&newNode, value, size, NULL);
+    if (count == 0)
+        return LINKED_LIST_SUCCESS;
 
-    if (nodeCreateResult != LINKED_LIST_SUCCESS)
-        return nodeCreateResult;
+    const uint8_t* const source = (const uint8_t*) values;
+    linked_list_node_t* chainHead = NULL;
+    linked_list_node_t* chainTail = NULL;
 
-    if (linkedList->head == NULL) {
-        linkedList->head = newNode;
-        linkedList->tail = newNode;
-        linkedList->size++;
+    for (uint64_t i = 0; i < count; i++) {
+        linked_list_node_t* node = NULL;
+        linked_list_result_t nodeCreateResult = linked_list_node_create(&linkedList->allocator, &node, source + stride * i, stride, NULL);
 
-        return LINKED_LIST_SUCCESS;
-    }
+        if (nodeCreateResult != LINKED_LIST_SUCCESS) {
+            while (chainHead != NULL) {
+                linked_list_node_t* nextNode = chainHead->next;
 
-    if (index == 0) {
-        newNode->next = linkedList->head;
-        linkedList->head = newNode;
-        linkedList->size++;
+                linked_list_node_free(&linkedList->allocator, &chainHead);
+                chainHead = nextNode;
+            }
 
-        return LINKED_LIST_SUCCESS;
-    }
-    else if (index == linkedList->size) {
-        linkedList->tail->next = newNode;
-        linkedList->tail = newNode;
-        linkedList->size++;
+            return nodeCreateResult;
+        }
 
-        return LINKED_LIST_SUCCESS;
+        if (chainHead == NULL)
+            chainHead = node;
+        else
+            chainTail->next = node;
+
+        chainTail = node;
     }
 
-    linked_list_node_t* previousNode = NULL;
-    linked_list_result_t getNodeResult = linked_list_node_get(linkedList, &previousNode, index - 1);
+    if (linkedList->head == NULL)
+        linkedList->head = chainHead;
+    else
+        linkedList->tail->next = chainHead;
 
-    if (getNodeResult != LINKED_LIST_SUCCESS)
-        return getNodeResult;
+    int64_t index = linkedList->size;
 
-    newNode->next = previousNode->next;
-    previousNode->next = newNode;
+    for (linked_list_node_t* node = chainHead; node != NULL; node = node->next)
+        linked_list_index_insert_at(linkedList, node, index++);
+
+    if (linkedList->finger.node == NULL)
+        linkedList->finger.node = chainHead;
+
+    linkedList->tail = chainTail;
+    linkedList->size += (int64_t) count;
 
-    linkedList->size++;
     return LINKED_LIST_SUCCESS;
 }
 
 
-linked_list_result_t linked_list_remove(linked_list_t* const linkedList, const uint64_t index) {
+linked_list_result_t linked_list_insert(linked_list_t* const linkedList, const int64_t index, void* value, const uint64_t size) {
     if (linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
-    else if (index >= linkedList->size || index < 0) 
+    else if (index > linkedList->size || index < 0) 
         return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
 
-    if (linkedList->size == 1) {
-        linked_list_result_t freeResult = linked_list_node_free(&linkedList->head);
-
-        if (freeResult != LINKED_LIST_SUCCESS)
-            return freeResult;
+    if (index == 0)
+        return linked_list_prepend(linkedList, value, size);
+    else if (index == linkedList->size)
+        return linked_list_append(linkedList, value, size);
 
-        linkedList->size--;
-        linkedList->head = NULL;
-        linkedList->tail = NULL;
-        return LINKED_LIST_SUCCESS;
-    }
+    linked_list_node_t* newNode = NULL;
+    linked_list_result_t nodeCreateResult = linked_list_node_store(linkedList, &newNode, value, size, NULL);
 
-    if (index == 0) {
-        linked_list_node_t* previousHead = linkedList->head;
+    if (nodeCreateResult != LINKED_LIST_SUCCESS)
+        return nodeCreateResult;
 
-        linkedList->head = previousHead->next;
-        linkedList->size--;
+    // the finger stays on the new node, so inserting at consecutive indices doesn't walk again.
+    linked_list_cursor_walk(&linkedList->finger, index);
+    linked_list_cursor_link(&linkedList->finger, newNode);
+    linked_list_index_added(linkedList, newNode, index);
 
-        linked_list_result_t freeResult = linked_list_node_free(&previousHead);
+    return LINKED_LIST_SUCCESS;
+}
 
-        if (freeResult != LINKED_LIST_SUCCESS)
-            return freeResult;
 
-        return LINKED_LIST_SUCCESS;
-    }
-    else if (index == linkedList->size - 1) {
-        linked_list_node_t* previousTail = linkedList->tail;
-        linked_list_node_t* newTail = NULL;
-        linked_list_result_t getResult = linked_list_node_get(linkedList, &newTail, index - 1);
+linked_list_result_t linked_list_remove(linked_list_t* const linkedList, const uint64_t index) {
+    if (linkedList == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (index >= (uint64_t) linkedList->size) 
+        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
 
-        if (getResult != LINKED_LIST_SUCCESS)
-            return getResult;
+    linked_list_node_t* node = NULL;
 
-        newTail->next = NULL;
-        linkedList->tail = newTail;
-        linkedList->size--;
+    linked_list_index_removing(linkedList, (int64_t) index);
+    linked_list_node_detach(linkedList, &node, (int64_t) index);
 
-        linked_list_result_t freeResult = linked_list_node_free(&previousTail);
+    return linked_list_node_free(&linkedList->allocator, &node);
+}
 
-        if (freeResult != LINKED_LIST_SUCCESS)
-            return freeResult;
 
-        return LINKED_LIST_SUCCESS;
-    }
+linked_list_result_t linked_list_remove_if(
+    linked_list_t* const linkedList, 
+    linked_list_predicate_function_t* const predicate, 
+    void* const context
+) {
+    if (linkedList == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (predicate == NULL)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
 
-    int64_t currentIndex = 0;
-    linked_list_node_t* lastNode = NULL;
+    linked_list_node_t* previous = NULL;
+    linked_list_node_t* node = linkedList->head;
+    int64_t removed = 0;
 
-    for (linked_list_node_t* current = linkedList->head; current != NULL; current = current->next) {
-        if (currentIndex == index) {
-            lastNode->next = current->next;
-            linkedList->size--;
+    while (node != NULL) {
+        linked_list_node_t* next = node->next;
 
-            linked_list_result_t freeResult = linked_list_node_free(&current);
+        if (!predicate(context, node->element->value, node->element->size)) {
+            previous = node;
+            node = next;
+            continue;
+        }
 
-            if (freeResult != LINKED_LIST_SUCCESS)
-                return freeResult;
+        if (previous == NULL)
+            linkedList->head = next;
+        else
+            previous->next = next;
 
-            return LINKED_LIST_SUCCESS;
-        }
+        if (node == linkedList->tail)
+            linkedList->tail = previous;
 
-        currentIndex++;
-        lastNode = current;
+        linked_list_node_free(&linkedList->allocator, &node);
+        removed++;
+        node = next;
     }
+
+    if (removed == 0)
+        return LINKED_LIST_SUCCESS;
+
+    linkedList->size -= removed;
+    linked_list_index_invalidate(linkedList);
+    linked_list_cursor_reset(&linkedList->finger);
+
+    return LINKED_LIST_SUCCESS;
 }
 
 
 linked_list_result_t linked_list_pop(linked_list_t* const linkedList, linked_list_element_t** elementOut, const uint64_t index) {
     if (linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
-    else if (index >= linkedList->size || index < 0) 
+    else if (index >= (uint64_t) linkedList->size) 
         return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
 
-    if (linkedList->size == 1) {
-        linked_list_element_t* elementClone = NULL;
-        linked_list_result_t cloneResult = linked_list_element_clone(linkedList->head->element, &elementClone);
-
-        if (cloneResult != LINKED_LIST_SUCCESS)
-            return cloneResult;
-
-        linked_list_result_t freeResult = linked_list_element_free(&linkedList->head->element);
+    linked_list_node_t* node = index == (uint64_t) linkedList->size - 1 ? linkedList->tail : NULL;
 
-        if (freeResult != LINKED_LIST_SUCCESS)
-            return freeResult;
-
-        free(linkedList->head);
-
-        linkedList->size--;
-        linkedList->head = NULL;
-        linkedList->tail = NULL;
+    if (node == NULL) {
+        linked_list_result_t getResult = linked_list_node_get(linkedList, &node, (int64_t) index);
 
-        *elementOut = elementClone;
-        return LINKED_LIST_SUCCESS;
+        if (getResult != LINKED_LIST_SUCCESS)
+            return getResult;
     }
 
-    if (index == 0) {
-        linked_list_element_t* elementClone = NULL;
-        linked_list_result_t cloneResult = linked_list_element_clone(linkedList->head->element, &elementClone);
-
-        if (cloneResult != LINKED_LIST_SUCCESS)
-            return cloneResult;
+    linked_list_element_t* elementClone = NULL;
+    linked_list_result_t cloneResult = linked_list_element_clone(confetti_allocator_default(), node->element, &elementClone);
 
-        linked_list_node_t* previousHead = linkedList->head;
+    if (cloneResult != LINKED_LIST_SUCCESS)
+        return cloneResult;
 
-        linkedList->head = previousHead->next;
-        linkedList->size--;
+    linked_list_index_removing(linkedList, (int64_t) index);
+    linked_list_node_detach(linkedList, &node, (int64_t) index);
+    linked_list_result_t freeResult = linked_list_node_free(&linkedList->allocator, &node);
 
-        linked_list_result_t freeResult = linked_list_element_free(&previousHead->element);
-
-        if (freeResult != LINKED_LIST_SUCCESS)
-            return freeResult;
-
-        free(previousHead);
-
-        *elementOut = elementClone;
-        return LINKED_LIST_SUCCESS;
+    if (freeResult != LINKED_LIST_SUCCESS) {
+        linked_list_element_free(&elementClone);
+        return freeResult;
     }
-    else if (index == linkedList->size - 1) {
-        linked_list_element_t* elementClone = NULL;
-        linked_list_result_t cloneResult = linked_list_element_clone(linkedList->tail->element, &elementClone);
 
-        if (cloneResult != LINKED_LIST_SUCCESS)
-            return cloneResult;
-
-        linked_list_node_t* previousTail = linkedList->tail;
-        linked_list_node_t* newTail = NULL;
-        linked_list_result_t getResult = linked_list_node_get(linkedList, &newTail, index - 1);
-
-        if (getResult != LINKED_LIST_SUCCESS)
-            return getResult;
+    *elementOut = elementClone;
+    return LINKED_LIST_SUCCESS;
+}
 
-        newTail->next = NULL;
-        linkedList->tail = newTail;
-        linkedList->size--;
 
-        linked_list_result_t freeResult = linked_list_element_free(&previousTail->element);
+linked_list_result_t linked_list_take(linked_list_t* const linkedList, linked_list_element_t** elementOut, const int64_t index) {
+    if (linkedList == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (index >= linkedList->size || index < 0) 
+        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
 
-        if (freeResult != LINKED_LIST_SUCCESS)
-            return freeResult;
+    linked_list_node_t* node = NULL;
+    linked_list_result_t getResult = linked_list_node_get(linkedList, &node, index);
 
-        free(previousTail);
+    if (getResult != LINKED_LIST_SUCCESS)
+        return getResult;
 
-        *elementOut = elementClone;
-        return LINKED_LIST_SUCCESS;
-    }
+    const confetti_allocator_t* const defaultAllocator = confetti_allocator_default();
+    linked_list_element_t* const element = node->element;
 
-    int64_t currentIndex = 0;
-    linked_list_node_t* lastNode = NULL;
+    // inline values and values owned by another allocator can't be handed over.
+    if (
+        linkedList->allocator.allocate != defaultAllocator->allocate 
+        || element->value == NULL 
+        || linked_list_element_is_inline(element)
+        || linked_list_node_is_shared(node)
+        || linked_list_block_of(element)->destructor != NULL
+    )
+        return linked_list_pop(linkedList, elementOut, (uint64_t) index);
 
-    for (linked_list_node_t* current = linkedList->head; current != NULL; current = current->next) {
-        if (currentIndex == index) {
-            linked_list_element_t* elementClone = NULL;
-            linked_list_result_t cloneResult = linked_list_element_clone(current->element, &elementClone);
+    linked_list_element_t* const takenElement = (linked_list_element_t*) defaultAllocator->allocate(defaultAllocator->context, sizeof(linked_list_element_t));
 
-            if (cloneResult != LINKED_LIST_SUCCESS)
-                return cloneResult;
+    if (takenElement == NULL)
+        return LINKED_LIST_ALLOCATION_FAILURE;
 
-            lastNode->next = current->next;
-            linkedList->size--;
+    linked_list_index_removing(linkedList, index);
 
-            linked_list_result_t freeResult = linked_list_element_free(&current->element);
+    takenElement->value = element->value;
+    takenElement->size = element->size;
+    element->value = NULL;
 
-            if (freeResult != LINKED_LIST_SUCCESS)
-                return freeResult;
+    linked_list_node_detach(linkedList, &node, index);
+    linked_list_result_t freeResult = linked_list_node_free(&linkedList->allocator, &node);
 
-            free(current);
-            *elementOut = elementClone;
-            return LINKED_LIST_SUCCESS;
-        }
+    if (freeResult != LINKED_LIST_SUCCESS)
+        return freeResult;
 
-        currentIndex++;
-        lastNode = current;
-    }
+    *elementOut = takenElement;
+    return LINKED_LIST_SUCCESS;
 }
 
 
@@ -926,22 +1820,25 @@ linked_list_result_t linked_list_clear(linked_list_t* const linkedList) {
     if (linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
 
-    linked_list_node_t* previousNode = NULL;
+    linked_list_node_t* node = linkedList->head;
 
-    for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next) {       
-        if (previousNode != NULL) {
-            linked_list_result_t nodeFreeResult = linked_list_node_free(&previousNode);
+    while (node != NULL) {
+        linked_list_node_t* nextNode = node->next;
+        linked_list_result_t nodeFreeResult = linked_list_node_free(&linkedList->allocator, &node);
 
-            if (nodeFreeResult != LINKED_LIST_SUCCESS)
-                return nodeFreeResult;
-        }
+        if (nodeFreeResult != LINKED_LIST_SUCCESS)
+            return nodeFreeResult;
 
-        previousNode = node;
+        node = nextNode;
     }
 
     linkedList->head = NULL;
     linkedList->tail = NULL;
     linkedList->size = 0;
+    linked_list_cursor_reset(&linkedList->finger);
+
+    if (linkedList->index != NULL)
+        confetti_hash_index_clear(linkedList->index);
 
     return LINKED_LIST_SUCCESS;
 }
@@ -951,62 +1848,77 @@ linked_list_result_t linked_list_clone(linked_list_t* const linkedList, linked_l
     if (linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
 
-    linked_list_t* const linkedListClone = (linked_list_t*) malloc(sizeof(linked_list_t));
+    linked_list_options_t options = { 
+        linkedList->equalityFunction, 
+        linkedList->sortingFunction, 
+        &linkedList->allocator, 
+        linkedList->hashFunction, 
+        linkedList->flags, 
+        linkedList->destructor 
+    };
+    linked_list_t* linkedListClone = NULL;
+    linked_list_result_t createResult = linked_list_create_with_options(&linkedListClone, &options);
 
-    if (linkedListClone == NULL)
-        return LINKED_LIST_ALLOCATION_FAILURE;
-
-    linkedListClone->head = NULL;
-    linkedListClone->tail = NULL;
-    linkedListClone->size = linkedList->size;
+    if (createResult != LINKED_LIST_SUCCESS)
+        return createResult;
 
-    if (linkedList->size > 0) {
-        linked_list_node_t* previousNodeClone = NULL;
-
-        for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next) {
-            linked_list_node_t* nodeClone = NULL;
-            linked_list_result_t nodeCloneResult = linked_list_node_clone(node, &nodeClone);
+    linked_list_node_t* previousNodeClone = NULL;
 
-            if (nodeCloneResult != LINKED_LIST_SUCCESS) 
-                return nodeCloneResult;
+    for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next) {
+        linked_list_node_t* nodeClone = NULL;
+        linked_list_result_t nodeCloneResult = linked_list_node_clone(&linkedListClone->allocator, node, &nodeClone);
 
-            if (linkedListClone->head == NULL) 
-                linkedListClone->head = nodeClone;
-            else 
-                previousNodeClone->next = nodeClone;
-            
-            previousNodeClone = nodeClone;
+        if (nodeCloneResult != LINKED_LIST_SUCCESS) {
+            linked_list_free(&linkedListClone);
+            return nodeCloneResult;
         }
 
-        linkedListClone->tail = previousNodeClone;
+        if (linkedListClone->head == NULL) 
+            linkedListClone->head = nodeClone;
+        else 
+            previousNodeClone->next = nodeClone;
+        
+        previousNodeClone = nodeClone;
+        linkedListClone->tail = nodeClone;
+        linkedListClone->size++;
     }
 
+    linked_list_index_invalidate(linkedListClone);
+    linked_list_cursor_reset(&linkedListClone->finger);
+
     *linkedListOut = linkedListClone;
     return LINKED_LIST_SUCCESS;
 }
 
 
-linked_list_result_t linked_list_join(linked_list_t* const linkedList1, linked_list_t* const linkedList2, linked_list_t** linkedListOut) {
-    if (linkedList1 == NULL || linkedList2 == NULL)
+linked_list_result_t linked_list_clone_shallow(linked_list_t* const linkedList, linked_list_t** linkedListOut) {
+    if (linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
 
-    linked_list_t* const linkedListClone = (linked_list_t*) malloc(sizeof(linked_list_t));
-
-    if (linkedListClone == NULL)
-        return LINKED_LIST_ALLOCATION_FAILURE;
+    linked_list_options_t options = { 
+        linkedList->equalityFunction, 
+        linkedList->sortingFunction, 
+        &linkedList->allocator, 
+        linkedList->hashFunction, 
+        linkedList->flags, 
+        linkedList->destructor 
+    };
+    linked_list_t* linkedListClone = NULL;
+    linked_list_result_t createResult = linked_list_create_with_options(&linkedListClone, &options);
 
-    linkedListClone->head = NULL;
-    linkedListClone->tail = NULL;
-    linkedListClone->size = linkedList1->size + linkedList2->size;
+    if (createResult != LINKED_LIST_SUCCESS)
+        return createResult;
 
     linked_list_node_t* previousNodeClone = NULL;
 
-    for (linked_list_node_t* node = linkedList1->head; node != NULL; node = node->next) {
+    for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next) {
         linked_list_node_t* nodeClone = NULL;
-        linked_list_result_t nodeCloneResult = linked_list_node_clone(node, &nodeClone);
+        linked_list_result_t nodeShareResult = linked_list_node_share(&linkedListClone->allocator, node, &nodeClone);
 
-        if (nodeCloneResult != LINKED_LIST_SUCCESS) 
-            return nodeCloneResult;
+        if (nodeShareResult != LINKED_LIST_SUCCESS) {
+            linked_list_free(&linkedListClone);
+            return nodeShareResult;
+        }
 
         if (linkedListClone->head == NULL) 
             linkedListClone->head = nodeClone;
@@ -1014,14 +1926,79 @@ linked_list_result_t linked_list_join(linked_list_t* const linkedList1, linked_l
             previousNodeClone->next = nodeClone;
         
         previousNodeClone = nodeClone;
+        linkedListClone->tail = nodeClone;
+        linkedListClone->size++;
     }
 
+    linked_list_index_invalidate(linkedListClone);
+    linked_list_cursor_reset(&linkedListClone->finger);
+
+    *linkedListOut = linkedListClone;
+    return LINKED_LIST_SUCCESS;
+}
+
+
+linked_list_result_t linked_list_splice(linked_list_t* const destination, linked_list_t* const source) {
+    if (destination == NULL || source == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (destination == source)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
+
+    // the nodes of the source will be freed by the destination.
+    if (destination->allocator.allocate != source->allocator.allocate 
+        || destination->allocator.reallocate != source->allocator.reallocate 
+        || destination->allocator.deallocate != source->allocator.deallocate 
+        || destination->allocator.context != source->allocator.context)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
+    
+    if (source->size == 0)
+        return LINKED_LIST_SUCCESS;
+
+    if (destination->head == NULL)
+        destination->head = source->head;
+    else
+        destination->tail->next = source->head;
+
+    // a finger past the tail now rests on the first spliced node.
+    if (destination->finger.node == NULL)
+        destination->finger.node = source->head;
+
+    destination->tail = source->tail;
+    destination->size += source->size;
+    linked_list_index_invalidate(destination);
+
+    source->head = NULL;
+    source->tail = NULL;
+    source->size = 0;
+    linked_list_cursor_reset(&source->finger);
+
+    if (source->index != NULL)
+        confetti_hash_index_clear(source->index);
+
+    return LINKED_LIST_SUCCESS;
+}
+
+
+linked_list_result_t linked_list_join(linked_list_t* const linkedList1, linked_list_t* const linkedList2, linked_list_t** linkedListOut) {
+    if (linkedList1 == NULL || linkedList2 == NULL)
+        return LINKED_LIST_NULL_ERROR;
+
+    linked_list_t* linkedListClone = NULL;
+    linked_list_result_t cloneResult = linked_list_clone(linkedList1, &linkedListClone);
+
+    if (cloneResult != LINKED_LIST_SUCCESS)
+        return cloneResult;
+
+    linked_list_node_t* previousNodeClone = linkedListClone->tail;
+
     for (linked_list_node_t* node = linkedList2->head; node != NULL; node = node->next) {
         linked_list_node_t* nodeClone = NULL;
-        linked_list_result_t nodeCloneResult = linked_list_node_clone(node, &nodeClone);
+        linked_list_result_t nodeCloneResult = linked_list_node_clone(&linkedListClone->allocator, node, &nodeClone);
 
-        if (nodeCloneResult != LINKED_LIST_SUCCESS) 
+        if (nodeCloneResult != LINKED_LIST_SUCCESS) {
+            linked_list_free(&linkedListClone);
             return nodeCloneResult;
+        }
 
         if (linkedListClone->head == NULL) 
             linkedListClone->head = nodeClone;
@@ -1029,9 +2006,12 @@ linked_list_result_t linked_list_join(linked_list_t* const linkedList1, linked_l
             previousNodeClone->next = nodeClone;
         
         previousNodeClone = nodeClone;
+        linkedListClone->tail = nodeClone;
+        linkedListClone->size++;
     }
 
-    linkedListClone->tail = previousNodeClone;
+    linked_list_index_invalidate(linkedListClone);
+    linked_list_cursor_reset(&linkedListClone->finger);
 
     *linkedListOut = linkedListClone;
     return LINKED_LIST_SUCCESS;
@@ -1042,76 +2022,45 @@ linked_list_result_t linked_list_resize(linked_list_t* const linkedList, uint64_
     if (linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
 
-    if (size == linkedList->size) 
+    if (size == (uint64_t) linkedList->size) 
         return LINKED_LIST_SUCCESS;
 
-    if (size == 0) {
-        linked_list_node_t* previousNode = NULL;
-
-        for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next) {
-            if (previousNode != NULL) {
-                linked_list_result_t nodeFreeResult = linked_list_node_free(&node);
-
-                if (nodeFreeResult != LINKED_LIST_SUCCESS)
-                    return nodeFreeResult;
-            }
-
-            previousNode = node;
-        }
-
-        linkedList->head = NULL;
-        linkedList->tail = NULL;
-    }
-    else if (size > linkedList->size) {
-        if (linkedList->head == NULL) {
-            linked_list_node_t* node = NULL;
-            linked_list_result_t nodeCreateResult = linked_list_node_create(&node, NULL, sizeof(NULL), NULL);
-
-            linkedList->head = node;
-            linkedList->tail = node;
-        }
-
-        linked_list_node_t* previousNode = linkedList->tail;
-
-        for (int i = 0; i < size - linkedList->size; i++) {
-            linked_list_node_t* node = NULL;
-            linked_list_result_t nodeCreateResult = linked_list_node_create(&node, NULL, sizeof(void*), NULL);
-
-            if (nodeCreateResult != LINKED_LIST_SUCCESS) 
-                return nodeCreateResult;
+    if (size == 0) 
+        return linked_list_clear(linkedList);
+    else if (size > (uint64_t) linkedList->size) {
+        while ((uint64_t) linkedList->size < size) {
+            linked_list_result_t appendResult = linked_list_append(linkedList, NULL, sizeof(void*));
 
-            previousNode->next = node;
-            previousNode = node;
+            if (appendResult != LINKED_LIST_SUCCESS) 
+                return appendResult;
         }
-
-        linkedList->tail = previousNode;
     }
-    else if (size < linkedList->size) {
-        linked_list_node_t* startingNode;
-        linked_list_result_t getNodeResult = size > 0 
-            ? linked_list_node_get(linkedList, &startingNode, size - 1) 
-            : linked_list_node_get(linkedList, &startingNode, size);
+    else {
+        linked_list_node_t* lastNode = NULL;
+        linked_list_result_t getNodeResult = linked_list_node_get(linkedList, &lastNode, (int64_t) size - 1);
 
         if (getNodeResult != LINKED_LIST_SUCCESS)
             return getNodeResult;
 
-        linked_list_node_t* previousNode = NULL;
+        linked_list_node_t* node = lastNode->next;
 
-        for (linked_list_node_t* node = startingNode->next; node != NULL; node = node->next) {
-            if (previousNode != NULL) {
-                linked_list_result_t nodeFreeResult = linked_list_node_free(&node);
+        while (node != NULL) {
+            linked_list_node_t* nextNode = node->next;
+            linked_list_result_t nodeFreeResult = linked_list_node_free(&linkedList->allocator, &node);
 
-                if (nodeFreeResult != LINKED_LIST_SUCCESS)
-                    return nodeFreeResult;
-            }
+            if (nodeFreeResult != LINKED_LIST_SUCCESS)
+                return nodeFreeResult;
 
-            previousNode = node;
+            node = nextNode;
         }
 
-        startingNode->next = NULL;
+        lastNode->next = NULL;
+        linkedList->tail = lastNode;
+        linkedList->size = (int64_t) size;
+        linked_list_index_invalidate(linkedList);
+        linked_list_cursor_reset(&linkedList->finger);
     }
 
-    linkedList->size = size;
     return LINKED_LIST_SUCCESS; 
 }
 
@@ -1138,6 +2087,8 @@ linked_list_result_t linked_list_reverse(linked_list_t* const linkedList) {
 
     linkedList->tail = linkedList->head;
     linkedList->head = previousNode;
+    linked_list_index_invalidate(linkedList);
+    linked_list_cursor_reset(&linkedList->finger);
 
     return LINKED_LIST_SUCCESS;
 }
@@ -1147,8 +2098,13 @@ linked_list_result_t linked_list_includes(linked_list_t* const linkedList, void*
     if (linkedList == NULL)
         return LINKED_LIST_NULL_ERROR;
 
+    int64_t indexedIndex;
+
+    if (linked_list_index_find(linkedList, value, size, 0, false, &indexedIndex))
+        return indexedIndex != -1 ? LINKED_LIST_SUCCESS : LINKED_LIST_ELEMENT_NOT_FOUND_ERROR;
+
     for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next) {
-        if (linkedList->equalityFunction(node->element->value, value, size) == 0) {
+        if (node->element->size == size && linkedList->equalityFunction(node->element->value, value, size) == 0) {
             return LINKED_LIST_SUCCESS;
         }
     }
@@ -1169,6 +2125,9 @@ linked_list_result_t linked_list_find_first(
     else if (startFromIndex >= linkedList->size || startFromIndex < 0) 
         return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
 
+    if (linked_list_index_find(linkedList, value, size, startFromIndex, false, indexOut))
+        return *indexOut != -1 ? LINKED_LIST_SUCCESS : LINKED_LIST_ELEMENT_NOT_FOUND_ERROR;
+
     int64_t index = 0;
 
     for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next) {
@@ -1177,7 +2136,7 @@ linked_list_result_t linked_list_find_first(
             continue;
         }
 
-        if (linkedList->equalityFunction(node->element->value, value, size) == 0) {
+        if (node->element->size == size && linkedList->equalityFunction(node->element->value, value, size) == 0) {
             *indexOut = index;
             return LINKED_LIST_SUCCESS;
         }
@@ -1201,6 +2160,9 @@ linked_list_result_t linked_list_find_last(
     else if (startFromIndex >= linkedList->size || startFromIndex < 0) 
         return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
 
+    if (linked_list_index_find(linkedList, value, size, startFromIndex, true, indexOut))
+        return *indexOut != -1 ? LINKED_LIST_SUCCESS : LINKED_LIST_ELEMENT_NOT_FOUND_ERROR;
+
     int64_t lastFoundIndex = -1;
     int64_t index = 0;
 
@@ -1210,7 +2172,7 @@ linked_list_result_t linked_list_find_last(
             continue;
         }
 
-        if (linkedList->equalityFunction(node->element->value, value, size) == 0) 
+        if (node->element->size == size && linkedList->equalityFunction(node->element->value, value, size) == 0) 
             lastFoundIndex = index;
 
         index++;
@@ -1221,14 +2183,144 @@ linked_list_result_t linked_list_find_last(
 }
 
 
+linked_list_result_t linked_list_index_attach(linked_list_t* const linkedList, linked_list_custom_hash_function_t* const hashFunction) {
+    if (linkedList == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (hashFunction == NULL)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
+
+    confetti_hash_index_t* index;
+
+    if (!confetti_hash_index_create(&linkedList->allocator, (uint64_t) linkedList->size, &index))
+        return LINKED_LIST_ALLOCATION_FAILURE;
+
+    confetti_hash_index_free(&linkedList->allocator, &linkedList->index);
+
+    linkedList->hashFunction = hashFunction;
+    linkedList->index = index;
+
+    if (!linked_list_index_rebuild(linkedList)) {
+        linked_list_index_detach(linkedList);
+        return LINKED_LIST_ALLOCATION_FAILURE;
+    }
+
+    return LINKED_LIST_SUCCESS;
+}
+
+
+linked_list_result_t linked_list_index_detach(linked_list_t* const linkedList) {
+    if (linkedList == NULL)
+        return LINKED_LIST_NULL_ERROR;
+
+    confetti_hash_index_free(&linkedList->allocator, &linkedList->index);
+    linkedList->hashFunction = NULL;
+
+    return LINKED_LIST_SUCCESS;
+}
+
+
 linked_list_result_t linked_list_sort(linked_list_t* const linkedList, const bool ascending) {
     if (linkedList == NULL) 
         return LINKED_LIST_NULL_ERROR;
     
     if (linkedList->size == 0 || linkedList->size == 1) 
         return LINKED_LIST_SUCCESS;
-     
-    return linkedList->sortingFunction(linkedList, ascending);
+
+    linked_list_index_invalidate(linkedList);
+    linked_list_cursor_reset(&linkedList->finger);
+
+    linked_list_result_t sortResult = linkedList->sortingFunction(linkedList, ascending);
+
+    linked_list_cursor_reset(&linkedList->finger);
+    return sortResult;
+}
+
+
+linked_list_result_t linked_list_sort_parallel(
+    linked_list_t* const linkedList, 
+    const bool ascending, 
+    const uint64_t threadCount, 
+    const confetti_executor_t* const executor
+) {
+    if (linkedList == NULL) 
+        return LINKED_LIST_NULL_ERROR;
+    else if (linkedList->sortingFunction != (linked_list_custom_sorting_function_t*) &default_sort)
+        return linked_list_sort(linkedList, ascending); // a custom sorting function decides the order, it's run on the calling thread.
+    
+    if (linkedList->size == 0 || linkedList->size == 1) 
+        return LINKED_LIST_SUCCESS;
+
+    const int64_t size = linkedList->size;
+    const uint64_t threads = threadCount == 0 ? confetti_executor_default_thread_count() : threadCount;
+    int64_t sublistCount = size / LINKED_LIST_PARALLEL_SORT_THRESHOLD;
+
+    if ((uint64_t) sublistCount > threads)
+        sublistCount = (int64_t) threads;
+
+    linked_list_index_invalidate(linkedList);
+    linked_list_cursor_reset(&linkedList->finger);
+
+    // too small to be worth handing to other threads.
+    if (sublistCount < 2) {
+        linkedList->head = merge_sort(linkedList->head, ascending, linkedList->equalityFunction, &linkedList->tail);
+        linked_list_cursor_reset(&linkedList->finger);
+
+        return LINKED_LIST_SUCCESS;
+    }
+
+    const uint64_t sublistsSize = sizeof(linked_list_node_t*) * (uint64_t) sublistCount;
+
+    linked_list_node_t** heads = (linked_list_node_t**) linkedList->allocator.allocate(linkedList->allocator.context, sublistsSize);
+    linked_list_node_t** tails = (linked_list_node_t**) linkedList->allocator.allocate(linkedList->allocator.context, sublistsSize);
+
+    if (heads == NULL || tails == NULL) {
+        linkedList->allocator.deallocate(linkedList->allocator.context, heads, sublistsSize);
+        linkedList->allocator.deallocate(linkedList->allocator.context, tails, sublistsSize);
+
+        return LINKED_LIST_ALLOCATION_FAILURE;
+    }
+
+    linked_list_node_t* node = linkedList->head;
+
+    // cut the chain into sublists of nearly equal length.
+    for (int64_t i = 0; i < sublistCount; i++) {
+        const int64_t length = size / sublistCount + (i < size % sublistCount ? 1 : 0);
+
+        heads[i] = node;
+
+        for (int64_t j = 1; j < length; j++)
+            node = node->next;
+
+        tails[i] = node;
+        node = node->next;
+        tails[i]->next = NULL;
+    }
+
+    linked_list_parallel_sort_t sort = { heads, tails, ascending, linkedList->equalityFunction };
+
+    confetti_executor_run(executor, threads, &linked_list_parallel_sort_sublist, &sort, (uint64_t) sublistCount);
+
+    while (sublistCount > 1) {
+        confetti_executor_run(executor, threads, &linked_list_parallel_merge_pair, &sort, (uint64_t) (sublistCount / 2));
+
+        const int64_t mergedCount = (sublistCount + 1) / 2;
+
+        for (int64_t i = 0; i < mergedCount; i++) {
+            heads[i] = heads[i * 2];
+            tails[i] = tails[i * 2];
+        }
+
+        sublistCount = mergedCount;
+    }
+
+    linkedList->head = heads[0];
+    linkedList->tail = tails[0];
+    linked_list_cursor_reset(&linkedList->finger);
+
+    linkedList->allocator.deallocate(linkedList->allocator.context, heads, sublistsSize);
+    linkedList->allocator.deallocate(linkedList->allocator.context, tails, sublistsSize);
+
+    return LINKED_LIST_SUCCESS;
 }
 
 
@@ -1242,22 +2334,23 @@ linked_list_result_t linked_list_swap(linked_list_t* const linkedList, const int
 
     if (index1 == index2) 
         return LINKED_LIST_SUCCESS;
-    
-    linked_list_node_t* node1Previous = NULL; 
-    linked_list_node_t* node1 = linkedList->head;
 
-    for (int i = 0; i < index1; i++) {
-        node1Previous = node1;
-        node1 = node1->next;
-    }
+    const int64_t lowIndex = index1 < index2 ? index1 : index2;
+    const int64_t highIndex = index1 < index2 ? index2 : index1;
 
-    linked_list_node_t* node2Previous = NULL;
-    linked_list_node_t* node2 = linkedList->head;
+    // both nodes are found in a single walk, the second continuing from the first.
+    linked_list_cursor_t* const finger = &linkedList->finger;
 
-    for (int i = 0; i < index2; i++) {
-        node2Previous = node2;
-        node2 = node2->next;
-    }
+    linked_list_cursor_walk(finger, lowIndex);
+    linked_list_node_t* node1Previous = finger->previous; 
+    linked_list_node_t* node1 = finger->node;
+
+    linked_list_cursor_walk(finger, highIndex);
+    linked_list_node_t* node2Previous = finger->previous;
+    linked_list_node_t* node2 = finger->node;
+
+    linked_list_index_erase_at(linkedList, node1, lowIndex);
+    linked_list_index_erase_at(linkedList, node2, highIndex);
 
     if (node1Previous != NULL)
         node1Previous->next = node2;
@@ -1278,35 +2371,197 @@ linked_list_result_t linked_list_swap(linked_list_t* const linkedList, const int
         linkedList->tail = node2;
     else if (node2 == linkedList->tail)
         linkedList->tail = node1;
+
+    linked_list_index_insert_at(linkedList, node2, lowIndex);
+    linked_list_index_insert_at(linkedList, node1, highIndex);
+    linked_list_cursor_reset(finger);
     
     return LINKED_LIST_SUCCESS;
 }
 
 
-linked_list_result_t linked_list_element_free(linked_list_element_t** element) {
-    if (*element == NULL)
+linked_list_result_t linked_list_save(linked_list_t* const linkedList, const char* const path) {
+    if (linkedList == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (path == NULL)
         return LINKED_LIST_INVALID_PARAMS_ERROR;
 
-    free((*element)->value);
-    (*element)->size = 0;
-    (*element)->value = NULL;
+    const confetti_allocator_t* const allocator = confetti_allocator_default();
+    const uint64_t count = (uint64_t) linkedList->size;
+    confetti_file_header_t header = { CONFETTI_FILE_MAGIC, CONFETTI_FILE_VERSION, count, 0, 0 };
+    confetti_file_entry_t* entries = NULL;
 
-    free(*element);
-    (*element) = NULL;
+    if (count > 0) {
+        entries = (confetti_file_entry_t*) allocator->allocate(allocator->context, sizeof(confetti_file_entry_t) * count);
+
+        if (entries == NULL)
+            return LINKED_LIST_ALLOCATION_FAILURE;
+    }
+
+    uint64_t i = 0;
+
+    for (linked_list_node_t* node = linkedList->head; node != NULL; node = node->next, i++) {
+        entries[i].offset = node->element->value == NULL ? CONFETTI_FILE_NO_VALUE : header.payloadSize;
+        entries[i].size = node->element->size;
+
+        if (node->element->value != NULL)
+            header.payloadSize += node->element->size;
+    }
+
+    FILE* const file = fopen(path, "wb");
+
+    if (file == NULL) {
+        allocator->deallocate(allocator->context, entries, sizeof(confetti_file_entry_t) * count);
+        return LINKED_LIST_FILE_ERROR;
+    }
+
+    setvbuf(file, NULL, _IOFBF, CONFETTI_FILE_BUFFER_SIZE);
+
+    bool written = fwrite(&header, sizeof(confetti_file_header_t), 1, file) == 1;
+
+    if (count > 0)
+        written = written && fwrite(entries, sizeof(confetti_file_entry_t), (size_t) count, file) == (size_t) count;
+
+    for (linked_list_node_t* node = linkedList->head; written && node != NULL; node = node->next) {
+        if (node->element->value != NULL)
+            written = fwrite(node->element->value, 1, (size_t) node->element->size, file) == (size_t) node->element->size;
+    }
+
+    // the file is closed even if a write failed, closing flushes the buffer so it can fail too.
+    written = fclose(file) == 0 && written;
+    allocator->deallocate(allocator->context, entries, sizeof(confetti_file_entry_t) * count);
+
+    return written ? LINKED_LIST_SUCCESS : LINKED_LIST_FILE_ERROR;
+}
+
+
+linked_list_result_t linked_list_load(
+    linked_list_t** linkedListOut, 
+    const char* const path, 
+    const linked_list_options_t* const options
+) {
+    if (linkedListOut == NULL || path == NULL)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
+
+    FILE* const file = fopen(path, "rb");
+
+    if (file == NULL)
+        return LINKED_LIST_FILE_ERROR;
+
+    setvbuf(file, NULL, _IOFBF, CONFETTI_FILE_BUFFER_SIZE);
+
+    confetti_file_header_t header;
+
+    if (
+        fread(&header, sizeof(confetti_file_header_t), 1, file) != 1 
+        || !confetti_file_header_check(&header) 
+        || !confetti_file_body_fits(file, &header)
+    ) {
+        fclose(file);
+        return LINKED_LIST_FILE_ERROR;
+    }
+
+    // the table and the values are read at once, then every node is created from the buffer.
+    const confetti_allocator_t* const allocator = confetti_allocator_default();
+    const uint64_t bodySize = confetti_file_body_size(&header);
+    uint8_t* const body = bodySize == 0 ? NULL : (uint8_t*) allocator->allocate(allocator->context, bodySize);
+
+    if (bodySize != 0 && body == NULL) {
+        fclose(file);
+        return LINKED_LIST_ALLOCATION_FAILURE;
+    }
+
+    const bool read = bodySize == 0 || fread(body, 1, (size_t) bodySize, file) == (size_t) bodySize;
+    const confetti_file_entry_t* const entries = (const confetti_file_entry_t*) body;
+    const uint8_t* const payload = header.stride == 0 ? body + sizeof(confetti_file_entry_t) * header.count : body;
+
+    fclose(file);
+
+    if (!read || (header.stride == 0 && !confetti_file_entries_check(entries, header.count, header.payloadSize))) {
+        allocator->deallocate(allocator->context, body, bodySize);
+        return LINKED_LIST_FILE_ERROR;
+    }
+
+    linked_list_options_t settings = { NULL, NULL, NULL, NULL, LINKED_LIST_FLAG_NONE, NULL };
+
+    if (options != NULL)
+        settings = *options;
+
+    linked_list_t* linkedList = NULL;
+    linked_list_result_t result = linked_list_create_with_options(&linkedList, &settings);
+
+    linked_list_node_t* chainHead = NULL;
+    linked_list_node_t* chainTail = NULL;
+
+    for (uint64_t i = 0; result == LINKED_LIST_SUCCESS && i < header.count; i++) {
+        const void* value = payload + header.stride * i;
+        uint64_t size = header.stride;
+
+        if (header.stride == 0) {
+            value = entries[i].offset == CONFETTI_FILE_NO_VALUE ? NULL : payload + entries[i].offset;
+            size = entries[i].size;
+        }
+
+        linked_list_node_t* node = NULL;
+        result = linked_list_node_create(&linkedList->allocator, &node, value, size, NULL);
+
+        if (result != LINKED_LIST_SUCCESS)
+            break;
+
+        if (chainHead == NULL)
+            chainHead = node;
+        else
+            chainTail->next = node;
+
+        chainTail = node;
+    }
+
+    allocator->deallocate(allocator->context, body, bodySize);
 
+    if (result != LINKED_LIST_SUCCESS) {
+        while (chainHead != NULL) {
+            linked_list_node_t* nextNode = chainHead->next;
+
+            linked_list_node_free(&linkedList->allocator, &chainHead);
+            chainHead = nextNode;
+        }
+
+        if (linkedList != NULL)
+            linked_list_free(&linkedList);
+
+        return result;
+    }
+
+    linkedList->head = chainHead;
+    linkedList->tail = chainTail;
+    linkedList->size = (int64_t) header.count;
+    linked_list_cursor_reset(&linkedList->finger);
+
+    int64_t index = 0;
+
+    for (linked_list_node_t* node = chainHead; node != NULL; node = node->next)
+        linked_list_index_insert_at(linkedList, node, index++);
+
+    *linkedListOut = linkedList;
     return LINKED_LIST_SUCCESS;
 }
 
 
+linked_list_result_t linked_list_element_free(linked_list_element_t** element) {
+    return linked_list_element_release(confetti_allocator_default(), element);
+}
+
+
 linked_list_result_t linked_list_iterator_create(linked_list_iterator_t** iteratorOut, linked_list_t* const list) {
     if (list == NULL)
         return LINKED_LIST_NULL_ERROR;
 
     linked_list_iterator_t* iterator = (linked_list_iterator_t*) malloc(sizeof(linked_list_iterator_t));
 
-    iterator->list = list;
-    iterator->node = NULL;
-    iterator->index = -1;
+    if (iterator == NULL)
+        return LINKED_LIST_ALLOCATION_FAILURE;
+
+    linked_list_iterator_init(iterator, list);
 
     *iteratorOut = iterator;
     return LINKED_LIST_SUCCESS;
@@ -1317,20 +2572,8 @@ linked_list_result_t linked_list_iterator_next(linked_list_iterator_t* const ite
     if (iterator == NULL)
         return LINKED_LIST_INVALID_PARAMS_ERROR;
 
-    if (iterator->node == NULL) {
-        iterator->node = iterator->list->head;
-        iterator->index = 0;
-    } 
-    else if (iterator->node->next == NULL) {
-        iterator->node = NULL;
-        iterator->index = -1;
-
+    if (!linked_list_iterator_step(iterator))
         return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
-    }
-    else {
-        iterator->node = iterator->node->next;
-        iterator->index++;
-    }
 
     return LINKED_LIST_SUCCESS;
 }
@@ -1360,4 +2603,144 @@ linked_list_result_t linked_list_iterator_free(linked_list_iterator_t** iterator
     return LINKED_LIST_SUCCESS;
 }
 
+
+linked_list_result_t linked_list_iterator_init(linked_list_iterator_t* const iterator, linked_list_t* const list) {
+    if (iterator == NULL)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
+
+    iterator->list = list;
+    iterator->node = NULL;
+    iterator->index = -1;
+
+    if (list == NULL)
+        return LINKED_LIST_NULL_ERROR;
+
+    return LINKED_LIST_SUCCESS;
+}
+
+
+linked_list_result_t linked_list_cursor_create(linked_list_cursor_t** cursorOut, linked_list_t* const linkedList) {
+    if (linkedList == NULL)
+        return LINKED_LIST_NULL_ERROR;
+
+    const confetti_allocator_t* const allocator = confetti_allocator_default();
+    linked_list_cursor_t* cursor = (linked_list_cursor_t*) allocator->allocate(allocator->context, sizeof(linked_list_cursor_t));
+
+    if (cursor == NULL)
+        return LINKED_LIST_ALLOCATION_FAILURE;
+
+    cursor->list = linkedList;
+    linked_list_cursor_reset(cursor);
+
+    *cursorOut = cursor;
+    return LINKED_LIST_SUCCESS;
+}
+
+
+linked_list_result_t linked_list_cursor_seek(linked_list_cursor_t* const cursor, const int64_t index) {
+    if (cursor == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (index > cursor->list->size || index < 0)
+        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    // seeking to the head also recovers cursors invalidated by changes made without them.
+    if (index == 0)
+        linked_list_cursor_reset(cursor);
+    else
+        linked_list_cursor_walk(cursor, index);
+
+    return LINKED_LIST_SUCCESS;
+}
+
+
+linked_list_result_t linked_list_cursor_next(linked_list_cursor_t* const cursor) {
+    if (cursor == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (cursor->node == NULL)
+        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    cursor->previous = cursor->node;
+    cursor->node = cursor->node->next;
+    cursor->index++;
+
+    return LINKED_LIST_SUCCESS;
+}
+
+
+linked_list_result_t linked_list_cursor_peek(linked_list_cursor_t* const cursor, const void** valueOut, uint64_t* const sizeOut) {
+    if (cursor == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (cursor->node == NULL)
+        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    *valueOut = cursor->node->element->value;
+
+    if (sizeOut != NULL)
+        *sizeOut = cursor->node->element->size;
+
+    return LINKED_LIST_SUCCESS;
+}
+
+
+linked_list_result_t linked_list_cursor_set(linked_list_cursor_t* const cursor, void* const value, const uint64_t size) {
+    if (cursor == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (cursor->node == NULL)
+        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    return linked_list_node_set(cursor->list, cursor->node, cursor->index, value, size);
+}
+
+
+linked_list_result_t linked_list_cursor_insert(linked_list_cursor_t* const cursor, void* const value, const uint64_t size) {
+    if (cursor == NULL)
+        return LINKED_LIST_NULL_ERROR;
+
+    linked_list_t* const linkedList = cursor->list;
+    linked_list_node_t* node = NULL;
+    linked_list_result_t nodeCreateResult = linked_list_node_store(linkedList, &node, value, size, NULL);
+
+    if (nodeCreateResult != LINKED_LIST_SUCCESS)
+        return nodeCreateResult;
+
+    linked_list_cursor_link(cursor, node);
+    linked_list_index_added(linkedList, node, cursor->index);
+
+    if (cursor != &linkedList->finger)
+        linked_list_cursor_reset(&linkedList->finger);
+
+    return LINKED_LIST_SUCCESS;
+}
+
+
+linked_list_result_t linked_list_cursor_remove(linked_list_cursor_t* const cursor) {
+    if (cursor == NULL)
+        return LINKED_LIST_NULL_ERROR;
+    else if (cursor->node == NULL)
+        return LINKED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    linked_list_t* const linkedList = cursor->list;
+
+    linked_list_index_removing(linkedList, cursor->index);
+    linked_list_node_t* node = linked_list_cursor_unlink(cursor);
+
+    if (cursor != &linkedList->finger)
+        linked_list_cursor_reset(&linkedList->finger);
+
+    return linked_list_node_free(&linkedList->allocator, &node);
+}
+
+
+linked_list_result_t linked_list_cursor_free(linked_list_cursor_t** cursor) {
+    if (cursor == NULL || *cursor == NULL)
+        return LINKED_LIST_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const allocator = confetti_allocator_default();
+
+    allocator->deallocate(allocator->context, *cursor, sizeof(linked_list_cursor_t));
+    *cursor = NULL;
+
+    return LINKED_LIST_SUCCESS;
+}
+
 #pragma endregion
@@ -17,6 +17,77 @@ If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "list.h"
+#include "confetti_hash_index.h"
+#include "confetti_search.h"
+#include "confetti_atomic.h"
+#include "confetti_file.h"
+
+// constant definitions
+
+#define LIST_INSERTION_SORT_THRESHOLD ((int64_t) 16) // Portions of at most this many elements are sorted with insertion sort.
+#define LIST_NINTHER_THRESHOLD ((int64_t) 128)       // Portions larger than this pick their pivot with a median of medians.
+#define LIST_SORT_STACK_SIZE 64                      // Deferred portions never exceed log2 of the list size.
+#define LIST_MIN_RUN_THRESHOLD ((int64_t) 64)        // Stable sort runs are extended to between half of and this many elements.
+#define LIST_RADIX_BITS 8                            // The amount of key bits sorted by every radix sort pass.
+#define LIST_RADIX_BUCKETS (1 << LIST_RADIX_BITS)    // The amount of buckets of every radix sort pass.
+#define LIST_RADIX_PASSES (64 / LIST_RADIX_BITS)     // The amount of radix sort passes covering a 64 bit key.
+#define LIST_PARALLEL_SORT_THRESHOLD ((int64_t) 4096) // The parallel sort never cuts the list into runs smaller than this.
+
+// private struct definitions
+
+/**
+ * @brief The layout of the allocation backing every element of a pointer list.
+ *
+ * The element comes first, so a pointer to the element is a pointer to the whole block.
+ */
+typedef struct list_element_block {
+    list_element_t element;       /* The element itself. */
+    volatile uint64_t references; /* Amount of lists holding the element, shallow clones share elements. */
+    list_value_destructor_t* destructor; /* Releases a stored pointer value, NULL if the element owns a copy of its value. */
+} list_element_block_t;
+
+/**
+ * @brief Pairs the sort key of an element with its index for `list_sort_by_key`.
+ */
+typedef struct list_key_entry {
+    uint64_t key;  /* The key extracted from the element. */
+    int64_t index; /* The index of the element before sorting. */
+} list_key_entry_t;
+
+/**
+ * @brief Shares the state of a `list_sort_parallel` call with its tasks.
+ */
+typedef struct list_parallel_sort {
+    list_t* list;         /* The list being sorted. */
+    bool ascending;       /* The sort order. */
+    uint64_t slotSize;    /* Size in bytes of every slot. */
+    int64_t* bounds;      /* Index of the first element of every sorted run, followed by the size of the list. */
+    int64_t runCount;     /* Amount of sorted runs left. */
+    uint8_t* source;      /* Slots the current level merges from. */
+    uint8_t* destination; /* Slots the current level merges into. */
+    int64_t pieceSize;    /* Amount of merged elements written by every merge task. */
+} list_parallel_sort_t;
+
+/**
+ * @brief Shares the state of a parallel pass over the elements of a list with its tasks.
+ *
+ * Only the fields used by the operation running the pass are set.
+ */
+typedef struct list_parallel_scan {
+    list_t* list;                         /* The list being passed over. */
+    int64_t startIndex;                   /* Index of the first element of the pass. */
+    int64_t chunkSize;                    /* Amount of elements handled by every task. */
+    void* context;                        /* The user context handed to every callback. */
+    list_for_each_function_t* forEach;    /* Function of `list_for_each_parallel`. */
+    list_reduce_function_t* reduce;       /* Folding function of `list_reduce`. */
+    list_predicate_function_t* predicate; /* Predicate of `list_filter_into`. */
+    uint8_t* results;                     /* Accumulator of every chunk, or whether every element is kept. */
+    uint64_t resultSize;                  /* Size in bytes of every accumulator. */
+    const void* value;                    /* Value searched for by `list_find_first_parallel`. */
+    uint64_t size;                        /* Size of the value searched for. */
+    bool vectorizable;                    /* Whether the search can use the vectorized search kernels. */
+    volatile uint64_t found;              /* Earliest match found so far, or the size of the list. */
+} list_parallel_scan_t;
 
 // private function definitions
 
@@ -30,6 +101,7 @@ If not, see <https://www.gnu.org/licenses/>.
  * is NULL, the element's value is set to NULL, and its size is set to
  * the specified value size.
  *
+ * @param allocator A pointer to the allocator the element is allocated with.
  * @param value A pointer to the value to be assigned to the new element.
  * @param size The size of value.
  * @param elementOut A double pointer to where the element will be stored.
@@ -39,7 +111,38 @@ If not, see <https://www.gnu.org/licenses/>.
  * 
  * - `LIST_ALLOCATION_FAILURE` if memory allocation fails during the process.
  */
-static list_result_t list_element_create(const void* const value, const uint64_t size, list_element_t** elementOut);
+static list_result_t list_element_create(
+    const confetti_allocator_t* const allocator, 
+    const void* const value, 
+    const uint64_t size, 
+    list_element_t** elementOut
+);
+
+/**
+ * @brief Creates a new element for a value added to a list.
+ *
+ * Lists created with `LIST_FLAG_STORE_POINTERS` keep the value pointer as it is,
+ * every other list copies the value with `list_element_create`.
+ *
+ * @param list A pointer to the list the element is created for.
+ * @param value A pointer to the value of the new element.
+ * @param size The size of value.
+ * @param elementOut A double pointer to where the element will be stored.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the element was created successfully.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if memory allocation fails during the process.
+ */
+static list_result_t list_element_store(list_t* const list, void* const value, const uint64_t size, list_element_t** elementOut);
+
+/**
+ * @brief Destructor of stored pointers of lists created without one, it leaves the value alone.
+ *
+ * @param value The stored pointer.
+ * @param size The size of the value.
+ */
+static void list_keep_value(void* const value, const uint64_t size);
 
 /**
  * @brief Sets the value of an existing list element.
@@ -48,6 +151,7 @@ static list_result_t list_element_create(const void* const value, const uint64_t
  * with a new value. If the size of the new value differs from the current
  * size of the element, it reallocates memory for the element's value.
  *
+ * @param allocator A pointer to the allocator the element was allocated with.
  * @param element A pointer to the list element whose value is to be set.
  * @param value A pointer to the new value to be assigned to the element.
  * @param size The size of value.
@@ -57,7 +161,12 @@ static list_result_t list_element_create(const void* const value, const uint64_t
  * 
  * - `LIST_ALLOCATION_FAILURE` if memory allocation fails during the process.
  */
-static list_result_t list_element_set(list_element_t* const element, const void* const value, const uint64_t size);
+static list_result_t list_element_set(
+    const confetti_allocator_t* const allocator, 
+    list_element_t* const element, 
+    const void* const value, 
+    const uint64_t size
+);
 
 /**
  * @brief Clones an existing list element.
@@ -66,6 +175,7 @@ static list_result_t list_element_set(list_element_t* const element, const void*
  * the specified existing element. It allocates memory for the new element
  * and copies the value from the original element.
  *
+ * @param allocator A pointer to the allocator the clone is allocated with.
  * @param element A pointer to the list element to be cloned.
  * @param elementOut A double pointer to where the cloned element will be stored.
  * 
@@ -74,7 +184,52 @@ static list_result_t list_element_set(list_element_t* const element, const void*
  * 
  * - `LIST_ALLOCATION_FAILURE` if memory allocation fails during the process.
  */
-static list_result_t list_element_clone(list_element_t* const element, list_element_t** elementOut);
+static list_result_t list_element_clone(
+    const confetti_allocator_t* const allocator, 
+    list_element_t* const element, 
+    list_element_t** elementOut
+);
+
+/**
+ * @brief Returns whether a list element is held by more than one list.
+ *
+ * @param element A pointer to the list element.
+ * 
+ * @return `true` if the element is shared with a shallow clone and must not be modified.
+ */
+static bool list_element_is_shared(const list_element_t* const element);
+
+/**
+ * @brief Gives every element of the list shared with a shallow clone a copy of its own.
+ *
+ * Stored pointers are left shared, the list doesn't own what they point to.
+ *
+ * @param list A pointer to the list.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` once no owned value of the list is shared. 
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if the system couldn't allocate enough memory for the operation, 
+ *   the elements copied so far keep their copies.
+ */
+static list_result_t list_elements_unshare(list_t* const list);
+
+/**
+ * @brief Frees a list element allocated with a specific allocator.
+ *
+ * Elements shared with other lists only lose a reference, the last reference frees them.
+ *
+ * @param allocator A pointer to the allocator the element was allocated with.
+ * @param element A double pointer to the element to be freed.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the element was successfully freed. 
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the provided element pointer is NULL.
+ * 
+ * @note Sets the element pointer to NULL after freeing.
+ */
+static list_result_t list_element_release(const confetti_allocator_t* const allocator, list_element_t** element);
 
 /**
  * @brief Reallocates the capacity of the list to a new size.
@@ -98,6 +253,392 @@ static list_result_t list_element_clone(list_element_t* const element, list_elem
  */
 static list_result_t list_realloc_capacity(list_t* const list, const int64_t capacity);
 
+/**
+ * @brief Grows the capacity of the list until it can hold the given amount of elements.
+ * 
+ * The capacity grows by the list's growth policy as many times as needed so only 
+ * a single reallocation takes place. Lists that are already large enough are left untouched.
+ *
+ * @param list A pointer to the list whose capacity may grow.
+ * @param capacity The minimum capacity the list must have.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list can hold the given amount of elements. 
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if memory allocation fails during the process.
+ */
+static list_result_t list_ensure_capacity(list_t* const list, const int64_t capacity);
+
+/**
+ * @brief Returns the capacity the growth policy of a list reaches from a capacity.
+ * 
+ * @param list A pointer to the list whose growth policy is used.
+ * @param capacity The capacity to grow from, at least 1.
+ * @param minimum The least capacity that must be reached.
+ * 
+ * @return The grown capacity, at least `minimum`.
+ */
+static int64_t list_grown_capacity(const list_t* const list, int64_t capacity, const int64_t minimum);
+
+/**
+ * @brief Shrinks the list when its growth policy says it has too much unused room.
+ * 
+ * A failed reallocation leaves the list as it was.
+ *
+ * @param list A pointer to the list which may shrink.
+ */
+static void list_auto_shrink(list_t* const list);
+
+/**
+ * @brief Returns whether two allocators hand out and release memory the same way.
+ *
+ * @param allocator1 A pointer to the first allocator.
+ * @param allocator2 A pointer to the second allocator.
+ * 
+ * @return `true` if memory allocated by either allocator may be freed by the other.
+ */
+static bool list_allocator_matches(const confetti_allocator_t* const allocator1, const confetti_allocator_t* const allocator2);
+
+/**
+ * @brief Returns the size of a single storage slot of the list.
+ *
+ * @param list A pointer to the list.
+ * 
+ * @return The stride for fixed stride lists, the size of an element pointer otherwise.
+ */
+static uint64_t list_slot_size(const list_t* const list);
+
+/**
+ * @brief Returns a pointer to the slot holding the first element of the list.
+ *
+ * @param list A pointer to the list.
+ * 
+ * @return The start of `data` for fixed stride lists, the start of `items` otherwise.
+ */
+static uint8_t* list_slots(const list_t* const list);
+
+/**
+ * @brief Points the list's storage at a new first slot.
+ *
+ * @param list A pointer to the list.
+ * @param slots A pointer to the slot that will hold the first element.
+ */
+static void list_set_slots(list_t* const list, uint8_t* const slots);
+
+/**
+ * @brief Moves the elements of the list back to the start of its allocation.
+ * 
+ * Any room reserved in front of the first element is handed to the back of the list.
+ *
+ * @param list A pointer to the list to compact.
+ */
+static void list_compact(list_t* const list);
+
+/**
+ * @brief Returns a pointer to the start of the list's slot allocation, in front of any reserved room.
+ *
+ * @param list A pointer to the list.
+ * 
+ * @return The start of the slot allocation.
+ */
+static uint8_t* list_slot_base(const list_t* const list);
+
+/**
+ * @brief Returns whether the slots of the list live in the buffer embedded in the list.
+ *
+ * @param list A pointer to the list.
+ * 
+ * @return `true` if the slots are inline, `false` if they were requested from the allocator.
+ */
+static bool list_slots_inline(const list_t* const list);
+
+/**
+ * @brief Resizes the slot allocation of a compacted list.
+ * 
+ * Allocations which fit are kept in the buffer embedded in the list and larger ones 
+ * are requested from the allocator, the contents are moved between the two as needed.
+ *
+ * @param list A pointer to the list, whose first element must be at the start of its allocation.
+ * @param oldSize The size in bytes of the current slot allocation.
+ * @param newSize The size in bytes the slot allocation must have.
+ * 
+ * @return A pointer to the resized allocation, or NULL if the allocation failed, leaving the old one untouched.
+ */
+static uint8_t* list_slots_reallocate(list_t* const list, const uint64_t oldSize, const uint64_t newSize);
+
+/**
+ * @brief Sets up a list in place as described by a set of options.
+ * 
+ * The memory of the list itself is left to the caller.
+ *
+ * @param list A pointer to the list to set up.
+ * @param options A pointer to the options describing the list, or NULL to use the defaults.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the list was set up successfully. 
+ * 
+ * - `LIST_INVALID_PARAMS_ERROR` if the options are invalid.
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if memory allocation fails during the process.
+ */
+static list_result_t list_setup(list_t* const list, const list_options_t* const options);
+
+/**
+ * @brief Releases every element, the hash index and the slot allocation of a list.
+ * 
+ * The memory of the list itself is left to the caller.
+ *
+ * @param list A pointer to the list to release.
+ */
+static void list_release(list_t* const list);
+
+/**
+ * @brief Reserves room in front of the first element of the list.
+ * 
+ * As much room as there are elements is reserved, so prepending to a list 
+ * repeatedly costs amortized O(1).
+ *
+ * @param list A pointer to the list, which must not have room in front of it already.
+ * 
+ * @return 
+ * - `LIST_SUCCESS` if the room was reserved successfully. 
+ * 
+ * - `LIST_ALLOCATION_FAILURE` if memory allocation fails during the process.
+ */
+static list_result_t list_reserve_front(list_t* const list);
+
+/**
+ * @brief Opens a gap of one slot at an index of the list.
+ * 
+ * Whichever side of the index holds fewer elements is moved, using the room in 
+ * front of the list when shifting towards the front. The size is incremented and 
+ * the new slot is left for the caller to fill.
+ *
+ * @param list A pointer to the list, which must have room for one more element.
+ * @param index The index of the gap.
+ */
+static void list_open_gap(list_t* const list, const int64_t index);
+
+/**
+ * @brief Closes the slot at an index of the list after its element was released.
+ * 
+ * Whichever side of the index holds fewer elements is moved over the slot 
+ * and the size is decremented.
+ *
+ * @param list A pointer to the list.
+ * @param index The index of the slot to close.
+ */
+static void list_close_gap(list_t* const list, const int64_t index);
+
+/**
+ * @brief Builds the options describing an existing list.
+ *
+ * @param list A pointer to the list.
+ * @param capacity The capacity to put in the options.
+ * @param optionsOut A pointer to where the options will be stored.
+ */
+static void list_options_of(const list_t* const list, const int64_t capacity, list_options_t* const optionsOut);
+
+/**
+ * @brief Returns a pointer to the value stored at an index.
+ *
+ * @param list A pointer to the list.
+ * @param index The index of the value, assumed to be in range.
+ * 
+ * @return A pointer into `data` for fixed stride lists, the element's value otherwise.
+ */
+static void* list_value_at(const list_t* const list, const int64_t index);
+
+/**
+ * @brief Returns the size of the value stored at an index.
+ *
+ * @param list A pointer to the list.
+ * @param index The index of the value, assumed to be in range.
+ * 
+ * @return The stride for fixed stride lists, the element's size otherwise.
+ */
+static uint64_t list_value_size_at(const list_t* const list, const int64_t index);
+
+/**
+ * @brief Copies a value into a slot of a fixed stride list.
+ *
+ * @param list A pointer to the fixed stride list.
+ * @param index The index of the slot, assumed to be below the capacity.
+ * @param value A pointer to `stride` bytes to copy, or NULL to zero the slot.
+ */
+static void list_fixed_write(list_t* const list, const int64_t index, const void* const value);
+
+/**
+ * @brief Exchanges the contents of two memory blocks of the same size.
+ *
+ * @param block1 A pointer to the first block.
+ * @param block2 A pointer to the second block.
+ * @param size The size in bytes of both blocks.
+ */
+static void list_bytes_swap(uint8_t* block1, uint8_t* block2, uint64_t size);
+
+/**
+ * @brief Swaps two elements of the list without validating the indices.
+ *
+ * @param list A pointer to the list.
+ * @param index1 The index of the first element.
+ * @param index2 The index of the second element.
+ */
+static void list_swap_at(list_t* const list, const int64_t index1, const int64_t index2);
+
+/**
+ * @brief Marks the hash index of the list as stale, if it has one.
+ *
+ * @param list A pointer to the list.
+ */
+static void list_index_invalidate(list_t* const list);
+
+/**
+ * @brief Adds the element at an index to the hash index of the list.
+ *
+ * Does nothing if the list has no index or it is stale, and marks it as stale if growing it fails.
+ *
+ * @param list A pointer to the list.
+ * @param index The index of the element, assumed to be in range.
+ */
+static void list_index_insert_at(list_t* const list, const int64_t index);
+
+/**
+ * @brief Removes the element at an index from the hash index of the list.
+ *
+ * Does nothing if the list has no index or it is stale.
+ *
+ * @param list A pointer to the list.
+ * @param index The index of the element, assumed to be in range.
+ */
+static void list_index_erase_at(list_t* const list, const int64_t index);
+
+/**
+ * @brief Updates the hash index of the list after elements were added.
+ *
+ * Elements added at either end are indexed in O(1) each, anywhere else the entries after them 
+ * are shifted first, which visits every slot of the index.
+ *
+ * @param list A pointer to the list, whose size already includes the new elements.
+ * @param index The index the first element was added at.
+ * @param count The amount of consecutive elements added.
+ */
+static void list_index_added(list_t* const list, const int64_t index, const int64_t count);
+
+/**
+ * @brief Updates the hash index of the list before an element is removed.
+ *
+ * Elements removed from either end are dropped in O(1), anywhere else the entries after them 
+ * are shifted afterwards, which visits every slot of the index.
+ *
+ * @param list A pointer to the list, which still holds the element.
+ * @param index The index of the element about to be removed.
+ */
+static void list_index_removing(list_t* const list, const int64_t index);
+
+/**
+ * @brief Updates the hash index of the list before a range of elements is removed.
+ *
+ * Ranges removed from either end are dropped element by element, anywhere else the entries after 
+ * them are shifted afterwards, which visits every slot of the index.
+ *
+ * @param list A pointer to the list, which still holds the elements.
+ * @param index The index of the first element about to be removed.
+ * @param count The amount of consecutive elements about to be removed.
+ */
+static void list_index_removing_range(list_t* const list, const int64_t index, const int64_t count);
+
+/**
+ * @brief Rebuilds the hash index of the list from every element.
+ *
+ * @param list A pointer to a list with an index.
+ * 
+ * @return `true` if the index is up to date, `false` if growing it failed.
+ */
+static bool list_index_rebuild(list_t* const list);
+
+/**
+ * @brief Looks up a value through the hash index of the list.
+ *
+ * @param list A pointer to the list.
+ * @param value A pointer to the value to look for.
+ * @param size The size of the value.
+ * @param startIndex The lowest index a match may have.
+ * @param last Whether the last match is wanted instead of the first.
+ * @param indexOut A pointer to where the index of the match, or -1, will be stored.
+ * 
+ * @return `true` if the index was used, `false` if the list has to be searched without it.
+ */
+static bool list_index_find(
+    list_t* const list, 
+    const void* const value, 
+    const uint64_t size, 
+    const int64_t startIndex, 
+    const bool last, 
+    int64_t* const indexOut
+);
+
+/**
+ * @brief Returns whether a search of the list can use the vectorized search kernels.
+ *
+ * That is the case for fixed stride lists of a width the kernels handle which 
+ * compare their elements with `default_equals`.
+ *
+ * @param list A pointer to the list.
+ * @param value A pointer to the value searched for.
+ * @param size The size of the value.
+ * 
+ * @return `true` if the kernels give the same result as comparing every element.
+ */
+static bool list_search_vectorizable(const list_t* const list, const void* const value, const uint64_t size);
+
+/**
+ * @brief Keeps the sorted mark of the list only if the values of a range that was just written still fit in order.
+ *
+ * @param list A pointer to the list.
+ * @param index The index of the first value written.
+ * @param count The amount of values written.
+ */
+static void list_sorted_changed(list_t* const list, const int64_t index, const int64_t count);
+
+/**
+ * @brief Orders the value of the list at an index against another value using its equality function.
+ *
+ * @param list A pointer to the list.
+ * @param index The index of the list's value.
+ * @param value A pointer to the other value.
+ * @param size The size of the other value.
+ * 
+ * @return A negative value if the list's value is smaller, zero if they are equal, a positive value otherwise.
+ */
+static int32_t list_order_value(list_t* const list, const int64_t index, const void* const value, const uint64_t size);
+
+/**
+ * @brief Binary searches an ascending list for the first position a value may be inserted at, or the last one.
+ *
+ * @param list A pointer to the list.
+ * @param value A pointer to the value.
+ * @param size The size of the value.
+ * @param startIndex The lowest index the search considers.
+ * @param upper Whether the position after every equal value is wanted instead of the one before them.
+ * 
+ * @return The position, between `startIndex` and the size of the list.
+ */
+static int64_t list_bound(list_t* const list, const void* const value, const uint64_t size, const int64_t startIndex, const bool upper);
+
+/**
+ * @brief Looks up a value by binary searching an ascending list.
+ *
+ * @param list A pointer to the list.
+ * @param value A pointer to the value to look for.
+ * @param size The size of the value.
+ * @param startIndex The lowest index a match may have.
+ * @param last Whether the last match is wanted instead of the first.
+ * 
+ * @return The index of the match, or -1 if there is none.
+ */
+static int64_t list_sorted_find(list_t* const list, const void* const value, const uint64_t size, const int64_t startIndex, const bool last);
+
 /**
  * @brief Compares two data elements for equality.
  *
@@ -122,49 +663,243 @@ static list_result_t list_realloc_capacity(list_t* const list, const int64_t cap
 static int32_t default_equals(const void* const data1, const void* const data2, const uint64_t size);
 
 /**
- * @brief Partitions the list for the Median of Three Pivot Quicksort algorithm and returns the pivot.
- *
- * This function partitions the specified portion of the list around a pivot element. 
- * It rearranges the elements in such a way that all elements less than or equal to the pivot 
- * are on one side, and all elements greater than the pivot are on the other side. 
- * The pivot is chosen based on the specified order.
+ * @brief Compares two elements of the list in the requested sorting order.
  *
- * @param list A pointer to the list to be partitioned.
- * @param low The starting index of the portion of the list to be partitioned.
- * @param high The ending index of the portion of the list to be partitioned.
+ * @param list A pointer to the list.
+ * @param index1 The index of the first element.
+ * @param index2 The index of the second element.
  * @param ascending A boolean value indicating the sort order.
  * 
- * @return The index of the pivot element after partitioning.
- * 
- * @note This function assumes that the portion of the list to be partitioned contains at least one element.
+ * @return A negative value if the first element must come before the second, 
+ * a positive value if it must come after it and `0` if their order does not matter.
  */
-static int64_t partition(list_t* const list, const int64_t low, const int64_t high, const bool ascending);
+static int32_t list_order_at(list_t* const list, const int64_t index1, const int64_t index2, const bool ascending);
 
 /**
- * @brief Sorts the elements of the list using Median of Three Pivot Quicksort.
- * 
- * This function sorts the elements of the specified list using
- * the `qsort_s` function. The sorting order is determined by the `ascending`
- * parameter, which specifies whether to sort in ascending or descending order.
- * The function uses the provided custom equality function to compare elements
- * during sorting.
+ * @brief Sorts a small portion of the list using insertion sort.
  *
- * @param list A pointer to the list whose elements are to be sorted.
- * @param low The starting index of the portion of the list to be sorted.
- * @param high The ending index of the portion of the list to be sorted.
+ * @param list A pointer to the list.
+ * @param low The index of the first element of the portion.
+ * @param high The index of the last element of the portion.
  * @param ascending A boolean value indicating the sort order.
- * 
- * @note The list is sorted in place.
  */
-void quicksort(list_t* const list, const int64_t low, const int64_t high, const bool ascending);
+static void list_insertion_sort(list_t* const list, const int64_t low, const int64_t high, const bool ascending);
 
 /**
- * @brief Sorts the elements of the list using a specified sorting order.
+ * @brief Sorts a portion of the list using heapsort.
  * 
- * This function sorts the elements of the specified list using
- * the `qsort_s` function. The sorting order is determined by the `ascending`
- * parameter, which specifies whether to sort in ascending or descending order.
- * The function uses the provided custom equality function to compare elements
+ * Used by `introsort` once a portion recursed too deeply, guaranteeing O(n log n).
+ *
+ * @param list A pointer to the list.
+ * @param low The index of the first element of the portion.
+ * @param high The index of the last element of the portion.
+ * @param ascending A boolean value indicating the sort order.
+ */
+static void list_heapsort(list_t* const list, const int64_t low, const int64_t high, const bool ascending);
+
+/**
+ * @brief Restores the heap property of a portion of the list below a root.
+ *
+ * @param list A pointer to the list.
+ * @param low The index of the first element of the heap.
+ * @param root The position of the root within the heap.
+ * @param count The amount of elements in the heap.
+ * @param ascending A boolean value indicating the sort order.
+ */
+static void list_sift_down(list_t* const list, const int64_t low, int64_t root, const int64_t count, const bool ascending);
+
+/**
+ * @brief Moves the median of three elements of the list to the index of the first one.
+ *
+ * @param list A pointer to the list.
+ * @param index1 The index the median is moved to.
+ * @param index2 The index of the second element.
+ * @param index3 The index of the third element.
+ * @param ascending A boolean value indicating the sort order.
+ */
+static void list_median_to(list_t* const list, const int64_t index1, const int64_t index2, const int64_t index3, const bool ascending);
+
+/**
+ * @brief Partitions a portion of the list into three parts around a pivot.
+ *
+ * The pivot is picked with a median of three, or a median of medians for large portions, 
+ * and the portion is rearranged into elements ordered before the pivot, elements equal
+ * to it and elements ordered after it, so runs of duplicates are never partitioned again.
+ *
+ * @param list A pointer to the list.
+ * @param low The index of the first element of the portion.
+ * @param high The index of the last element of the portion.
+ * @param ascending A boolean value indicating the sort order.
+ * @param lessEndOut A pointer to where the index after the last element ordered before the pivot will be stored.
+ * @param greaterStartOut A pointer to where the index of the first element ordered after the pivot will be stored.
+ */
+static void list_partition(
+    list_t* const list, 
+    const int64_t low, 
+    const int64_t high, 
+    const bool ascending, 
+    int64_t* const lessEndOut, 
+    int64_t* const greaterStartOut
+);
+
+/**
+ * @brief Sorts the elements of the list using introsort.
+ * 
+ * Portions are partitioned iteratively with an explicit stack, always continuing with
+ * the smaller side so the stack stays bounded. Portions of at most `LIST_INSERTION_SORT_THRESHOLD`
+ * elements are finished with insertion sort and portions that exceed the depth limit 
+ * fall back to heapsort.
+ *
+ * @param list A pointer to the list whose elements are to be sorted.
+ * @param low The starting index of the portion of the list to be sorted.
+ * @param high The ending index of the portion of the list to be sorted.
+ * @param ascending A boolean value indicating the sort order.
+ * 
+ * @note The list is sorted in place and the sort is not stable.
+ */
+static void introsort(list_t* const list, const int64_t low, const int64_t high, const bool ascending);
+
+/**
+ * @brief Compares the values held by two storage slots of the list in the requested sorting order.
+ *
+ * @param list A pointer to the list.
+ * @param slot1 A pointer to the first slot, either inside the list or in a merge buffer.
+ * @param slot2 A pointer to the second slot, either inside the list or in a merge buffer.
+ * @param ascending A boolean value indicating the sort order.
+ * 
+ * @return A negative value if the first value must come before the second, 
+ * a positive value if it must come after it and `0` if their order does not matter.
+ */
+static int32_t list_order_slots(list_t* const list, const uint8_t* const slot1, const uint8_t* const slot2, const bool ascending);
+
+/**
+ * @brief Stably merges two adjacent sorted portions of the list.
+ * 
+ * The smaller portion is moved to the buffer and merged back from the matching end.
+ *
+ * @param list A pointer to the list.
+ * @param low The index of the first element of the first portion.
+ * @param middle The index of the first element of the second portion.
+ * @param high The index after the last element of the second portion.
+ * @param ascending A boolean value indicating the sort order.
+ * @param buffer A pointer to room for the smaller portion's slots.
+ */
+static void list_merge(
+    list_t* const list, 
+    const int64_t low, 
+    const int64_t middle, 
+    const int64_t high, 
+    const bool ascending, 
+    uint8_t* const buffer
+);
+
+/**
+ * @brief Finds how many elements of the first of two sorted portions come before a position of their merge.
+ *
+ * Elements of the first portion come first when elements are equal, the same as `list_merge`.
+ *
+ * @param list A pointer to the list.
+ * @param first A pointer to the slots of the first portion.
+ * @param firstCount The amount of elements in the first portion.
+ * @param second A pointer to the slots of the second portion.
+ * @param secondCount The amount of elements in the second portion.
+ * @param rank The position in the merged portions.
+ * @param ascending A boolean value indicating the sort order.
+ *
+ * @return The amount of elements taken from the first portion before `rank`.
+ */
+static int64_t list_merge_split(
+    list_t* const list, 
+    const uint8_t* const first, 
+    const int64_t firstCount, 
+    const uint8_t* const second, 
+    const int64_t secondCount, 
+    const int64_t rank, 
+    const bool ascending
+);
+
+/**
+ * @brief Task of `list_sort_parallel` sorting one of the runs in place.
+ *
+ * @param context A pointer to the `list_parallel_sort_t` of the sort.
+ * @param index The index of the run.
+ */
+static void list_parallel_sort_run(void* const context, const uint64_t index);
+
+/**
+ * @brief Task of `list_sort_parallel` writing one piece of the current merge level.
+ *
+ * Every level merges pairs of runs from the source into the destination, and the output 
+ * is cut into pieces of equal size regardless of which pair they fall into, so every 
+ * task does the same amount of work even when the runs differ in size.
+ *
+ * @param context A pointer to the `list_parallel_sort_t` of the sort.
+ * @param index The index of the piece.
+ */
+static void list_parallel_merge_piece(void* const context, const uint64_t index);
+
+/**
+ * @brief Picks the chunk size of a parallel pass so every thread gets one chunk, but no chunk is too small to hand out.
+ *
+ * @param count The amount of elements of the pass.
+ * @param threads The amount of threads of the pass.
+ *
+ * @return The amount of elements handled by every task, at least `LIST_PARALLEL_CHUNK_SIZE`.
+ */
+static int64_t list_parallel_chunk_size(const int64_t count, const uint64_t threads);
+
+/**
+ * @brief Returns the range of elements handled by a task of a parallel pass.
+ *
+ * @param scan A pointer to the state of the pass.
+ * @param index The index of the task.
+ * @param lowOut A pointer to where the index of the first element will be stored.
+ * @param highOut A pointer to where the index after the last element will be stored.
+ */
+static void list_parallel_chunk(const list_parallel_scan_t* const scan, const uint64_t index, int64_t* const lowOut, int64_t* const highOut);
+
+/**
+ * @brief Task of `list_for_each_parallel` visiting one chunk.
+ *
+ * @param context A pointer to the `list_parallel_scan_t` of the pass.
+ * @param index The index of the chunk.
+ */
+static void list_parallel_for_each_chunk(void* const context, const uint64_t index);
+
+/**
+ * @brief Task of `list_reduce` folding one chunk into its accumulator.
+ *
+ * @param context A pointer to the `list_parallel_scan_t` of the pass.
+ * @param index The index of the chunk.
+ */
+static void list_parallel_reduce_chunk(void* const context, const uint64_t index);
+
+/**
+ * @brief Task of `list_filter_into` evaluating the predicate for one chunk.
+ *
+ * @param context A pointer to the `list_parallel_scan_t` of the pass.
+ * @param index The index of the chunk.
+ */
+static void list_parallel_filter_chunk(void* const context, const uint64_t index);
+
+/**
+ * @brief Task of `list_find_first_parallel` searching one chunk.
+ *
+ * The chunk is skipped if a match was already found before it, and a match 
+ * replaces the one found so far only if it comes earlier.
+ *
+ * @param context A pointer to the `list_parallel_scan_t` of the pass.
+ * @param index The index of the chunk.
+ */
+static void list_parallel_find_chunk(void* const context, const uint64_t index);
+
+/**
+ * @brief Sorts the elements of the list using a specified sorting order.
+ * 
+ * This function sorts the elements of the specified list using
+ * `introsort`. The sorting order is determined by the `ascending`
+ * parameter, which specifies whether to sort in ascending or descending order.
+ * The function uses the provided custom equality function to compare elements
  * during sorting.
  *
  * @param list A pointer to the list whose elements are to be sorted.
@@ -173,731 +908,3161 @@ void quicksort(list_t* const list, const int64_t low, const int64_t high, const
  */
 static list_result_t default_sort(list_t* const list, const bool ascending);
 
-#pragma endregion
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static list_result_t list_element_create(
+    const confetti_allocator_t* const allocator, 
+    const void* const value, 
+    const uint64_t size, 
+    list_element_t** elementOut
+) {
+    list_element_block_t* const block = (list_element_block_t*) allocator->allocate(allocator->context, sizeof(list_element_block_t));
+
+    if (block == NULL)
+        return LIST_ALLOCATION_FAILURE;
+
+    list_element_t* element = &block->element;
+
+    block->references = 1;
+    block->destructor = NULL;
+    element->value = NULL;
+    element->size = size;
+
+    if (value != NULL) {
+        element->value = allocator->allocate(allocator->context, size);
+
+        if (element->value == NULL) {
+            allocator->deallocate(allocator->context, block, sizeof(list_element_block_t));
+            element = NULL;
+
+            return LIST_ALLOCATION_FAILURE;
+        }
+
+        memcpy(element->value, value, size);
+    }
+
+    *elementOut = element;
+    return LIST_SUCCESS;
+}
+
+
+static list_result_t list_element_store(list_t* const list, void* const value, const uint64_t size, list_element_t** elementOut) {
+    if ((list->flags & LIST_FLAG_STORE_POINTERS) == 0)
+        return list_element_create(&list->allocator, value, size, elementOut);
+
+    list_element_block_t* const block = (list_element_block_t*) list->allocator.allocate(list->allocator.context, sizeof(list_element_block_t));
+
+    if (block == NULL)
+        return LIST_ALLOCATION_FAILURE;
+
+    block->references = 1;
+    block->destructor = list->destructor == NULL ? &list_keep_value : list->destructor;
+    block->element.value = value;
+    block->element.size = size;
+
+    *elementOut = &block->element;
+    return LIST_SUCCESS;
+}
+
+
+static void list_keep_value(void* const value, const uint64_t size) {
+    (void) value;
+    (void) size;
+}
+
+
+static list_result_t list_element_set(
+    const confetti_allocator_t* const allocator, 
+    list_element_t* const element, 
+    const void* const value, 
+    const uint64_t size
+) {
+    if (size != element->size || element->value == NULL) {
+        void* newValue = element->value == NULL
+            ? allocator->allocate(allocator->context, size)
+            : allocator->reallocate(allocator->context, element->value, element->size, size);
+
+        if (newValue == NULL)
+            return LIST_ALLOCATION_FAILURE;
+
+        element->value = newValue;
+        element->size = size;
+    }
+
+    if (value != NULL)
+        memcpy(element->value, value, size);
+    else
+        memset(element->value, 0, size);
+    return LIST_SUCCESS;
+}
+
+
+static list_result_t list_element_clone(
+    const confetti_allocator_t* const allocator, 
+    list_element_t* const element, 
+    list_element_t** elementOut
+) {
+    return list_element_create(allocator, element->value, element->size, elementOut);
+}
+
+
+static bool list_element_is_shared(const list_element_t* const element) {
+    return confetti_atomic_load(&((const list_element_block_t*) element)->references) > 1;
+}
+
+
+static list_result_t list_elements_unshare(list_t* const list) {
+    for (int64_t i = 0; list->stride == 0 && i < list->size; i++) {
+        list_element_t* const element = list->items[i];
+
+        if (element == NULL || !list_element_is_shared(element) || ((list_element_block_t*) element)->destructor != NULL)
+            continue;
+
+        list_element_t* copy;
+        list_result_t createResult = list_element_create(&list->allocator, element->value, element->size, &copy);
+
+        if (createResult != LIST_SUCCESS)
+            return createResult;
+
+        list_element_release(&list->allocator, &list->items[i]);
+        list->items[i] = copy;
+    }
+
+    return LIST_SUCCESS;
+}
+
+
+static list_result_t list_element_release(const confetti_allocator_t* const allocator, list_element_t** element) {
+    if (*element == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    list_element_block_t* const block = (list_element_block_t*) *element;
+
+    // a sole owner can't race anyone, otherwise only the last reference frees the element.
+    if (confetti_atomic_load(&block->references) > 1 && confetti_atomic_fetch_add(&block->references, UINT64_MAX) > 1) {
+        *element = NULL;
+        return LIST_SUCCESS;
+    }
+
+    if (block->destructor != NULL)
+        block->destructor((*element)->value, (*element)->size);
+    else
+        allocator->deallocate(allocator->context, (*element)->value, (*element)->size);
+
+    (*element)->value = NULL;
+    (*element)->size = 0;
+
+    allocator->deallocate(allocator->context, block, sizeof(list_element_block_t));
+    *element = NULL;
+
+    return LIST_SUCCESS;
+}
+
+
+static list_result_t list_realloc_capacity(list_t* const list, const int64_t capacity) {
+    if (capacity < 1)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    if (capacity == list->capacity)
+        return LIST_SUCCESS;
+
+    list_compact(list);
+
+    int64_t oldCapacity = list->capacity;
+
+    if (capacity == oldCapacity)
+        return LIST_SUCCESS;
+
+    if (list->stride != 0) {
+        uint8_t* data = list_slots_reallocate(
+            list, 
+            list->stride * (uint64_t) oldCapacity, 
+            list->stride * (uint64_t) capacity
+        );
+
+        if (data == NULL)
+            return LIST_ALLOCATION_FAILURE;
+
+        list->data = data;
+        list->capacity = capacity;
+
+        if (list->size > capacity)
+            list->size = capacity;
+
+        return LIST_SUCCESS;
+    }
+
+    if (capacity < oldCapacity) {
+        for (int64_t i = oldCapacity - 1; i > capacity - 1; i--) {
+            if (list->items[i] != NULL) {
+                list_element_t* element = list->items[i];
+
+                list_element_release(&list->allocator, &element);
+            }
+
+            list->items[i] = NULL;
+        }
+
+        if (list->size > capacity)
+            list->size = capacity;
+    }
+
+    list_element_t** items = (list_element_t**) list_slots_reallocate(
+        list, 
+        sizeof(list_element_t*) * (uint64_t) oldCapacity, 
+        sizeof(list_element_t*) * (uint64_t) capacity
+    );
+
+    if (items == NULL)
+        return LIST_ALLOCATION_FAILURE;
+
+    list->items = items;
+    list->capacity = capacity;
+
+    for (int64_t i = oldCapacity; i < capacity; i++)
+        list->items[i] = NULL;
+
+    return LIST_SUCCESS;
+}
+
+
+static list_result_t list_ensure_capacity(list_t* const list, const int64_t capacity) {
+    if (capacity <= list->capacity)
+        return LIST_SUCCESS;
+
+    // reuse the room left in front by removals when it makes up most of the allocation.
+    if (list->offset >= list->size && capacity <= list->offset + list->capacity) {
+        list_compact(list);
+        return LIST_SUCCESS;
+    }
+
+    const int64_t oldCapacity = list->offset + list->capacity > 0 ? list->offset + list->capacity : 1;
+
+    return list_realloc_capacity(list, list_grown_capacity(list, oldCapacity, capacity));
+}
+
+
+static int64_t list_grown_capacity(const list_t* const list, int64_t capacity, const int64_t minimum) {
+    const int64_t percent = (int64_t) list->growth.factor - 100;
+
+    do {
+        if (capacity / 100 > INT64_MAX / percent)
+            return minimum > capacity ? minimum : capacity;
+
+        int64_t step = capacity / 100 * percent + capacity % 100 * percent / 100;
+
+        if (step < 1)
+            step = 1;
+
+        if (list->growth.maxStep > 0 && step >= list->growth.maxStep) {
+            // every later step is capped as well, so the rest is made up in one go.
+            const int64_t steps = minimum > capacity ? (minimum - capacity + list->growth.maxStep - 1) / list->growth.maxStep : 1;
+
+            if (steps > (INT64_MAX - capacity) / list->growth.maxStep)
+                return minimum > capacity ? minimum : capacity;
+
+            return capacity + steps * list->growth.maxStep;
+        }
+
+        if (step > INT64_MAX - capacity)
+            return minimum > capacity ? minimum : capacity;
+
+        capacity += step;
+    } while (capacity < minimum);
+
+    return capacity;
+}
+
+
+static void list_auto_shrink(list_t* const list) {
+    if (list->growth.shrinkDivisor == 0)
+        return;
+
+    const int64_t capacity = list->offset + list->capacity;
+
+    if (capacity <= DEFAULT_LIST_CAPACITY || list->size > capacity / (int64_t) list->growth.shrinkDivisor)
+        return;
+
+    int64_t target = list_grown_capacity(list, list->size > 0 ? list->size : 1, 1);
+
+    if (target < DEFAULT_LIST_CAPACITY)
+        target = DEFAULT_LIST_CAPACITY;
+
+    if (target < capacity)
+        list_realloc_capacity(list, target);
+}
+
+
+static bool list_allocator_matches(const confetti_allocator_t* const allocator1, const confetti_allocator_t* const allocator2) {
+    return allocator1->allocate == allocator2->allocate 
+        && allocator1->reallocate == allocator2->reallocate 
+        && allocator1->deallocate == allocator2->deallocate 
+        && allocator1->context == allocator2->context;
+}
+
+
+static uint64_t list_slot_size(const list_t* const list) {
+    return list->stride != 0 ? list->stride : sizeof(list_element_t*);
+}
+
+
+static uint8_t* list_slots(const list_t* const list) {
+    return list->stride != 0 ? list->data : (uint8_t*) list->items;
+}
+
+
+static void list_set_slots(list_t* const list, uint8_t* const slots) {
+    if (list->stride != 0)
+        list->data = slots;
+    else
+        list->items = (list_element_t**) slots;
+}
+
+
+static void list_compact(list_t* const list) {
+    if (list->offset == 0)
+        return;
+
+    const uint64_t slotSize = list_slot_size(list);
+    uint8_t* const slots = list_slots(list);
+    uint8_t* const base = slots - slotSize * (uint64_t) list->offset;
+
+    memmove(base, slots, slotSize * (uint64_t) list->size);
+
+    // keep every unused pointer slot NULL.
+    if (list->stride == 0) {
+        uint8_t* const vacated = base + slotSize * (uint64_t) list->size;
+        memset(vacated, 0, (uint64_t) (slots + slotSize * (uint64_t) list->size - vacated));
+    }
+
+    list->capacity += list->offset;
+    list->offset = 0;
+    list_set_slots(list, base);
+}
+
+
+static uint8_t* list_slot_base(const list_t* const list) {
+    return list_slots(list) - list_slot_size(list) * (uint64_t) list->offset;
+}
+
+
+static bool list_slots_inline(const list_t* const list) {
+    return list_slot_base(list) == (const uint8_t*) list->inlineSlots;
+}
+
+
+static uint8_t* list_slots_reallocate(list_t* const list, const uint64_t oldSize, const uint64_t newSize) {
+    uint8_t* const slots = list_slots(list);
+    uint8_t* const inlineSlots = (uint8_t*) list->inlineSlots;
+
+    if (newSize <= LIST_INLINE_BUFFER_SIZE) {
+        if (slots == inlineSlots)
+            return inlineSlots;
+
+        memcpy(inlineSlots, slots, newSize < oldSize ? newSize : oldSize);
+        list->allocator.deallocate(list->allocator.context, slots, oldSize);
+
+        return inlineSlots;
+    }
+
+    if (slots != inlineSlots)
+        return (uint8_t*) list->allocator.reallocate(list->allocator.context, slots, oldSize, newSize);
+
+    uint8_t* const heapSlots = (uint8_t*) list->allocator.allocate(list->allocator.context, newSize);
+
+    if (heapSlots != NULL)
+        memcpy(heapSlots, inlineSlots, oldSize);
+
+    return heapSlots;
+}
+
+
+static list_result_t list_reserve_front(list_t* const list) {
+    const uint64_t slotSize = list_slot_size(list);
+    int64_t front = list->size > 0 ? list->size : 1;
+
+    if (list->growth.maxStep > 0 && front > list->growth.maxStep)
+        front = list->growth.maxStep;
+
+    if (front > INT64_MAX - list->capacity)
+        return LIST_ALLOCATION_FAILURE;
+
+    uint8_t* const slots = list_slots_reallocate(
+        list, 
+        slotSize * (uint64_t) list->capacity, 
+        slotSize * (uint64_t) (front + list->capacity)
+    );
+
+    if (slots == NULL)
+        return LIST_ALLOCATION_FAILURE;
+
+    memmove(slots + slotSize * (uint64_t) front, slots, slotSize * (uint64_t) list->capacity);
+
+    if (list->stride == 0)
+        memset(slots, 0, slotSize * (uint64_t) front);
+
+    list->offset = front;
+    list_set_slots(list, slots + slotSize * (uint64_t) front);
+
+    return LIST_SUCCESS;
+}
+
+
+static void list_open_gap(list_t* const list, const int64_t index) {
+    const uint64_t slotSize = list_slot_size(list);
+    uint8_t* slots = list_slots(list);
+
+    if (list->offset > 0 && (index < list->size - index || list->size == list->capacity)) {
+        slots -= slotSize;
+        memmove(slots, slots + slotSize, slotSize * (uint64_t) index);
+
+        list->offset--;
+        list->capacity++;
+        list_set_slots(list, slots);
+    }
+    else
+        memmove(slots + slotSize * (uint64_t) (index + 1), slots + slotSize * (uint64_t) index, slotSize * (uint64_t) (list->size - index));
+
+    list->size++;
+}
+
+
+static void list_close_gap(list_t* const list, const int64_t index) {
+    const uint64_t slotSize = list_slot_size(list);
+    uint8_t* slots = list_slots(list);
+
+    if (index < list->size - 1 - index) {
+        memmove(slots + slotSize, slots, slotSize * (uint64_t) index);
+
+        if (list->stride == 0)
+            list->items[0] = NULL;
+
+        list->offset++;
+        list->capacity--;
+        list_set_slots(list, slots + slotSize);
+    }
+    else {
+        memmove(slots + slotSize * (uint64_t) index, slots + slotSize * (uint64_t) (index + 1), slotSize * (uint64_t) (list->size - index - 1));
+
+        if (list->stride == 0)
+            list->items[list->size - 1] = NULL;
+    }
+
+    list->size--;
+
+    if (list->size == 0)
+        list_compact(list);
+
+    list_auto_shrink(list);
+}
+
+
+static void list_options_of(const list_t* const list, const int64_t capacity, list_options_t* const optionsOut) {
+    optionsOut->capacity = capacity;
+    optionsOut->elementSize = list->stride;
+    optionsOut->equalityFunction = list->equalityFunction;
+    optionsOut->sortingFunction = list->sortingFunction;
+    optionsOut->allocator = &list->allocator;
+    optionsOut->flags = list->flags;
+    optionsOut->hashFunction = list->hashFunction;
+    optionsOut->destructor = list->destructor;
+    optionsOut->growth = list->growth;
+}
+
+
+static void* list_value_at(const list_t* const list, const int64_t index) {
+    if (list->stride != 0)
+        return list->data + list->stride * (uint64_t) index;
+
+    return list->items[index]->value;
+}
+
+
+static uint64_t list_value_size_at(const list_t* const list, const int64_t index) {
+    if (list->stride != 0)
+        return list->stride;
+
+    return list->items[index]->size;
+}
+
+
+static void list_fixed_write(list_t* const list, const int64_t index, const void* const value) {
+    uint8_t* slot = list->data + list->stride * (uint64_t) index;
+
+    if (value != NULL)
+        memcpy(slot, value, list->stride);
+    else
+        memset(slot, 0, list->stride);
+}
+
+
+static void list_bytes_swap(uint8_t* block1, uint8_t* block2, uint64_t size) {
+    uint8_t buffer[64];
+
+    while (size > 0) {
+        uint64_t chunk = size < sizeof(buffer) ? size : sizeof(buffer);
+
+        memcpy(buffer, block1, chunk);
+        memcpy(block1, block2, chunk);
+        memcpy(block2, buffer, chunk);
+
+        block1 += chunk;
+        block2 += chunk;
+        size -= chunk;
+    }
+}
+
+
+static void list_swap_at(list_t* const list, const int64_t index1, const int64_t index2) {
+    if (list->stride != 0) {
+        list_bytes_swap(
+            list->data + list->stride * (uint64_t) index1,
+            list->data + list->stride * (uint64_t) index2,
+            list->stride
+        );
+        return;
+    }
+
+    list_element_t* temp = list->items[index1];
+
+    list->items[index1] = list->items[index2];
+    list->items[index2] = temp;
+}
+
+
+static void list_index_invalidate(list_t* const list) {
+    if (list->index != NULL)
+        list->index->stale = true;
+}
+
+
+static void list_index_insert_at(list_t* const list, const int64_t index) {
+    if (list->index == NULL || list->index->stale)
+        return;
+
+    const uint64_t hash = list->hashFunction(list_value_at(list, index), list_value_size_at(list, index));
+
+    if (!confetti_hash_index_insert(&list->allocator, list->index, hash, index, NULL))
+        list->index->stale = true;
+}
+
+
+static void list_index_erase_at(list_t* const list, const int64_t index) {
+    if (list->index == NULL || list->index->stale)
+        return;
+
+    const uint64_t hash = list->hashFunction(list_value_at(list, index), list_value_size_at(list, index));
+
+    if (!confetti_hash_index_erase(list->index, hash, index))
+        list->index->stale = true;
+}
+
+
+static void list_index_added(list_t* const list, const int64_t index, const int64_t count) {
+    if (list->index == NULL || list->index->stale)
+        return;
+
+    if (index == list->size - count) {
+        for (int64_t i = index; i < list->size; i++)
+            list_index_insert_at(list, i);
+    }
+    else if (index == 0) {
+        // moving the base back shifts every other element up at once.
+        list->index->base -= count;
+
+        for (int64_t i = 0; i < count; i++)
+            list_index_insert_at(list, i);
+    }
+    else {
+        // the elements after the new ones are moved up in place, nothing is rehashed.
+        confetti_hash_index_shift(list->index, index, count);
+
+        for (int64_t i = index; i < index + count; i++)
+            list_index_insert_at(list, i);
+    }
+}
+
+
+static void list_index_removing(list_t* const list, const int64_t index) {
+    if (list->index == NULL || list->index->stale)
+        return;
+
+    if (index == list->size - 1)
+        list_index_erase_at(list, index);
+    else if (index == 0) {
+        list_index_erase_at(list, 0);
+        list->index->base++;
+    }
+    else {
+        list_index_erase_at(list, index);
+
+        if (!list->index->stale)
+            confetti_hash_index_shift(list->index, index + 1, -1);
+    }
+}
+
+
+static void list_index_removing_range(list_t* const list, const int64_t index, const int64_t count) {
+    if (list->index == NULL || list->index->stale)
+        return;
+
+    if (index + count == list->size) {
+        for (int64_t i = index; i < list->size; i++)
+            list_index_erase_at(list, i);
+    }
+    else if (index == 0) {
+        for (int64_t i = 0; i < count; i++)
+            list_index_erase_at(list, i);
+
+        // the base moving forward shifts every remaining element down at once.
+        if (list->index != NULL && !list->index->stale)
+            list->index->base += count;
+    }
+    else {
+        for (int64_t i = index; i < index + count; i++)
+            list_index_erase_at(list, i);
+
+        if (!list->index->stale)
+            confetti_hash_index_shift(list->index, index + count, -count);
+    }
+}
+
+
+static bool list_index_rebuild(list_t* const list) {
+    confetti_hash_index_clear(list->index);
+
+    for (int64_t i = 0; i < list->size && !list->index->stale; i++)
+        list_index_insert_at(list, i);
+
+    return !list->index->stale;
+}
+
+
+static bool list_index_find(
+    list_t* const list, 
+    const void* const value, 
+    const uint64_t size, 
+    const int64_t startIndex, 
+    const bool last, 
+    int64_t* const indexOut
+) {
+    if (list->index == NULL)
+        return false;
+    else if (list->index->stale && !list_index_rebuild(list))
+        return false;
+
+    const uint64_t hash = list->hashFunction(value, size);
+    const confetti_hash_index_entry_t* entry;
+    uint64_t cursor = 0;
+    int64_t found = -1;
+
+    // duplicates are spread over the probe sequence in no particular order, so every one of them is visited.
+    while ((entry = confetti_hash_index_probe(list->index, hash, &cursor)) != NULL) {
+        const int64_t position = confetti_hash_index_position(list->index, entry);
+
+        if (position < startIndex || (found != -1 && (last ? position < found : position > found)))
+            continue;
+
+        if (list_value_size_at(list, position) != size)
+            continue;
+
+        if (list->equalityFunction(list_value_at(list, position), value, size) == 0)
+            found = position;
+    }
+
+    *indexOut = found;
+    return true;
+}
+
+
+static bool list_search_vectorizable(const list_t* const list, const void* const value, const uint64_t size) {
+    return list->stride != 0 
+        && size == list->stride 
+        && value != NULL 
+        && list->equalityFunction == (list_custom_equality_function_t*) &default_equals 
+        && confetti_search_supports(list->stride);
+}
+
+
+static void list_sorted_changed(list_t* const list, const int64_t index, const int64_t count) {
+    if (!list->sorted || count <= 0)
+        return;
+
+    const int64_t first = index > 0 ? index - 1 : 0;
+    const int64_t last = index + count < list->size ? index + count : list->size - 1;
+
+    // only the written values and their two neighbours can be out of order.
+    for (int64_t i = first; i < last; i++) {
+        if (list_order_at(list, i, i + 1, true) > 0) {
+            list->sorted = false;
+            return;
+        }
+    }
+}
+
+
+static int32_t list_order_value(list_t* const list, const int64_t index, const void* const value, const uint64_t size) {
+    const uint64_t valueSize = list_value_size_at(list, index);
+
+    return list->equalityFunction(list_value_at(list, index), value, valueSize < size ? valueSize : size);
+}
+
+
+static int64_t list_bound(list_t* const list, const void* const value, const uint64_t size, const int64_t startIndex, const bool upper) {
+    int64_t low = startIndex;
+    int64_t high = list->size;
+
+    while (low < high) {
+        const int64_t middle = low + (high - low) / 2;
+        const int32_t order = list_order_value(list, middle, value, size);
+
+        if (upper ? order <= 0 : order < 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+
+static int64_t list_sorted_find(list_t* const list, const void* const value, const uint64_t size, const int64_t startIndex, const bool last) {
+    // equal values of another size share the run of matches, so the run is walked until one fits.
+    if (last) {
+        for (int64_t i = list_bound(list, value, size, startIndex, true) - 1; i >= startIndex && list_order_value(list, i, value, size) == 0; i--) {
+            if (list_value_size_at(list, i) == size)
+                return i;
+        }
+    }
+    else {
+        for (int64_t i = list_bound(list, value, size, startIndex, false); i < list->size && list_order_value(list, i, value, size) == 0; i++) {
+            if (list_value_size_at(list, i) == size)
+                return i;
+        }
+    }
+
+    return -1;
+}
+
+
+static int32_t default_equals(const void* const data1, const void* const data2, const uint64_t size)
+{
+    if (data1 == NULL && data2 != NULL)
+        return -1;
+    else if (data1 != NULL && data2 == NULL) 
+        return 1;
+    else if (data1 == NULL && data2 == NULL)
+        return 0;
+
+    return memcmp(data1, data2, size);
+}
+
+
+static int32_t list_order_at(list_t* const list, const int64_t index1, const int64_t index2, const bool ascending) {
+    int32_t comparison_result = list->equalityFunction(list_value_at(list, index1), list_value_at(list, index2), list_value_size_at(list, index1));
+
+    if (comparison_result == 0)
+        return 0;
+
+    return (comparison_result > 0) == ascending ? 1 : -1;
+}
+
+
+static void list_insertion_sort(list_t* const list, const int64_t low, const int64_t high, const bool ascending) {
+    for (int64_t i = low + 1; i <= high; i++) {
+        for (int64_t j = i; j > low && list_order_at(list, j - 1, j, ascending) > 0; j--)
+            list_swap_at(list, j - 1, j);
+    }
+}
+
+
+static void list_sift_down(list_t* const list, const int64_t low, int64_t root, const int64_t count, const bool ascending) {
+    while (2 * root + 1 < count) {
+        int64_t child = 2 * root + 1;
+
+        if (child + 1 < count && list_order_at(list, low + child, low + child + 1, ascending) < 0)
+            child++;
+
+        if (list_order_at(list, low + root, low + child, ascending) >= 0)
+            return;
+
+        list_swap_at(list, low + root, low + child);
+        root = child;
+    }
+}
+
+
+static void list_heapsort(list_t* const list, const int64_t low, const int64_t high, const bool ascending) {
+    const int64_t count = high - low + 1;
+
+    for (int64_t root = count / 2 - 1; root >= 0; root--)
+        list_sift_down(list, low, root, count, ascending);
+
+    for (int64_t end = count - 1; end > 0; end--) {
+        list_swap_at(list, low, low + end);
+        list_sift_down(list, low, 0, end, ascending);
+    }
+}
+
+
+static void list_median_to(list_t* const list, const int64_t index1, const int64_t index2, const int64_t index3, const bool ascending) {
+    if (list_order_at(list, index2, index3, ascending) > 0)
+        list_swap_at(list, index2, index3);
+
+    // index2 now holds the smaller of the two, so the median is either index1, index2 or index3.
+    if (list_order_at(list, index1, index2, ascending) < 0)
+        list_swap_at(list, index1, index2);
+    else if (list_order_at(list, index1, index3, ascending) > 0)
+        list_swap_at(list, index1, index3);
+}
+
+
+static void list_partition(
+    list_t* const list, 
+    const int64_t low, 
+    const int64_t high, 
+    const bool ascending, 
+    int64_t* const lessEndOut, 
+    int64_t* const greaterStartOut
+) {
+    const int64_t mid = low + (high - low) / 2;
+
+    if (high - low + 1 > LIST_NINTHER_THRESHOLD) {
+        const int64_t step = (high - low) / 8;
+
+        list_median_to(list, low, low + step, low + 2 * step, ascending);
+        list_median_to(list, mid, mid - step, mid + step, ascending);
+        list_median_to(list, high, high - step, high - 2 * step, ascending);
+        list_median_to(list, low, mid, high, ascending);
+    }
+    else
+        list_median_to(list, low, mid, high, ascending);
+
+    // elements in [low, lessEnd) come before the pivot, [lessEnd, i) equal it and (greaterStart, high] come after it.
+    int64_t lessEnd = low;
+    int64_t i = low + 1;
+    int64_t greaterStart = high;
+
+    while (i <= greaterStart) {
+        int32_t order = list_order_at(list, i, lessEnd, ascending);
+
+        if (order < 0)
+            list_swap_at(list, lessEnd++, i++);
+        else if (order > 0)
+            list_swap_at(list, i, greaterStart--);
+        else
+            i++;
+    }
+
+    *lessEndOut = lessEnd;
+    *greaterStartOut = greaterStart + 1;
+}
+
+
+static void introsort(list_t* const list, const int64_t low, const int64_t high, const bool ascending) {
+    int64_t lows[LIST_SORT_STACK_SIZE];
+    int64_t highs[LIST_SORT_STACK_SIZE];
+    int64_t depths[LIST_SORT_STACK_SIZE];
+    int64_t stackSize = 0;
+
+    int64_t depthLimit = 0;
+
+    for (int64_t count = high - low + 1; count > 1; count >>= 1)
+        depthLimit += 2;
+
+    int64_t currentLow = low;
+    int64_t currentHigh = high;
+    int64_t depth = depthLimit;
+
+    while (true) {
+        if (currentHigh - currentLow + 1 <= LIST_INSERTION_SORT_THRESHOLD) {
+            if (currentLow < currentHigh)
+                list_insertion_sort(list, currentLow, currentHigh, ascending);
+        }
+        else if (depth == 0)
+            list_heapsort(list, currentLow, currentHigh, ascending);
+        else {
+            int64_t lessEnd, greaterStart;
+            list_partition(list, currentLow, currentHigh, ascending, &lessEnd, &greaterStart);
+            depth--;
+
+            // continue with the smaller side and defer the larger one, bounding the stack by log2(n).
+            if (lessEnd - currentLow < currentHigh - greaterStart) {
+                lows[stackSize] = greaterStart;
+                highs[stackSize] = currentHigh;
+                depths[stackSize++] = depth;
+
+                currentHigh = lessEnd - 1;
+            }
+            else {
+                lows[stackSize] = currentLow;
+                highs[stackSize] = lessEnd - 1;
+                depths[stackSize++] = depth;
+
+                currentLow = greaterStart;
+            }
+
+            continue;
+        }
+
+        if (stackSize == 0)
+            return;
+
+        stackSize--;
+        currentLow = lows[stackSize];
+        currentHigh = highs[stackSize];
+        depth = depths[stackSize];
+    }
+}
+
+
+static int32_t list_order_slots(list_t* const list, const uint8_t* const slot1, const uint8_t* const slot2, const bool ascending) {
+    int32_t comparison_result;
+
+    if (list->stride != 0)
+        comparison_result = list->equalityFunction(slot1, slot2, list->stride);
+    else {
+        const list_element_t* const element1 = *(list_element_t* const*) slot1;
+        const list_element_t* const element2 = *(list_element_t* const*) slot2;
+
+        comparison_result = list->equalityFunction(
+            element1 != NULL ? element1->value : NULL, 
+            element2 != NULL ? element2->value : NULL, 
+            element1 != NULL ? element1->size : 0
+        );
+    }
+
+    if (comparison_result == 0)
+        return 0;
+
+    return (comparison_result > 0) == ascending ? 1 : -1;
+}
+
+
+static void list_merge(
+    list_t* const list, 
+    const int64_t low, 
+    const int64_t middle, 
+    const int64_t high, 
+    const bool ascending, 
+    uint8_t* const buffer
+) {
+    const uint64_t slotSize = list_slot_size(list);
+    uint8_t* const slots = list_slots(list);
+
+    // the portions are already in order.
+    if (list_order_at(list, middle - 1, middle, ascending) <= 0)
+        return;
+
+    if (middle - low <= high - middle) {
+        const int64_t count = middle - low;
+        int64_t i = 0, j = middle, k = low;
+
+        memcpy(buffer, slots + slotSize * (uint64_t) low, slotSize * (uint64_t) count);
+
+        while (i < count && j < high) {
+            if (list_order_slots(list, slots + slotSize * (uint64_t) j, buffer + slotSize * (uint64_t) i, ascending) < 0)
+                memcpy(slots + slotSize * (uint64_t) k++, slots + slotSize * (uint64_t) j++, slotSize);
+            else
+                memcpy(slots + slotSize * (uint64_t) k++, buffer + slotSize * (uint64_t) i++, slotSize);
+        }
+
+        memcpy(slots + slotSize * (uint64_t) k, buffer + slotSize * (uint64_t) i, slotSize * (uint64_t) (count - i));
+    }
+    else {
+        const int64_t count = high - middle;
+        int64_t i = middle - 1, j = count - 1, k = high - 1;
+
+        memcpy(buffer, slots + slotSize * (uint64_t) middle, slotSize * (uint64_t) count);
+
+        while (i >= low && j >= 0) {
+            if (list_order_slots(list, buffer + slotSize * (uint64_t) j, slots + slotSize * (uint64_t) i, ascending) < 0)
+                memcpy(slots + slotSize * (uint64_t) k--, slots + slotSize * (uint64_t) i--, slotSize);
+            else
+                memcpy(slots + slotSize * (uint64_t) k--, buffer + slotSize * (uint64_t) j--, slotSize);
+        }
+
+        memcpy(slots + slotSize * (uint64_t) low, buffer, slotSize * (uint64_t) (j + 1));
+    }
+}
+
+
+static int64_t list_merge_split(
+    list_t* const list, 
+    const uint8_t* const first, 
+    const int64_t firstCount, 
+    const uint8_t* const second, 
+    const int64_t secondCount, 
+    const int64_t rank, 
+    const bool ascending
+) {
+    const uint64_t slotSize = list_slot_size(list);
+    int64_t low = rank > secondCount ? rank - secondCount : 0;
+    int64_t high = rank < firstCount ? rank : firstCount;
+
+    // take one more element of the first portion while it doesn't come after the second portion's last taken one.
+    while (low < high) {
+        const int64_t i = low + (high - low) / 2;
+        const int64_t j = rank - i;
+
+        if (list_order_slots(list, first + slotSize * (uint64_t) i, second + slotSize * (uint64_t) (j - 1), ascending) <= 0)
+            low = i + 1;
+        else
+            high = i;
+    }
+
+    return low;
+}
+
+
+static void list_parallel_sort_run(void* const context, const uint64_t index) {
+    list_parallel_sort_t* const sort = (list_parallel_sort_t*) context;
+
+    introsort(sort->list, sort->bounds[index], sort->bounds[index + 1] - 1, sort->ascending);
+}
+
+
+static void list_parallel_merge_piece(void* const context, const uint64_t index) {
+    list_parallel_sort_t* const sort = (list_parallel_sort_t*) context;
+    const uint64_t slotSize = sort->slotSize;
+    const int64_t size = sort->bounds[sort->runCount];
+
+    int64_t start = sort->pieceSize * (int64_t) index;
+    const int64_t end = start + sort->pieceSize < size ? start + sort->pieceSize : size;
+
+    // find the last run starting at or before the piece, then the pair it belongs to.
+    int64_t low = 0, high = sort->runCount - 1;
+
+    while (low < high) {
+        const int64_t middle = low + (high - low + 1) / 2;
+
+        if (sort->bounds[middle] <= start)
+            low = middle;
+        else
+            high = middle - 1;
+    }
+
+    for (int64_t run = low - low % 2; start < end; run += 2) {
+        const int64_t pairLow = sort->bounds[run];
+        const int64_t pairMiddle = sort->bounds[run + 1 < sort->runCount ? run + 1 : sort->runCount];
+        const int64_t pairHigh = sort->bounds[run + 2 < sort->runCount ? run + 2 : sort->runCount];
+        const int64_t pieceEnd = end < pairHigh ? end : pairHigh;
+
+        const uint8_t* const first = sort->source + slotSize * (uint64_t) pairLow;
+        const uint8_t* const second = sort->source + slotSize * (uint64_t) pairMiddle;
+        const int64_t firstCount = pairMiddle - pairLow;
+        const int64_t secondCount = pairHigh - pairMiddle;
+
+        int64_t i = list_merge_split(sort->list, first, firstCount, second, secondCount, start - pairLow, sort->ascending);
+        int64_t j = start - pairLow - i;
+
+        for (int64_t k = start; k < pieceEnd; k++) {
+            uint8_t* const slot = sort->destination + slotSize * (uint64_t) k;
+
+            if (j < secondCount 
+                && (i == firstCount 
+                    || list_order_slots(sort->list, second + slotSize * (uint64_t) j, first + slotSize * (uint64_t) i, sort->ascending) < 0))
+                memcpy(slot, second + slotSize * (uint64_t) j++, slotSize);
+            else
+                memcpy(slot, first + slotSize * (uint64_t) i++, slotSize);
+        }
+
+        start = pieceEnd;
+    }
+}
+
+
+static int64_t list_parallel_chunk_size(const int64_t count, const uint64_t threads) {
+    const int64_t chunkSize = (uint64_t) count > threads ? (count + (int64_t) threads - 1) / (int64_t) threads : 1;
+
+    return chunkSize > LIST_PARALLEL_CHUNK_SIZE ? chunkSize : LIST_PARALLEL_CHUNK_SIZE;
+}
+
+
+static void list_parallel_chunk(const list_parallel_scan_t* const scan, const uint64_t index, int64_t* const lowOut, int64_t* const highOut) {
+    const int64_t low = scan->startIndex + scan->chunkSize * (int64_t) index;
+
+    *lowOut = low;
+    *highOut = scan->list->size - low > scan->chunkSize ? low + scan->chunkSize : scan->list->size;
+}
+
+
+static void list_parallel_for_each_chunk(void* const context, const uint64_t index) {
+    list_parallel_scan_t* const scan = (list_parallel_scan_t*) context;
+    int64_t low, high;
+
+    list_parallel_chunk(scan, index, &low, &high);
+
+    for (int64_t i = low; i < high; i++)
+        scan->forEach(scan->context, list_value_at(scan->list, i), list_value_size_at(scan->list, i), i);
+}
+
+
+static void list_parallel_reduce_chunk(void* const context, const uint64_t index) {
+    list_parallel_scan_t* const scan = (list_parallel_scan_t*) context;
+    void* const accumulator = scan->results + scan->resultSize * index;
+    int64_t low, high;
+
+    list_parallel_chunk(scan, index, &low, &high);
+
+    for (int64_t i = low; i < high; i++)
+        scan->reduce(scan->context, accumulator, list_value_at(scan->list, i), list_value_size_at(scan->list, i));
+}
+
+
+static void list_parallel_filter_chunk(void* const context, const uint64_t index) {
+    list_parallel_scan_t* const scan = (list_parallel_scan_t*) context;
+    int64_t low, high;
+
+    list_parallel_chunk(scan, index, &low, &high);
+
+    for (int64_t i = low; i < high; i++)
+        scan->results[i] = scan->predicate(scan->context, list_value_at(scan->list, i), list_value_size_at(scan->list, i));
+}
+
+
+static void list_parallel_find_chunk(void* const context, const uint64_t index) {
+    list_parallel_scan_t* const scan = (list_parallel_scan_t*) context;
+    list_t* const list = scan->list;
+    int64_t low, high;
+
+    list_parallel_chunk(scan, index, &low, &high);
+
+    // chunks are claimed in order, so once a match is known every chunk after it can be skipped.
+    if ((uint64_t) low >= confetti_atomic_load(&scan->found))
+        return;
+
+    int64_t match = -1;
+
+    if (scan->vectorizable) {
+        const int64_t found = confetti_search_first(list->data + list->stride * (uint64_t) low, high - low, list->stride, scan->value);
+
+        match = found != -1 ? low + found : -1;
+    }
+    else {
+        for (int64_t i = low; i < high; i++) {
+            if (list_value_size_at(list, i) == scan->size && list->equalityFunction(list_value_at(list, i), scan->value, scan->size) == 0) {
+                match = i;
+                break;
+            }
+        }
+    }
+
+    if (match == -1)
+        return;
+
+    uint64_t expected = confetti_atomic_load(&scan->found);
+
+    while ((uint64_t) match < expected && !confetti_atomic_compare_exchange(&scan->found, &expected, (uint64_t) match));
+}
+
+
+static list_result_t default_sort(list_t* const list, const bool ascending)
+{
+    introsort(list, 0, list->size - 1, ascending);
+
+    return LIST_SUCCESS;
+}
+
+
+static list_result_t list_setup(list_t* const list, const list_options_t* const options) {
+    list_options_t defaults = { 0, 0, NULL, NULL, NULL, LIST_FLAG_NONE, NULL, NULL, { 0, 0, 0 } };
+    const list_options_t* const settings = options == NULL ? &defaults : options;
+    const confetti_allocator_t* const allocator = settings->allocator == NULL 
+        ? confetti_allocator_default() 
+        : settings->allocator;
+
+    const uint32_t factor = settings->growth.factor == 0 ? DEFAULT_LIST_GROWTH_FACTOR : settings->growth.factor;
+
+    if (settings->elementSize != 0 && (settings->flags & LIST_FLAG_STORE_POINTERS) != 0)
+        return LIST_INVALID_PARAMS_ERROR;
+    else if (factor <= 100 || settings->growth.maxStep < 0)
+        return LIST_INVALID_PARAMS_ERROR;
+    else if (settings->growth.shrinkDivisor != 0 && (uint64_t) settings->growth.shrinkDivisor * 100 <= factor)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    const uint64_t slotSize = settings->elementSize != 0 ? settings->elementSize : sizeof(list_element_t*);
+
+    list->size = 0;
+    list->capacity = settings->capacity < 1 ? DEFAULT_LIST_CAPACITY : settings->capacity;
+    list->items = NULL;
+    list->stride = settings->elementSize;
+    list->data = NULL;
+    list->allocator = *allocator;
+    list->offset = 0;
+    list->flags = settings->flags;
+    list->hashFunction = NULL;
+    list->index = NULL;
+    list->destructor = settings->destructor;
+    list->growth = settings->growth;
+    list->growth.factor = factor;
+    list->embedded = false;
+    list->sorted = false;
+    list->equalityFunction = settings->equalityFunction == NULL 
+        ? (list_custom_equality_function_t*) &default_equals 
+        : settings->equalityFunction;
+    list->sortingFunction = settings->sortingFunction == NULL 
+        ? (list_custom_sorting_function_t*) &default_sort 
+        : settings->sortingFunction;
+
+    uint8_t* slots = (uint8_t*) list->inlineSlots;
+
+    // small lists keep their slots inline, the capacity stays the one asked for.
+    if ((uint64_t) list->capacity > LIST_INLINE_BUFFER_SIZE / slotSize)
+        slots = (uint8_t*) allocator->allocate(allocator->context, slotSize * (uint64_t) list->capacity);
+
+    if (slots == NULL)
+        return LIST_ALLOCATION_FAILURE;
+
+    if (list->stride == 0)
+        memset(slots, 0, slotSize * (uint64_t) list->capacity);
+
+    list_set_slots(list, slots);
+
+    if (settings->hashFunction != NULL) {
+        list_result_t indexResult = list_index_attach(list, settings->hashFunction);
+
+        if (indexResult != LIST_SUCCESS) {
+            list_release(list);
+            return indexResult;
+        }
+    }
+
+    return LIST_SUCCESS;
+}
+
+
+static void list_release(list_t* const list) {
+    for (int64_t i = 0; list->items != NULL && i < list->size; i++) {
+        if (list->items[i] == NULL)
+            continue;
+
+        list_element_release(&list->allocator, &list->items[i]);
+    }
+
+    confetti_hash_index_free(&list->allocator, &list->index);
+
+    if (!list_slots_inline(list))
+        list->allocator.deallocate(list->allocator.context, list_slot_base(list), list_slot_size(list) * (uint64_t) (list->offset + list->capacity));
+
+    list->items = NULL;
+    list->data = NULL;
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+list_result_t list_create(
+    list_t** listOut,
+    const int64_t capacity,
+    list_custom_equality_function_t* const customEqualityFunction,
+    list_custom_sorting_function_t* const customSortingFunction
+) {
+    list_options_t options = { capacity, 0, customEqualityFunction, customSortingFunction, NULL, LIST_FLAG_NONE, NULL, NULL, { 0, 0, 0 } };
+
+    return list_create_with_options(listOut, &options);
+}
+
+
+list_result_t list_create_fixed(
+    list_t** listOut,
+    const int64_t capacity,
+    const uint64_t elementSize,
+    list_custom_equality_function_t* const customEqualityFunction,
+    list_custom_sorting_function_t* const customSortingFunction
+) {
+    if (elementSize == 0)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    list_options_t options = { capacity, elementSize, customEqualityFunction, customSortingFunction, NULL, LIST_FLAG_NONE, NULL, NULL, { 0, 0, 0 } };
+
+    return list_create_with_options(listOut, &options);
+}
+
+
+list_result_t list_create_with_options(list_t** listOut, const list_options_t* const options) {
+    const confetti_allocator_t* const allocator = options == NULL || options->allocator == NULL 
+        ? confetti_allocator_default() 
+        : options->allocator;
+
+    list_t* list = (list_t*) allocator->allocate(allocator->context, sizeof(list_t));
+
+    if (list == NULL)
+        return LIST_ALLOCATION_FAILURE;
+
+    list_result_t setupResult = list_setup(list, options);
+
+    if (setupResult != LIST_SUCCESS) {
+        allocator->deallocate(allocator->context, list, sizeof(list_t));
+        return setupResult;
+    }
+
+    *listOut = list;
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_init(list_t* const list, const list_options_t* const options) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    list_result_t setupResult = list_setup(list, options);
+
+    if (setupResult != LIST_SUCCESS)
+        return setupResult;
+
+    list->embedded = true;
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_free(list_t** list) {
+    if (*list == NULL)
+        return LIST_NULL_ERROR;
+    else if ((*list)->embedded)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    confetti_allocator_t allocator = (*list)->allocator;
+
+    list_release(*list);
+
+    allocator.deallocate(allocator.context, *list, sizeof(list_t));
+    *list = NULL;
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_deinit(list_t* const list) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (!list->embedded)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    list_release(list);
+    list->size = 0;
+    list->capacity = 0;
+    list->embedded = false;
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_print(list_t* list) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    printf("[");
+
+    for (int64_t i = 0LL; i < list->size; i++) {
+        void* value = list_value_at(list, i);
+
+        if (value != NULL)
+            printf(i == list->size - 1 ? "%p" : "%p, ", value);
+        else
+            printf(i == list->size - 1 ? "NULL" : "NULL, ");
+    }
+
+    printf("] -> %p\n", list);
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_resize(list_t* list, const int64_t capacity) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (capacity < 1)
+        return LIST_INVALID_PARAMS_ERROR;
+    else if (capacity == list->capacity)
+        return LIST_SUCCESS;
+
+    if (capacity < list->size)
+        list_index_invalidate(list);
+
+    list_result_t result;
+    result = list_realloc_capacity(list, capacity);
+
+    if (result != LIST_SUCCESS) 
+        return result;
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_reserve(list_t* const list, const int64_t capacity) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (capacity < 0)
+        return LIST_INVALID_PARAMS_ERROR;
+    else if (capacity <= list->capacity)
+        return LIST_SUCCESS;
+
+    if (capacity <= list->offset + list->capacity) {
+        list_compact(list);
+        return LIST_SUCCESS;
+    }
+
+    return list_realloc_capacity(list, capacity);
+}
+
+
+list_result_t list_shrink_to_fit(list_t* const list) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    const int64_t capacity = list->size > 0 ? list->size : 1;
+
+    if (list->offset == 0 && list->capacity == capacity)
+        return LIST_SUCCESS;
+
+    // compacting first hands the room in front over to the capacity, so it can be cut off too.
+    list_compact(list);
+
+    return list_realloc_capacity(list, capacity);
+}
+
+
+list_result_t list_prepend(list_t* list, void* value, const uint64_t size) {
+    return list_insert(list, 0, value, size);
+}
+
+
+list_result_t list_append(list_t* list, void* const value, const uint64_t size) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (list->stride != 0 && size != list->stride)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    list_result_t capacityResult = list_ensure_capacity(list, list->size + 1);
+
+    if (capacityResult != LIST_SUCCESS) 
+        return capacityResult;
+
+    if (list->stride != 0) {
+        list_fixed_write(list, list->size++, value);
+        list_index_added(list, list->size - 1, 1);
+        list_sorted_changed(list, list->size - 1, 1);
+
+        return LIST_SUCCESS;
+    }
+
+    list_element_t* element;
+    list_result_t result = list_element_store(list, value, size, &element);
+
+    if (result != LIST_SUCCESS)
+        return result;
+
+    list->items[list->size++] = element;
+    list_index_added(list, list->size - 1, 1);
+    list_sorted_changed(list, list->size - 1, 1);
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_insert(list_t* list, const int64_t index, void* const value, const uint64_t size) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (index > list->size || index < 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+    else if (list->stride != 0 && size != list->stride)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    list_result_t capacityResult = LIST_SUCCESS;
+
+    if (list->offset == 0 && (list->flags & LIST_FLAG_DEQUE) != 0 && index < list->size - index)
+        capacityResult = list_reserve_front(list);
+    else if (list->offset == 0)
+        capacityResult = list_ensure_capacity(list, list->size + 1);
+
+    if (capacityResult != LIST_SUCCESS) 
+        return capacityResult;
+
+    if (list->stride != 0) {
+        list_open_gap(list, index);
+        list_fixed_write(list, index, value);
+        list_index_added(list, index, 1);
+        list_sorted_changed(list, index, 1);
+
+        return LIST_SUCCESS;
+    }
+
+    list_element_t* element;
+    list_result_t createResult = list_element_store(list, value, size, &element);
+
+    if (createResult != LIST_SUCCESS)
+        return createResult;
+
+    list_open_gap(list, index);
+    list->items[index] = element;
+    list_index_added(list, index, 1);
+    list_sorted_changed(list, index, 1);
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_append_many(list_t* const list, const void* const values, const int64_t count, const uint64_t stride) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    return list_insert_many(list, list->size, values, count, stride);
+}
+
+
+list_result_t list_insert_many(list_t* const list, const int64_t index, const void* const values, const int64_t count, const uint64_t stride) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (index > list->size || index < 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+    else if (count < 0 || count > INT64_MAX - list->size || stride == 0 || (values == NULL && count > 0))
+        return LIST_INVALID_PARAMS_ERROR;
+    else if (list->stride != 0 && stride != list->stride)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    if (count == 0)
+        return LIST_SUCCESS;
+
+    list_result_t capacityResult = list_ensure_capacity(list, list->size + count);
+
+    if (capacityResult != LIST_SUCCESS) 
+        return capacityResult;
+
+    const uint8_t* const source = (const uint8_t*) values;
+
+    if (list->stride != 0) {
+        uint8_t* slot = list->data + stride * (uint64_t) index;
+
+        memmove(slot + stride * (uint64_t) count, slot, stride * (uint64_t) (list->size - index));
+        memcpy(slot, source, stride * (uint64_t) count);
+        list->size += count;
+        list_index_added(list, index, count);
+        list_sorted_changed(list, index, count);
+
+        return LIST_SUCCESS;
+    }
+
+    memmove(&list->items[index + count], &list->items[index], sizeof(list_element_t*) * (uint64_t) (list->size - index));
+
+    for (int64_t i = 0; i < count; i++) {
+        list_result_t createResult = list_element_create(&list->allocator, source + stride * (uint64_t) i, stride, &list->items[index + i]);
+
+        if (createResult != LIST_SUCCESS) {
+            for (int64_t j = 0; j < i; j++)
+                list_element_release(&list->allocator, &list->items[index + j]);
+
+            memmove(&list->items[index], &list->items[index + count], sizeof(list_element_t*) * (uint64_t) (list->size - index));
+
+            for (int64_t j = list->size; j < list->size + count; j++)
+                list->items[j] = NULL;
+
+            return createResult;
+        }
+    }
+
+    list->size += count;
+    list_index_added(list, index, count);
+    list_sorted_changed(list, index, count);
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_get(list_t* list,  list_element_t** elementOut, const int64_t index) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (index >= list->size || index < 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    list_element_t* element;
+    list_result_t result = list->stride != 0
+        ? list_element_create(confetti_allocator_default(), list_value_at(list, index), list->stride, &element)
+        : list_element_clone(confetti_allocator_default(), list->items[index], &element);
+
+    if (result != LIST_SUCCESS) {
+        *elementOut = NULL;
+        return result;
+    }
+
+    *elementOut = element;
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_peek(list_t* const list, const void** valueOut, uint64_t* const sizeOut, const int64_t index) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (index >= list->size || index < 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    *valueOut = list_value_at(list, index);
+
+    if (sizeOut != NULL)
+        *sizeOut = list_value_size_at(list, index);
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_set(list_t* list, const int64_t index, void* const value, const uint64_t size) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (index >= list->size || index < 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+    else if (size == 0)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    if (list->stride != 0) {
+        if (size != list->stride)
+            return LIST_INVALID_PARAMS_ERROR;
+
+        list_index_erase_at(list, index);
+        list_fixed_write(list, index, value);
+        list_index_insert_at(list, index);
+        list_sorted_changed(list, index, 1);
+
+        return LIST_SUCCESS;
+    }
+
+    if (list->items[index] != NULL)
+        list_index_erase_at(list, index);
+
+    list_element_block_t* const block = (list_element_block_t*) list->items[index];
+
+    if (block != NULL && block->destructor != NULL && block->element.value == value) {
+        // the pointer is already stored, a shared element keeps the size its other lists know.
+        if (!list_element_is_shared(list->items[index]))
+            block->element.size = size;
+    }
+    else if (
+        block == NULL 
+        || block->destructor != NULL 
+        || (list->flags & LIST_FLAG_STORE_POINTERS) != 0 
+        || list_element_is_shared(list->items[index])
+    ) {
+        // an element shared with a shallow clone is copied on write, stored pointers are replaced.
+        list_element_t* element;
+        list_result_t result = list_element_store(list, value, size, &element);
+
+        if (result != LIST_SUCCESS) {
+            list_index_invalidate(list);
+            return result;
+        }
+
+        if (list->items[index] != NULL)
+            list_element_release(&list->allocator, &list->items[index]);
+
+        list->items[index] = element;
+    }
+    else {
+        list_result_t result = list_element_set(&list->allocator, list->items[index], value, size);
+
+        if (result != LIST_SUCCESS) {
+            list_index_invalidate(list);
+            return result;
+        }
+    }
+
+    list_index_insert_at(list, index);
+    list_sorted_changed(list, index, 1);
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_remove(list_t* list, const int64_t index) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (index >= list->size || index < 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    list_index_removing(list, index);
+
+    if (list->stride != 0) {
+        list_close_gap(list, index);
+        return LIST_SUCCESS;
+    }
+
+    list_result_t freeResult = list_element_release(&list->allocator, &list->items[index]);
+
+    if (freeResult != LIST_SUCCESS)
+        return freeResult;
+
+    list_close_gap(list, index);
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_remove_range(list_t* const list, const int64_t startIndex, const int64_t endIndex) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (startIndex < 0 || endIndex > list->size || startIndex > endIndex)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    const int64_t count = endIndex - startIndex;
+
+    if (count == 0)
+        return LIST_SUCCESS;
+
+    list_index_removing_range(list, startIndex, count);
+
+    for (int64_t i = startIndex; list->stride == 0 && i < endIndex; i++)
+        list_element_release(&list->allocator, &list->items[i]);
+
+    const uint64_t slotSize = list_slot_size(list);
+    uint8_t* const slots = list_slots(list);
+
+    if (startIndex < list->size - endIndex) {
+        // the elements in front move up and the room they leave is kept in front of the list.
+        memmove(slots + slotSize * (uint64_t) count, slots, slotSize * (uint64_t) startIndex);
+
+        if (list->stride == 0)
+            memset(slots, 0, slotSize * (uint64_t) count);
+
+        list->offset += count;
+        list->capacity -= count;
+        list_set_slots(list, slots + slotSize * (uint64_t) count);
+    }
+    else {
+        memmove(slots + slotSize * (uint64_t) startIndex, slots + slotSize * (uint64_t) endIndex, slotSize * (uint64_t) (list->size - endIndex));
+
+        if (list->stride == 0)
+            memset(slots + slotSize * (uint64_t) (list->size - count), 0, slotSize * (uint64_t) count);
+    }
+
+    list->size -= count;
+
+    if (list->size == 0)
+        list_compact(list);
+
+    list_auto_shrink(list);
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_retain_if(list_t* const list, list_predicate_function_t* const predicate, void* const context) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (predicate == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    const uint64_t slotSize = list_slot_size(list);
+    uint8_t* const slots = list_slots(list);
+    int64_t kept = 0;
+
+    for (int64_t i = 0; i < list->size; i++) {
+        if (!predicate(context, list_value_at(list, i), list_value_size_at(list, i))) {
+            if (list->stride == 0)
+                list_element_release(&list->allocator, &list->items[i]);
+
+            continue;
+        }
+
+        if (kept != i)
+            memcpy(slots + slotSize * (uint64_t) kept, slots + slotSize * (uint64_t) i, slotSize);
+
+        kept++;
+    }
+
+    if (kept == list->size)
+        return LIST_SUCCESS;
+
+    if (list->stride == 0)
+        memset(slots + slotSize * (uint64_t) kept, 0, slotSize * (uint64_t) (list->size - kept));
+
+    list_index_invalidate(list);
+    list->size = kept;
+
+    if (list->size == 0)
+        list_compact(list);
+
+    list_auto_shrink(list);
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_pop(list_t* const list, list_element_t** elementOut, const int64_t index) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (index >= list->size || index < 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    if (list->stride != 0) {
+        list_result_t createResult = list_element_create(confetti_allocator_default(), list_value_at(list, index), list->stride, elementOut);
+
+        if (createResult != LIST_SUCCESS)
+            return createResult;
+
+        return list_remove(list, index);
+    }
+
+    list_result_t cloneResult = list_element_clone(confetti_allocator_default(), list->items[index], elementOut);
+    
+    if (cloneResult != LIST_SUCCESS)
+        return cloneResult;
+    
+    list_index_removing(list, index);
+
+    list_result_t freeResult = list_element_release(&list->allocator, &list->items[index]);
+
+    if (freeResult != LIST_SUCCESS)
+        return freeResult;
+
+    list_close_gap(list, index);
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_take(list_t* const list, list_element_t** elementOut, const int64_t index) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (index >= list->size || index < 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    if (
+        list->stride != 0 
+        || list->allocator.allocate != confetti_allocator_default()->allocate 
+        || list_element_is_shared(list->items[index])
+        || ((list_element_block_t*) list->items[index])->destructor != NULL
+    )
+        return list_pop(list, elementOut, index);
+
+    list_index_removing(list, index);
+
+    *elementOut = list->items[index];
+    list->items[index] = NULL;
+
+    list_close_gap(list, index);
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_reverse(list_t* const list) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    list_index_invalidate(list);
+    list->sorted = list->size < 2;
+
+    if (list->stride != 0) {
+        for (int64_t i = 0LL; i < list->size / 2LL; i++)
+            list_swap_at(list, i, list->size - 1 - i);
+
+        return LIST_SUCCESS;
+    }
+
+    list_element_t** start = list->items;
+    list_element_t** end = list->items + list->size - 1;
+    int64_t mid = list->size / 2LL;
+
+    for (int64_t i = 0LL; i < mid; i++) {
+        list_element_t* leftElement = *start;
+        list_element_t* rightElement = *end;
+
+        *start = rightElement;
+        *end = leftElement;
+
+        start++;
+        end--;
+    }
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_clone(list_t* const list, list_t** listOut) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    list_options_t options;
+    list_options_of(list, list->capacity, &options);
+
+    list_t* listClone;
+    list_result_t createResult = list_create_with_options(&listClone, &options);
+
+    if (createResult != LIST_SUCCESS)
+        return createResult;
+
+    if (list->stride != 0) {
+        memcpy(listClone->data, list->data, list->stride * (uint64_t) list->size);
+        listClone->size = list->size;
+        list_index_invalidate(listClone);
+        listClone->sorted = list->sorted;
+
+        *listOut = listClone;
+        return LIST_SUCCESS;
+    }
+
+    for (int64_t i = 0LL; i < list->size; i++) {
+        list_element_t* elementClone;
+        list_result_t result = list_element_clone(&listClone->allocator, list->items[i], &elementClone);
+
+        if (result != LIST_SUCCESS) {
+            list_free(&listClone);
+            return result;
+        }
+
+        listClone->items[i] = elementClone;
+        listClone->size++;
+    }
+
+    list_index_invalidate(listClone);
+    listClone->sorted = list->sorted;
+        
+    *listOut = listClone;
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_clone_shallow(list_t* const list, list_t** listOut) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (list->stride != 0)
+        return list_clone(list, listOut);
+
+    list_options_t options;
+    list_options_of(list, list->capacity, &options);
+
+    list_t* listClone;
+    list_result_t createResult = list_create_with_options(&listClone, &options);
+
+    if (createResult != LIST_SUCCESS)
+        return createResult;
+
+    memcpy(listClone->items, list_slots(list), sizeof(list_element_t*) * (uint64_t) list->size);
+    listClone->size = list->size;
+
+    for (int64_t i = 0; i < list->size; i++)
+        confetti_atomic_fetch_add(&((list_element_block_t*) listClone->items[i])->references, 1);
+
+    list_index_invalidate(listClone);
+    listClone->sorted = list->sorted;
+
+    *listOut = listClone;
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_clear(list_t* const list) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    for (int64_t i = 0; list->items != NULL && i < list->size; i++) {
+        list_element_release(&list->allocator, &list->items[i]);
+    }
+
+    list->size = 0;
+    list_compact(list);
+    list_auto_shrink(list);
+
+    if (list->index != NULL)
+        confetti_hash_index_clear(list->index);
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_join(list_t* const list1, list_t* const list2, list_t** listOut) {
+    if (list1 == NULL)
+        return LIST_NULL_ERROR;
+    else if (list2 == NULL)
+        return LIST_NULL_ERROR;
+
+    uint64_t stride = list1->stride == list2->stride ? list1->stride : 0;
+
+    list_options_t options;
+    list_options_of(list1, list1->size + list2->size, &options);
+    options.elementSize = stride;
+    options.equalityFunction = NULL;
+    options.sortingFunction = NULL;
+    options.hashFunction = NULL;
+
+    list_t* joinList;
+    list_result_t result = list_create_with_options(&joinList, &options);
+
+    if (result != LIST_SUCCESS)
+        return result;
+
+    if (stride != 0) {
+        memcpy(joinList->data, list1->data, stride * (uint64_t) list1->size);
+        memcpy(joinList->data + stride * (uint64_t) list1->size, list2->data, stride * (uint64_t) list2->size);
+        joinList->size = list1->size + list2->size;
+
+        *listOut = joinList;
+        return LIST_SUCCESS;
+    }
+
+    list_t* const sources[2] = { list1, list2 };
+
+    for (int32_t source = 0; source < 2; source++) {
+        list_t* const sourceList = sources[source];
+
+        for (int64_t i = 0; i < sourceList->size; i++) {
+            list_element_t* element;
+            result = sourceList->stride != 0
+                ? list_element_create(&joinList->allocator, list_value_at(sourceList, i), sourceList->stride, &element)
+                : list_element_clone(&joinList->allocator, sourceList->items[i], &element);
+
+            if (result != LIST_SUCCESS) {
+                list_free(&joinList);
+                return result;
+            }
+
+            joinList->items[joinList->size++] = element;
+        }
+    }
+
+    *listOut = joinList;
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_concat_into(list_t* const destination, list_t* const source) {
+    if (destination == NULL || source == NULL)
+        return LIST_NULL_ERROR;
+    else if (destination == source)
+        return LIST_INVALID_PARAMS_ERROR;
+    else if (source->size == 0)
+        return LIST_SUCCESS;
+
+    const int64_t count = source->size;
+    const int64_t oldSize = destination->size;
+
+    if (destination->stride != 0) {
+        if (source->stride != 0 && source->stride != destination->stride)
+            return LIST_INVALID_PARAMS_ERROR;
+
+        for (int64_t i = 0; source->stride == 0 && i < count; i++) {
+            if (source->items[i]->size != destination->stride)
+                return LIST_INVALID_PARAMS_ERROR;
+        }
+    }
+
+    // slots can move over as they are when they hold values, or elements both lists free the same way.
+    const bool steal = destination->stride == source->stride 
+        && (destination->stride != 0 || list_allocator_matches(&destination->allocator, &source->allocator));
+
+    if (steal && oldSize == 0 && list_allocator_matches(&destination->allocator, &source->allocator) 
+        && !list_slots_inline(destination) && !list_slots_inline(source)) {
+        // an empty destination takes over the storage of the source as a whole.
+        list_element_t** const items = destination->items;
+        uint8_t* const data = destination->data;
+        const int64_t capacity = destination->capacity;
+        const int64_t offset = destination->offset;
+
+        destination->items = source->items;
+        destination->data = source->data;
+        destination->capacity = source->capacity;
+        destination->offset = source->offset;
+
+        source->items = items;
+        source->data = data;
+        source->capacity = capacity;
+        source->offset = offset;
+    }
+    else {
+        const list_result_t capacityResult = list_ensure_capacity(destination, oldSize + count);
+
+        if (capacityResult != LIST_SUCCESS)
+            return capacityResult;
+
+        const uint64_t slotSize = list_slot_size(destination);
+
+        if (steal) {
+            memcpy(list_slots(destination) + slotSize * (uint64_t) oldSize, list_slots(source), slotSize * (uint64_t) count);
+
+            // the destination owns the stolen elements now, unused slots of the source must stay NULL.
+            if (source->stride == 0)
+                memset(list_slots(source), 0, sizeof(list_element_t*) * (uint64_t) count);
+        }
+        else if (destination->stride != 0) {
+            for (int64_t i = 0; i < count; i++)
+                list_fixed_write(destination, oldSize + i, list_value_at(source, i));
+        }
+        else {
+            for (int64_t i = 0; i < count; i++) {
+                list_result_t result = source->stride != 0
+                    ? list_element_create(&destination->allocator, list_value_at(source, i), source->stride, &destination->items[oldSize + i])
+                    : list_element_clone(&destination->allocator, source->items[i], &destination->items[oldSize + i]);
+
+                if (result != LIST_SUCCESS) {
+                    // leave both lists as they were.
+                    while (i-- > 0)
+                        list_element_release(&destination->allocator, &destination->items[oldSize + i]);
+
+                    return result;
+                }
+            }
+        }
+
+        for (int64_t i = 0; !steal && source->items != NULL && i < count; i++)
+            list_element_release(&source->allocator, &source->items[i]);
+    }
+
+    destination->size = oldSize + count;
+    source->size = 0;
+
+    // shrinking releases every non NULL slot past the new capacity, so stolen slots were cleared above.
+    list_compact(source);
+    list_auto_shrink(source);
+
+    list_index_added(destination, oldSize, count);
+    list_sorted_changed(destination, oldSize, count);
+
+    if (source->index != NULL)
+        confetti_hash_index_clear(source->index);
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_includes(list_t* const list, void* value, const uint64_t size) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    int64_t indexedIndex;
+
+    if (list_index_find(list, value, size, 0, false, &indexedIndex))
+        return indexedIndex != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
+
+    if (list->sorted)
+        return list_sorted_find(list, value, size, 0, false) != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
+
+    if (list_search_vectorizable(list, value, size))
+        return confetti_search_first(list->data, list->size, list->stride, value) != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
+
+    for (int64_t i = 0LL; i < list->size; i++)
+    {
+        if (list_value_size_at(list, i) != size)
+            continue;
+
+        if (list->equalityFunction(list_value_at(list, i), value, size) == 0)
+            return LIST_SUCCESS;
+    }
+
+    return LIST_ELEMENT_NOT_FOUND_ERROR;
+}
+
+
+list_result_t list_find_first(
+    list_t* const list, 
+    int64_t* const indexOut, 
+    const int64_t startIndex, 
+    void* const value, 
+    const uint64_t size
+) {
+    if (list == NULL) {
+        *indexOut = -1;
+        return LIST_NULL_ERROR;
+    }
+    else if (startIndex >= list->size || startIndex < 0) {
+        *indexOut = -1;
+        return LIST_INVALID_PARAMS_ERROR;
+    }
+    else if (size <= 0) {
+        *indexOut = -1;
+        return LIST_INVALID_PARAMS_ERROR;
+    }
+
+    if (list_index_find(list, value, size, startIndex, false, indexOut))
+        return *indexOut != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
+
+    if (list->sorted) {
+        *indexOut = list_sorted_find(list, value, size, startIndex, false);
+        return *indexOut != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
+    }
+
+    int64_t index = startIndex > 0LL ? startIndex : 0LL;
+
+    if (list_search_vectorizable(list, value, size)) {
+        const int64_t found = confetti_search_first(list->data + list->stride * (uint64_t) index, list->size - index, list->stride, value);
+
+        *indexOut = found != -1 ? index + found : -1;
+        return found != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
+    }
+
+    for (int64_t i = index; i < list->size; i++) {
+        if (list_value_size_at(list, i) != size)
+            continue;
+
+        if (list->equalityFunction(list_value_at(list, i), value, size) == 0) {
+            *indexOut = i;
+            return LIST_SUCCESS;
+        }
+    }
+
+    *indexOut = -1;
+    return LIST_ELEMENT_NOT_FOUND_ERROR;
+}
+
+
+list_result_t list_find_last(list_t* const list, int64_t* indexOut, const int64_t startIndex, void* value, const uint64_t size) {
+    if (list == NULL) {
+        *indexOut = -1;
+        return LIST_NULL_ERROR;
+    }
+    else if (startIndex >= list->size || startIndex < 0) {
+        *indexOut = -1;
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+    }
+    else if (size <= 0) {
+        *indexOut = -1;
+        return LIST_INVALID_PARAMS_ERROR;
+    }
+
+    if (list_index_find(list, value, size, startIndex, true, indexOut))
+        return *indexOut != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
+
+    if (list->sorted) {
+        *indexOut = list_sorted_find(list, value, size, startIndex, true);
+        return *indexOut != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
+    }
+
+    if (list_search_vectorizable(list, value, size)) {
+        const int64_t found = confetti_search_last(list->data + list->stride * (uint64_t) startIndex, list->size - startIndex, list->stride, value);
+
+        *indexOut = found != -1 ? startIndex + found : -1;
+        return found != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
+    }
+
+    // scanning backward lets the search stop at the first match it meets.
+    for (int64_t i = list->size - 1; i >= startIndex; i--) {
+        if (list_value_size_at(list, i) != size)
+            continue;
+
+        if (list->equalityFunction(list_value_at(list, i), value, size) == 0) {
+            *indexOut = i;
+            return LIST_SUCCESS;
+        }
+    }
+
+    *indexOut = -1;
+    return LIST_ELEMENT_NOT_FOUND_ERROR;
+}
+
+
+list_result_t list_sorted_insert(list_t* const list, int64_t* const indexOut, void* const value, const uint64_t size) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    const bool empty = list->size == 0;
+    const int64_t index = list_bound(list, value, size, 0, true);
+    list_result_t insertResult = list_insert(list, index, value, size);
+
+    if (insertResult != LIST_SUCCESS)
+        return insertResult;
+
+    if (empty)
+        list->sorted = true;
+
+    if (indexOut != NULL)
+        *indexOut = index;
+
+    return LIST_SUCCESS;
+}
+
+
+list_result_t list_binary_search(list_t* const list, int64_t* const indexOut, void* const value, const uint64_t size) {
+    if (list == NULL) {
+        *indexOut = -1;
+        return LIST_NULL_ERROR;
+    }
 
-// private functions
+    *indexOut = list_sorted_find(list, value, size, 0, false);
+    return *indexOut != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
+}
 
-#pragma region private functions
 
-static list_result_t list_element_create(const void* const value, const uint64_t size, list_element_t** elementOut) {
-    list_element_t* element = (list_element_t*) malloc(sizeof(list_element_t));
+list_result_t list_lower_bound(list_t* const list, int64_t* const indexOut, void* const value, const uint64_t size) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
 
-    if (element == NULL)
-        return LIST_ALLOCATION_FAILURE;
+    *indexOut = list_bound(list, value, size, 0, false);
+    return LIST_SUCCESS;
+}
 
-    element->value = NULL;
-    element->size = size;
 
-    if (value != NULL) {
-        element->value = (void*) malloc(size);
+list_result_t list_upper_bound(list_t* const list, int64_t* const indexOut, void* const value, const uint64_t size) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
 
-        if (element->value == NULL) {
-            free(element);
-            element = NULL;
+    *indexOut = list_bound(list, value, size, 0, true);
+    return LIST_SUCCESS;
+}
 
-            return LIST_ALLOCATION_FAILURE;
-        }
 
-        memcpy(element->value, value, size);
+list_result_t list_find_first_parallel(
+    list_t* const list, 
+    int64_t* const indexOut, 
+    const int64_t startIndex, 
+    void* const value, 
+    const uint64_t size,
+    const uint64_t threadCount,
+    const confetti_executor_t* const executor
+) {
+    if (list == NULL) {
+        *indexOut = -1;
+        return LIST_NULL_ERROR;
+    }
+    else if (list->index != NULL)
+        return list_find_first(list, indexOut, startIndex, value, size);
+    else if (startIndex >= list->size || startIndex < 0) {
+        *indexOut = -1;
+        return LIST_INVALID_PARAMS_ERROR;
+    }
+    else if (size <= 0) {
+        *indexOut = -1;
+        return LIST_INVALID_PARAMS_ERROR;
     }
 
-    *elementOut = element;
-    return LIST_SUCCESS;
-}
+    list_parallel_scan_t scan = { 0 };
 
+    scan.list = list;
+    scan.startIndex = startIndex;
+    scan.chunkSize = LIST_PARALLEL_CHUNK_SIZE;
+    scan.value = value;
+    scan.size = size;
+    scan.vectorizable = list_search_vectorizable(list, value, size);
+    scan.found = (uint64_t) list->size;
 
-static list_result_t list_element_set(list_element_t* const element, const void* value, const uint64_t size) {
-    if (size != element->size) {
-        if (element->value == NULL)
-            element->value = (void*)malloc(size);
-        else
-            element->value = (void*)realloc(element->value, size);
+    const uint64_t chunkCount = (uint64_t) ((list->size - startIndex + scan.chunkSize - 1) / scan.chunkSize);
 
-        element->size = size;
+    confetti_executor_run(executor, threadCount, &list_parallel_find_chunk, &scan, chunkCount);
 
-        if (element->value == NULL)
-            return LIST_ALLOCATION_FAILURE;
+    if (scan.found == (uint64_t) list->size) {
+        *indexOut = -1;
+        return LIST_ELEMENT_NOT_FOUND_ERROR;
     }
 
-    memcpy(element->value, value, size);
+    *indexOut = (int64_t) scan.found;
     return LIST_SUCCESS;
 }
 
 
-static list_result_t list_element_clone(list_element_t* const element, list_element_t** elementOut) {
-    list_element_t* elementClone = (list_element_t*)malloc(sizeof(list_element_t));
+list_result_t list_for_each_parallel(
+    list_t* const list, 
+    list_for_each_function_t* const function, 
+    void* const context, 
+    const uint64_t threadCount, 
+    const confetti_executor_t* const executor
+) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (function == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+    else if (list->size == 0)
+        return LIST_SUCCESS;
 
-    if (elementClone == NULL)
-        return LIST_ALLOCATION_FAILURE;
+    // values modified in place must not show in a shallow clone, so shared ones are copied on write.
+    list_result_t unshareResult = list_elements_unshare(list);
 
-    elementClone->value = NULL;
-    elementClone->size = element->size;
+    if (unshareResult != LIST_SUCCESS)
+        return unshareResult;
 
-    if (element->value != NULL) {
-        elementClone->value = (void*)malloc(element->size);
+    // neither the index nor the order can be trusted once the function may have changed the values.
+    list_index_invalidate(list);
+    list->sorted = false;
 
-        if (elementClone->value == NULL)
-            return LIST_ALLOCATION_FAILURE;
+    const uint64_t threads = threadCount == 0 ? confetti_executor_default_thread_count() : threadCount;
+    list_parallel_scan_t scan = { 0 };
 
-        memcpy(elementClone->value, element->value, element->size);
-    }
+    scan.list = list;
+    scan.chunkSize = list_parallel_chunk_size(list->size, threads);
+    scan.context = context;
+    scan.forEach = function;
+
+    const uint64_t chunkCount = (uint64_t) ((list->size + scan.chunkSize - 1) / scan.chunkSize);
+
+    confetti_executor_run(executor, threads, &list_parallel_for_each_chunk, &scan, chunkCount);
 
-    *elementOut = elementClone;
     return LIST_SUCCESS;
 }
 
 
-static list_result_t list_realloc_capacity(list_t* const list, const int64_t capacity) {
-    if (capacity < 1)
+list_result_t list_reduce(
+    list_t* const list, 
+    void* const accumulator, 
+    const uint64_t accumulatorSize, 
+    list_reduce_function_t* const reduce, 
+    list_combine_function_t* const combine, 
+    void* const context, 
+    const uint64_t threadCount, 
+    const confetti_executor_t* const executor
+) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (accumulator == NULL || accumulatorSize == 0 || reduce == NULL || combine == NULL)
         return LIST_INVALID_PARAMS_ERROR;
+    else if (list->size == 0)
+        return LIST_SUCCESS;
 
-    int64_t oldCapacity = list->capacity;
+    const uint64_t threads = threadCount == 0 ? confetti_executor_default_thread_count() : threadCount;
+    const int64_t chunkSize = list_parallel_chunk_size(list->size, threads);
+    const uint64_t chunkCount = (uint64_t) ((list->size + chunkSize - 1) / chunkSize);
+
+    // a single chunk is folded straight into the accumulator on the calling thread.
+    if (chunkCount == 1) {
+        for (int64_t i = 0; i < list->size; i++)
+            reduce(context, accumulator, list_value_at(list, i), list_value_size_at(list, i));
 
-    if (capacity == oldCapacity)
         return LIST_SUCCESS;
+    }
 
-    if (capacity < oldCapacity) {
-        for (int64_t i = oldCapacity - 1; i > capacity - 1; i--) {
-            if (list->items[i] != NULL) {
-                list_element_t* element = list->items[i];
+    const uint64_t resultsSize = accumulatorSize * chunkCount;
+    uint8_t* const results = (uint8_t*) list->allocator.allocate(list->allocator.context, resultsSize);
 
-                list_element_free(&element);
-            }
+    if (results == NULL)
+        return LIST_ALLOCATION_FAILURE;
 
-            list->items[i] = NULL;
-        }
+    for (uint64_t i = 0; i < chunkCount; i++)
+        memcpy(results + accumulatorSize * i, accumulator, accumulatorSize);
 
-        if (list->size > capacity)
-            list->size = capacity;
-    }
+    list_parallel_scan_t scan = { 0 };
 
-    list->capacity = capacity;
-    list->items = (list_element_t**) realloc(list->items, sizeof(list_element_t*) * capacity);
+    scan.list = list;
+    scan.chunkSize = chunkSize;
+    scan.context = context;
+    scan.reduce = reduce;
+    scan.results = results;
+    scan.resultSize = accumulatorSize;
 
-    if (list->items == NULL)
-        return LIST_ALLOCATION_FAILURE;
+    confetti_executor_run(executor, threads, &list_parallel_reduce_chunk, &scan, chunkCount);
 
-    if (capacity > oldCapacity) {
-        for (int64_t i = oldCapacity; i < capacity - 1; i++) {
-            list->items[i] = NULL;
-        }
-    }
+    for (uint64_t i = 0; i < chunkCount; i++)
+        combine(context, accumulator, results + accumulatorSize * i);
+
+    list->allocator.deallocate(list->allocator.context, results, resultsSize);
 
     return LIST_SUCCESS;
 }
 
 
-static int32_t default_equals(const void* const data1, const void* const data2, const uint64_t size)
-{
-    if (data1 == NULL && data2 != NULL)
-        return -1;
-    else if (data1 != NULL && data2 == NULL) 
-        return 1;
-    else if (data1 == NULL && data2 == NULL)
-        return 0;
+list_result_t list_filter_into(
+    list_t* const list, 
+    list_t* const destination, 
+    list_predicate_function_t* const predicate, 
+    void* const context, 
+    const uint64_t threadCount, 
+    const confetti_executor_t* const executor
+) {
+    if (list == NULL || destination == NULL)
+        return LIST_NULL_ERROR;
+    else if (predicate == NULL || list == destination)
+        return LIST_INVALID_PARAMS_ERROR;
+    else if (list->size == 0)
+        return LIST_SUCCESS;
 
-    return memcmp(data1, data2, size);
-}
+    const uint64_t threads = threadCount == 0 ? confetti_executor_default_thread_count() : threadCount;
+    const uint64_t keptSize = (uint64_t) list->size;
+    uint8_t* const kept = (uint8_t*) list->allocator.allocate(list->allocator.context, keptSize);
 
+    if (kept == NULL)
+        return LIST_ALLOCATION_FAILURE;
 
-static int64_t partition(list_t* const list, const int64_t low, const int64_t high, const bool ascending) {
-    if (high - low + 1 >= 3) {
-        int64_t mid = low + (high - low) / 2;
+    list_parallel_scan_t scan = { 0 };
 
-        if (ascending) {
-            if (list->equalityFunction(list->items[low]->value, list->items[mid]->value, list->items[low]->size) > 0) {
-                list_swap(list, low, mid);
-            }
+    scan.list = list;
+    scan.chunkSize = list_parallel_chunk_size(list->size, threads);
+    scan.context = context;
+    scan.predicate = predicate;
+    scan.results = kept;
 
-            if (list->equalityFunction(list->items[low]->value, list->items[high]->value, list->items[low]->size) > 0) {
-                list_swap(list, low, high);
-            }
+    const uint64_t chunkCount = (uint64_t) ((list->size + scan.chunkSize - 1) / scan.chunkSize);
 
-            if (list->equalityFunction(list->items[mid]->value, list->items[high]->value, list->items[mid]->size) > 0) {
-                list_swap(list, mid, high);
-            }
-        }
-        else {
-            if (list->equalityFunction(list->items[low]->value, list->items[mid]->value, list->items[low]->size) < 0) {
-                list_swap(list, low, mid);
-            }
+    confetti_executor_run(executor, threads, &list_parallel_filter_chunk, &scan, chunkCount);
 
-            if (list->equalityFunction(list->items[low]->value, list->items[high]->value, list->items[low]->size) < 0) {
-                list_swap(list, low, high);
-            }
+    int64_t keptCount = 0;
 
-            if (list->equalityFunction(list->items[mid]->value, list->items[high]->value, list->items[mid]->size) < 0) {
-                list_swap(list, mid, high);
-            }
-        }
+    for (int64_t i = 0; i < list->size; i++)
+        keptCount += kept[i];
 
-        list_swap(list, mid, high - 1);
+    list_result_t result = list_ensure_capacity(destination, destination->size + keptCount);
+
+    for (int64_t i = 0; i < list->size && result == LIST_SUCCESS; i++) {
+        if (kept[i])
+            result = list_append(destination, list_value_at(list, i), list_value_size_at(list, i));
     }
 
-    list_element_t* pivot_element = list->items[high - 1];
-    void* pivot_value = pivot_element->value;
-    uint64_t pivot_size = pivot_element->size;
+    list->allocator.deallocate(list->allocator.context, kept, keptSize);
 
-    int64_t i = (low - 1);
+    return result;
+}
 
-    for (int64_t j = low; j <= high - 2; j++) {
-        int32_t comparison_result = list->equalityFunction(list->items[j]->value, pivot_value, pivot_size);
 
-        bool condition = ascending 
-            ? (comparison_result <= 0) 
-            : (comparison_result >= 0);
+list_result_t list_index_attach(list_t* const list, list_custom_hash_function_t* const hashFunction) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+    else if (hashFunction == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
 
-        if (condition) {
-            i++;
-            list_swap(list, i, j);
-        }
-    }
+    confetti_hash_index_t* index;
 
-    list_swap(list, i + 1, high - 1);
-    return (i + 1);
-}
+    if (!confetti_hash_index_create(&list->allocator, (uint64_t) list->size, &index))
+        return LIST_ALLOCATION_FAILURE;
 
+    confetti_hash_index_free(&list->allocator, &list->index);
 
-void quicksort(list_t* const list, const int64_t low, const int64_t high, const bool ascending) {
-    if (low < high) {
-        int32_t p = partition(list, low, high, ascending);
+    list->hashFunction = hashFunction;
+    list->index = index;
 
-        quicksort(list, low, p - 1, ascending);
-        quicksort(list, p + 1, high, ascending);
+    if (!list_index_rebuild(list)) {
+        list_index_detach(list);
+        return LIST_ALLOCATION_FAILURE;
     }
+
+    return LIST_SUCCESS;
 }
 
 
-static list_result_t default_sort(list_t* const list, const bool ascending)
-{
-    quicksort(list, 0, list->size - 1, ascending);
+list_result_t list_index_detach(list_t* const list) {
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    confetti_hash_index_free(&list->allocator, &list->index);
+    list->hashFunction = NULL;
 
     return LIST_SUCCESS;
 }
 
-#pragma endregion
 
-// public functions
+list_result_t list_sort(list_t* const list, const bool ascending) {
+    if (list == NULL) 
+        return LIST_NULL_ERROR;
+    else if (list->size == 0 || list->size == 1) {
+        list->sorted = true;
+        return LIST_SUCCESS;
+    }
 
-#pragma region public functions
+    list_index_invalidate(list);
+    
+    list_result_t sortResult = list->sortingFunction(list, ascending);
 
-list_result_t list_create(
-    list_t** listOut,
-    const int64_t capacity,
-    list_custom_equality_function_t* const customEqualityFunction,
-    list_custom_sorting_function_t* const customSortingFunction
-) {
-    list_t* list = (list_t*) malloc(sizeof(list_t));
+    // a custom sorting function may order the values differently from the equality function.
+    list->sorted = sortResult == LIST_SUCCESS 
+        && ascending 
+        && list->sortingFunction == (list_custom_sorting_function_t*) &default_sort;
 
-    if (list == NULL)
-        return LIST_ALLOCATION_FAILURE;
+    return sortResult;
+}
 
-    list->size = 0;
-    list->capacity = capacity < 1 ? DEFAULT_LIST_CAPACITY : capacity;
-    list->items = (list_element_t**) calloc(list->capacity, sizeof(list_element_t*));
-    list->equalityFunction = customEqualityFunction == NULL ? (list_custom_equality_function_t*) &default_equals : customEqualityFunction;
-    list->sortingFunction = customSortingFunction == NULL ? (list_custom_sorting_function_t*) &default_sort : customSortingFunction;
 
-    if (list->items == NULL) {
-        free(list);
-        return LIST_ALLOCATION_FAILURE;
+list_result_t list_sort_stable(list_t* const list, const bool ascending) {
+    if (list == NULL) 
+        return LIST_NULL_ERROR;
+    else if (list->size < 2) {
+        list->sorted = true;
+        return LIST_SUCCESS;
     }
 
-    *listOut = list;
-    return LIST_SUCCESS;
-}
+    const int64_t size = list->size;
+    const uint64_t slotSize = list_slot_size(list);
 
+    list_index_invalidate(list);
+    list->sorted = false;
 
-list_result_t list_free(list_t** list) {
-    if (*list == NULL)
-        return LIST_NULL_ERROR;
+    // pick a run length between half of and the threshold so the runs merge evenly, as timsort does.
+    int64_t minimumRun = size;
+    int64_t remainder = 0;
+
+    while (minimumRun >= LIST_MIN_RUN_THRESHOLD) {
+        remainder |= minimumRun & 1;
+        minimumRun >>= 1;
+    }
 
-    for (int64_t i = 0; i < (*list)->size; i++) {
-        list_element_t* element = (*list)->items[i];
+    minimumRun += remainder;
 
-        if (element == NULL)
-            continue;
+    const uint64_t runCapacity = (uint64_t) (size / minimumRun + 1);
+    const uint64_t bufferSize = slotSize * (uint64_t) (size / 2 + 1);
 
-        free(element->value);
-        element->value = NULL;
-        element->size = 0;
+    int64_t* runs = (int64_t*) list->allocator.allocate(list->allocator.context, sizeof(int64_t) * runCapacity);
+    uint8_t* buffer = (uint8_t*) list->allocator.allocate(list->allocator.context, bufferSize);
 
-        free(element);
-        (*list)->items[i] = NULL;
+    if (runs == NULL || buffer == NULL) {
+        list->allocator.deallocate(list->allocator.context, runs, sizeof(int64_t) * runCapacity);
+        list->allocator.deallocate(list->allocator.context, buffer, bufferSize);
+
+        return LIST_ALLOCATION_FAILURE;
     }
 
-    free((*list)->items);
-    (*list)->items = NULL;
+    int64_t runCount = 0;
 
-    free(*list);
-    *list = NULL;
+    for (int64_t start = 0; start < size; ) {
+        int64_t end = start + 1;
 
-    return LIST_SUCCESS;
-}
+        if (end < size && list_order_at(list, start, end, ascending) > 0) {
+            // only strictly reversed runs are flipped, keeping equal elements in order.
+            while (end < size && list_order_at(list, end - 1, end, ascending) > 0)
+                end++;
 
+            for (int64_t i = start, j = end - 1; i < j; i++, j--)
+                list_swap_at(list, i, j);
+        }
+        else {
+            while (end < size && list_order_at(list, end - 1, end, ascending) <= 0)
+                end++;
+        }
 
-list_result_t list_print(list_t* list) {
-    if (list == NULL)
-        return LIST_NULL_ERROR;
+        if (end - start < minimumRun) {
+            end = start + minimumRun < size ? start + minimumRun : size;
+            list_insertion_sort(list, start, end - 1, ascending);
+        }
 
-    printf("[");
+        runs[runCount++] = start;
+        start = end;
+    }
 
-    for (int64_t i = 0LL; i < list->size; i++) {
-        list_element_t* element = list->items[i];
+    while (runCount > 1) {
+        int64_t mergedCount = 0;
 
-        if (element->value != NULL)
-            printf(i == list->size - 1 ? "%p" : "%p, ", element->value);
-        else
-            printf(i == list->size - 1 ? "NULL" : "NULL, ", element->value);
+        for (int64_t i = 0; i < runCount; i += 2) {
+            if (i + 1 < runCount)
+                list_merge(list, runs[i], runs[i + 1], i + 2 < runCount ? runs[i + 2] : size, ascending, buffer);
+
+            runs[mergedCount++] = runs[i];
+        }
+
+        runCount = mergedCount;
     }
 
-    printf("] -> %p\n", list);
+    list->allocator.deallocate(list->allocator.context, runs, sizeof(int64_t) * runCapacity);
+    list->allocator.deallocate(list->allocator.context, buffer, bufferSize);
+
+    list->sorted = ascending;
 
     return LIST_SUCCESS;
 }
 
 
-list_result_t list_resize(list_t* list, const int64_t capacity) {
-    if (list == NULL)
+list_result_t list_sort_parallel(
+    list_t* const list, 
+    const bool ascending, 
+    const uint64_t threadCount, 
+    const confetti_executor_t* const executor
+) {
+    if (list == NULL) 
         return LIST_NULL_ERROR;
-    else if (capacity < 1)
-        return LIST_INVALID_PARAMS_ERROR;
-    else if (capacity == list->capacity)
+    else if (list->sortingFunction != (list_custom_sorting_function_t*) &default_sort)
+        return list_sort(list, ascending); // a custom sorting function decides the order, it's run on the calling thread.
+    else if (list->size < 2) {
+        list->sorted = true;
         return LIST_SUCCESS;
+    }
 
-    list_result_t result;
-    result = list_realloc_capacity(list, capacity);
+    const int64_t size = list->size;
+    const uint64_t slotSize = list_slot_size(list);
+    const uint64_t threads = threadCount == 0 ? confetti_executor_default_thread_count() : threadCount;
+    int64_t runCount = size / LIST_PARALLEL_SORT_THRESHOLD;
 
-    if (result != LIST_SUCCESS) 
-        return result;
+    if ((uint64_t) runCount > threads)
+        runCount = (int64_t) threads;
 
-    return LIST_SUCCESS;
-}
+    list_index_invalidate(list);
+    list->sorted = false;
+
+    // too small to be worth handing to other threads.
+    if (runCount < 2) {
+        introsort(list, 0, size - 1, ascending);
+        list->sorted = ascending;
+        return LIST_SUCCESS;
+    }
 
+    const uint64_t boundsSize = sizeof(int64_t) * (uint64_t) (runCount + 1);
+    const uint64_t bufferSize = slotSize * (uint64_t) size;
 
-list_result_t list_prepend(list_t* list, void* value, const uint64_t size) {
-    if (list == NULL)
-        return LIST_NULL_ERROR;
+    int64_t* const bounds = (int64_t*) list->allocator.allocate(list->allocator.context, boundsSize);
+    uint8_t* const buffer = (uint8_t*) list->allocator.allocate(list->allocator.context, bufferSize);
 
-    if (list->size == list->capacity) {
-        list_result_t result = list_realloc_capacity(list, list->capacity * 2);
+    if (bounds == NULL || buffer == NULL) {
+        list->allocator.deallocate(list->allocator.context, bounds, boundsSize);
+        list->allocator.deallocate(list->allocator.context, buffer, bufferSize);
 
-        if (result != LIST_SUCCESS) 
-            return result;
+        return LIST_ALLOCATION_FAILURE;
     }
 
-    for (int64_t i = list->size - 1; i >= 0; i--)
-        list->items[i + 1] = list->items[i];
-    
-    list_element_t* element = (list_element_t*) malloc(sizeof(list_element_t));
-    list_result_t result = list_element_create(value, size, &element);
+    for (int64_t i = 0; i <= runCount; i++)
+        bounds[i] = size / runCount * i + (size % runCount) * i / runCount;
 
-    if (result != LIST_SUCCESS)
-        return result;
+    list_parallel_sort_t sort = { 
+        list, ascending, slotSize, bounds, runCount, list_slots(list), buffer, (size + runCount - 1) / runCount 
+    };
+    const uint64_t pieceCount = (uint64_t) ((size + sort.pieceSize - 1) / sort.pieceSize);
 
-    list->items[0] = element;
-    list->size++;
+    confetti_executor_run(executor, threads, &list_parallel_sort_run, &sort, (uint64_t) runCount);
 
-    return LIST_SUCCESS;
-}
+    while (sort.runCount > 1) {
+        confetti_executor_run(executor, threads, &list_parallel_merge_piece, &sort, pieceCount);
 
+        const int64_t mergedCount = (sort.runCount + 1) / 2;
 
-list_result_t list_append(list_t* list, void* const value, const uint64_t size) {
-    if (list == NULL)
-        return LIST_NULL_ERROR;
+        for (int64_t i = 0; i < mergedCount; i++)
+            bounds[i] = bounds[i * 2];
 
-    if (list->size == list->capacity) {
-        list_result_t result = list_realloc_capacity(list, list->capacity * 2);
+        bounds[mergedCount] = size;
+        sort.runCount = mergedCount;
 
-        if (result != LIST_SUCCESS) 
-            return result;
+        uint8_t* const merged = sort.destination;
+        sort.destination = sort.source;
+        sort.source = merged;
     }
 
-    list_element_t* element;
-    list_result_t result = list_element_create(value, size, &element);
+    if (sort.source != list_slots(list))
+        memcpy(list_slots(list), sort.source, bufferSize);
 
-    if (result != LIST_SUCCESS)
-        return result;
+    list->allocator.deallocate(list->allocator.context, bounds, boundsSize);
+    list->allocator.deallocate(list->allocator.context, buffer, bufferSize);
+
+    list->sorted = ascending;
 
-    list->items[list->size++] = element;
     return LIST_SUCCESS;
 }
 
 
-list_result_t list_insert(list_t* list, const int64_t index, void* const value, const uint64_t size) {
-    if (list == NULL)
+list_result_t list_sort_by_key(list_t* const list, list_key_function_t* const keyFunction, const bool ascending) {
+    if (list == NULL) 
         return LIST_NULL_ERROR;
-    else if (index > list->size || index < 0)
-        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+    else if (keyFunction == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+    else if (list->size < 2) 
+        return LIST_SUCCESS;
 
-    if (list->size == list->capacity) {
-        list_result_t result = list_realloc_capacity(list, list->capacity * 2);
+    const int64_t size = list->size;
+    const uint64_t slotSize = list_slot_size(list);
+    const uint64_t entriesSize = sizeof(list_key_entry_t) * (uint64_t) size * 2;
+    const uint64_t bufferSize = slotSize * (uint64_t) size;
 
-        if (result != LIST_SUCCESS) return result;
+    list_index_invalidate(list);
+    list->sorted = false;
+
+    list_key_entry_t* entries = (list_key_entry_t*) list->allocator.allocate(list->allocator.context, entriesSize);
+    uint8_t* buffer = (uint8_t*) list->allocator.allocate(list->allocator.context, bufferSize);
+
+    if (entries == NULL || buffer == NULL) {
+        list->allocator.deallocate(list->allocator.context, entries, entriesSize);
+        list->allocator.deallocate(list->allocator.context, buffer, bufferSize);
+
+        return LIST_ALLOCATION_FAILURE;
     }
 
-    for (int i = list->size - 1; i >= index; i--)
-        list->items[i + 1] = list->items[i];
+    // the histograms of every pass are gathered while the keys are extracted.
+    uint64_t counts[LIST_RADIX_PASSES][LIST_RADIX_BUCKETS];
+    memset(counts, 0, sizeof(counts));
 
-    list_result_t createResult = list_element_create(value, size, &list->items[index]);
-    list->size++;
+    for (int64_t i = 0; i < size; i++) {
+        uint64_t key = keyFunction(list_value_at(list, i), list_value_size_at(list, i));
 
-    return LIST_SUCCESS;
-}
+        // inverting the keys reverses their order while keeping equal keys in their original order.
+        if (!ascending)
+            key = ~key;
 
+        entries[i].key = key;
+        entries[i].index = i;
 
-list_result_t list_get(list_t* list,  list_element_t** elementOut, const int64_t index) {
-    if (list == NULL)
-        return LIST_NULL_ERROR;
-    else if (index >= list->size || index < 0)
-        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+        for (int pass = 0; pass < LIST_RADIX_PASSES; pass++)
+            counts[pass][(key >> (pass * LIST_RADIX_BITS)) & (LIST_RADIX_BUCKETS - 1)]++;
+    }
 
-    list_element_t* element;
-    list_result_t result = list_element_clone(list->items[index], &element);
+    list_key_entry_t* source = entries;
+    list_key_entry_t* destination = entries + size;
 
-    if (result != LIST_SUCCESS) {
-        *elementOut = NULL;
-        return result;
+    for (int pass = 0; pass < LIST_RADIX_PASSES; pass++) {
+        const int shift = pass * LIST_RADIX_BITS;
+
+        // every key shares this digit, so the pass would not move anything.
+        if (counts[pass][(source[0].key >> shift) & (LIST_RADIX_BUCKETS - 1)] == (uint64_t) size)
+            continue;
+
+        uint64_t offset = 0;
+
+        for (int bucket = 0; bucket < LIST_RADIX_BUCKETS; bucket++) {
+            uint64_t count = counts[pass][bucket];
+
+            counts[pass][bucket] = offset;
+            offset += count;
+        }
+
+        for (int64_t i = 0; i < size; i++)
+            destination[counts[pass][(source[i].key >> shift) & (LIST_RADIX_BUCKETS - 1)]++] = source[i];
+
+        list_key_entry_t* temp = source;
+
+        source = destination;
+        destination = temp;
     }
 
-    *elementOut = element;
+    uint8_t* const slots = list_slots(list);
+
+    for (int64_t i = 0; i < size; i++)
+        memcpy(buffer + slotSize * (uint64_t) i, slots + slotSize * (uint64_t) source[i].index, slotSize);
+
+    memcpy(slots, buffer, bufferSize);
+
+    list->allocator.deallocate(list->allocator.context, entries, entriesSize);
+    list->allocator.deallocate(list->allocator.context, buffer, bufferSize);
+
     return LIST_SUCCESS;
 }
 
 
-list_result_t list_set(list_t* list, const int64_t index, void* const value, const uint64_t size) {
-    if (list == NULL)
-        return LIST_NULL_ERROR;
-    else if (index >= list->size || index < 0)
-        return LIST_INDEX_OUT_OF_RANGE_ERROR;
-    else if (size == 0)
-        return LIST_INVALID_PARAMS_ERROR;
+uint64_t list_key_from_int64(const int64_t value) {
+    return (uint64_t) value ^ ((uint64_t) 1 << 63);
+}
 
-    if (list->items[index] == NULL) {
-        list_element_t* element;
-        list_result_t result = list_element_create(value, size, &element);
 
-        if (result == LIST_SUCCESS)
-            list->items[index] = element;
-        else
-            return result;
-    }
-    else {
-        list_result_t result = list_element_set(list->items[index], value, size);
+uint64_t list_key_from_double(const double value) {
+    if (value != value)
+        return UINT64_MAX;
 
-        if (result != LIST_SUCCESS)
-            return result;
-    }
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
 
-    return LIST_SUCCESS;
+    // negative numbers have every bit flipped, positive numbers only their sign bit.
+    return (bits & ((uint64_t) 1 << 63)) != 0 ? ~bits : bits | ((uint64_t) 1 << 63);
 }
 
 
-list_result_t list_remove(list_t* list, const int64_t index) {
+list_result_t list_fill(list_t* const list, void* const value, const uint64_t size) {
     if (list == NULL)
         return LIST_NULL_ERROR;
-    else if (index >= list->capacity || index < 0)
-        return LIST_INDEX_OUT_OF_RANGE_ERROR;
 
-    list_result_t freeResult = list_element_free(&list->items[index]);
+    if (list->stride != 0) {
+        if (size != list->stride)
+            return LIST_INVALID_PARAMS_ERROR;
 
-    if (freeResult != LIST_SUCCESS)
-        return freeResult;
+        const int64_t oldSize = list->size;
 
-    for (int64_t i = index; i < list->size - 1; i++)
-        list->items[i] = list->items[i + 1];
+        for (int64_t i = list->size; i < list->capacity; i++)
+            list_fixed_write(list, i, value);
 
-    list->size--;
-    return LIST_SUCCESS;
-}
+        list->size = list->capacity;
+        list_index_added(list, oldSize, list->size - oldSize);
+        list_sorted_changed(list, oldSize, list->size - oldSize);
 
+        return LIST_SUCCESS;
+    }
 
-list_result_t list_pop(list_t* const list, list_element_t** elementOut, const int64_t index) {
-    if (list == NULL)
-        return LIST_NULL_ERROR;
-    else if (index >= list->capacity || index < 0)
-        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+    for (int64_t i = list->size; i < list->capacity; i++) {
+        list_element_t* element;
+        list_result_t result = list_element_create(&list->allocator, value, size, &element);
 
-    list_result_t cloneResult = list_element_clone(list->items[index], elementOut);
-    
-    if (cloneResult != LIST_SUCCESS)
-        return cloneResult;
-    
-    list_result_t freeResult = list_element_free(&list->items[index]);
+        if (result != LIST_SUCCESS)
+            return result;
 
-    if (freeResult != LIST_SUCCESS)
-        return freeResult;
+        list->items[i] = element;
+    }
 
-    for (int64_t i = index; i < list->size - 1; i++)
-        list->items[i] = list->items[i + 1];
+    const int64_t oldSize = list->size;
+
+    list->size = list->capacity;
+    list_index_added(list, oldSize, list->size - oldSize);
+    list_sorted_changed(list, oldSize, list->size - oldSize);
 
-    list->size--;
     return LIST_SUCCESS;
 }
 
 
-list_result_t list_reverse(list_t* const list) {
+list_result_t list_swap(list_t* const list, const int64_t index1, const int64_t index2) {
     if (list == NULL)
         return LIST_NULL_ERROR;
+    else if (index1 >= list->size || index1 < 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+    else if (index2 >= list->size || index2 < 0)
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
 
-    list_element_t** start = list->items;
-    list_element_t** end = list->items + list->size - 1;
-    int64_t mid = list->size / 2LL;
-
-    for (int64_t i = 0LL; i < mid; i++) {
-        list_element_t* leftElement = *start;
-        list_element_t* rightElement = *end;
-
-        *start = rightElement;
-        *end = leftElement;
+    if (index1 == index2)
+        return LIST_SUCCESS;
 
-        start++;
-        end--;
-    }
+    list_index_erase_at(list, index1);
+    list_index_erase_at(list, index2);
+    list_swap_at(list, index1, index2);
+    list_index_insert_at(list, index1);
+    list_index_insert_at(list, index2);
+    list_sorted_changed(list, index1, 1);
+    list_sorted_changed(list, index2, 1);
 
     return LIST_SUCCESS;
 }
 
 
-list_result_t list_clone(list_t* const list, list_t** listOut) {
+list_result_t list_save(list_t* const list, const char* const path) {
     if (list == NULL)
         return LIST_NULL_ERROR;
+    else if (path == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
 
-    list_t* const listClone = (list_t*) malloc(sizeof(list_t));
+    const confetti_allocator_t* const allocator = confetti_allocator_default();
+    const uint64_t count = (uint64_t) list->size;
+    confetti_file_header_t header = { CONFETTI_FILE_MAGIC, CONFETTI_FILE_VERSION, count, list->stride, list->stride * count };
+    confetti_file_entry_t* entries = NULL;
 
-    if (list == NULL)
-        return LIST_ALLOCATION_FAILURE;
+    if (list->stride == 0 && count > 0) {
+        entries = (confetti_file_entry_t*) allocator->allocate(allocator->context, sizeof(confetti_file_entry_t) * count);
 
-    listClone->size = list->size;
-    listClone->capacity = list->capacity;
-    listClone->items = (list_element_t**) calloc(listClone->capacity, sizeof(list_element_t*));
+        if (entries == NULL)
+            return LIST_ALLOCATION_FAILURE;
 
-    if (listClone->items == NULL)
-        return LIST_ALLOCATION_FAILURE;
+        for (uint64_t i = 0; i < count; i++) {
+            const list_element_t* const element = list->items[i];
 
-    for (int64_t i = 0LL; i < list->size; i++) {
-        list_element_t* elementClone;
-        list_result_t result = list_element_clone(list->items[i], &elementClone);
+            entries[i].offset = element->value == NULL ? CONFETTI_FILE_NO_VALUE : header.payloadSize;
+            entries[i].size = element->size;
 
-        listClone->items[i] = elementClone;
+            if (element->value != NULL)
+                header.payloadSize += element->size;
+        }
     }
-        
-    *listOut = listClone;
-    return LIST_SUCCESS;
-}
 
+    FILE* const file = fopen(path, "wb");
 
-list_result_t list_clear(list_t* const list) {
-    if (list == NULL)
-        return LIST_NULL_ERROR;
+    if (file == NULL) {
+        allocator->deallocate(allocator->context, entries, sizeof(confetti_file_entry_t) * count);
+        return LIST_FILE_ERROR;
+    }
 
-    for (int64_t i = 0; i < list->size; i++) {
-        list_element_free(&list->items[i]);
+    setvbuf(file, NULL, _IOFBF, CONFETTI_FILE_BUFFER_SIZE);
+
+    bool written = fwrite(&header, sizeof(confetti_file_header_t), 1, file) == 1;
+
+    if (list->stride != 0 && count > 0)
+        written = written && fwrite(list_value_at(list, 0), (size_t) list->stride, (size_t) count, file) == (size_t) count;
+    else if (count > 0) {
+        written = written && fwrite(entries, sizeof(confetti_file_entry_t), (size_t) count, file) == (size_t) count;
+
+        for (uint64_t i = 0; written && i < count; i++) {
+            const list_element_t* const element = list->items[i];
+
+            if (element->value != NULL)
+                written = fwrite(element->value, 1, (size_t) element->size, file) == (size_t) element->size;
+        }
     }
 
-    list->size = 0;
-    return LIST_SUCCESS;
+    // the file is closed even if a write failed, closing flushes the buffer so it can fail too.
+    written = fclose(file) == 0 && written;
+    allocator->deallocate(allocator->context, entries, sizeof(confetti_file_entry_t) * count);
+
+    return written ? LIST_SUCCESS : LIST_FILE_ERROR;
 }
 
 
-list_result_t list_join(list_t* const list1, list_t* const list2, list_t** listOut) {
-    if (list1 == NULL)
-        return LIST_NULL_ERROR;
-    else if (list2 == NULL)
-        return LIST_NULL_ERROR;
+list_result_t list_load(list_t** listOut, const char* const path, const list_options_t* const options) {
+    if (listOut == NULL || path == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
 
-    list_t* joinList;
-    list_result_t result = list_create(&joinList, (list1->size + list2->size), NULL, NULL);
+    FILE* const file = fopen(path, "rb");
 
-    if (result != LIST_SUCCESS)
-        return result;
+    if (file == NULL)
+        return LIST_FILE_ERROR;
 
-    list_element_t** tempJoinListPointer = joinList->items;
+    setvbuf(file, NULL, _IOFBF, CONFETTI_FILE_BUFFER_SIZE);
 
-    for (int64_t i = 0; i < list1->size; i++) {
-        list_element_t* element;
-        list_element_clone(list1->items[i], &element);
+    confetti_file_header_t header;
 
-        *tempJoinListPointer = element;
-        tempJoinListPointer++;
+    if (
+        fread(&header, sizeof(confetti_file_header_t), 1, file) != 1 
+        || !confetti_file_header_check(&header) 
+        || !confetti_file_body_fits(file, &header)
+    ) {
+        fclose(file);
+        return LIST_FILE_ERROR;
     }
 
-    for (int64_t i = 0; i < list2->size; i++) {
-        list_element_t* element;
-        list_element_clone(list2->items[i], &element);
+    list_options_t settings = { 0, 0, NULL, NULL, NULL, LIST_FLAG_NONE, NULL, NULL, { 0, 0, 0 } };
+
+    if (options != NULL)
+        settings = *options;
+
+    settings.capacity = (int64_t) header.count;
+    settings.elementSize = header.stride;
+
+    list_t* list = NULL;
+    list_result_t createResult = list_create_with_options(&list, &settings);
 
-        *tempJoinListPointer = element;
-        tempJoinListPointer++;
+    if (createResult != LIST_SUCCESS) {
+        fclose(file);
+        return createResult;
     }
 
-    joinList->size = joinList->capacity;
-    *listOut = joinList;
-    return LIST_SUCCESS;
-}
+    if (header.stride != 0) {
+        const bool read = header.count == 0 || fread(list->data, (size_t) header.stride, (size_t) header.count, file) == (size_t) header.count;
 
+        fclose(file);
 
-list_result_t list_includes(list_t* const list, void* value, const uint64_t size) {
-    if (list == NULL)
-        return LIST_NULL_ERROR;
+        if (!read) {
+            list_free(&list);
+            return LIST_FILE_ERROR;
+        }
 
-    for (int64_t i = 0LL; i < list->size; i++)
-    {
-        list_element_t* element = list->items[i];
+        list->size = (int64_t) header.count;
+        list_index_added(list, 0, list->size);
 
-        if (element->size != size)
-            continue;
+        *listOut = list;
+        return LIST_SUCCESS;
+    }
 
-        if (list->equalityFunction(element->value, value, element->size) == 0)
-            return LIST_SUCCESS;
+    // the table and the values are read at once, then every element is created from the buffer.
+    const confetti_allocator_t* const allocator = confetti_allocator_default();
+    const uint64_t bodySize = confetti_file_body_size(&header);
+    uint8_t* const body = bodySize == 0 ? NULL : (uint8_t*) allocator->allocate(allocator->context, bodySize);
+
+    if (bodySize != 0 && body == NULL) {
+        fclose(file);
+        list_free(&list);
+        return LIST_ALLOCATION_FAILURE;
     }
 
-    return LIST_ELEMENT_NOT_FOUND_ERROR;
-}
+    const bool read = bodySize == 0 || fread(body, 1, (size_t) bodySize, file) == (size_t) bodySize;
+    const confetti_file_entry_t* const entries = (const confetti_file_entry_t*) body;
+    const uint8_t* const payload = body + sizeof(confetti_file_entry_t) * header.count;
 
+    fclose(file);
 
-list_result_t list_find_first(
-    list_t* const list, 
-    int64_t* const indexOut, 
-    const int64_t startIndex, 
-    void* const value, 
-    const uint64_t size
-) {
-    if (list == NULL) {
-        *indexOut = -1;
-        return LIST_NULL_ERROR;
-    }
-    else if (startIndex >= list->size || startIndex < 0) {
-        *indexOut = -1;
-        return LIST_INVALID_PARAMS_ERROR;
-    }
-    else if (size <= 0) {
-        *indexOut = -1;
-        return LIST_INVALID_PARAMS_ERROR;
+    if (!read || !confetti_file_entries_check(entries, header.count, header.payloadSize)) {
+        allocator->deallocate(allocator->context, body, bodySize);
+        list_free(&list);
+        return LIST_FILE_ERROR;
     }
 
-    int64_t index = startIndex > 0LL ? startIndex : 0LL;
-
-    for (int64_t i = index; i < list->size; i++) {
-        list_element_t* element = list->items[i];
+    for (uint64_t i = 0; i < header.count; i++) {
+        const void* const value = entries[i].offset == CONFETTI_FILE_NO_VALUE ? NULL : payload + entries[i].offset;
+        list_result_t result = list_element_create(&list->allocator, value, entries[i].size, &list->items[i]);
 
-        if (element->size != size)
-            continue;
+        if (result != LIST_SUCCESS) {
+            list->size = (int64_t) i;
+            allocator->deallocate(allocator->context, body, bodySize);
+            list_free(&list);
 
-        if (list->equalityFunction(element->value, value, element->size) == 0) {
-            *indexOut = i;
-            return LIST_SUCCESS;
+            return result;
         }
     }
 
-    *indexOut = -1;
-    return LIST_ELEMENT_NOT_FOUND_ERROR;
+    allocator->deallocate(allocator->context, body, bodySize);
+
+    list->size = (int64_t) header.count;
+    list_index_added(list, 0, list->size);
+
+    *listOut = list;
+    return LIST_SUCCESS;
 }
 
 
-list_result_t list_find_last(list_t* const list, int64_t* indexOut, const int64_t startIndex, void* value, const uint64_t size) {
-    if (list == NULL) {
-        *indexOut = -1;
-        return LIST_NULL_ERROR;
-    }
-    else if (startIndex >= list->size || startIndex < 0) {
-        *indexOut = -1;
-        return LIST_INDEX_OUT_OF_RANGE_ERROR;
-    }
-    else if (size <= 0) {
-        *indexOut = -1;
+list_result_t list_open_mapped(list_mapped_t** mappedOut, const char* const path) {
+    if (mappedOut == NULL || path == NULL)
         return LIST_INVALID_PARAMS_ERROR;
-    }
 
-    int64_t index = -1;
+    confetti_file_map_t map;
 
-    for (int64_t i = startIndex; i < list->size; i++) {
-        list_element_t* element = list->items[i];
+    if (!confetti_file_map(path, &map))
+        return LIST_FILE_ERROR;
 
-        if (element->size != size)
-            continue;
+    confetti_file_header_t header;
 
-        if (list->equalityFunction(element->value, value, element->size) == 0) 
-            index = i;
+    if (map.size < sizeof(confetti_file_header_t)) {
+        confetti_file_unmap(&map);
+        return LIST_FILE_ERROR;
     }
 
-    *indexOut = index;
-    return index != -1 ? LIST_SUCCESS : LIST_ELEMENT_NOT_FOUND_ERROR;
-}
-
-
-list_result_t list_sort(list_t* const list, const bool ascending) {
-    if (list == NULL) 
-        return LIST_NULL_ERROR;
-    else if (list->size == 0 || list->size == 1) 
-        return LIST_SUCCESS;
-    
-    return list->sortingFunction(list, ascending);
-}
+    memcpy(&header, map.data, sizeof(confetti_file_header_t));
 
+    // the header is a multiple of 8 bytes long, so the table following it is aligned inside the page aligned mapping.
+    const confetti_file_entry_t* const entries = (const confetti_file_entry_t*) (map.data + sizeof(confetti_file_header_t));
 
-list_result_t list_fill(list_t* const list, void* const value, const uint64_t size) {
-    if (list == NULL)
-        return LIST_NULL_ERROR;
-
-    for (int64_t i = list->size; i < list->capacity; i++) {
-        list_element_t* element;
-        list_result_t result = list_element_create(value, size, &element);
+    if (
+        !confetti_file_header_check(&header) 
+        || confetti_file_body_size(&header) > map.size - sizeof(confetti_file_header_t)
+        || (header.stride == 0 && !confetti_file_entries_check(entries, header.count, header.payloadSize))
+    ) {
+        confetti_file_unmap(&map);
+        return LIST_FILE_ERROR;
+    }
 
-        if (result != LIST_SUCCESS)
-            return result;
+    const confetti_allocator_t* const allocator = confetti_allocator_default();
+    list_mapped_t* const mapped = (list_mapped_t*) allocator->allocate(allocator->context, sizeof(list_mapped_t));
 
-        list->items[i] = element;
+    if (mapped == NULL) {
+        confetti_file_unmap(&map);
+        return LIST_ALLOCATION_FAILURE;
     }
 
-    list->size = list->capacity;
+    mapped->size = (int64_t) header.count;
+    mapped->stride = header.stride;
+    mapped->table = header.stride == 0 ? (const uint64_t*) entries : NULL;
+    mapped->payload = (const uint8_t*) entries + (header.stride == 0 ? sizeof(confetti_file_entry_t) * header.count : 0);
+    mapped->data = map.data;
+    mapped->mappedSize = map.size;
+    mapped->handle = map.handle;
+
+    *mappedOut = mapped;
     return LIST_SUCCESS;
 }
 
 
-list_result_t list_swap(list_t* const list, const int64_t index1, const int64_t index2) {
-    if (list == NULL)
+list_result_t list_mapped_peek(
+    const list_mapped_t* const mapped, 
+    const void** valueOut, 
+    uint64_t* const sizeOut, 
+    const int64_t index
+) {
+    if (mapped == NULL)
         return LIST_NULL_ERROR;
-    else if (index1 >= list->size || index1 < 0)
-        return LIST_INDEX_OUT_OF_RANGE_ERROR;
-    else if (index2 >= list->size || index2 < 0)
+    else if (index >= mapped->size || index < 0)
         return LIST_INDEX_OUT_OF_RANGE_ERROR;
 
-    if (index1 == index2)
+    if (mapped->stride != 0) {
+        *valueOut = mapped->payload + mapped->stride * (uint64_t) index;
+
+        if (sizeOut != NULL)
+            *sizeOut = mapped->stride;
+
         return LIST_SUCCESS;
+    }
 
-    list_element_t* temp = list->items[index1];
+    const uint64_t offset = mapped->table[2 * index];
 
-    list->items[index1] = list->items[index2];
-    list->items[index2] = temp;
+    *valueOut = offset == CONFETTI_FILE_NO_VALUE ? NULL : mapped->payload + offset;
+
+    if (sizeOut != NULL)
+        *sizeOut = mapped->table[2 * index + 1];
 
     return LIST_SUCCESS;
 }
 
 
-list_result_t list_element_free(list_element_t** element) {
-    if (*element == NULL)
-        return LIST_INVALID_PARAMS_ERROR;
+list_result_t list_mapped_close(list_mapped_t** mapped) {
+    if (*mapped == NULL)
+        return LIST_NULL_ERROR;
 
-    free((*element)->value);
-    free(*element);
+    confetti_file_map_t map = { (*mapped)->data, (*mapped)->mappedSize, (*mapped)->handle };
 
-    (*element)->value = NULL;
-    (*element)->size = 0;
-    *element = NULL;
+    confetti_file_unmap(&map);
+    confetti_allocator_default()->deallocate(confetti_allocator_default()->context, *mapped, sizeof(list_mapped_t));
+    *mapped = NULL;
 
     return LIST_SUCCESS;
 }
 
 
+list_result_t list_element_free(list_element_t** element) {
+    return list_element_release(confetti_allocator_default(), element);
+}
+
+
 list_result_t list_iterator_create(list_iterator_t** iteratorOut, list_t* list) {
     if (list == NULL)
         return LIST_NULL_ERROR;
 
     list_iterator_t* iterator = (list_iterator_t*) malloc(sizeof(list_iterator_t));
 
-    iterator->list = list;
-    iterator->index = -1;
-    iterator->element = NULL;
+    if (iterator == NULL)
+        return LIST_ALLOCATION_FAILURE;
+
+    list_iterator_init(iterator, list);
 
     *iteratorOut = iterator;
     return LIST_SUCCESS;
@@ -908,20 +4073,8 @@ list_result_t list_iterator_next(list_iterator_t* iterator) {
     if (iterator == NULL)
         return LIST_INVALID_PARAMS_ERROR;
 
-    if (iterator->index == -1) {
-        iterator->index = 0;
-        iterator->element = iterator->list->items[iterator->index];
-    } 
-    else if (iterator->index + 1 >= iterator->list->size) {
-        iterator->index = -1;
-        iterator->element = NULL;
-
+    if (!list_iterator_step(iterator))
         return LIST_INDEX_OUT_OF_RANGE_ERROR;
-    }
-    else {
-        iterator->index++;
-        iterator->element = iterator->list->items[iterator->index];
-    }
 
     return LIST_SUCCESS;
 }
@@ -951,4 +4104,48 @@ list_result_t list_iterator_free(list_iterator_t** iterator) {
     return LIST_SUCCESS;
 }
 
+
+list_result_t list_iterator_init(list_iterator_t* const iterator, list_t* const list) {
+    return list_iterator_init_range(iterator, list, 0, -1, false);
+}
+
+
+list_result_t list_iterator_init_reverse(list_iterator_t* const iterator, list_t* const list) {
+    return list_iterator_init_range(iterator, list, 0, -1, true);
+}
+
+
+list_result_t list_iterator_init_range(
+    list_iterator_t* const iterator, 
+    list_t* const list, 
+    const int64_t startIndex, 
+    const int64_t endIndex, 
+    const bool reverse
+) {
+    if (iterator == NULL)
+        return LIST_INVALID_PARAMS_ERROR;
+
+    iterator->list = NULL;
+    iterator->index = -1;
+    iterator->element = NULL;
+    iterator->view.value = NULL;
+    iterator->view.size = 0;
+    iterator->startIndex = 0;
+    iterator->endIndex = -1;
+    iterator->reverse = reverse;
+
+    if (list == NULL)
+        return LIST_NULL_ERROR;
+
+    // an end index of -1 follows the size of the list as it changes.
+    if (startIndex < 0 || (endIndex != -1 && (endIndex > list->size || startIndex > endIndex)))
+        return LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    iterator->list = list;
+    iterator->startIndex = startIndex;
+    iterator->endIndex = endIndex;
+
+    return LIST_SUCCESS;
+}
+
 #pragma endregion
@@ -0,0 +1,206 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "ring_queue.h"
+#include "confetti_atomic.h"
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Returns the cell a position of the ring queue maps to.
+ *
+ * @param ringQueue Pointer to the ring queue.
+ * @param position The position.
+ *
+ * @return Pointer to the sequence number of the cell, its value follows right after it.
+ */
+static volatile uint64_t* ring_queue_cell(const ring_queue_t* const ringQueue, const uint64_t position);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static volatile uint64_t* ring_queue_cell(const ring_queue_t* const ringQueue, const uint64_t position) {
+    return (volatile uint64_t*) (ringQueue->cells + (position & (ringQueue->capacity - 1)) * ringQueue->cellSize);
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+ring_queue_result_t ring_queue_create(ring_queue_t** ringQueueOut, const uint64_t capacity, const uint64_t stride) {
+    ring_queue_options_t options = { capacity, stride, NULL };
+
+    return ring_queue_create_with_options(ringQueueOut, &options);
+}
+
+
+ring_queue_result_t ring_queue_create_with_options(ring_queue_t** ringQueueOut, const ring_queue_options_t* const options) {
+    if (options == NULL || options->stride == 0)
+        return RING_QUEUE_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const allocator = options->allocator == NULL 
+        ? confetti_allocator_default() 
+        : options->allocator;
+
+    if (allocator->allocate == NULL || allocator->reallocate == NULL || allocator->deallocate == NULL)
+        return RING_QUEUE_INVALID_PARAMS_ERROR;
+
+    const uint64_t requestedCapacity = options->capacity == 0 ? DEFAULT_RING_QUEUE_CAPACITY : options->capacity;
+    uint64_t capacity = 2;
+
+    while (capacity < requestedCapacity) {
+        if (capacity > UINT64_MAX / 2)
+            return RING_QUEUE_ALLOCATION_FAILURE;
+
+        capacity <<= 1;
+    }
+
+    // every cell keeps its value 8 byte aligned after its sequence number.
+    const uint64_t cellSize = sizeof(uint64_t) + ((options->stride + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1));
+
+    if (capacity > UINT64_MAX / cellSize)
+        return RING_QUEUE_ALLOCATION_FAILURE;
+
+    ring_queue_t* const ringQueue = (ring_queue_t*) allocator->allocate(allocator->context, sizeof(ring_queue_t));
+
+    if (ringQueue == NULL)
+        return RING_QUEUE_ALLOCATION_FAILURE;
+
+    ringQueue->cells = (uint8_t*) allocator->allocate(allocator->context, capacity * cellSize);
+
+    if (ringQueue->cells == NULL) {
+        allocator->deallocate(allocator->context, ringQueue, sizeof(ring_queue_t));
+        return RING_QUEUE_ALLOCATION_FAILURE;
+    }
+
+    ringQueue->capacity = capacity;
+    ringQueue->stride = options->stride;
+    ringQueue->cellSize = cellSize;
+    ringQueue->allocator = *allocator;
+    ringQueue->pushPosition = 0;
+    ringQueue->popPosition = 0;
+
+    // a cell is free to push to once its sequence number equals the pushing position.
+    for (uint64_t position = 0; position < capacity; position++)
+        *ring_queue_cell(ringQueue, position) = position;
+
+    *ringQueueOut = ringQueue;
+    return RING_QUEUE_SUCCESS;
+}
+
+
+ring_queue_result_t ring_queue_free(ring_queue_t** ringQueue) {
+    if (*ringQueue == NULL)
+        return RING_QUEUE_NULL_ERROR;
+
+    confetti_allocator_t allocator = (*ringQueue)->allocator;
+
+    allocator.deallocate(allocator.context, (*ringQueue)->cells, (*ringQueue)->capacity * (*ringQueue)->cellSize);
+    allocator.deallocate(allocator.context, *ringQueue, sizeof(ring_queue_t));
+    *ringQueue = NULL;
+
+    return RING_QUEUE_SUCCESS;
+}
+
+
+ring_queue_result_t ring_queue_push(ring_queue_t* const ringQueue, const void* const value) {
+    if (ringQueue == NULL)
+        return RING_QUEUE_NULL_ERROR;
+    else if (value == NULL)
+        return RING_QUEUE_INVALID_PARAMS_ERROR;
+
+    uint64_t position = confetti_atomic_load_relaxed(&ringQueue->pushPosition);
+    volatile uint64_t* cell = NULL;
+
+    while (true) {
+        cell = ring_queue_cell(ringQueue, position);
+
+        const int64_t difference = (int64_t) (confetti_atomic_load(cell) - position);
+
+        // the cell still holds the value pushed a lap ago, which hasn't been popped yet.
+        if (difference < 0)
+            return RING_QUEUE_FULL_ERROR;
+        else if (difference == 0 && confetti_atomic_compare_exchange(&ringQueue->pushPosition, &position, position + 1))
+            break;
+        else if (difference > 0)
+            position = confetti_atomic_load_relaxed(&ringQueue->pushPosition);
+    }
+
+    memcpy((void*) (cell + 1), value, ringQueue->stride);
+    confetti_atomic_store(cell, position + 1);
+
+    return RING_QUEUE_SUCCESS;
+}
+
+
+ring_queue_result_t ring_queue_pop(ring_queue_t* const ringQueue, void* const valueOut) {
+    if (ringQueue == NULL)
+        return RING_QUEUE_NULL_ERROR;
+    else if (valueOut == NULL)
+        return RING_QUEUE_INVALID_PARAMS_ERROR;
+
+    uint64_t position = confetti_atomic_load_relaxed(&ringQueue->popPosition);
+    volatile uint64_t* cell = NULL;
+
+    while (true) {
+        cell = ring_queue_cell(ringQueue, position);
+
+        const int64_t difference = (int64_t) (confetti_atomic_load(cell) - (position + 1));
+
+        // the cell hasn't been pushed to since it was last popped.
+        if (difference < 0)
+            return RING_QUEUE_EMPTY_ERROR;
+        else if (difference == 0 && confetti_atomic_compare_exchange(&ringQueue->popPosition, &position, position + 1))
+            break;
+        else if (difference > 0)
+            position = confetti_atomic_load_relaxed(&ringQueue->popPosition);
+    }
+
+    memcpy(valueOut, (const void*) (cell + 1), ringQueue->stride);
+
+    // the cell becomes free to push to on the next lap.
+    confetti_atomic_store(cell, position + ringQueue->capacity);
+
+    return RING_QUEUE_SUCCESS;
+}
+
+
+ring_queue_result_t ring_queue_size(ring_queue_t* const ringQueue, uint64_t* const sizeOut) {
+    if (ringQueue == NULL)
+        return RING_QUEUE_NULL_ERROR;
+    else if (sizeOut == NULL)
+        return RING_QUEUE_INVALID_PARAMS_ERROR;
+
+    const uint64_t popPosition = confetti_atomic_load(&ringQueue->popPosition);
+    const uint64_t pushPosition = confetti_atomic_load(&ringQueue->pushPosition);
+
+    const uint64_t size = pushPosition - popPosition;
+
+    // both positions may move between the two loads, pushes can't outrun pops by more than a lap though.
+    *sizeOut = size < ringQueue->capacity ? size : ringQueue->capacity;
+
+    return RING_QUEUE_SUCCESS;
+}
+
+#pragma endregion
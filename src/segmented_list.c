@@ -0,0 +1,751 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "segmented_list.h"
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Returns the amount of blocks needed to hold an amount of elements.
+ *
+ * @param list Pointer to the segmented list.
+ * @param size The amount of elements.
+ *
+ * @return The amount of blocks.
+ */
+static uint64_t segmented_list_blocks_for(const segmented_list_t* const list, const uint64_t size);
+
+/**
+ * @brief Returns a pointer to the slot of the element at an index.
+ *
+ * @param list Pointer to the segmented list.
+ * @param index The index of the element, whose block is assumed to be allocated.
+ *
+ * @return Pointer to the inline value or `segmented_list_element_t` of the element.
+ */
+static uint8_t* segmented_list_slot(const segmented_list_t* const list, const uint64_t index);
+
+/**
+ * @brief Makes sure an amount of blocks is allocated, growing the directory if needed.
+ *
+ * Only the directory of block pointers is ever reallocated, blocks themselves stay where they are.
+ *
+ * @param list Pointer to the segmented list.
+ * @param blockCount The amount of blocks needed.
+ *
+ * @return
+ * - `SEGMENTED_LIST_SUCCESS` if enough blocks are allocated.
+ * 
+ * - `SEGMENTED_LIST_ALLOCATION_FAILURE` if memory allocation failed, blocks allocated before failing are kept.
+ */
+static segmented_list_result_t segmented_list_reserve_blocks(segmented_list_t* const list, const uint64_t blockCount);
+
+/**
+ * @brief Returns every block past an amount of blocks to the allocator.
+ *
+ * @param list Pointer to the segmented list.
+ * @param blockCount The amount of blocks to keep.
+ */
+static void segmented_list_release_blocks(segmented_list_t* const list, const uint64_t blockCount);
+
+/**
+ * @brief Frees the values of a range of elements of a segmented list of variable sized values.
+ *
+ * Does nothing for inline segmented lists.
+ *
+ * @param list Pointer to the segmented list.
+ * @param start The index of the first element.
+ * @param end The index one past the last element.
+ */
+static void segmented_list_release_values(segmented_list_t* const list, const uint64_t start, const uint64_t end);
+
+/**
+ * @brief Writes a value into the slot of an element.
+ *
+ * An element of a segmented list of variable sized values must not hold a value yet.
+ *
+ * @param list Pointer to the segmented list.
+ * @param slot Pointer to the slot.
+ * @param value Pointer to the value to copy, or NULL for a zeroed inline value or no value.
+ * @param size The size of the value.
+ *
+ * @return
+ * - `SEGMENTED_LIST_SUCCESS` if the value was written.
+ * 
+ * - `SEGMENTED_LIST_ALLOCATION_FAILURE` if a variable sized value couldn't be allocated.
+ */
+static segmented_list_result_t segmented_list_slot_write(
+    segmented_list_t* const list, 
+    uint8_t* const slot, 
+    const void* const value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Allocates an element with the default allocator for a value handed to the caller.
+ *
+ * @param value Pointer to the value to copy, or NULL for no value.
+ * @param size The size of the value.
+ * @param elementOut Double pointer to where the element will be stored.
+ *
+ * @return
+ * - `SEGMENTED_LIST_SUCCESS` if the element was created.
+ * 
+ * - `SEGMENTED_LIST_ALLOCATION_FAILURE` if memory allocation failed.
+ */
+static segmented_list_result_t segmented_list_element_create(const void* const value, const uint64_t size, segmented_list_element_t** elementOut);
+
+/**
+ * @brief Default function for comparing two elements for equality.
+ *
+ * @param data1 Pointer to the first data element.
+ * @param data2 Pointer to the second data element.
+ * @param size Size of the data elements to be compared.
+ *
+ * @return 
+ * - `0` if elements are equal.
+ * 
+ * - A negative value if the first element is less than the second.
+ * 
+ * - A positive value if the first element is greater than the second.
+ */
+static int32_t default_equals(const void* const data1, const void* const data2, const uint64_t size);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static uint64_t segmented_list_blocks_for(const segmented_list_t* const list, const uint64_t size) {
+    return (size + list->blockCapacity - 1) >> list->blockShift;
+}
+
+
+static uint8_t* segmented_list_slot(const segmented_list_t* const list, const uint64_t index) {
+    return list->blocks[index >> list->blockShift] + (index & (list->blockCapacity - 1)) * list->slotSize;
+}
+
+
+static segmented_list_result_t segmented_list_reserve_blocks(segmented_list_t* const list, const uint64_t blockCount) {
+    if (blockCount > list->directoryCapacity) {
+        uint64_t directoryCapacity = list->directoryCapacity;
+
+        while (directoryCapacity < blockCount)
+            directoryCapacity *= 2;
+
+        uint8_t** const blocks = (uint8_t**) list->allocator.reallocate(
+            list->allocator.context, 
+            list->blocks, 
+            sizeof(uint8_t*) * list->directoryCapacity, 
+            sizeof(uint8_t*) * directoryCapacity
+        );
+
+        if (blocks == NULL)
+            return SEGMENTED_LIST_ALLOCATION_FAILURE;
+
+        list->blocks = blocks;
+        list->directoryCapacity = directoryCapacity;
+    }
+
+    const uint64_t blockSize = list->slotSize * list->blockCapacity;
+
+    while (list->blockCount < blockCount) {
+        uint8_t* const block = (uint8_t*) list->allocator.allocate(list->allocator.context, blockSize);
+
+        if (block == NULL)
+            return SEGMENTED_LIST_ALLOCATION_FAILURE;
+
+        list->blocks[list->blockCount++] = block;
+    }
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+static void segmented_list_release_blocks(segmented_list_t* const list, const uint64_t blockCount) {
+    const uint64_t blockSize = list->slotSize * list->blockCapacity;
+
+    while (list->blockCount > blockCount) {
+        list->blockCount--;
+        list->allocator.deallocate(list->allocator.context, list->blocks[list->blockCount], blockSize);
+        list->blocks[list->blockCount] = NULL;
+    }
+}
+
+
+static void segmented_list_release_values(segmented_list_t* const list, const uint64_t start, const uint64_t end) {
+    if (list->stride != 0)
+        return;
+
+    for (uint64_t i = start; i < end; i++) {
+        segmented_list_element_t* const element = (segmented_list_element_t*) segmented_list_slot(list, i);
+
+        list->allocator.deallocate(list->allocator.context, element->value, element->size);
+        element->value = NULL;
+        element->size = 0;
+    }
+}
+
+
+static segmented_list_result_t segmented_list_slot_write(
+    segmented_list_t* const list, 
+    uint8_t* const slot, 
+    const void* const value, 
+    const uint64_t size
+) {
+    if (list->stride != 0) {
+        if (value != NULL)
+            memcpy(slot, value, list->stride);
+        else
+            memset(slot, 0, list->stride);
+
+        return SEGMENTED_LIST_SUCCESS;
+    }
+
+    segmented_list_element_t* const element = (segmented_list_element_t*) slot;
+
+    element->value = NULL;
+    element->size = size;
+
+    if (value == NULL)
+        return SEGMENTED_LIST_SUCCESS;
+
+    element->value = list->allocator.allocate(list->allocator.context, size);
+
+    if (element->value == NULL) {
+        element->size = 0;
+        return SEGMENTED_LIST_ALLOCATION_FAILURE;
+    }
+
+    memcpy(element->value, value, size);
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+static segmented_list_result_t segmented_list_element_create(const void* const value, const uint64_t size, segmented_list_element_t** elementOut) {
+    const confetti_allocator_t* const allocator = confetti_allocator_default();
+    segmented_list_element_t* const element = (segmented_list_element_t*) allocator->allocate(allocator->context, sizeof(segmented_list_element_t));
+
+    if (element == NULL)
+        return SEGMENTED_LIST_ALLOCATION_FAILURE;
+
+    element->value = NULL;
+    element->size = size;
+
+    if (value != NULL) {
+        element->value = allocator->allocate(allocator->context, size);
+
+        if (element->value == NULL) {
+            allocator->deallocate(allocator->context, element, sizeof(segmented_list_element_t));
+            return SEGMENTED_LIST_ALLOCATION_FAILURE;
+        }
+
+        memcpy(element->value, value, size);
+    }
+
+    *elementOut = element;
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+static int32_t default_equals(const void* const data1, const void* const data2, const uint64_t size) {
+    if (data1 == NULL && data2 != NULL)
+        return -1;
+    else if (data1 != NULL && data2 == NULL) 
+        return 1;
+    else if (data1 == NULL && data2 == NULL)
+        return 0;
+
+    return memcmp(data1, data2, size);
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+segmented_list_result_t segmented_list_create(
+    segmented_list_t** listOut, 
+    const uint64_t elementSize, 
+    segmented_list_custom_equality_function_t* const customEqualityFunction
+) {
+    segmented_list_options_t options = { elementSize, 0, customEqualityFunction, NULL };
+
+    return segmented_list_create_with_options(listOut, &options);
+}
+
+
+segmented_list_result_t segmented_list_create_with_options(
+    segmented_list_t** listOut, 
+    const segmented_list_options_t* const options
+) {
+    segmented_list_options_t defaults = { 0, 0, NULL, NULL };
+    const segmented_list_options_t* const settings = options == NULL ? &defaults : options;
+    const confetti_allocator_t* const allocator = settings->allocator == NULL 
+        ? confetti_allocator_default() 
+        : settings->allocator;
+
+    if (allocator->allocate == NULL || allocator->reallocate == NULL || allocator->deallocate == NULL)
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+
+    const uint64_t slotSize = settings->elementSize == 0 ? sizeof(segmented_list_element_t) : settings->elementSize;
+    const uint64_t requestedCapacity = settings->blockCapacity == 0 ? DEFAULT_SEGMENTED_LIST_BLOCK_CAPACITY : settings->blockCapacity;
+    uint64_t blockCapacity = 1;
+    uint32_t blockShift = 0;
+
+    while (blockCapacity < requestedCapacity && blockShift < 62) {
+        blockCapacity <<= 1;
+        blockShift++;
+    }
+
+    if (blockCapacity < requestedCapacity || slotSize > UINT64_MAX / blockCapacity)
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+
+    segmented_list_t* const list = (segmented_list_t*) allocator->allocate(allocator->context, sizeof(segmented_list_t));
+
+    if (list == NULL)
+        return SEGMENTED_LIST_ALLOCATION_FAILURE;
+
+    list->blocks = (uint8_t**) allocator->allocate(allocator->context, sizeof(uint8_t*) * DEFAULT_SEGMENTED_LIST_DIRECTORY_CAPACITY);
+
+    if (list->blocks == NULL) {
+        allocator->deallocate(allocator->context, list, sizeof(segmented_list_t));
+        return SEGMENTED_LIST_ALLOCATION_FAILURE;
+    }
+
+    list->size = 0;
+    list->stride = settings->elementSize;
+    list->slotSize = slotSize;
+    list->blockCapacity = blockCapacity;
+    list->blockShift = blockShift;
+    list->blockCount = 0;
+    list->directoryCapacity = DEFAULT_SEGMENTED_LIST_DIRECTORY_CAPACITY;
+    list->equalityFunction = settings->equalityFunction == NULL 
+        ? (segmented_list_custom_equality_function_t*) &default_equals 
+        : settings->equalityFunction;
+    list->allocator = *allocator;
+
+    *listOut = list;
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_free(segmented_list_t** list) {
+    if (*list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+
+    confetti_allocator_t allocator = (*list)->allocator;
+
+    segmented_list_release_values(*list, 0, (uint64_t) (*list)->size);
+    segmented_list_release_blocks(*list, 0);
+
+    allocator.deallocate(allocator.context, (*list)->blocks, sizeof(uint8_t*) * (*list)->directoryCapacity);
+    allocator.deallocate(allocator.context, *list, sizeof(segmented_list_t));
+    *list = NULL;
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_print(segmented_list_t* const list) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+
+    printf("[ ");
+
+    for (int64_t i = 0; i < list->size; i++) {
+        const void* value = segmented_list_slot(list, (uint64_t) i);
+
+        if (list->stride == 0)
+            value = ((const segmented_list_element_t*) value)->value;
+
+        if (value != NULL)
+            printf(i + 1 < list->size ? "%p, " : "%p", value);
+        else
+            printf(i + 1 < list->size ? "NULL, " : "NULL");
+    }
+
+    printf(" ] -> %p\n", (void*) list);
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_append(segmented_list_t* const list, const void* const value, const uint64_t size) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+    else if (list->stride != 0 && size != list->stride)
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+
+    const uint64_t index = (uint64_t) list->size;
+
+    if ((index >> list->blockShift) >= list->blockCount) {
+        segmented_list_result_t reserveResult = segmented_list_reserve_blocks(list, (index >> list->blockShift) + 1);
+
+        if (reserveResult != SEGMENTED_LIST_SUCCESS)
+            return reserveResult;
+    }
+
+    segmented_list_result_t writeResult = segmented_list_slot_write(list, segmented_list_slot(list, index), value, size);
+
+    if (writeResult != SEGMENTED_LIST_SUCCESS)
+        return writeResult;
+
+    list->size++;
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_append_many(
+    segmented_list_t* const list, 
+    const void* const values, 
+    const int64_t count, 
+    const uint64_t stride
+) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+    else if (values == NULL || count < 0 || stride == 0 || (list->stride != 0 && stride != list->stride))
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+    else if (count > INT64_MAX - list->size)
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+
+    if (count == 0)
+        return SEGMENTED_LIST_SUCCESS;
+
+    const uint64_t start = (uint64_t) list->size;
+    const uint64_t end = start + (uint64_t) count;
+    const uint64_t oldBlockCount = list->blockCount;
+    segmented_list_result_t reserveResult = segmented_list_reserve_blocks(list, segmented_list_blocks_for(list, end));
+
+    if (reserveResult != SEGMENTED_LIST_SUCCESS) {
+        segmented_list_release_blocks(list, oldBlockCount);
+        return reserveResult;
+    }
+
+    const uint8_t* const source = (const uint8_t*) values;
+
+    if (list->stride != 0) {
+        // values are copied a block at a time, up to the end of the block the next index lands in.
+        uint64_t index = start;
+
+        while (index < end) {
+            const uint64_t offset = index & (list->blockCapacity - 1);
+            const uint64_t run = end - index < list->blockCapacity - offset ? end - index : list->blockCapacity - offset;
+
+            memcpy(segmented_list_slot(list, index), source + stride * (index - start), list->stride * run);
+            index += run;
+        }
+
+        list->size = (int64_t) end;
+        return SEGMENTED_LIST_SUCCESS;
+    }
+
+    for (uint64_t i = start; i < end; i++) {
+        segmented_list_result_t writeResult = segmented_list_slot_write(list, segmented_list_slot(list, i), source + stride * (i - start), stride);
+
+        if (writeResult != SEGMENTED_LIST_SUCCESS) {
+            segmented_list_release_values(list, start, i);
+            segmented_list_release_blocks(list, oldBlockCount);
+
+            return writeResult;
+        }
+    }
+
+    list->size = (int64_t) end;
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_get(segmented_list_t* const list, segmented_list_element_t** elementOut, const int64_t index) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+    else if (index >= list->size || index < 0)
+        return SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    const uint8_t* const slot = segmented_list_slot(list, (uint64_t) index);
+
+    if (list->stride != 0)
+        return segmented_list_element_create(slot, list->stride, elementOut);
+
+    const segmented_list_element_t* const element = (const segmented_list_element_t*) slot;
+
+    return segmented_list_element_create(element->value, element->size, elementOut);
+}
+
+
+segmented_list_result_t segmented_list_peek(
+    segmented_list_t* const list, 
+    const void** valueOut, 
+    uint64_t* const sizeOut, 
+    const int64_t index
+) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+    else if (index >= list->size || index < 0)
+        return SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    const uint8_t* const slot = segmented_list_slot(list, (uint64_t) index);
+
+    if (list->stride != 0) {
+        *valueOut = slot;
+
+        if (sizeOut != NULL)
+            *sizeOut = list->stride;
+
+        return SEGMENTED_LIST_SUCCESS;
+    }
+
+    *valueOut = ((const segmented_list_element_t*) slot)->value;
+
+    if (sizeOut != NULL)
+        *sizeOut = ((const segmented_list_element_t*) slot)->size;
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_set(
+    segmented_list_t* const list, 
+    const int64_t index, 
+    const void* const value, 
+    const uint64_t size
+) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+    else if (index >= list->size || index < 0)
+        return SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+    else if (list->stride != 0 && size != list->stride)
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+
+    uint8_t* const slot = segmented_list_slot(list, (uint64_t) index);
+
+    if (list->stride != 0)
+        return segmented_list_slot_write(list, slot, value, size);
+
+    // the new value is written aside first, so a failed allocation leaves the old one in place.
+    segmented_list_element_t* const element = (segmented_list_element_t*) slot;
+    segmented_list_element_t replacement;
+    segmented_list_result_t writeResult = segmented_list_slot_write(list, (uint8_t*) &replacement, value, size);
+
+    if (writeResult != SEGMENTED_LIST_SUCCESS)
+        return writeResult;
+
+    list->allocator.deallocate(list->allocator.context, element->value, element->size);
+    *element = replacement;
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_pop(segmented_list_t* const list, segmented_list_element_t** elementOut) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+    else if (list->size == 0)
+        return SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    const uint64_t index = (uint64_t) list->size - 1;
+
+    if (elementOut != NULL) {
+        segmented_list_result_t getResult = segmented_list_get(list, elementOut, (int64_t) index);
+
+        if (getResult != SEGMENTED_LIST_SUCCESS)
+            return getResult;
+    }
+
+    segmented_list_release_values(list, index, index + 1);
+    list->size--;
+
+    // one empty block is kept past the last element.
+    segmented_list_release_blocks(list, segmented_list_blocks_for(list, index) + 1);
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_clear(segmented_list_t* const list) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+
+    segmented_list_release_values(list, 0, (uint64_t) list->size);
+    segmented_list_release_blocks(list, 0);
+    list->size = 0;
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_resize(segmented_list_t* const list, const int64_t size) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+    else if (size < 0)
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+
+    const uint64_t oldSize = (uint64_t) list->size;
+    const uint64_t newSize = (uint64_t) size;
+
+    if (newSize <= oldSize) {
+        segmented_list_release_values(list, newSize, oldSize);
+        segmented_list_release_blocks(list, segmented_list_blocks_for(list, newSize));
+        list->size = size;
+
+        return SEGMENTED_LIST_SUCCESS;
+    }
+
+    const uint64_t oldBlockCount = list->blockCount;
+    segmented_list_result_t reserveResult = segmented_list_reserve_blocks(list, segmented_list_blocks_for(list, newSize));
+
+    if (reserveResult != SEGMENTED_LIST_SUCCESS) {
+        segmented_list_release_blocks(list, oldBlockCount);
+        return reserveResult;
+    }
+
+    // zeroed inline values and zeroed elements, which have no value, are both all zero bytes.
+    uint64_t index = oldSize;
+
+    while (index < newSize) {
+        const uint64_t offset = index & (list->blockCapacity - 1);
+        const uint64_t run = newSize - index < list->blockCapacity - offset ? newSize - index : list->blockCapacity - offset;
+
+        memset(segmented_list_slot(list, index), 0, list->slotSize * run);
+        index += run;
+    }
+
+    list->size = size;
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_find_first(
+    segmented_list_t* const list, 
+    int64_t* const indexOut, 
+    const int64_t startIndex, 
+    const void* const value, 
+    const uint64_t size
+) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+    else if (startIndex >= list->size || startIndex < 0)
+        return SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    if (list->stride != 0 && size != list->stride)
+        return SEGMENTED_LIST_ELEMENT_NOT_FOUND_ERROR;
+
+    for (int64_t i = startIndex; i < list->size; i++) {
+        const uint8_t* const slot = segmented_list_slot(list, (uint64_t) i);
+        const void* elementValue = slot;
+
+        if (list->stride == 0) {
+            if (((const segmented_list_element_t*) slot)->size != size)
+                continue;
+
+            elementValue = ((const segmented_list_element_t*) slot)->value;
+        }
+
+        if (list->equalityFunction(elementValue, value, size) == 0) {
+            *indexOut = i;
+            return SEGMENTED_LIST_SUCCESS;
+        }
+    }
+
+    return SEGMENTED_LIST_ELEMENT_NOT_FOUND_ERROR;
+}
+
+
+segmented_list_result_t segmented_list_element_free(segmented_list_element_t** element) {
+    if (element == NULL || *element == NULL)
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const allocator = confetti_allocator_default();
+
+    allocator->deallocate(allocator->context, (*element)->value, (*element)->size);
+    allocator->deallocate(allocator->context, *element, sizeof(segmented_list_element_t));
+    *element = NULL;
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_iterator_create(segmented_list_iterator_t** iteratorOut, segmented_list_t* const list) {
+    if (list == NULL)
+        return SEGMENTED_LIST_NULL_ERROR;
+
+    segmented_list_iterator_t* iterator = (segmented_list_iterator_t*) malloc(sizeof(segmented_list_iterator_t));
+
+    if (iterator == NULL)
+        return SEGMENTED_LIST_ALLOCATION_FAILURE;
+
+    iterator->list = list;
+    segmented_list_iterator_rewind(iterator);
+
+    *iteratorOut = iterator;
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_iterator_next(segmented_list_iterator_t* const iterator) {
+    if (iterator == NULL)
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+
+    const segmented_list_t* const list = iterator->list;
+    const int64_t block = iterator->block + 1;
+    const int64_t index = (int64_t) ((uint64_t) block << list->blockShift);
+
+    if (index >= list->size) {
+        segmented_list_iterator_rewind(iterator);
+        return SEGMENTED_LIST_INDEX_OUT_OF_RANGE_ERROR;
+    }
+
+    const int64_t remaining = list->size - index;
+
+    iterator->block = block;
+    iterator->index = index;
+    iterator->count = remaining < (int64_t) list->blockCapacity ? remaining : (int64_t) list->blockCapacity;
+    iterator->values = list->blocks[block];
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_iterator_rewind(segmented_list_iterator_t* const iterator) {
+    if (iterator == NULL)
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+
+    iterator->block = -1;
+    iterator->index = -1;
+    iterator->count = 0;
+    iterator->values = NULL;
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+
+segmented_list_result_t segmented_list_iterator_free(segmented_list_iterator_t** iterator) {
+    if (iterator == NULL || *iterator == NULL)
+        return SEGMENTED_LIST_INVALID_PARAMS_ERROR;
+
+    free(*iterator);
+    *iterator = NULL;
+
+    return SEGMENTED_LIST_SUCCESS;
+}
+
+#pragma endregion
@@ -0,0 +1,597 @@
+/*
+This file is part of confetti.
+
+confetti is free software: you can redistribute it and/or modify it 
+under the terms of the GNU Lesser General Public License as published 
+by the Free Software Foundation, either version 3 of the License, 
+or (at your option) any later version.
+
+confetti is distributed in the hope that it will be useful, 
+but WITHOUT ANY WARRANTY; without even the implied warranty 
+of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. 
+
+See the GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License along with confetti. 
+If not, see <https://www.gnu.org/licenses/>.
+*/
+#include "skiplist.h"
+
+// private function definitions
+
+#pragma region private function definitions
+
+/**
+ * @brief Returns the size of the single block backing a skip list node.
+ *
+ * @param level The amount of levels the node is linked into.
+ * @param size The size in bytes of the node's value.
+ *
+ * @return The size in bytes of the block.
+ */
+static uint64_t skiplist_node_allocation_size(const uint32_t level, const uint64_t size);
+
+/**
+ * @brief Creates a new unlinked skip list node holding a copy of a value.
+ *
+ * @param allocator Pointer to the allocator the node is allocated with.
+ * @param nodeOut Pointer to where the newly allocated node will be stored.
+ * @param level The amount of levels the node is linked into.
+ * @param value Pointer to the value to be copied into the node.
+ * @param size Size in bytes of the value.
+ *
+ * @return
+ * - `SKIPLIST_SUCCESS` if the node was successfully created.
+ * 
+ * - `SKIPLIST_ALLOCATION_FAILURE` if memory allocation failed.
+ */
+static skiplist_result_t skiplist_node_create(
+    const confetti_allocator_t* const allocator, 
+    skiplist_node_t** nodeOut, 
+    const uint32_t level, 
+    const void* const value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Frees the memory associated with a skip list node.
+ *
+ * @param allocator Pointer to the allocator the node was allocated with.
+ * @param node Double pointer to the node to be freed.
+ */
+static void skiplist_node_free(const confetti_allocator_t* const allocator, skiplist_node_t** node);
+
+/**
+ * @brief Compares the value of a node against a value.
+ *
+ * Both values are compared over the smaller of their sizes, when they are equal 
+ * over it the smaller value comes first.
+ *
+ * @param skiplist Pointer to the skip list.
+ * @param node Pointer to the node.
+ * @param value Pointer to the value.
+ * @param size Size in bytes of the value.
+ *
+ * @return A negative value if the node comes before the value, a positive 
+ * value if it comes after it and `0` if they are equal.
+ */
+static int32_t skiplist_node_compare(
+    const skiplist_t* const skiplist, 
+    const skiplist_node_t* const node, 
+    const void* const value, 
+    const uint64_t size
+);
+
+/**
+ * @brief Finds the first node that doesn't come before a value.
+ *
+ * @param skiplist Pointer to the skip list.
+ * @param value Pointer to the value.
+ * @param size Size in bytes of the value.
+ * @param afterEqual If `true`, nodes equal to the value are skipped as well.
+ * @param linksOut Pointer to `SKIPLIST_MAX_LEVEL` link slots where, for every level in use, 
+ *                 the address of the link pointing at the found position is stored, or NULL.
+ *
+ * @return Pointer to the found node, or NULL if every node comes before the value.
+ */
+static skiplist_node_t* skiplist_node_find(
+    skiplist_t* const skiplist, 
+    const void* const value, 
+    const uint64_t size, 
+    const bool afterEqual, 
+    skiplist_node_t*** linksOut
+);
+
+/**
+ * @brief Unlinks a node from every level it is linked into and frees it.
+ *
+ * @param skiplist Pointer to the skip list.
+ * @param node Double pointer to the node.
+ * @param links Pointer to the link slots of the node's position, as found by `skiplist_node_find`.
+ */
+static void skiplist_node_remove(skiplist_t* const skiplist, skiplist_node_t** node, skiplist_node_t*** links);
+
+/**
+ * @brief Picks the level of a new node.
+ *
+ * Each additional level is picked with a chance of one in four.
+ *
+ * @param skiplist Pointer to the skip list, whose generator is advanced.
+ *
+ * @return The level, between 1 and `SKIPLIST_MAX_LEVEL`.
+ */
+static uint32_t skiplist_random_level(skiplist_t* const skiplist);
+
+/**
+ * @brief Default equality comparison function for memory blocks.
+ *
+ * If both pointers are NULL they are considered equal, if only one is NULL the 
+ * non-null value is considered greater, otherwise `memcmp` is used to compare them.
+ *
+ * @param data1 Pointer to the first data block.
+ * @param data2 Pointer to the second data block.
+ * @param size Number of bytes to compare.
+ *
+ * @return `0` if the blocks are equal, a negative value if `data1` is less 
+ * than `data2` and a positive value if `data1` is greater than `data2`.
+ */
+static int32_t default_equals(const void* const data1, const void* const data2, const uint64_t size);
+
+#pragma endregion
+
+// private functions
+
+#pragma region private functions
+
+static uint64_t skiplist_node_allocation_size(const uint32_t level, const uint64_t size) {
+    return sizeof(skiplist_node_t) + sizeof(skiplist_node_t*) * level + size;
+}
+
+
+static skiplist_result_t skiplist_node_create(
+    const confetti_allocator_t* const allocator, 
+    skiplist_node_t** nodeOut, 
+    const uint32_t level, 
+    const void* const value, 
+    const uint64_t size
+) {
+    skiplist_node_t* const node = (skiplist_node_t*) allocator->allocate(allocator->context, skiplist_node_allocation_size(level, size));
+
+    if (node == NULL)
+        return SKIPLIST_ALLOCATION_FAILURE;
+
+    // the value is stored right after the links of the node.
+    node->element.value = (void*) (node->next + level);
+    node->element.size = size;
+    node->level = level;
+
+    for (uint32_t i = 0; i < level; i++)
+        node->next[i] = NULL;
+
+    memcpy(node->element.value, value, size);
+
+    *nodeOut = node;
+    return SKIPLIST_SUCCESS;
+}
+
+
+static void skiplist_node_free(const confetti_allocator_t* const allocator, skiplist_node_t** node) {
+    const uint64_t allocationSize = skiplist_node_allocation_size((*node)->level, (*node)->element.size);
+
+    allocator->deallocate(allocator->context, *node, allocationSize);
+    *node = NULL;
+}
+
+
+static int32_t skiplist_node_compare(
+    const skiplist_t* const skiplist, 
+    const skiplist_node_t* const node, 
+    const void* const value, 
+    const uint64_t size
+) {
+    const uint64_t nodeSize = node->element.size;
+    int32_t equality = skiplist->equalityFunction(node->element.value, value, nodeSize < size ? nodeSize : size);
+
+    if (equality != 0 || nodeSize == size)
+        return equality;
+
+    return nodeSize < size ? -1 : 1;
+}
+
+
+static skiplist_node_t* skiplist_node_find(
+    skiplist_t* const skiplist, 
+    const void* const value, 
+    const uint64_t size, 
+    const bool afterEqual, 
+    skiplist_node_t*** linksOut
+) {
+    // links is the array of next pointers of the last node passed, starting at the heads.
+    skiplist_node_t** links = skiplist->head;
+    const int32_t bound = afterEqual ? 1 : 0;
+
+    for (uint32_t level = skiplist->level; level-- > 0;) {
+        while (links[level] != NULL && skiplist_node_compare(skiplist, links[level], value, size) < bound)
+            links = links[level]->next;
+
+        if (linksOut != NULL)
+            linksOut[level] = &links[level];
+    }
+
+    return skiplist->level > 0 ? links[0] : NULL;
+}
+
+
+static void skiplist_node_remove(skiplist_t* const skiplist, skiplist_node_t** node, skiplist_node_t*** links) {
+    for (uint32_t level = 0; level < (*node)->level; level++)
+        *links[level] = (*node)->next[level];
+
+    while (skiplist->level > 0 && skiplist->head[skiplist->level - 1] == NULL)
+        skiplist->level--;
+
+    skiplist->size--;
+    skiplist_node_free(&skiplist->allocator, node);
+}
+
+
+static uint32_t skiplist_random_level(skiplist_t* const skiplist) {
+    // xorshift64*, the top bits of its output are the most random.
+    uint64_t state = skiplist->seed;
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    skiplist->seed = state;
+
+    uint64_t bits = state * UINT64_C(0x2545F4914F6CDD1D);
+    uint32_t level = 1;
+
+    while (level < SKIPLIST_MAX_LEVEL && (bits >> 62) == 0) {
+        level++;
+        bits <<= 2;
+    }
+
+    return level;
+}
+
+
+static int32_t default_equals(const void* data1, const void* data2, uint64_t size) {
+    if (data1 == NULL && data2 != NULL)
+        return -1;
+    else if (data1 != NULL && data2 == NULL) 
+        return 1;
+    else if (data1 == NULL && data2 == NULL)
+        return 0;
+
+    return memcmp(data1, data2, size);
+}
+
+#pragma endregion
+
+// public functions
+
+#pragma region public functions
+
+skiplist_result_t skiplist_create(skiplist_t** skiplistOut, skiplist_custom_equality_function_t* const customEqualityFunction) {
+    skiplist_options_t options = { customEqualityFunction, NULL, 0 };
+
+    return skiplist_create_with_options(skiplistOut, &options);
+}
+
+
+skiplist_result_t skiplist_create_with_options(skiplist_t** skiplistOut, const skiplist_options_t* const options) {
+    if (options == NULL)
+        return SKIPLIST_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const allocator = options->allocator == NULL 
+        ? confetti_allocator_default() 
+        : options->allocator;
+
+    if (allocator->allocate == NULL || allocator->reallocate == NULL || allocator->deallocate == NULL)
+        return SKIPLIST_INVALID_PARAMS_ERROR;
+
+    skiplist_t* const skiplist = (skiplist_t*) allocator->allocate(allocator->context, sizeof(skiplist_t));
+
+    if (skiplist == NULL)
+        return SKIPLIST_ALLOCATION_FAILURE;
+
+    for (uint32_t level = 0; level < SKIPLIST_MAX_LEVEL; level++)
+        skiplist->head[level] = NULL;
+
+    skiplist->level = 0;
+    skiplist->size = 0;
+    skiplist->equalityFunction = options->equalityFunction == NULL 
+        ? (skiplist_custom_equality_function_t*) &default_equals 
+        : options->equalityFunction;
+    skiplist->allocator = *allocator;
+    skiplist->seed = options->seed == 0 ? DEFAULT_SKIPLIST_SEED : options->seed;
+
+    *skiplistOut = skiplist;
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_free(skiplist_t** skiplist) {
+    if (*skiplist == NULL)
+        return SKIPLIST_NULL_ERROR;
+
+    skiplist_result_t clearResult = skiplist_clear(*skiplist);
+
+    if (clearResult != SKIPLIST_SUCCESS)
+        return clearResult;
+
+    confetti_allocator_t allocator = (*skiplist)->allocator;
+
+    allocator.deallocate(allocator.context, *skiplist, sizeof(skiplist_t));
+    *skiplist = NULL;
+
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_print(skiplist_t* const skiplist) {
+    if (skiplist == NULL)
+        return SKIPLIST_NULL_ERROR;
+
+    printf("[ ");
+
+    for (skiplist_node_t* node = skiplist->head[0]; node != NULL; node = node->next[0]) 
+        printf(node->next[0] != NULL ? "%p, " : "%p", node->element.value);
+
+    printf(" ] -> %p\n", skiplist);
+
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_insert(skiplist_t* const skiplist, void* const value, const uint64_t size) {
+    if (skiplist == NULL)
+        return SKIPLIST_NULL_ERROR;
+    else if (value == NULL)
+        return SKIPLIST_INVALID_PARAMS_ERROR;
+
+    skiplist_node_t** links[SKIPLIST_MAX_LEVEL];
+    skiplist_node_find(skiplist, value, size, true, links);
+
+    const uint32_t level = skiplist_random_level(skiplist);
+    skiplist_node_t* node = NULL;
+    skiplist_result_t nodeCreateResult = skiplist_node_create(&skiplist->allocator, &node, level, value, size);
+
+    if (nodeCreateResult != SKIPLIST_SUCCESS)
+        return nodeCreateResult;
+
+    // levels that weren't in use yet are linked in straight from their heads.
+    for (; skiplist->level < level; skiplist->level++)
+        links[skiplist->level] = &skiplist->head[skiplist->level];
+
+    for (uint32_t i = 0; i < level; i++) {
+        node->next[i] = *links[i];
+        *links[i] = node;
+    }
+
+    skiplist->size++;
+
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_remove(skiplist_t* const skiplist, void* const value, const uint64_t size) {
+    if (skiplist == NULL)
+        return SKIPLIST_NULL_ERROR;
+    else if (value == NULL)
+        return SKIPLIST_INVALID_PARAMS_ERROR;
+
+    skiplist_node_t** links[SKIPLIST_MAX_LEVEL];
+    skiplist_node_t* node = skiplist_node_find(skiplist, value, size, false, links);
+
+    if (node == NULL || skiplist_node_compare(skiplist, node, value, size) != 0)
+        return SKIPLIST_ELEMENT_NOT_FOUND_ERROR;
+
+    skiplist_node_remove(skiplist, &node, links);
+
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_includes(skiplist_t* const skiplist, void* const value, const uint64_t size) {
+    const void* foundValue = NULL;
+
+    return skiplist_peek(skiplist, &foundValue, NULL, value, size);
+}
+
+
+skiplist_result_t skiplist_peek(
+    skiplist_t* const skiplist, 
+    const void** valueOut, 
+    uint64_t* const sizeOut, 
+    void* const value, 
+    const uint64_t size
+) {
+    if (skiplist == NULL)
+        return SKIPLIST_NULL_ERROR;
+    else if (value == NULL)
+        return SKIPLIST_INVALID_PARAMS_ERROR;
+
+    skiplist_node_t* const node = skiplist_node_find(skiplist, value, size, false, NULL);
+
+    if (node == NULL || skiplist_node_compare(skiplist, node, value, size) != 0)
+        return SKIPLIST_ELEMENT_NOT_FOUND_ERROR;
+
+    *valueOut = node->element.value;
+
+    if (sizeOut != NULL)
+        *sizeOut = node->element.size;
+
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_peek_first(skiplist_t* const skiplist, const void** valueOut, uint64_t* const sizeOut) {
+    if (skiplist == NULL)
+        return SKIPLIST_NULL_ERROR;
+    else if (skiplist->size == 0)
+        return SKIPLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    *valueOut = skiplist->head[0]->element.value;
+
+    if (sizeOut != NULL)
+        *sizeOut = skiplist->head[0]->element.size;
+
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_peek_last(skiplist_t* const skiplist, const void** valueOut, uint64_t* const sizeOut) {
+    if (skiplist == NULL)
+        return SKIPLIST_NULL_ERROR;
+    else if (skiplist->size == 0)
+        return SKIPLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    skiplist_node_t* const* links = skiplist->head;
+    skiplist_node_t* node = NULL;
+
+    for (uint32_t level = skiplist->level; level-- > 0;) {
+        while (links[level] != NULL) {
+            node = links[level];
+            links = node->next;
+        }
+    }
+
+    *valueOut = node->element.value;
+
+    if (sizeOut != NULL)
+        *sizeOut = node->element.size;
+
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_pop_first(skiplist_t* const skiplist, skiplist_element_t** elementOut) {
+    if (skiplist == NULL)
+        return SKIPLIST_NULL_ERROR;
+    else if (skiplist->size == 0)
+        return SKIPLIST_INDEX_OUT_OF_RANGE_ERROR;
+
+    skiplist_node_t* node = skiplist->head[0];
+    const confetti_allocator_t* const defaultAllocator = confetti_allocator_default();
+    skiplist_element_t* const element = (skiplist_element_t*) defaultAllocator->allocate(
+        defaultAllocator->context, 
+        sizeof(skiplist_element_t) + node->element.size
+    );
+
+    if (element == NULL)
+        return SKIPLIST_ALLOCATION_FAILURE;
+
+    element->value = (void*) (element + 1);
+    element->size = node->element.size;
+    memcpy(element->value, node->element.value, node->element.size);
+
+    // the first node is linked straight from the heads on every level it is in.
+    skiplist_node_t** links[SKIPLIST_MAX_LEVEL];
+
+    for (uint32_t level = 0; level < node->level; level++)
+        links[level] = &skiplist->head[level];
+
+    skiplist_node_remove(skiplist, &node, links);
+
+    *elementOut = element;
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_clear(skiplist_t* const skiplist) {
+    if (skiplist == NULL)
+        return SKIPLIST_NULL_ERROR;
+
+    skiplist_node_t* node = skiplist->head[0];
+
+    while (node != NULL) {
+        skiplist_node_t* nextNode = node->next[0];
+
+        skiplist_node_free(&skiplist->allocator, &node);
+        node = nextNode;
+    }
+
+    for (uint32_t level = 0; level < SKIPLIST_MAX_LEVEL; level++)
+        skiplist->head[level] = NULL;
+
+    skiplist->level = 0;
+    skiplist->size = 0;
+
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_element_free(skiplist_element_t** element) {
+    if (element == NULL || *element == NULL)
+        return SKIPLIST_INVALID_PARAMS_ERROR;
+
+    const confetti_allocator_t* const defaultAllocator = confetti_allocator_default();
+
+    defaultAllocator->deallocate(defaultAllocator->context, *element, sizeof(skiplist_element_t) + (*element)->size);
+    *element = NULL;
+
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_iterator_create(skiplist_iterator_t** iteratorOut, skiplist_t* const list) {
+    if (list == NULL)
+        return SKIPLIST_NULL_ERROR;
+
+    skiplist_iterator_t* iterator = (skiplist_iterator_t*) malloc(sizeof(skiplist_iterator_t));
+
+    if (iterator == NULL)
+        return SKIPLIST_ALLOCATION_FAILURE;
+
+    iterator->list = list;
+    iterator->node = NULL;
+
+    *iteratorOut = iterator;
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_iterator_next(skiplist_iterator_t* const iterator) {
+    if (iterator == NULL)
+        return SKIPLIST_INVALID_PARAMS_ERROR;
+
+    iterator->node = iterator->node == NULL ? iterator->list->head[0] : iterator->node->next[0];
+
+    return iterator->node != NULL ? SKIPLIST_SUCCESS : SKIPLIST_INDEX_OUT_OF_RANGE_ERROR;
+}
+
+
+skiplist_result_t skiplist_iterator_seek(skiplist_iterator_t* const iterator, void* const value, const uint64_t size) {
+    if (iterator == NULL || value == NULL)
+        return SKIPLIST_INVALID_PARAMS_ERROR;
+
+    iterator->node = skiplist_node_find(iterator->list, value, size, false, NULL);
+
+    return iterator->node != NULL ? SKIPLIST_SUCCESS : SKIPLIST_INDEX_OUT_OF_RANGE_ERROR;
+}
+
+
+skiplist_result_t skiplist_iterator_rewind(skiplist_iterator_t* const iterator) {
+    if (iterator == NULL)
+        return SKIPLIST_INVALID_PARAMS_ERROR;
+
+    iterator->node = NULL;
+
+    return SKIPLIST_SUCCESS;
+}
+
+
+skiplist_result_t skiplist_iterator_free(skiplist_iterator_t** iterator) {
+    if (iterator == NULL || *iterator == NULL)
+        return SKIPLIST_INVALID_PARAMS_ERROR;
+
+    (*iterator)->list = NULL;
+    (*iterator)->node = NULL;
+
+    free((*iterator));
+    *iterator = NULL;
+    return SKIPLIST_SUCCESS;
+}
+
+#pragma endregion